@@ -0,0 +1,95 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Synthetic inputs shared by the vneio_bench suites.
+
+#include "vertexnova/io/image/volume.h"
+#include "vertexnova/io/mesh/mesh.h"
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace vne {
+namespace bench {
+
+/** @brief Scratch directory for generated input files (created on first use). */
+inline const std::filesystem::path& scratchDir() {
+    static const std::filesystem::path dir = [] {
+        std::filesystem::path p = std::filesystem::temp_directory_path() / "vneio_bench";
+        std::filesystem::create_directories(p);
+        return p;
+    }();
+    return dir;
+}
+
+/** @brief Scratch file path for @p name. */
+inline std::string scratchPath(const std::string& name) {
+    return (scratchDir() / name).string();
+}
+
+/** @brief Cube volume of @p edge^3 voxels with a deterministic ramp pattern. */
+inline vne::image::Volume makeVolume(int edge, vne::image::VolumePixelType type) {
+    vne::image::Volume volume;
+    volume.dims[0] = volume.dims[1] = volume.dims[2] = edge;
+    volume.pixel_type = type;
+    volume.data.resize(volume.byteCount());
+    for (size_t i = 0; i < volume.data.size(); ++i) {
+        volume.data[i] = static_cast<uint8_t>(i * 31u + (i >> 8));
+    }
+    return volume;
+}
+
+/**
+ * @brief Wavy height-field grid of @p cells x @p cells quads (two triangles each),
+ *        with normals and UVs, one submesh and one material.
+ */
+inline vne::mesh::Mesh makeGridMesh(int cells) {
+    vne::mesh::Mesh mesh;
+    const int side = cells + 1;
+    mesh.vertices.resize(static_cast<size_t>(side) * side);
+    for (int y = 0; y < side; ++y) {
+        for (int x = 0; x < side; ++x) {
+            vne::mesh::VertexAttributes& v = mesh.vertices[static_cast<size_t>(y) * side + x];
+            v = {};
+            const float u = static_cast<float>(x) / static_cast<float>(cells);
+            const float w = static_cast<float>(y) / static_cast<float>(cells);
+            v.position[0] = u;
+            v.position[1] = w;
+            v.position[2] = 0.25f * std::sin(6.0f * u) * std::cos(6.0f * w);
+            v.normal[2] = 1.0f;
+            v.texcoord0[0] = u;
+            v.texcoord0[1] = w;
+        }
+    }
+    mesh.indices.reserve(static_cast<size_t>(cells) * cells * 6);
+    for (int y = 0; y < cells; ++y) {
+        for (int x = 0; x < cells; ++x) {
+            const auto i0 = static_cast<uint32_t>(y * side + x);
+            const auto i1 = i0 + 1;
+            const auto i2 = i0 + static_cast<uint32_t>(side);
+            const auto i3 = i2 + 1;
+            mesh.indices.insert(mesh.indices.end(), {i0, i1, i2, i1, i3, i2});
+        }
+    }
+    mesh.parts.push_back({0, static_cast<uint32_t>(mesh.indices.size()), 0});
+    mesh.materials.push_back({"grid", "", {1, 1, 1, 1}});
+    mesh.has_normals = true;
+    mesh.has_uv0 = true;
+    mesh.aabb_min[0] = mesh.aabb_min[1] = 0.0f;
+    mesh.aabb_min[2] = -0.25f;
+    mesh.aabb_max[0] = mesh.aabb_max[1] = 1.0f;
+    mesh.aabb_max[2] = 0.25f;
+    return mesh;
+}
+
+}  // namespace bench
+}  // namespace vne
@@ -0,0 +1,65 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+// Image kernels on generated RGBA images. The size argument is the square image edge in pixels.
+
+#include "vertexnova/io/image/image.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using vne::image::Image;
+
+namespace {
+
+constexpr int kChannels = 4;
+
+Image makeImage(int edge) {
+    std::vector<uint8_t> pixels(static_cast<size_t>(edge) * edge * kChannels);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i * 7u);
+    }
+    return Image(pixels.data(), edge, edge, kChannels);
+}
+
+void setThroughput(benchmark::State& state, int64_t pixels) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * pixels * kChannels);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * pixels);
+}
+
+void BM_ImageResizeHalf(benchmark::State& state) {
+    const auto edge = static_cast<int>(state.range(0));
+    const Image source = makeImage(edge);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Image image = source;
+        state.ResumeTiming();
+        if (!image.resize(edge / 2, edge / 2)) {
+            state.SkipWithError("resize failed");
+            break;
+        }
+        benchmark::DoNotOptimize(image.getData());
+    }
+    // Throughput counts the source pixels read.
+    setThroughput(state, static_cast<int64_t>(edge) * edge);
+}
+
+void BM_ImageFlipVertically(benchmark::State& state) {
+    const auto edge = static_cast<int>(state.range(0));
+    Image image = makeImage(edge);
+    for (auto _ : state) {
+        image.flipVertically();
+        benchmark::ClobberMemory();
+    }
+    setThroughput(state, static_cast<int64_t>(edge) * edge);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ImageResizeHalf)->RangeMultiplier(2)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImageFlipVertically)->RangeMultiplier(2)->Range(256, 4096)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,111 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+// AssimpLoader and the OBJ exporter on generated grid meshes. The size argument is the
+// grid edge in quads (2 * cells^2 triangles).
+
+#include "bench_utils.h"
+
+#include "vertexnova/io/mesh/assimp_loader.h"
+#include "vertexnova/io/mesh/mesh_exporter.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using vne::mesh::AssimpLoaderOptions;
+using vne::mesh::Mesh;
+
+namespace {
+
+/** Every boolean AssimpLoaderOptions field, in bit order of the "opts" argument. */
+constexpr int kAssimpOptionBits = 8;
+
+AssimpLoaderOptions optionsFromMask(int64_t mask) {
+    AssimpLoaderOptions opts;
+    opts.flip_uvs = (mask & 1) != 0;
+    opts.gen_tangents = (mask & 2) != 0;
+    opts.triangulate = (mask & 4) != 0;
+    opts.calc_normals_if_missing = (mask & 8) != 0;
+    opts.pre_transform_vertices = (mask & 16) != 0;
+    opts.ensure_ccw_winding = (mask & 32) != 0;
+    opts.normalize_to_unit_sphere = (mask & 64) != 0;
+    opts.generate_barycentrics = (mask & 128) != 0;
+    return opts;
+}
+
+/** @brief Write a grid mesh of @p cells once and return the OBJ path (empty on failure). */
+std::string objInput(benchmark::State& state, int cells) {
+    const std::string path = vne::bench::scratchPath("grid_" + std::to_string(cells) + ".obj");
+    if (std::filesystem::exists(path)) {
+        return path;
+    }
+    vne::mesh::ObjExportOptions opts;
+    opts.write_mtl = false;
+    std::string error;
+    if (!vne::mesh::exportObj(path, vne::bench::makeGridMesh(cells), opts, &error)) {
+        state.SkipWithError(error.c_str());
+        return {};
+    }
+    return path;
+}
+
+void loadObj(benchmark::State& state, int cells, const AssimpLoaderOptions& opts) {
+    const std::string path = objInput(state, cells);
+    if (path.empty()) {
+        return;
+    }
+    const auto file_bytes = static_cast<size_t>(std::filesystem::file_size(path));
+    vne::mesh::AssimpLoader loader;
+    size_t triangles = 0;
+    for (auto _ : state) {
+        Mesh mesh;
+        if (!loader.loadFile(path, mesh, opts)) {
+            state.SkipWithError(loader.getLastError().c_str());
+            break;
+        }
+        triangles = mesh.indices.size() / 3;
+        benchmark::DoNotOptimize(mesh.vertices.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(file_bytes));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(triangles));
+}
+
+void BM_AssimpLoadObj(benchmark::State& state) {
+    loadObj(state, static_cast<int>(state.range(0)), AssimpLoaderOptions{});
+}
+
+void BM_AssimpLoadObjOptions(benchmark::State& state) {
+    loadObj(state, static_cast<int>(state.range(0)), optionsFromMask(state.range(1)));
+}
+
+void BM_ExportObj(benchmark::State& state) {
+    const Mesh mesh = vne::bench::makeGridMesh(static_cast<int>(state.range(0)));
+    const std::string path = vne::bench::scratchPath("export.obj");
+    std::string error;
+    for (auto _ : state) {
+        if (!vne::mesh::exportObj(path, mesh, {}, &error)) {
+            state.SkipWithError(error.c_str());
+            break;
+        }
+    }
+    const size_t bytes = mesh.vertices.size() * sizeof(vne::mesh::VertexAttributes)
+                         + mesh.indices.size() * sizeof(uint32_t);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(mesh.indices.size() / 3));
+}
+
+}  // namespace
+
+BENCHMARK(BM_AssimpLoadObj)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+// All 2^8 option combinations on one mid-sized grid.
+BENCHMARK(BM_AssimpLoadObjOptions)
+    ->ArgNames({"cells", "opts"})
+    ->ArgsProduct({{128}, benchmark::CreateDenseRange(0, (1 << kAssimpOptionBits) - 1, 1)})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ExportObj)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
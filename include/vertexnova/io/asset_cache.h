@@ -0,0 +1,163 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/image/image.h"
+#include "vertexnova/io/image/volume.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/mesh/mesh.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file asset_cache.h
+ * @brief In-memory LRU cache of decoded assets with a byte budget.
+ */
+
+/**
+ * @struct AssetCacheStats
+ * @brief Counters and occupancy of an AssetCache.
+ */
+struct AssetCacheStats {
+    uint64_t hits = 0;         //!< Lookups that returned a cached asset.
+    uint64_t misses = 0;       //!< Lookups that found nothing.
+    uint64_t evictions = 0;    //!< Entries dropped to stay within the byte budget.
+    size_t entry_count = 0;    //!< Entries currently cached.
+    size_t bytes_in_use = 0;   //!< Sum of the byte sizes of cached entries.
+    size_t byte_budget = 0;    //!< Configured budget.
+};
+
+/**
+ * @brief Size in bytes charged against the cache budget for an asset (pixel, voxel, vertex and index buffers).
+ */
+[[nodiscard]] size_t assetByteSize(const vne::image::Image& image);
+/** @brief See assetByteSize(const Image&). */
+[[nodiscard]] size_t assetByteSize(const vne::mesh::Mesh& mesh);
+/** @brief See assetByteSize(const Image&). */
+[[nodiscard]] size_t assetByteSize(const vne::image::Volume& volume);
+
+/**
+ * @class AssetCache
+ * @brief Thread-safe LRU cache of shared, immutable decoded assets.
+ *
+ * Keys identify the file contents and the load options (see makeKey()); a file
+ * that changes on disk gets a new key, and the stale entry ages out. Inserting
+ * evicts least-recently-used entries until the new entry fits the byte budget.
+ * Evicted assets stay alive while callers still hold their shared_ptr.
+ */
+class AssetCache {
+   public:
+    /**
+     * @brief Construct a cache.
+     * @param byte_budget Maximum bytes of cached assets (0 = cache nothing).
+     */
+    explicit AssetCache(size_t byte_budget = 0);
+
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    /**
+     * @brief Build the cache key for a request: uri and file system, file size and mtime, asset type and load flags.
+     * @param request Load request.
+     * @return Key, or std::nullopt if the file cannot be stat'ed or the request is a buffer load or sets a
+     *         memory_resource (such requests are not cached).
+     */
+    [[nodiscard]] static std::optional<std::string> makeKey(const LoadRequest& request);
+
+    /**
+     * @brief Look up an asset and mark it most recently used.
+     * @param key Key from makeKey().
+     * @return Cached asset, or nullptr on miss (also when cached under another asset type).
+     */
+    template<typename T>
+    [[nodiscard]] std::shared_ptr<const T> find(const std::string& key);
+
+    /**
+     * @brief Insert an asset, evicting LRU entries to fit the budget.
+     *
+     * If the key is already present the existing asset is kept and returned, so
+     * concurrent loaders of the same file converge on one shared instance. Assets
+     * larger than the whole budget are returned without being cached.
+     * @param key Key from makeKey().
+     * @param asset Decoded asset.
+     * @return The cached (or passed-in) asset.
+     */
+    template<typename T>
+    std::shared_ptr<const T> insert(const std::string& key, std::shared_ptr<const T> asset);
+
+    /** @brief Change the byte budget, evicting entries if it shrank. */
+    void setByteBudget(size_t byte_budget);
+    /** @brief Drop every entry (counters are kept). */
+    void clear();
+    /** @brief Snapshot of counters and occupancy. */
+    [[nodiscard]] AssetCacheStats stats() const;
+
+   private:
+    using Value = std::variant<std::shared_ptr<const vne::image::Image>,
+                               std::shared_ptr<const vne::mesh::Mesh>,
+                               std::shared_ptr<const vne::image::Volume>>;
+
+    struct Entry {
+        std::string key;
+        Value value;
+        size_t bytes = 0;
+    };
+
+    /** @brief Locked lookup that updates LRU order and hit/miss counters; std::nullopt on miss. */
+    std::optional<Value> findValue(const std::string& key);
+    Value insertValue(const std::string& key, Value value, size_t bytes);
+    /** @brief Evict from the LRU tail until bytes_in_use_ + incoming_bytes fits (mutex_ held). */
+    void evictToFit(size_t incoming_bytes);
+
+    mutable std::mutex mutex_;
+    std::list<Entry> lru_;  //!< Front = most recently used.
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t byte_budget_ = 0;
+    size_t bytes_in_use_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+template<typename T>
+std::shared_ptr<const T> AssetCache::find(const std::string& key) {
+    std::optional<Value> value = findValue(key);
+    if (!value) {
+        return nullptr;
+    }
+    const auto* typed = std::get_if<std::shared_ptr<const T>>(&*value);
+    return typed ? *typed : nullptr;
+}
+
+template<typename T>
+std::shared_ptr<const T> AssetCache::insert(const std::string& key, std::shared_ptr<const T> asset) {
+    if (!asset) {
+        return asset;
+    }
+    const size_t bytes = assetByteSize(*asset);
+    Value stored = insertValue(key, Value(asset), bytes);
+    const auto* typed = std::get_if<std::shared_ptr<const T>>(&stored);
+    return typed ? *typed : asset;
+}
+
+}  // namespace io
+}  // namespace vne
@@ -10,17 +10,34 @@
  * ----------------------------------------------------------------------
  */
 
+#include "vertexnova/io/asset_cache.h"
+#include "vertexnova/io/common/completion_queue.h"
+#include "vertexnova/io/cook_cache.h"
+#include "vertexnova/io/common/single_flight.h"
+#include "vertexnova/io/common/thread_pool.h"
 #include "vertexnova/io/dicom/dicom_loader.h"
 #include "vertexnova/io/dicom/dicom_series.h"
 #include "vertexnova/io/image/image.h"
 #include "vertexnova/io/image/image_loader.h"
 #include "vertexnova/io/image/volume.h"
 #include "vertexnova/io/image/volume_loader.h"
+#include "vertexnova/io/load_handle.h"
 #include "vertexnova/io/load_request.h"
 #include "vertexnova/io/mesh/mesh.h"
 #include "vertexnova/io/mesh/mesh_loader.h"
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/pack_file_system.h"
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace vne {
@@ -31,18 +48,80 @@ namespace io {
  * @brief Unified asset IO: register loaders and load by request (CPU decode only).
  */
 
+/**
+ * @brief Any asset AssetIO can produce; std::monostate when the load failed.
+ */
+using Asset =
+    std::variant<std::monostate, vne::image::Image, vne::mesh::Mesh, vne::image::Volume, vne::dicom::DicomSeries>;
+
+/**
+ * @struct BatchLoadStats
+ * @brief Timing of a loadBatch() call.
+ */
+struct BatchLoadStats {
+    double wall_seconds = 0.0;         //!< Elapsed time of the whole batch.
+    double summed_item_seconds = 0.0;  //!< Sum of per-request load times (serial cost).
+    size_t succeeded = 0;              //!< Requests that loaded successfully.
+    size_t failed = 0;                 //!< Requests that failed.
+
+    /** @brief Achieved parallelism (summed item time / wall time; 0 if nothing ran). */
+    [[nodiscard]] double parallelism() const { return wall_seconds > 0.0 ? summed_item_seconds / wall_seconds : 0.0; }
+};
+
+/**
+ * @struct BatchLoadResult
+ * @brief Per-request results of loadBatch(), in input order, plus aggregate timing.
+ */
+struct BatchLoadResult {
+    std::vector<LoadResult<Asset>> results;  //!< One result per request, same order as the input.
+    std::vector<double> item_seconds;        //!< Load time of each request in seconds.
+    BatchLoadStats stats;                    //!< Aggregate timing.
+};
+
 /**
  * @class AssetIO
  * @brief Unified asset io: register loaders and load by request.
  *
  * Decode on CPU only; upload to GPU lives in a separate module (e.g. engine).
+ *
+ * Register all loaders before the first load. The *Async methods run the
+ * corresponding blocking load on an internal worker pool (created on first use);
+ * completion callbacks are queued and run by pollCompletions() on the caller's thread.
+ * Queued loads leave the pool by LoadRequest::priority, then deadline, then submission
+ * order; setLoadPriority() promotes a load that has not started yet.
+ *
+ * The load*Shared methods go through an optional in-memory cache (disabled until
+ * setCacheBudget() is given a non-zero budget) and return shared immutable assets.
+ *
+ * Request uris are OS paths unless a file system is installed with setFileSystem();
+ * then every load, format sniff and cache key resolves uris through it. Uris starting with
+ * "pack://" always resolve inside the pack installed with mountPack().
+ *
+ * Concurrent identical requests share one in-flight load (see setLoadCoalescing()).
+ *
+ * With setCookCacheDirectory(), image, mesh and volume loads by loaders that report an
+ * IAssetLoader::optionsKey() are restored from on-disk blobs across process runs.
  */
 class AssetIO {
    public:
-    AssetIO() = default;
-    ~AssetIO() = default;
+    /**
+     * @brief Construct an empty registry.
+     * @param worker_count Worker threads for asynchronous loads (0 = hardware concurrency).
+     */
+    explicit AssetIO(uint32_t worker_count = 0);
+    /** @brief Waits for outstanding asynchronous loads before destroying the loaders. */
+    ~AssetIO();
 
-    /** @brief Register an image loader. Called first is tried first. */
+    AssetIO(const AssetIO&) = delete;
+    AssetIO& operator=(const AssetIO&) = delete;
+
+    /**
+     * @brief Register an image loader. Called first is tried first.
+     *
+     * Loaders are indexed by supportedExtensions() here, so a load only consults the loaders
+     * registered for the request's format (hint_format, else the uri extension). If none of them
+     * succeeds and no hint was given, the file's leading bytes are sniffed to pick another loader.
+     */
     void registerImageLoader(std::unique_ptr<vne::image::IImageLoader> loader);
     /** @brief Register a mesh loader. */
     void registerMeshLoader(std::unique_ptr<vne::mesh::IMeshLoader> loader);
@@ -51,6 +130,24 @@ class AssetIO {
     /** @brief Register a DICOM loader. */
     void registerDicomLoader(std::unique_ptr<vne::dicom::IDicomLoader> loader);
 
+    /**
+     * @brief Serve request uris from a virtual file system (e.g. a PackFileSystem) instead of OS paths.
+     *
+     * Set before the first load. Requests that already carry a file_system keep it.
+     * @param file_system File system, or nullptr to use OS paths again.
+     */
+    void setFileSystem(std::shared_ptr<const IFileSystem> file_system);
+    /** @brief Installed file system (nullptr = OS paths). */
+    [[nodiscard]] const std::shared_ptr<const IFileSystem>& fileSystem() const { return file_system_; }
+
+    /**
+     * @brief Resolve "pack://<path>" uris inside @p pack, alongside OS paths or the installed file system.
+     *
+     * Set before the first load. Until a pack is mounted, pack:// loads fail with eFileNotFound.
+     * @param pack Opened pack, or nullptr to unmount.
+     */
+    void mountPack(std::shared_ptr<const PackFileSystem> pack);
+
     /**
      * @brief Load an image from the given request.
      * @param request Load request (uri = file path).
@@ -75,12 +172,188 @@ class AssetIO {
      * @return Load result with DicomSeries on success, Status on failure.
      */
     LoadResult<vne::dicom::DicomSeries> loadDicomSeries(const LoadRequest& request);
+    /**
+     * @brief Load any asset kind, dispatching on request.asset_type.
+     * @param request Load request.
+     * @return Load result holding the asset alternative that matches asset_type.
+     */
+    LoadResult<Asset> loadAsset(const LoadRequest& request);
+
+    /**
+     * @brief Load many heterogeneous requests in parallel on the worker pool.
+     *
+     * Requests are grouped by the loader that will handle them and interleaved
+     * across groups (largest files first within a group) so one slow or serialized
+     * loader cannot occupy every worker. While workers decode, the calling thread
+     * issues read-ahead hints for the files still queued, overlapping disk reads with
+     * decode. Blocks until every request has finished; do not call from a completion
+     * callback or a worker thread.
+     * @param requests Requests to load.
+     * @return Results in input order plus wall-clock vs. summed per-item time.
+     */
+    BatchLoadResult loadBatch(std::span<const LoadRequest> requests);
+
+    /**
+     * @brief Load an image through the asset cache.
+     *
+     * Cache hits skip reading and decoding; misses load as loadImage() and insert the
+     * result. With the cache disabled this is loadImage() wrapped in a shared_ptr.
+     * @param request Load request (uri = file path).
+     * @return Load result with a shared immutable Image on success.
+     */
+    LoadResult<std::shared_ptr<const vne::image::Image>> loadImageShared(const LoadRequest& request);
+    /** @brief Load a mesh through the asset cache (see loadImageShared). */
+    LoadResult<std::shared_ptr<const vne::mesh::Mesh>> loadMeshShared(const LoadRequest& request);
+    /** @brief Load a volume through the asset cache (see loadImageShared). */
+    LoadResult<std::shared_ptr<const vne::image::Volume>> loadVolumeShared(const LoadRequest& request);
+
+    /**
+     * @brief Set the asset cache byte budget, evicting LRU entries if it shrank.
+     * @param byte_budget Maximum cached bytes (0 = disable the cache; default).
+     */
+    void setCacheBudget(size_t byte_budget);
+    /** @brief Drop all cached assets (counters are kept). */
+    void clearCache();
+    /** @brief Cache hit/miss/eviction counters and occupancy. */
+    [[nodiscard]] AssetCacheStats cacheStats() const;
+
+    /**
+     * @brief Share one load among concurrent identical requests (default on).
+     *
+     * While a load runs, requests with the same file identity and load flags (the cache key)
+     * wait for it instead of reading and decoding again. Blocking, async and batch callers each
+     * receive a copy of the result; load*Shared callers receive the same instance. Requests with
+     * a buffer, cancel token, progress callback or memory resource always load on their own.
+     */
+    void setLoadCoalescing(bool enabled);
+    /** @brief Loads executed vs. coalesced into an identical in-flight load (duplicate loads avoided). */
+    [[nodiscard]] SingleFlightStats coalescingStats() const;
+
+    /**
+     * @brief Keep loaded assets in a persistent CookCache directory (disabled by default).
+     *
+     * Set before the first load. Loads whose loader reports an optionsKey() first look for a
+     * blob keyed by the source contents and options and, on a miss, store the loaded asset.
+     * Buffer and memory-mapped loads bypass the cook cache.
+     * @param directory Cache directory (created on first store), or empty to disable.
+     */
+    void setCookCacheDirectory(const std::string& directory);
+    /** @brief Cook cache hits/misses/stores (all zero while disabled). */
+    [[nodiscard]] CookCacheStats cookCacheStats() const;
+
+    /**
+     * @brief Load an image on the worker pool.
+     * @param request Load request (copied).
+     * @param on_complete Optional callback, queued for pollCompletions() when the load finishes.
+     * @return Handle to the pending result.
+     */
+    LoadHandle<vne::image::Image> loadImageAsync(const LoadRequest& request,
+                                                 LoadCallback<vne::image::Image> on_complete = {});
+    /** @brief Load a mesh on the worker pool (see loadImageAsync). */
+    LoadHandle<vne::mesh::Mesh> loadMeshAsync(const LoadRequest& request,
+                                              LoadCallback<vne::mesh::Mesh> on_complete = {});
+    /** @brief Load a volume on the worker pool (see loadImageAsync). */
+    LoadHandle<vne::image::Volume> loadVolumeAsync(const LoadRequest& request,
+                                                   LoadCallback<vne::image::Volume> on_complete = {});
+    /** @brief Load a DICOM series on the worker pool (see loadImageAsync). */
+    LoadHandle<vne::dicom::DicomSeries> loadDicomSeriesAsync(const LoadRequest& request,
+                                                             LoadCallback<vne::dicom::DicomSeries> on_complete = {});
+
+    /**
+     * @brief Run completion callbacks of finished asynchronous loads on the calling thread.
+     *
+     * Call from a single thread (e.g. once per frame on the render thread).
+     * @param max_callbacks Upper bound on callbacks executed by this call.
+     * @return Number of callbacks executed.
+     */
+    size_t pollCompletions(size_t max_callbacks = std::numeric_limits<size_t>::max());
+
+    /** @brief Block until every queued asynchronous load has finished (callbacks still need pollCompletions()). */
+    void waitIdle();
+
+    /**
+     * @brief Change the priority of an asynchronous load that is still queued.
+     *
+     * Use it to bump a prefetch the user is now looking at ahead of the remaining bulk work.
+     * @param handle Handle returned by a *Async method of this AssetIO.
+     * @param priority New priority.
+     * @return false if the load already started or finished.
+     */
+    template<typename T>
+    bool setLoadPriority(const LoadHandle<T>& handle, LoadPriority priority) {
+        return reprioritize(handle.taskId(), priority);
+    }
 
    private:
+    template<typename T>
+    using LoadFn = LoadResult<T> (AssetIO::*)(const LoadRequest&);
+
+    template<typename T>
+    LoadHandle<T> submitLoad(LoadFn<T> load_fn, const LoadRequest& request, LoadCallback<T> on_complete);
+
+    template<typename T>
+    LoadResult<std::shared_ptr<const T>> loadShared(const LoadRequest& request);
+
+    /** @brief Run the loaders registered for T on a routed request. */
+    template<typename T>
+    LoadResult<T> dispatch(const LoadRequest& request);
+    /** @brief Route the request and dispatch(), sharing the load with identical in-flight requests. */
+    template<typename T>
+    LoadResult<T> load(const LoadRequest& request);
+    /** @brief Single-flight key of a routed request, or std::nullopt if it must load on its own. */
+    [[nodiscard]] std::optional<std::string> coalescingKey(const LoadRequest& request) const;
+
+    ThreadPool& workerPool();
+    bool reprioritize(uint64_t task_id, LoadPriority priority);
+    /** @brief The request with file_system defaulted to the installed one. */
+    [[nodiscard]] LoadRequest route(const LoadRequest& request) const;
+    /** @brief Format name -> loader positions (registration order), built when loaders are registered. */
+    struct LoaderIndex {
+        std::unordered_map<std::string, std::vector<size_t>> by_format;
+        std::vector<size_t> fallback;  //!< Loaders declaring no extensions; asked via canLoad().
+
+        void add(size_t position, const std::vector<std::string>& extensions);
+        [[nodiscard]] const std::vector<size_t>* find(const std::string& format) const;
+    };
+
+    template<typename Loader>
+    static std::vector<size_t> candidateLoaders(const std::vector<std::unique_ptr<Loader>>& loaders,
+                                                const LoaderIndex& index,
+                                                const LoadRequest& request,
+                                                const std::string& format);
+    template<typename Loader>
+    static int selectLoader(const std::vector<std::unique_ptr<Loader>>& loaders,
+                            const LoaderIndex& index,
+                            const LoadRequest& request);
+    template<typename T, typename Loader, typename LoadFnT>
+    static LoadResult<T> dispatchLoad(const std::vector<std::unique_ptr<Loader>>& loaders,
+                                      const LoaderIndex& index,
+                                      const LoadRequest& request,
+                                      const char* kind,
+                                      LoadFnT load);
+
+    /** @brief Index of the loader that would handle the request first (grouping key), or -1. */
+    [[nodiscard]] int findLoaderIndex(const LoadRequest& request) const;
+
     std::vector<std::unique_ptr<vne::image::IImageLoader>> image_loaders_;
     std::vector<std::unique_ptr<vne::mesh::IMeshLoader>> mesh_loaders_;
     std::vector<std::unique_ptr<vne::image::IVolumeLoader>> volume_loaders_;
     std::vector<std::unique_ptr<vne::dicom::IDicomLoader>> dicom_loaders_;
+    LoaderIndex image_index_;
+    LoaderIndex mesh_index_;
+    LoaderIndex volume_index_;
+    LoaderIndex dicom_index_;
+
+    uint32_t worker_count_ = 0;
+    std::once_flag pool_once_;
+    std::unique_ptr<ThreadPool> pool_;
+    CompletionQueue completions_;
+    AssetCache cache_;
+    std::atomic<bool> coalescing_{true};
+    SingleFlight flights_;
+    std::unique_ptr<CookCache> cook_cache_;
+    std::shared_ptr<const IFileSystem> file_system_;
+    std::shared_ptr<const PackFileSystem> pack_;
 };
 
 }  // namespace io
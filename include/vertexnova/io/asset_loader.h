@@ -12,6 +12,9 @@
 
 #include "vertexnova/io/load_request.h"
 
+#include <string>
+#include <vector>
+
 namespace vne {
 namespace io {
 
@@ -26,6 +29,13 @@ namespace io {
  *
  * Loader implementations (e.g. AssimpLoader, NrrdLoader) implement canLoad()
  * and the type-specific load method. Used by AssetIO registry.
+ *
+ * AssetIO dispatches through an extension table built from supportedExtensions()
+ * at registration; loaders that declare no extensions are asked via canLoad().
+ *
+ * The request-based load methods (loadImage/loadMesh/loadVolume/loadDicomSeries)
+ * may be called concurrently from AssetIO worker threads and must not mutate
+ * shared loader state; report errors through the returned Status instead.
  */
 class IAssetLoader {
    public:
@@ -37,6 +47,24 @@ class IAssetLoader {
      * @return true if this loader can load the asset
      */
     [[nodiscard]] virtual bool canLoad(const LoadRequest& request) const = 0;
+
+    /**
+     * @brief Formats this loader handles, as lowercase extensions without the dot (e.g. "png")
+     * @return Extension list; empty (default) means "ask canLoad() for every request"
+     */
+    [[nodiscard]] virtual const std::vector<std::string>& supportedExtensions() const {
+        static const std::vector<std::string> kNone;
+        return kNone;
+    }
+
+    /**
+     * @brief Options that shape this loader's output, for the on-disk CookCache key
+     *
+     * Loaders whose output depends only on the source file bytes and their options return a
+     * non-empty string that changes whenever those options (or the decoder version) change.
+     * @return Options key; empty (default) means "do not cache this loader's output"
+     */
+    [[nodiscard]] virtual std::string optionsKey() const { return {}; }
 };
 
 }  // namespace io
@@ -0,0 +1,160 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/asset_io.h"
+#include "vertexnova/io/common/cancellation.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/load_request.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file asset_watcher.h
+ * @brief Hot reload: re-import watched assets when their source file changes.
+ */
+
+/**
+ * @brief Hot-reload notification; runs on the thread that calls AssetIO::pollCompletions().
+ *
+ * @p generation starts at 1 for the first reload of a watch and grows by one per reload.
+ */
+template<typename T>
+using ReloadCallback = std::function<void(uint64_t generation, const LoadResult<T>& result)>;
+
+/**
+ * @struct AssetWatcherStats
+ * @brief Counters of an AssetWatcher.
+ */
+struct AssetWatcherStats {
+    uint64_t events = 0;      //!< File system events that matched a watched file.
+    uint64_t reloads = 0;     //!< Reloads submitted after debouncing.
+    uint64_t superseded = 0;  //!< Reloads still undelivered when a newer one was submitted (cancelled).
+};
+
+/**
+ * @class AssetWatcher
+ * @brief Watches source files of AssetIO loads and re-imports only the ones that change.
+ *
+ * Each watch names one request. The watcher observes the file's directory (editors often
+ * save by writing a temporary file and renaming it over the original) and waits until the
+ * file has been quiet for the debounce interval. Then it submits the request to the
+ * AssetIO worker pool, so only the loaders of changed files run. The callback receives the
+ * new generation and result through AssetIO::pollCompletions(). A newer change cancels a
+ * reload that is still running, and results older than the last delivered generation are
+ * dropped.
+ *
+ * Uses inotify on Linux; elsewhere supported() is false and watch*() fail with
+ * eNotImplemented. Only the request's own file is watched, so a change to a detached
+ * data file (e.g. the .raw of an .mhd) must be followed by touching the header.
+ *
+ * The AssetIO must outlive the watcher. No callback runs after the watcher is destroyed.
+ */
+class AssetWatcher {
+   public:
+    /** Default quiet period before a changed file is reloaded. */
+    static constexpr std::chrono::milliseconds kDefaultDebounce{100};
+
+    /**
+     * @brief Start the watcher thread.
+     * @param io AssetIO that runs the reloads.
+     * @param debounce Quiet period after the last change event before reloading.
+     */
+    explicit AssetWatcher(AssetIO& io, std::chrono::milliseconds debounce = kDefaultDebounce);
+    ~AssetWatcher();
+
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    /** @brief True if change notifications are available on this platform. */
+    [[nodiscard]] static bool supported();
+
+    /**
+     * @brief Reload an image whenever request.uri changes.
+     * @param request Load request for an OS path (no buffer or file_system); cancel_token is replaced.
+     * @param on_reload Callback for each reload.
+     * @return Watch id for unwatch(), or eInvalidArgument / eNotImplemented / eFileNotFound.
+     */
+    Result<uint64_t> watchImage(const LoadRequest& request, ReloadCallback<vne::image::Image> on_reload);
+    /** @brief Reload a mesh whenever request.uri changes (see watchImage). */
+    Result<uint64_t> watchMesh(const LoadRequest& request, ReloadCallback<vne::mesh::Mesh> on_reload);
+    /** @brief Reload a volume whenever request.uri changes (see watchImage). */
+    Result<uint64_t> watchVolume(const LoadRequest& request, ReloadCallback<vne::image::Volume> on_reload);
+
+    /**
+     * @brief Stop watching; a reload already submitted is cancelled and never delivered.
+     * @return false if @p watch_id is unknown.
+     */
+    bool unwatch(uint64_t watch_id);
+
+    /** @brief Snapshot of the counters. */
+    [[nodiscard]] AssetWatcherStats stats() const;
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    /** Delivery state shared with in-flight reloads (which may outlive the watch). */
+    struct Delivery {
+        std::atomic<uint64_t> delivered{0};  //!< Newest generation handed to the callback.
+        std::atomic<bool> active{true};      //!< Cleared by unwatch() and the destructor.
+    };
+
+    struct Watch {
+        std::string directory;
+        std::string path;  //!< Absolute, normalized source path.
+        std::function<CancellationToken(uint64_t generation)> reload;  //!< Submits one reload.
+        std::shared_ptr<Delivery> delivery;
+        uint64_t generation = 0;
+        CancellationToken running;              //!< Token of the newest submitted reload.
+        std::optional<Clock::time_point> due;  //!< Debounce deadline of a pending change.
+    };
+
+    template<typename T>
+    Result<uint64_t> watch(const LoadRequest& request, ReloadCallback<T> on_reload);
+    Result<uint64_t> addWatch(const LoadRequest& request, Watch watch);
+    void run();
+    void readEvents();
+    void submitDue(Clock::time_point now);
+
+    AssetIO& io_;
+    std::chrono::milliseconds debounce_;
+    int inotify_fd_ = -1;
+    int wake_fd_ = -1;
+
+    mutable std::mutex mutex_;
+    uint64_t next_id_ = 1;
+    std::map<uint64_t, Watch> watches_;
+    std::unordered_map<std::string, std::vector<uint64_t>> by_path_;  //!< Source path -> watch ids.
+    std::unordered_map<int, std::string> directories_;                //!< inotify descriptor -> directory.
+    std::unordered_map<std::string, int> directory_watches_;          //!< Directory -> inotify descriptor.
+    std::atomic<uint64_t> events_{0};
+    std::atomic<uint64_t> reloads_{0};
+    std::atomic<uint64_t> superseded_{0};
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+};
+
+}  // namespace io
+}  // namespace vne
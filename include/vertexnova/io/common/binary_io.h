@@ -15,6 +15,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -24,11 +27,162 @@ namespace binaryio {
 
 /**
  * @file binary_io.h
- * @brief Small IO helpers: read/write full buffers, read header until blank line, byte swap.
+ * @brief Small IO helpers: read/write full buffers, memory-mapped files, read header until blank line, byte swap.
  */
 
+/**
+ * @enum MapAccess
+ * @brief Expected access pattern of a MappedFile range (forwarded to madvise).
+ */
+enum class MapAccess : uint8_t {
+    eNormal = 0,  //!< No special treatment.
+    eSequential,  //!< Read front to back; aggressive read-ahead, pages may be dropped after use.
+    eRandom,      //!< Random access; no read-ahead.
+    eWillNeed,    //!< Start paging the range in now.
+};
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Pages are loaded on first touch, so mapping a large raw payload costs neither a
+ * zero-fill nor a copy. Keep the MappedFile alive (e.g. through a shared_ptr) for
+ * as long as any pointer into data() is used. On platforms without mmap the file
+ * is read into an owned buffer instead (isMapped() is false).
+ */
+class MappedFile {
+   public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file read-only (closes any previous mapping).
+     * @param path File path.
+     * @param access Access hint for the whole file.
+     * @return Status (eOk on success; an empty file maps to data() == nullptr, size() == 0).
+     */
+    [[nodiscard]] Status open(const std::string& path, MapAccess access = MapAccess::eSequential);
+
+    /** @brief Unmap the file. */
+    void close();
+
+    /**
+     * @brief Apply an access hint to part of the mapping (no-op when not mapped).
+     * @param access Access hint.
+     * @param offset Start of the range in bytes.
+     * @param length Length in bytes (0 = to the end of the file).
+     */
+    void advise(MapAccess access, size_t offset = 0, size_t length = 0) const;
+
+    [[nodiscard]] bool isOpen() const { return is_open_; }
+    [[nodiscard]] bool isMapped() const { return is_mapped_; }
+    [[nodiscard]] const uint8_t* data() const { return data_; }
+    [[nodiscard]] size_t size() const { return size_; }
+
+   private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+    bool is_mapped_ = false;
+    std::vector<uint8_t> fallback_;  //!< Owned copy when mmap is unavailable.
+};
+
+/**
+ * @brief Map part of a file read-only and return a pointer that keeps the mapping alive.
+ * @param path File path.
+ * @param offset Start of the range in bytes.
+ * @param length Length of the range in bytes.
+ * @param out Output: aliasing shared_ptr to the first byte of the range (owns the MappedFile).
+ * @param access Access hint for the range.
+ * @return Status (eDataTruncated if the file is shorter than offset + length).
+ */
+[[nodiscard]] Status mapFileRange(const std::string& path,
+                                  size_t offset,
+                                  size_t length,
+                                  std::shared_ptr<const uint8_t>& out,
+                                  MapAccess access = MapAccess::eSequential);
+
+/**
+ * @enum ReadBackend
+ * @brief How readFileRange() and IFile::readRange() move a large payload into memory.
+ */
+enum class ReadBackend : uint8_t {
+    eAuto = 0,  //!< io_uring for multi-chunk reads when the kernel allows it, else pread.
+    eStream,    //!< One std::ifstream, chunk after chunk (the portable baseline).
+    ePread,     //!< Blocking positional reads, chunk after chunk.
+    eIoUring,   //!< Linux io_uring with queue_depth chunk reads in flight (falls back to pread if unavailable).
+};
+
+/** Default chunk size of ranged reads. */
+constexpr size_t kReadChunkBytes = size_t{1} << 20;
+
+/** Default number of io_uring chunk reads kept in flight. */
+constexpr uint32_t kReadQueueDepth = 16;
+
+/** Buffer address, file offset and length granularity of direct (page-cache bypassing) reads. */
+constexpr size_t kDirectIoAlignment = 4096;
+
+/**
+ * @struct ReadOptions
+ * @brief Tuning and progress hook of a ranged read.
+ */
+struct ReadOptions {
+    ReadBackend backend = ReadBackend::eAuto;  //!< Read path.
+    size_t chunk_bytes = kReadChunkBytes;      //!< Bytes per read request.
+    uint32_t queue_depth = kReadQueueDepth;    //!< Requests in flight (io_uring only).
+    bool direct = false;                       //!< Bypass the page cache (see readFileRange()).
+    /** Called after each completed chunk with (bytes done, total); return false to stop (eCancelled). */
+    std::function<bool(uint64_t, uint64_t)> on_chunk;
+};
+
+/**
+ * @brief True if this process can use io_uring (Linux, built with VNEIO_WITH_IO_URING, not blocked by seccomp).
+ *
+ * Probed once; the answer is cached.
+ */
+[[nodiscard]] bool ioUringAvailable();
+
+/**
+ * @brief Heap memory resource whose blocks are kDirectIoAlignment-aligned.
+ *
+ * Direct reads land in place only in aligned memory; allocate the destination (e.g. Volume::data)
+ * from this resource to avoid the bounce-buffer copy.
+ */
+[[nodiscard]] std::pmr::memory_resource* directIoMemoryResource();
+
+/**
+ * @brief Read [offset, offset + bytes) of a file into @p dst.
+ *
+ * Intended for large raw payloads: with io_uring many chunk reads are in flight at once,
+ * which keeps deep NVMe queues busy where a single blocking read cannot.
+ *
+ * With ReadOptions::direct the aligned middle of the range is read straight into @p dst when
+ * @p offset and @p dst are kDirectIoAlignment-aligned; otherwise (e.g. voxels after an .mha or
+ * attached .nrrd header) aligned blocks are read into a bounce buffer and copied out. macOS uses
+ * F_NOCACHE instead. If the file system refuses O_DIRECT the read is buffered and its pages are
+ * dropped from the cache afterwards.
+ * @param path File path.
+ * @param offset Absolute byte offset.
+ * @param dst Destination (at least @p bytes long).
+ * @param bytes Number of bytes to read.
+ * @param options Backend, chunking and progress hook.
+ * @return Status (eFileOpenFailed, eDataTruncated if the file ends early, eFileReadFailed, eCancelled).
+ */
+[[nodiscard]] Status readFileRange(const std::string& path,
+                                   uint64_t offset,
+                                   void* dst,
+                                   size_t bytes,
+                                   const ReadOptions& options = {});
+
 /**
  * @brief Read entire file into a byte vector.
+ *
+ * Copies the whole file; for large payloads that are only read, prefer MappedFile.
  * @param path File path.
  * @param out Output vector (cleared and filled).
  * @return Status (eOk on success).
@@ -53,6 +207,15 @@ namespace binaryio {
     return Status::okStatus();
 }
 
+/**
+ * @brief Hint the OS to start reading a file into the page cache in the background.
+ *
+ * Used to overlap disk reads of queued files with decode of earlier ones. Best effort:
+ * a no-op on platforms without posix_fadvise, and failures are ignored.
+ * @param path File path.
+ */
+void adviseWillNeed(const std::string& path);
+
 /**
  * @brief Write a buffer to a file.
  * @param path File path.
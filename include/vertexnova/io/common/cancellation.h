@@ -0,0 +1,83 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file cancellation.h
+ * @brief Cooperative cancellation and progress reporting for loads.
+ */
+
+/**
+ * @class CancellationToken
+ * @brief Shared cancel flag; copies observe the same flag.
+ *
+ * A default-constructed token is inert (never cancelled, cancel() does nothing), so
+ * requests that do not need cancellation pay nothing. Create a live token with make(),
+ * copy it into one or more LoadRequests and call cancel() from any thread.
+ */
+class CancellationToken {
+   public:
+    CancellationToken() = default;
+
+    /** @brief Create a live, not yet cancelled token. */
+    [[nodiscard]] static CancellationToken make() {
+        CancellationToken token;
+        token.flag_ = std::make_shared<std::atomic<bool>>(false);
+        return token;
+    }
+
+    /** @brief Request cancellation (no-op on an inert token). */
+    void cancel() const noexcept {
+        if (flag_) {
+            flag_->store(true, std::memory_order_relaxed);
+        }
+    }
+
+    /** @brief True for tokens created with make() (and their copies). */
+    [[nodiscard]] bool valid() const noexcept { return flag_ != nullptr; }
+
+    /** @brief True once cancel() has been called on this token or a copy. */
+    [[nodiscard]] bool isCancelled() const noexcept { return flag_ && flag_->load(std::memory_order_relaxed); }
+
+   private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+/**
+ * @struct LoadProgress
+ * @brief Progress of one load stage.
+ *
+ * Stages: "read" and "swap" count bytes, "convert" counts meshes, and "decode" counts
+ * percent for the Assimp import or goes from 0 to 1 for single-step decoders (stb, NrrdIO).
+ */
+struct LoadProgress {
+    std::string_view stage;  //!< Stage name ("read", "swap", "decode", "convert").
+    uint64_t completed = 0;  //!< Units of the stage done so far.
+    uint64_t total = 0;      //!< Units in the stage.
+};
+
+/**
+ * @brief Progress callback. Invoked on the loading thread (a worker for asynchronous loads),
+ * at chunk boundaries; keep it cheap.
+ */
+using ProgressCallback = std::function<void(const LoadProgress&)>;
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,118 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/status.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+/**
+ * @file codec.h
+ * @brief Compression codecs for payloads (volume data, cooked blobs, pack entries).
+ */
+
+/**
+ * @enum CodecId
+ * @brief Stable identifier of a codec; safe to store next to a payload.
+ */
+enum class CodecId : uint8_t {
+    eNone = 0,  //!< Stored as-is.
+    eLz = 1,    //!< Built-in LZ77 block codec: fast, modest ratio; always available.
+    eZlib = 2,  //!< zlib-wrapped deflate (MetaImage CompressedData); needs VNEIO_WITH_ZLIB.
+    eGzip = 3,  //!< gzip-wrapped deflate (NRRD "encoding: gzip"); needs VNEIO_WITH_ZLIB.
+    eZstd = 4,  //!< Zstandard; needs VNEIO_WITH_ZSTD.
+};
+
+/** Compression level that selects each codec's own default. */
+constexpr int kDefaultCompressionLevel = 0;
+
+/**
+ * @class ICodec
+ * @brief One compression format.
+ *
+ * Streams carry no vneio framing: callers store the codec id and the decoded size next to
+ * the payload. Implementations must be thread-safe (one instance serves all threads).
+ */
+class ICodec {
+   public:
+    virtual ~ICodec() = default;
+
+    [[nodiscard]] virtual CodecId id() const = 0;
+
+    /** @brief Lower-case name ("lz", "zlib", "gzip", "zstd"). */
+    [[nodiscard]] virtual std::string_view name() const = 0;
+
+    /** @brief Upper bound of the compressed size of @p size input bytes. */
+    [[nodiscard]] virtual size_t maxCompressedSize(size_t size) const = 0;
+
+    /**
+     * @brief Compress @p size bytes of @p src into @p dst.
+     * @param capacity Size of @p dst; maxCompressedSize(size) always suffices.
+     * @param out_size Output: compressed size.
+     * @param level Codec-specific level (kDefaultCompressionLevel = the codec's default).
+     * @return Status (eInvalidArgument if @p capacity is too small, eThirdPartyError).
+     */
+    [[nodiscard]] virtual Status compress(
+        const uint8_t* src, size_t size, uint8_t* dst, size_t capacity, size_t& out_size, int level) const = 0;
+
+    /**
+     * @brief Decompress @p size bytes of @p src into exactly @p dst_size bytes of @p dst.
+     * @return Status (eDataCorrupt if the stream is malformed or does not decode to @p dst_size bytes).
+     */
+    [[nodiscard]] virtual Status decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) const = 0;
+};
+
+/**
+ * @brief Codec registered for @p id.
+ * @return The codec, or nullptr for eNone and for codecs not built in or registered.
+ */
+[[nodiscard]] std::shared_ptr<const ICodec> findCodec(CodecId id);
+
+/** @brief Codec registered under @p name (see ICodec::name()), or nullptr. */
+[[nodiscard]] std::shared_ptr<const ICodec> findCodec(std::string_view name);
+
+/**
+ * @brief Install @p codec for its id, replacing the built-in one (e.g. a zstd linked by the application).
+ *
+ * Loads already holding the previous codec finish with it.
+ */
+void registerCodec(std::shared_ptr<const ICodec> codec);
+
+/**
+ * @brief Compress a buffer with a registered codec.
+ * @param id Codec; eNone copies the bytes.
+ * @param src Input bytes.
+ * @param size Input size in bytes.
+ * @param out Output (replaced by the compressed bytes).
+ * @param level Codec-specific level.
+ * @return Status (eUnsupportedFeature if the codec is not available).
+ */
+[[nodiscard]] Status compressBuffer(
+    CodecId id, const uint8_t* src, size_t size, std::vector<uint8_t>& out, int level = kDefaultCompressionLevel);
+
+/**
+ * @brief Decompress a buffer with a registered codec.
+ * @param id Codec; eNone copies the bytes (sizes must match).
+ * @return Status (eUnsupportedFeature if the codec is not available, eDataCorrupt).
+ */
+[[nodiscard]] Status decompressBuffer(CodecId id, const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size);
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
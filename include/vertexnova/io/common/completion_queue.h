@@ -0,0 +1,74 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file completion_queue.h
+ * @brief Lock-free multi-producer / single-consumer queue of completion callbacks.
+ */
+
+/**
+ * @class CompletionQueue
+ * @brief Lock-free MPSC queue of callbacks (intrusive Vyukov queue).
+ *
+ * Any thread may push(); exactly one thread (e.g. the render thread) calls drain()
+ * to run the queued callbacks in push order. push() never blocks and never takes a lock.
+ */
+class CompletionQueue {
+   public:
+    using Callback = std::function<void()>;
+
+    CompletionQueue();
+    ~CompletionQueue();
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    /**
+     * @brief Enqueue a callback (thread-safe, lock-free).
+     * @param callback Callable to run on the consumer thread (ignored if empty).
+     */
+    void push(Callback callback);
+
+    /**
+     * @brief Run queued callbacks on the calling thread (single consumer only).
+     * @param max_callbacks Maximum number of callbacks to run in this call.
+     * @return Number of callbacks executed.
+     */
+    size_t drain(size_t max_callbacks = std::numeric_limits<size_t>::max());
+
+    /** @brief True if no callback is currently visible to the consumer. */
+    [[nodiscard]] bool empty() const;
+
+   private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        Callback callback;
+    };
+
+    void pushNode(Node* node);
+    Node* popNode();
+
+    std::atomic<Node*> head_;  //!< Producer end (most recently pushed).
+    Node* tail_;               //!< Consumer end.
+    Node stub_;
+};
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,91 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/load_request.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file format_detect.h
+ * @brief Format names used for loader dispatch: extension/hint normalization and magic-byte sniffing.
+ *
+ * A format name is a lowercase file extension without the dot (e.g. "png", "nrrd", "stl").
+ */
+
+/** Bytes sniffFormat() inspects (the DICOM "DICM" tag sits after a 128-byte preamble). */
+constexpr size_t kSniffHeaderBytes = 132;
+
+/**
+ * @brief Normalize a format name or extension: lowercase, leading '.' removed ("*.PNG" style globs too).
+ * @param format Format name, extension or hint.
+ * @return Normalized name (empty if format is empty).
+ */
+[[nodiscard]] std::string normalizeFormat(std::string_view format);
+
+/**
+ * @brief Normalized extension of the last path component.
+ * @param path File path or filename.
+ * @return Format name (e.g. "nrrd"), or empty if the filename has no extension.
+ */
+[[nodiscard]] std::string fileExtension(std::string_view path);
+
+/**
+ * @brief Format a request asks for: the normalized hint_format if set, else the uri extension.
+ * @param request Load request.
+ * @return Format name, or empty if neither is available.
+ */
+[[nodiscard]] std::string requestFormat(const LoadRequest& request);
+
+/**
+ * @brief Identify a file format from its leading bytes.
+ *
+ * Recognizes PNG, JPEG, BMP and GIF signatures, "NRRD000", MetaImage "ObjectType =",
+ * the DICOM "DICM" preamble, the "ply" magic line, the GLB "glTF" magic, STL (binary by its
+ * size/triangle-count invariant, or "solid"), and the "VNECOOK" and "VNEMESH" magics.
+ * @param header First bytes of the file (up to kSniffHeaderBytes).
+ * @param file_size Total file size in bytes (used for binary STL).
+ * @return Format name ("png", "jpg", "bmp", "gif", "nrrd", "mhd", "dcm", "ply", "glb", "stl", "vnecook",
+ * "vnemesh"), or empty if unknown.
+ */
+[[nodiscard]] std::string sniffFormat(std::span<const uint8_t> header, uint64_t file_size);
+
+/**
+ * @brief Read the first bytes of a file and sniff its format (see sniffFormat()).
+ * @param path File path.
+ * @return Format name, or empty if the file cannot be read or is not recognized.
+ */
+[[nodiscard]] std::string sniffFileFormat(const std::string& path);
+
+/**
+ * @brief Sniff a file read through a virtual file system (see sniffFormat()).
+ * @param fs File system.
+ * @param path Path inside @p fs.
+ * @return Format name, or empty if the file cannot be read or is not recognized.
+ */
+[[nodiscard]] std::string sniffFileFormat(const IFileSystem& fs, const std::string& path);
+
+/**
+ * @brief Sniff the bytes a request names: request.buffer when set, else the file (through request.file_system).
+ * @param request Load request.
+ * @return Format name, or empty if the file cannot be read or is not recognized.
+ */
+[[nodiscard]] std::string sniffRequestFormat(const LoadRequest& request);
+
+}  // namespace io
+}  // namespace vne
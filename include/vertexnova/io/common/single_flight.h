@@ -0,0 +1,121 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file single_flight.h
+ * @brief Collapse concurrent identical calls into one execution.
+ */
+
+/**
+ * @struct SingleFlightStats
+ * @brief Counters of a SingleFlight.
+ */
+struct SingleFlightStats {
+    uint64_t executed = 0;   //!< Calls that ran their function (no identical call was in flight).
+    uint64_t coalesced = 0;  //!< Calls that waited for an identical in-flight call instead (duplicate work avoided).
+};
+
+/**
+ * @class SingleFlight
+ * @brief Runs concurrent calls with the same key once; every caller receives the result.
+ *
+ * The first caller for a key runs the function. Callers arriving while it runs block
+ * and receive a copy of its result, or its exception. The key is released as soon as
+ * that call returns, so later calls run again (caching is a separate concern). The
+ * result is copied only if someone waited for it.
+ */
+class SingleFlight {
+   public:
+    SingleFlight() = default;
+
+    SingleFlight(const SingleFlight&) = delete;
+    SingleFlight& operator=(const SingleFlight&) = delete;
+
+    /**
+     * @brief Run @p fn, or wait for the identical call already running under @p key.
+     * @param key Identity of the call; calls with different Result types never share.
+     * @param fn Callable returning Result (copyable).
+     * @return fn()'s result (the leader's copy for callers that waited).
+     */
+    template<typename Result, typename Fn>
+    Result run(const std::string& key, Fn&& fn);
+
+    /** @brief Snapshot of the counters. */
+    [[nodiscard]] SingleFlightStats stats() const;
+
+   private:
+    struct Flight {
+        std::mutex mutex;
+        std::condition_variable done_cv;
+        bool done = false;
+        size_t waiters = 0;  //!< Guarded by SingleFlight::mutex_.
+        std::shared_ptr<const void> result;
+        std::exception_ptr error;
+    };
+
+    /** @brief The flight running under @p key (caller becomes a waiter), or nullptr after starting one in @p started. */
+    std::shared_ptr<Flight> join(const std::string& key, std::shared_ptr<Flight>& started);
+    /** @brief Release @p key; returns how many callers are waiting for the result. */
+    size_t finish(const std::string& key, Flight& flight);
+    static void publish(Flight& flight, std::shared_ptr<const void> result, std::exception_ptr error);
+    static void wait(Flight& flight);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Flight>> flights_;
+    uint64_t executed_ = 0;
+    uint64_t coalesced_ = 0;
+};
+
+template<typename Result, typename Fn>
+Result SingleFlight::run(const std::string& key, Fn&& fn) {
+    // One table serves every result type, so the type is part of the key.
+    const std::string typed_key = key + '#' + typeid(Result).name();
+    std::shared_ptr<Flight> started;
+    if (std::shared_ptr<Flight> running = join(typed_key, started)) {
+        wait(*running);
+        if (running->error) {
+            std::rethrow_exception(running->error);
+        }
+        return *std::static_pointer_cast<const Result>(running->result);
+    }
+    std::optional<Result> result;
+    try {
+        result.emplace(std::forward<Fn>(fn)());
+    } catch (...) {
+        if (finish(typed_key, *started) > 0) {
+            publish(*started, nullptr, std::current_exception());
+        }
+        throw;
+    }
+    if (finish(typed_key, *started) > 0) {
+        publish(*started, std::make_shared<const Result>(*result), nullptr);
+    }
+    return std::move(*result);
+}
+
+}  // namespace io
+}  // namespace vne
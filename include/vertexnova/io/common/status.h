@@ -44,6 +44,7 @@ enum class ErrorCode : int {
     eInvalidDimensions, //!< Invalid dimensions.
     eInvalidPixelType,  //!< Unsupported pixel type.
     eThirdPartyError,   //!< Error from third-party library.
+    eCancelled,         //!< Operation cancelled by the caller.
 };
 
 /**
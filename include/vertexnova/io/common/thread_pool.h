@@ -0,0 +1,119 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file thread_pool.h
+ * @brief Fixed-size worker pool used by AssetIO for asynchronous and batched loads.
+ */
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size pool of worker threads executing queued tasks by priority.
+ *
+ * Workers take the queued task with the highest priority; ties go to the earliest
+ * deadline (tasks without one last), then to submission order. A queued task can be
+ * moved to another priority with reprioritize() until a worker picks it up.
+ *
+ * Tasks already queued when the pool is destroyed still run; the destructor
+ * joins all workers after the queue is drained.
+ */
+class ThreadPool {
+   public:
+    using Task = std::function<void()>;
+    using Clock = std::chrono::steady_clock;
+    using TaskId = uint64_t;
+
+    /** Id never returned by submit(). */
+    static constexpr TaskId kInvalidTaskId = 0;
+
+    /**
+     * @brief Start the pool.
+     * @param thread_count Number of workers (0 = std::thread::hardware_concurrency(), at least 1).
+     */
+    explicit ThreadPool(uint32_t thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queue a task for execution on a worker thread.
+     * @param task Callable to run (ignored if empty).
+     * @param priority Higher runs first (0 = normal).
+     * @param deadline Optional time the task should complete by; earlier deadlines run first within a priority.
+     * @return Id for reprioritize(), or kInvalidTaskId if the task was empty.
+     */
+    TaskId submit(Task task, int priority = 0, std::optional<Clock::time_point> deadline = std::nullopt);
+
+    /**
+     * @brief Move a queued task to another priority (keeping its deadline and submission order).
+     * @return false if the task is no longer queued (running, finished or unknown).
+     */
+    bool reprioritize(TaskId id, int priority);
+
+    /** @brief Number of tasks queued and not yet started. */
+    [[nodiscard]] size_t pendingCount() const;
+
+    /** @brief Block until the queue is empty and no task is running. */
+    void waitIdle();
+
+    /** @brief Number of worker threads. */
+    [[nodiscard]] uint32_t threadCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+   private:
+    /** @brief Queue position: priority (descending), deadline, then submission order. */
+    struct QueueKey {
+        int priority = 0;
+        Clock::time_point deadline = Clock::time_point::max();
+        TaskId id = kInvalidTaskId;
+
+        bool operator<(const QueueKey& other) const {
+            if (priority != other.priority) {
+                return priority > other.priority;
+            }
+            if (deadline != other.deadline) {
+                return deadline < other.deadline;
+            }
+            return id < other.id;
+        }
+    };
+
+    void workerLoop();
+
+    std::vector<std::thread> workers_;
+    std::map<QueueKey, Task> tasks_;                  // front = next to run
+    std::unordered_map<TaskId, QueueKey> queued_keys_;  // queued task id -> its key in tasks_
+    TaskId next_id_ = 1;
+    mutable std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable idle_cv_;
+    size_t active_tasks_ = 0;
+    bool is_stopping_ = false;
+};
+
+}  // namespace io
+}  // namespace vne
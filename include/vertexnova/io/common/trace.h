@@ -0,0 +1,125 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/status.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace io {
+namespace trace {
+
+/**
+ * @file trace.h
+ * @brief Load-stage timeline spans, recorded per thread and dumped as Chrome Trace Event JSON.
+ *
+ * Library code marks stages with VNEIO_TRACE_SPAN("name"). With VNEIO_WITH_TRACING
+ * off (the default) the macro expands to nothing; with it on, each span records one
+ * complete ("X") event into the calling thread's ring buffer. Open the output of
+ * writeChromeTrace() in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * The recorder API below is always available so tools link either way; without
+ * VNEIO_WITH_TRACING it simply has no library spans to report.
+ */
+
+/** Events kept per thread; older events are overwritten once a thread's ring is full. */
+constexpr size_t kTraceEventsPerThread = 16384;
+
+/**
+ * @struct TraceEvent
+ * @brief One completed span.
+ */
+struct TraceEvent {
+    const char* name = "";       //!< Span name (string literal).
+    const char* category = "";   //!< Category (string literal, e.g. "vneio").
+    uint64_t start_ns = 0;       //!< Start, steady clock nanoseconds.
+    uint64_t duration_ns = 0;    //!< Duration in nanoseconds.
+    uint32_t thread_id = 0;      //!< Small sequential id of the recording thread (1-based).
+};
+
+/** @brief True if spans are being recorded (on by default). */
+[[nodiscard]] bool isEnabled();
+
+/** @brief Pause or resume recording at runtime. */
+void setEnabled(bool enabled);
+
+/** @brief Current steady clock time in nanoseconds (the span time base). */
+[[nodiscard]] uint64_t nowNs();
+
+/**
+ * @brief Record a completed span on the calling thread.
+ * @param name Span name; must outlive the recorder (use string literals).
+ * @param category Category; same lifetime rule.
+ * @param start_ns Start time from nowNs().
+ * @param end_ns End time from nowNs().
+ */
+void record(const char* name, const char* category, uint64_t start_ns, uint64_t end_ns);
+
+/** @brief Copy of all recorded events, ordered by start time. */
+[[nodiscard]] std::vector<TraceEvent> snapshot();
+
+/** @brief Drop all recorded events (thread ids are kept). */
+void clear();
+
+/** @brief Recorded events as a Chrome Trace Event JSON document. */
+[[nodiscard]] std::string toChromeTraceJson();
+
+/**
+ * @brief Write toChromeTraceJson() to a file.
+ * @param path Output path.
+ * @return Status (eFileWriteFailed on error).
+ */
+[[nodiscard]] Status writeChromeTrace(const std::string& path);
+
+/**
+ * @class ScopedSpan
+ * @brief Records [construction, destruction) as one event when recording is enabled.
+ */
+class ScopedSpan {
+   public:
+    ScopedSpan(const char* name, const char* category)
+        : name_(name)
+        , category_(category)
+        , start_ns_(isEnabled() ? nowNs() : 0) {}
+
+    ~ScopedSpan() {
+        if (start_ns_ != 0) {
+            record(name_, category_, start_ns_, nowNs());
+        }
+    }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+   private:
+    const char* name_;
+    const char* category_;
+    uint64_t start_ns_;
+};
+
+}  // namespace trace
+}  // namespace io
+}  // namespace vne
+
+#define VNEIO_TRACE_CONCAT_INNER(a, b) a##b
+#define VNEIO_TRACE_CONCAT(a, b) VNEIO_TRACE_CONCAT_INNER(a, b)
+
+#if defined(VNEIO_WITH_TRACING) && VNEIO_WITH_TRACING
+/** @brief Trace the rest of the enclosing scope as span @p name. */
+#define VNEIO_TRACE_SPAN(name) \
+    const ::vne::io::trace::ScopedSpan VNEIO_TRACE_CONCAT(vneio_trace_span_, __LINE__)(name, "vneio")
+#else
+#define VNEIO_TRACE_SPAN(name) static_cast<void>(0)
+#endif
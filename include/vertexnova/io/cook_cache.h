@@ -0,0 +1,165 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/image/image.h"
+#include "vertexnova/io/image/volume.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/mesh/mesh.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file cook_cache.h
+ * @brief Persistent on-disk cache of post-processed ("cooked") assets.
+ */
+
+/** Format name (file extension) of standalone cooked blobs written by CookCache::encode(). */
+inline constexpr std::string_view kCookedFormat = "vnecook";
+
+/**
+ * @struct CookCacheStats
+ * @brief Counters of a CookCache.
+ */
+struct CookCacheStats {
+    uint64_t hits = 0;    //!< Assets restored from a blob.
+    uint64_t misses = 0;  //!< Lookups without a usable blob (absent, stale format or unreadable).
+    uint64_t stores = 0;  //!< Blobs written.
+};
+
+/**
+ * @class CookCache
+ * @brief Directory of binary blobs holding loaded Image, Mesh and Volume assets.
+ *
+ * A blob is keyed by a content hash of the source file, the loader's options
+ * (IAssetLoader::optionsKey()), the request flags that change the decoded asset and
+ * kFormatVersion. A warm load is then one mapping of the blob and a memcpy per buffer
+ * instead of a full import. Editing the source or changing an option makes a new key;
+ * stale blobs are left in place (delete the directory to reclaim them).
+ *
+ * Loaders whose output depends on other files (material libraries, external buffers) list
+ * them in LoadRequest::dependencies. store() records their content hashes, relative to the
+ * source's directory, and load() re-hashes them for the request being served: an edited,
+ * created or deleted dependency is a miss, and an identical source in another directory is
+ * checked against its own neighbours.
+ *
+ * Blobs are written to a temporary name and renamed, so concurrent processes and threads
+ * may share one directory. They use host byte order and are not meant to be portable.
+ */
+class CookCache {
+   public:
+    /** Blob layout version; bump when the layout or a loader's output changes. */
+    static constexpr uint32_t kFormatVersion = 2;
+
+    /**
+     * @brief Use @p directory for blobs (created on first store).
+     * @param directory Cache directory.
+     */
+    explicit CookCache(std::string directory);
+
+    CookCache(const CookCache&) = delete;
+    CookCache& operator=(const CookCache&) = delete;
+
+    /** @brief Cache directory. */
+    [[nodiscard]] const std::string& directory() const { return directory_; }
+
+    /**
+     * @brief Build the key of a request loaded by a loader with the given options key.
+     *
+     * Hashes the whole source file (through request.file_system when set).
+     * @param request Load request (routed).
+     * @param loader_key IAssetLoader::optionsKey() of the loader.
+     * @return Key, or std::nullopt if the request is not cacheable (buffer or memory-mapped load,
+     *         empty @p loader_key) or the source cannot be read.
+     */
+    [[nodiscard]] static std::optional<std::string> makeKey(const LoadRequest& request,
+                                                            const std::string& loader_key);
+
+    /**
+     * @brief Restore an asset stored under @p key.
+     * @param key Key from makeKey().
+     * @param out Asset to fill; its buffers keep their memory resource. Unchanged on a miss.
+     * @param request Request being served. The blob's dependencies are re-hashed relative to its uri
+     *        and through its file system, and appended to its `dependencies` list on a hit. A blob
+     *        with dependencies is a miss without a request.
+     * @return true on a hit.
+     */
+    [[nodiscard]] bool load(const std::string& key, vne::image::Image& out, const LoadRequest* request = nullptr);
+    /** @brief See load(const std::string&, Image&, const LoadRequest*). */
+    [[nodiscard]] bool load(const std::string& key, vne::mesh::Mesh& out, const LoadRequest* request = nullptr);
+    /** @brief See load(const std::string&, Image&, const LoadRequest*). */
+    [[nodiscard]] bool load(const std::string& key, vne::image::Volume& out, const LoadRequest* request = nullptr);
+
+    /**
+     * @brief Write @p asset under @p key, replacing any previous blob.
+     * @param request Request @p asset was loaded with; the files in its `dependencies` list (missing
+     *        ones included) are recorded with the blob.
+     * @return Status (eFileWriteFailed if the directory or blob cannot be written, eFileReadFailed if
+     *         a dependency cannot be read).
+     */
+    Status store(const std::string& key, const vne::image::Image& asset, const LoadRequest* request = nullptr);
+    /** @brief See store(const std::string&, const Image&, const LoadRequest*). */
+    Status store(const std::string& key, const vne::mesh::Mesh& asset, const LoadRequest* request = nullptr);
+    /** @brief See store(const std::string&, const Image&, const LoadRequest*). */
+    Status store(const std::string& key, const vne::image::Volume& asset, const LoadRequest* request = nullptr);
+
+    /**
+     * @brief Serialize an asset as a standalone blob without a cache key (e.g. a ".vnecook" pack entry).
+     * @return Blob bytes, readable by decode() and the cooked asset loaders.
+     */
+    [[nodiscard]] static std::vector<uint8_t> encode(const vne::image::Image& asset);
+    /** @brief See encode(const Image&). */
+    [[nodiscard]] static std::vector<uint8_t> encode(const vne::mesh::Mesh& asset);
+    /** @brief See encode(const Image&). */
+    [[nodiscard]] static std::vector<uint8_t> encode(const vne::image::Volume& asset);
+
+    /**
+     * @brief Restore an asset from a blob written by encode() or store(); the key is not checked.
+     * @param data Blob bytes.
+     * @param size Blob size in bytes.
+     * @param out Asset to fill; its buffers keep their memory resource. Unchanged on failure.
+     * @return false if the blob is truncated, of another version or holds another asset type, or if
+     * a mesh has an index past its vertices or a submesh past its indices or materials.
+     */
+    [[nodiscard]] static bool decode(const uint8_t* data, size_t size, vne::image::Image& out);
+    /** @brief See decode(const uint8_t*, size_t, Image&). */
+    [[nodiscard]] static bool decode(const uint8_t* data, size_t size, vne::mesh::Mesh& out);
+    /** @brief See decode(const uint8_t*, size_t, Image&). */
+    [[nodiscard]] static bool decode(const uint8_t* data, size_t size, vne::image::Volume& out);
+
+    /** @brief Snapshot of the counters. */
+    [[nodiscard]] CookCacheStats stats() const;
+
+   private:
+    [[nodiscard]] std::string blobPath(const std::string& key) const;
+    template<typename T>
+    [[nodiscard]] bool loadBlob(const std::string& key, T& out, const LoadRequest* request);
+    template<typename T>
+    Status storeBlob(const std::string& key, const T& asset, const LoadRequest* request);
+
+    std::string directory_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> stores_{0};
+};
+
+}  // namespace io
+}  // namespace vne
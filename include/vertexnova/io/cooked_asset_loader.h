@@ -0,0 +1,71 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/image/image_loader.h"
+#include "vertexnova/io/image/volume_loader.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/mesh/mesh_loader.h"
+
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file cooked_asset_loader.h
+ * @brief Loaders for pre-cooked ".vnecook" blobs (CookCache::encode()), e.g. shipped inside a pack.
+ *
+ * A cooked entry is restored with one copy per buffer straight from the file's contents()
+ * (the pack mapping for PackFileSystem), with no decoding or post-processing.
+ */
+
+/**
+ * @class CookedImageLoader
+ * @brief Restores images from ".vnecook" blobs (implements IImageLoader).
+ */
+class CookedImageLoader : public vne::image::IImageLoader {
+   public:
+    [[nodiscard]] bool canLoad(const LoadRequest& request) const override;
+    [[nodiscard]] LoadResult<vne::image::Image> loadImage(const LoadRequest& request) override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+};
+
+/**
+ * @class CookedMeshLoader
+ * @brief Restores meshes from ".vnecook" blobs (implements IMeshLoader).
+ */
+class CookedMeshLoader : public vne::mesh::IMeshLoader {
+   public:
+    [[nodiscard]] LoadResult<vne::mesh::Mesh> loadMesh(const LoadRequest& request) override;
+    [[nodiscard]] bool loadFile(const std::string& path, vne::mesh::Mesh& out_mesh) override;
+    [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+
+   private:
+    std::string last_error_;
+};
+
+/**
+ * @class CookedVolumeLoader
+ * @brief Restores volumes from ".vnecook" blobs (implements IVolumeLoader).
+ */
+class CookedVolumeLoader : public vne::image::IVolumeLoader {
+   public:
+    [[nodiscard]] bool canLoad(const LoadRequest& request) const override;
+    [[nodiscard]] LoadResult<vne::image::Volume> loadVolume(const LoadRequest& request) override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+};
+
+}  // namespace io
+}  // namespace vne
@@ -12,9 +12,15 @@
 
 #include <string>
 #include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <memory_resource>
 
 namespace vne {
+namespace io {
+class IFile;
+}  // namespace io
+
 namespace image {
 
 /**
@@ -42,6 +48,12 @@ class Image {
      */
     explicit Image(const std::string& file_path);
 
+    /**
+     * @brief Constructor that creates an empty image whose pixels allocate from a memory resource
+     * @param resource Memory resource for the pixel buffer
+     */
+    explicit Image(std::pmr::memory_resource* resource);
+
     /**
      * @brief Constructor that creates an image from raw data
      * @param data Raw pixel data
@@ -56,6 +68,14 @@ class Image {
      */
     ~Image();
 
+    /**
+     * @brief Copies allocate from the default memory resource; moves keep the source's
+     */
+    Image(const Image&) = default;
+    Image& operator=(const Image&) = default;
+    Image(Image&&) noexcept = default;
+    Image& operator=(Image&&) noexcept = default;
+
     /**
      * @brief Load an image from file
      * @param file_path Path to the image file
@@ -65,6 +85,25 @@ class Image {
      */
     [[nodiscard]] bool loadFromFile(const std::string& file_path, bool flip_vertically = true);
 
+    /**
+     * @brief Load an image from a virtual file system handle
+     * @param file Open file (decoded through stb's callback API, or from memory when resident)
+     * @param flip_vertically Whether to flip the image vertically after loading
+     * (default = true)
+     * @return True if loading succeeded, false otherwise
+     */
+    [[nodiscard]] bool loadFromFile(const vne::io::IFile& file, bool flip_vertically = true);
+
+    /**
+     * @brief Load an image from encoded bytes in memory (PNG, JPG, ...)
+     * @param data Encoded image bytes
+     * @param size Number of bytes
+     * @param flip_vertically Whether to flip the image vertically after loading
+     * (default = true)
+     * @return True if loading succeeded, false otherwise
+     */
+    [[nodiscard]] bool loadFromMemory(const uint8_t* data, size_t size, bool flip_vertically = true);
+
     /**
      * @brief Save the image to a file
      * @param file_path Path where the image will be saved
@@ -97,6 +136,16 @@ class Image {
      */
     [[nodiscard]] int getChannels() const;
 
+    /**
+     * @brief Replace the pixels with a copy of raw data, keeping the memory resource
+     * @param data Raw pixel data (width * height * channels bytes)
+     * @param width Image width
+     * @param height Image height
+     * @param channels Number of color channels
+     * @return True if the data was copied, false for null data or non-positive dimensions
+     */
+    [[nodiscard]] bool setPixels(const uint8_t* data, int width, int height, int channels);
+
     /**
      * @brief Resize the image
      * @param new_width New width in pixels
@@ -116,17 +165,28 @@ class Image {
      */
     [[nodiscard]] bool isEmpty() const;
 
+    /**
+     * @brief Get the memory resource the pixel buffer allocates from
+     * @return Memory resource (the default resource unless one was given at construction)
+     */
+    [[nodiscard]] std::pmr::memory_resource* getMemoryResource() const;
+
    private:
     /**
      * @brief Clear the image data
      */
     void clear();
 
+    /**
+     * @brief Copy decoded stb pixels into the image and free them
+     */
+    bool assignDecoded(uint8_t* data, int width, int height, int channels);
+
    private:
-    std::vector<uint8_t> data_;  //!< Raw pixel data
-    int width_;                  //!< Image width in pixels
-    int height_;                 //!< Image height in pixels
-    int channels_;               //!< Image channels (1=grayscale, 3=RGB, 4=RGBA)
+    std::pmr::vector<uint8_t> data_;  //!< Raw pixel data
+    int width_;                       //!< Image width in pixels
+    int height_;                      //!< Image height in pixels
+    int channels_;                    //!< Image channels (1=grayscale, 3=RGB, 4=RGBA)
 };
 
 /** @brief Canonical CPU image type alias (for AssetIO / upload documentation). */
@@ -154,6 +214,42 @@ namespace image_utils {
                    int desired_channels = 0,
                    bool flip_vertically = true);
 
+/**
+ * @brief Decode an image from encoded bytes in memory (see loadImage)
+ * @param buffer Encoded image bytes
+ * @param size Number of bytes
+ * @param width Output parameter for image width
+ * @param height Output parameter for image height
+ * @param channels Output parameter for image channels
+ * @param desired_channels Desired number of channels (0 = keep original)
+ * @param flip_vertically Whether to flip the image vertically after loading
+ * @return Pointer to image data, or nullptr if loading failed
+ */
+[[nodiscard]] uint8_t* loadImageFromMemory(const uint8_t* buffer,
+                             size_t size,
+                             int* width,
+                             int* height,
+                             int* channels,
+                             int desired_channels = 0,
+                             bool flip_vertically = true);
+
+/**
+ * @brief Decode an image from a virtual file system handle (see loadImage)
+ * @param file Open file
+ * @param width Output parameter for image width
+ * @param height Output parameter for image height
+ * @param channels Output parameter for image channels
+ * @param desired_channels Desired number of channels (0 = keep original)
+ * @param flip_vertically Whether to flip the image vertically after loading
+ * @return Pointer to image data, or nullptr if loading failed
+ */
+[[nodiscard]] uint8_t* loadImage(const vne::io::IFile& file,
+                   int* width,
+                   int* height,
+                   int* channels,
+                   int desired_channels = 0,
+                   bool flip_vertically = true);
+
 /**
  * @brief Free image data loaded by loadImage
  * @param data Pointer to the image data to free
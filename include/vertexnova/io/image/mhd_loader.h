@@ -15,6 +15,7 @@
 #include "vertexnova/io/load_request.h"
 
 #include <string>
+#include <vector>
 
 namespace vne {
 namespace image {
@@ -30,6 +31,7 @@ namespace image {
  *
  * Reads NDims, DimSize, ElementType, ElementSpacing, ElementDataFile
  * (or inline data in MHA). ElementType: MET_UCHAR, MET_USHORT, MET_FLOAT.
+ * CompressedData (zlib) needs a build with VNEIO_WITH_ZLIB.
  */
 class MhdLoader : public IVolumeLoader {
    public:
@@ -37,6 +39,7 @@ class MhdLoader : public IVolumeLoader {
 
     [[nodiscard]] bool canLoad(const vne::io::LoadRequest& request) const override;
     [[nodiscard]] vne::io::LoadResult<Volume> loadVolume(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
 
     /**
      * @brief Load a volume from a MHD/MHA file (legacy API).
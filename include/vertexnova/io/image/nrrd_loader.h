@@ -15,6 +15,7 @@
 #include "vertexnova/io/load_request.h"
 
 #include <string>
+#include <vector>
 
 namespace vne {
 namespace image {
@@ -28,8 +29,9 @@ namespace image {
  * @class NrrdLoader
  * @brief Loader for NRRD 3D volumes (implements IVolumeLoader).
  *
- * Supports dimension 3, type uchar/uint8/ushort/uint16/float, encoding raw,
- * attached or detached data file. Spacings and (optionally) space origin are read when present.
+ * Supports dimension 3, type uchar/uint8/ushort/uint16/float, encoding raw (and gzip, inflated
+ * natively when built with VNEIO_WITH_ZLIB), attached or detached data file. Spacings and
+ * (optionally) space origin are read when present.
  */
 class NrrdLoader : public IVolumeLoader {
    public:
@@ -37,6 +39,7 @@ class NrrdLoader : public IVolumeLoader {
 
     [[nodiscard]] bool canLoad(const vne::io::LoadRequest& request) const override;
     [[nodiscard]] vne::io::LoadResult<Volume> loadVolume(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
 
     /**
      * @brief Load a volume from a NRRD file (legacy API).
@@ -15,6 +15,7 @@
 #include "vertexnova/io/load_request.h"
 
 #include <string>
+#include <vector>
 
 namespace vne {
 namespace image {
@@ -34,6 +35,9 @@ class StbImageLoader : public IImageLoader {
 
     [[nodiscard]] bool canLoad(const vne::io::LoadRequest& request) const override;
     [[nodiscard]] vne::io::LoadResult<Image> loadImage(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    /** @brief Constant: decoding has no options (flipped vertically, native channel count). */
+    [[nodiscard]] std::string optionsKey() const override;
 
     /**
      * @brief Check if the given path has a supported image extension.
@@ -41,9 +45,6 @@ class StbImageLoader : public IImageLoader {
      * @return true if the extension is supported.
      */
     [[nodiscard]] static bool isExtensionSupported(const std::string& path);
-
-   private:
-    std::string last_error_;
 };
 
 }  // namespace image
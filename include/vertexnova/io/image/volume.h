@@ -12,6 +12,10 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 namespace vne {
@@ -80,8 +84,20 @@ constexpr int kBytesPerFloat64 = 8;
  * Dimensions (width, height, depth), spacing (mm or physical units),
  * origin, pixel type, and contiguous raw buffer. Used for multiplanar
  * reformats and window/level in viewers.
+ *
+ * Voxels live either in the owned `data` vector or, for zero-copy loads, in
+ * read-only external storage (e.g. a file mapping) kept alive by external_data.
+ * Read voxels through getData()/dataSize(), which cover both cases.
+ *
+ * `data` allocates from a std::pmr::memory_resource chosen at construction (moves keep
+ * it; copies and move-assignment keep the destination's).
  */
 struct Volume {
+    Volume() = default;
+    /** @brief Empty volume whose voxel storage allocates from @p resource. */
+    explicit Volume(std::pmr::memory_resource* resource)
+        : data(resource) {}
+
     int dims[3] = {0, 0, 0};   //!< Width (x), height (y), depth (z).
     float spacing[3] = {1.0f, 1.0f, 1.0f};  //!< Voxel spacing (e.g. mm).
     float origin[3] = {0.0f, 0.0f, 0.0f};   //!< World-space origin.
@@ -98,7 +114,9 @@ struct Volume {
     };
     VolumePixelType pixel_type = VolumePixelType::eUint8;  //!< Scalar type of voxels.
     int components = 1;   //!< Components per voxel (1 for scalar).
-    std::vector<uint8_t> data;  //!< Contiguous voxel data.
+    std::pmr::vector<uint8_t> data;  //!< Contiguous voxel data (empty when external storage is used).
+    std::shared_ptr<const uint8_t> external_data;  //!< Read-only voxel storage owned elsewhere; used when set.
+    size_t external_bytes = 0;                     //!< Size of external_data in bytes.
 
     [[nodiscard]] int width() const { return dims[0]; }
     [[nodiscard]] int height() const { return dims[1]; }
@@ -112,10 +130,46 @@ struct Volume {
         return voxelCount() * static_cast<size_t>(components) * static_cast<size_t>(bytesPerVoxel(pixel_type));
     }
 
-    [[nodiscard]] bool isEmpty() const { return dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0 || data.size() < byteCount(); }
+    [[nodiscard]] bool isEmpty() const {
+        return dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0 || dataSize() < byteCount();
+    }
+
+    /** @brief True if voxels are backed by external storage rather than `data`. */
+    [[nodiscard]] bool hasExternalData() const { return external_data != nullptr; }
+    /** @brief Size in bytes of the voxel storage in use. */
+    [[nodiscard]] size_t dataSize() const { return external_data ? external_bytes : data.size(); }
 
-    [[nodiscard]] const uint8_t* getData() const { return data.data(); }
-    [[nodiscard]] uint8_t* getData() { return data.data(); }
+    /**
+     * @brief Use read-only external storage for the voxels (clears `data`).
+     * @param storage Buffer owner; an aliasing shared_ptr may point into a larger allocation or mapping.
+     * @param bytes Size of the storage in bytes.
+     */
+    void setExternalData(std::shared_ptr<const uint8_t> storage, size_t bytes) {
+        data.clear();
+        data.shrink_to_fit();
+        external_data = std::move(storage);
+        external_bytes = external_data ? bytes : 0;
+    }
+
+    /** @brief Copy external storage into `data` so the voxels become owned and writable (no-op if owned). */
+    void detachExternalData() {
+        if (!external_data) {
+            return;
+        }
+        data.resize(external_bytes);
+        if (external_bytes > 0) {
+            std::memcpy(data.data(), external_data.get(), external_bytes);
+        }
+        external_data.reset();
+        external_bytes = 0;
+    }
+
+    [[nodiscard]] const uint8_t* getData() const { return external_data ? external_data.get() : data.data(); }
+    /** @brief Writable voxels; detaches (copies) external storage first. */
+    [[nodiscard]] uint8_t* getData() {
+        detachExternalData();
+        return data.data();
+    }
 };
 
 /** @brief Canonical CPU volume type alias (for AssetIO / upload documentation). */
@@ -10,6 +10,7 @@
  * ----------------------------------------------------------------------
  */
 
+#include "vertexnova/io/common/codec.h"
 #include "vertexnova/io/image/volume.h"
 
 #include <string>
@@ -28,6 +29,9 @@ namespace vne::image {
 struct NrrdExportOptions {
     bool detached_data = false;       //!< If true, write .nhdr + separate .raw file.
     std::string detached_data_name;  //!< Override name for the raw file (optional).
+    /** eNone ("encoding: raw") or eGzip ("encoding: gzip", needs VNEIO_WITH_ZLIB). */
+    vne::io::binaryio::CodecId codec = vne::io::binaryio::CodecId::eNone;
+    int compression_level = vne::io::binaryio::kDefaultCompressionLevel;  //!< Codec level (1-9 for gzip).
 };
 
 /**
@@ -37,10 +41,13 @@ struct NrrdExportOptions {
 struct MhdExportOptions {
     bool inline_data = false;   //!< If true, write .mha (ElementDataFile = LOCAL).
     std::string raw_data_name;  //!< Name for raw file when inline_data is false.
+    /** eNone or eZlib ("CompressedData = True", needs VNEIO_WITH_ZLIB). */
+    vne::io::binaryio::CodecId codec = vne::io::binaryio::CodecId::eNone;
+    int compression_level = vne::io::binaryio::kDefaultCompressionLevel;  //!< Codec level (1-9 for zlib).
 };
 
 /**
- * @brief Export volume to NRRD (.nrrd or .nhdr + .raw).
+ * @brief Export volume to NRRD (.nrrd or .nhdr + .raw, .raw.gz when gzip-encoded).
  * @param nrrd_or_nhdr_path Output path for .nrrd or .nhdr.
  * @param vol Volume to export.
  * @param opts Export options.
@@ -53,7 +60,7 @@ struct MhdExportOptions {
                               std::string* out_error = nullptr);
 
 /**
- * @brief Export volume to MetaImage (.mhd/.mha or .mha with inline data).
+ * @brief Export volume to MetaImage (.mhd/.mha or .mha with inline data; .zraw when compressed).
  * @param mhd_or_mha_path Output path for .mhd or .mha.
  * @param vol Volume to export.
  * @param opts Export options.
@@ -0,0 +1,76 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/load_request.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <utility>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file load_handle.h
+ * @brief Future-like handle returned by AssetIO asynchronous loads.
+ */
+
+/**
+ * @brief Completion callback for asynchronous loads; runs on the thread that calls AssetIO::pollCompletions().
+ */
+template<typename T>
+using LoadCallback = std::function<void(const LoadResult<T>&)>;
+
+/**
+ * @class LoadHandle
+ * @brief Shared, copyable handle to the result of an asynchronous load.
+ *
+ * The result is produced once on a worker thread; any number of copies may
+ * poll or wait for it. get() blocks until the result is available.
+ */
+template<typename T>
+class LoadHandle {
+   public:
+    LoadHandle() = default;
+    explicit LoadHandle(std::shared_future<LoadResult<T>> future, uint64_t task_id = 0)
+        : future_(std::move(future))
+        , task_id_(task_id) {}
+
+    /** @brief True if the handle refers to a load (default-constructed handles do not). */
+    [[nodiscard]] bool valid() const { return future_.valid(); }
+
+    /** @brief True if the result is available; never blocks. */
+    [[nodiscard]] bool isReady() const {
+        return future_.valid() && future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    /** @brief Block until the result is available. */
+    void wait() const { future_.wait(); }
+
+    /**
+     * @brief Block until the result is available and return it.
+     * @return Load result (value valid when ok()).
+     */
+    [[nodiscard]] const LoadResult<T>& get() const { return future_.get(); }
+
+    /** @brief Worker pool task id of the load (see AssetIO::setLoadPriority()); 0 if none. */
+    [[nodiscard]] uint64_t taskId() const { return task_id_; }
+
+   private:
+    std::shared_future<LoadResult<T>> future_;
+    uint64_t task_id_ = 0;
+};
+
+}  // namespace io
+}  // namespace vne
@@ -10,14 +10,23 @@
  * ----------------------------------------------------------------------
  */
 
+#include "vertexnova/io/common/cancellation.h"
 #include "vertexnova/io/common/status.h"
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace vne {
 namespace io {
 
+class IFileSystem;
+
 /**
  * @file load_request.h
  * @brief Load request and result types for AssetIO registry and loader interfaces.
@@ -34,9 +43,43 @@ enum class AssetType : uint8_t {
     eDicomSeries,    //!< DICOM series (directory of slices)
 };
 
+/**
+ * @enum LoadPriority
+ * @brief Scheduling class of an asynchronous or batched load; higher classes leave the queue first.
+ */
+enum class LoadPriority : uint8_t {
+    eBackground = 0,  //!< Prefetch and other speculative work.
+    eNormal,          //!< Default.
+    eHigh,            //!< Needed soon (e.g. visible assets).
+    eUrgent,          //!< Needed now (e.g. the asset under the cursor).
+};
+
 /**
  * @struct LoadRequest
- * @brief Request to load an asset (file path or future: URI, pak, etc.)
+ * @brief Request to load an asset (file path, a path inside an IFileSystem, or a memory buffer).
+ *
+ * When `buffer` is non-empty the asset is decoded from it and `uri` is only used as
+ * a name (for its extension, error messages, and to resolve detached data files).
+ * The caller keeps the buffer alive until the load (including an asynchronous one) completes.
+ *
+ * Loaders poll `cancel_token` and call `on_progress` at chunk boundaries of raw reads,
+ * byte swapping and mesh conversion; a cancelled load fails with ErrorCode::eCancelled.
+ *
+ * Asset storage (Volume::data, Mesh::vertices/indices, Image pixels) is allocated from
+ * `memory_resource` when set. The resource must outlive the loaded assets and, when one
+ * resource serves concurrent loads (async, batch), be thread-safe (e.g.
+ * std::pmr::synchronized_pool_resource).
+ *
+ * `direct_io` reads volume payloads with O_DIRECT (bulk ingest that should not evict the page
+ * cache). Volume::data is then allocated binaryio::kDirectIoAlignment-aligned unless
+ * `memory_resource` is set. It has no effect on mapped or in-memory loads.
+ *
+ * `priority` and `deadline` only order queued work on AssetIO's worker pool (async
+ * loads and loadBatch); blocking loads run immediately on the calling thread.
+ *
+ * When `dependencies` is set, loaders append every other file they read or looked for
+ * (OBJ material libraries, external glTF buffers, files an Assimp importer opens), even a
+ * missing one. AssetIO's cook cache records them so that editing one invalidates the blob.
  */
 struct LoadRequest {
     AssetType asset_type = AssetType::eImage;  //!< Kind of asset to load.
@@ -45,8 +88,23 @@ struct LoadRequest {
     bool generate_mips = false;                 //!< For images: generate mipmaps.
     bool force_srgb = false;                   //!< For images: treat as sRGB.
     bool prefer_16bit = false;                 //!< For medical volumes: prefer 16-bit if applicable.
+    bool memory_map = false;                   //!< For raw volumes: back voxels by a read-only file mapping.
+    bool direct_io = false;                    //!< For raw volumes: read voxels bypassing the page cache.
+    const IFileSystem* file_system = nullptr;  //!< Where uri is resolved (nullptr = OS paths; set by AssetIO).
+    std::span<const std::byte> buffer;         //!< Encoded asset bytes to load instead of reading uri.
+    CancellationToken cancel_token;            //!< Abort the load when cancelled (inert by default).
+    ProgressCallback on_progress;              //!< Optional progress callback (see LoadProgress).
+    std::pmr::memory_resource* memory_resource = nullptr;  //!< Asset storage allocator (nullptr = default resource).
+    LoadPriority priority = LoadPriority::eNormal;            //!< Queue order on the worker pool.
+    std::optional<std::chrono::steady_clock::time_point> deadline;  //!< Earlier runs first within a priority.
+    std::vector<std::string>* dependencies = nullptr;               //!< Receives the other files read (see above).
 };
 
+/** @brief Resource a loader allocates the asset's storage from: request.memory_resource or the default one. */
+[[nodiscard]] inline std::pmr::memory_resource* assetMemoryResource(const LoadRequest& request) {
+    return request.memory_resource ? request.memory_resource : std::pmr::get_default_resource();
+}
+
 /**
  * @brief Load result: asset value + status. Alias to Result for consistency with loader APIs.
  */
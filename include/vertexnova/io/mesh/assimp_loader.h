@@ -14,6 +14,7 @@
 #include "vertexnova/io/mesh/mesh_loader.h"
 
 #include <string>
+#include <vector>
 
 namespace vne {
 namespace mesh {
@@ -50,6 +51,12 @@ struct AssimpLoaderOptions {
 class AssimpLoader : public IMeshLoader {
    public:
     AssimpLoader() = default;
+    /**
+     * @brief Create a loader whose request-based loads use @p options.
+     * @param options Options applied by loadMesh().
+     */
+    explicit AssimpLoader(const AssimpLoaderOptions& options)
+        : options_(options) {}
     ~AssimpLoader() override = default;
 
     [[nodiscard]] vne::io::LoadResult<Mesh> loadMesh(const vne::io::LoadRequest& request) override;
@@ -62,10 +69,20 @@ class AssimpLoader : public IMeshLoader {
      * @return true on success, false otherwise (see getLastError()).
      */
     [[nodiscard]] bool loadFile(const std::string& path, Mesh& out_mesh, const AssimpLoaderOptions& opts);
+    /** @brief Check the extension against Assimp's import list (queried once per process and cached). */
     [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
     [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+    /**
+     * @brief Assimp version and every field of the loadMesh() options.
+     *
+     * The files an import opens besides the source (e.g. .mtl libraries) are listed in
+     * LoadRequest::dependencies, so the cook cache also notices edits to them.
+     */
+    [[nodiscard]] std::string optionsKey() const override;
 
    private:
+    AssimpLoaderOptions options_;
     std::string last_error_;
 };
 
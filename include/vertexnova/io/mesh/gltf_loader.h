@@ -0,0 +1,169 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/mesh/mesh.h"
+#include "vertexnova/io/mesh/mesh_loader.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace mesh {
+
+/**
+ * @file gltf_loader.h
+ * @brief Native glTF 2.0 / GLB loader with zero-copy accessor views (implements IMeshLoader).
+ */
+
+/**
+ * @struct GltfLoaderOptions
+ * @brief Options for native glTF loading (defaults match AssimpLoaderOptions).
+ */
+struct GltfLoaderOptions {
+    /**
+     * Keep UVs with a top-left origin, like AssimpLoader's flip_uvs. glTF already stores them that
+     * way, so true keeps the stored values and false converts them (v' = 1 - v).
+     */
+    bool flip_uvs = true;
+    bool pre_transform_vertices = true;  //!< Apply node transforms (one copy per node instance of a mesh).
+    uint32_t max_threads = 0;            //!< Threads for vertex conversion (0 = hardware concurrency).
+};
+
+/** glTF accessor component types (their GL enum values). */
+enum class GltfComponentType : uint32_t {
+    eInt8 = 5120,
+    eUint8 = 5121,
+    eInt16 = 5122,
+    eUint16 = 5123,
+    eUint32 = 5125,
+    eFloat = 5126,
+};
+
+/**
+ * @struct GltfAccessorView
+ * @brief Read-only, strided view of one accessor inside the original glTF buffer.
+ */
+struct GltfAccessorView {
+    const std::byte* data = nullptr;                               //!< First element.
+    size_t count = 0;                                              //!< Number of elements.
+    size_t stride = 0;                                             //!< Bytes between consecutive elements.
+    GltfComponentType component_type = GltfComponentType::eFloat;  //!< Type of each component.
+    uint32_t components = 0;                                       //!< 1 (SCALAR) to 4 (VEC4), 9 (MAT3), 16 (MAT4).
+    bool normalized = false;                                       //!< Integer components map to [0, 1] or [-1, 1].
+
+    [[nodiscard]] bool empty() const { return count == 0; }
+    /** @brief Bytes of one element (components * component size). */
+    [[nodiscard]] size_t elementSize() const;
+    /**
+     * @brief The elements as a contiguous array of @p T.
+     * @return Empty when the elements are interleaved, not sizeof(T) bytes each, or not aligned for T.
+     */
+    template<typename T>
+    [[nodiscard]] std::span<const T> tight() const {
+        if (empty() || stride != sizeof(T) || elementSize() != sizeof(T)
+            || reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+            return {};
+        }
+        return {reinterpret_cast<const T*>(data), count};
+    }
+};
+
+/**
+ * @struct GltfPrimitiveView
+ * @brief Triangle primitive of a glTF mesh, as views of its accessors.
+ */
+struct GltfPrimitiveView {
+    uint32_t mesh_index = 0;      //!< Index of the glTF mesh.
+    uint32_t material_index = 0;  //!< Index into GltfView::materials.
+    GltfAccessorView positions;   //!< POSITION (VEC3 float).
+    GltfAccessorView normals;     //!< NORMAL (VEC3 float); empty if absent.
+    GltfAccessorView tangents;    //!< TANGENT (VEC4 float, w = handedness); empty if absent.
+    GltfAccessorView texcoord0;   //!< TEXCOORD_0 (VEC2 float or normalized integers); empty if absent.
+    GltfAccessorView indices;     //!< Indices (SCALAR uint8/16/32); empty for non-indexed primitives.
+};
+
+/**
+ * @struct GltfView
+ * @brief Non-owning view of every triangle primitive of a glTF asset.
+ *
+ * Accessor views point straight into the mapped GLB, the mapped .bin files or the caller's
+ * request buffer; nothing is converted and node transforms are not applied.
+ */
+struct GltfView {
+    std::vector<GltfPrimitiveView> primitives;  //!< Triangle primitives in mesh order.
+    std::vector<Material> materials;            //!< glTF materials, then "DefaultMaterial" if needed.
+    std::shared_ptr<const void> keep;           //!< Keeps mappings alive; views are valid while it is held.
+};
+
+/**
+ * @class GltfLoader
+ * @brief Loads glTF 2.0 (.gltf with .bin or data: buffers, and binary .glb) without Assimp.
+ *
+ * GLB files and external buffers are memory-mapped (or used in place from a buffer or resident
+ * virtual file). loadView() hands out GltfView: the accessors of every triangle primitive as
+ * strided views of those bytes, with no conversion at all. loadMesh() converts the same
+ * primitives into Mesh: one submesh (with its own vertex range) per primitive instance,
+ * attributes decoded straight from the views in parallel, and tightly packed 32-bit index
+ * buffers copied in bulk.
+ *
+ * Materials come from pbrMetallicRoughness (baseColorFactor and the baseColorTexture image URI).
+ * Tangents come from TANGENT (bitangent = cross(normal, tangent) * w); they are not generated.
+ * Primitives other than triangles are skipped. Sparse accessors, and extensions listed in
+ * extensionsRequired (e.g. Draco, meshopt), fail with eUnsupportedFeature.
+ */
+class GltfLoader : public IMeshLoader {
+   public:
+    GltfLoader() = default;
+    /**
+     * @brief Create a loader whose loads use @p options.
+     * @param options Options applied by loadMesh(), loadFile() and loadView().
+     */
+    explicit GltfLoader(const GltfLoaderOptions& options)
+        : options_(options) {}
+    ~GltfLoader() override = default;
+
+    [[nodiscard]] vne::io::LoadResult<Mesh> loadMesh(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] bool loadFile(const std::string& path, Mesh& out_mesh) override;
+    [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+    /**
+     * @brief Loader version, UV flip and node transforms (the thread count does not change the output).
+     *
+     * External buffer files are listed in LoadRequest::dependencies, so the cook cache also notices
+     * edits to a .bin next to an unchanged .gltf.
+     */
+    [[nodiscard]] std::string optionsKey() const override;
+
+    /**
+     * @brief Map the asset and return views of its accessors (no conversion).
+     *
+     * With a request buffer the views point into that buffer, which must outlive them.
+     * @param request Load request (buffer, file_system or OS path).
+     * @return Result (file errors, eParseError, eDataTruncated, eUnsupportedFeature; accessors
+     * without a bufferView cannot be viewed and also fail with eUnsupportedFeature).
+     */
+    [[nodiscard]] vne::io::Result<GltfView> loadView(const vne::io::LoadRequest& request);
+
+   private:
+    GltfLoaderOptions options_;
+    std::string last_error_;
+};
+
+}  // namespace mesh
+}  // namespace vne
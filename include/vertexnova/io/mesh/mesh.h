@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <memory_resource>
 
 namespace vne::mesh {
 
@@ -59,13 +60,20 @@ struct Submesh {
  * @brief Mesh for loading and managing 3D meshes.
  *
  * Supports multi-material meshes with vertex attributes for modern rendering pipelines.
+ * Vertex and index storage allocates from a std::pmr::memory_resource chosen at construction.
  */
 struct Mesh {
-    std::string name;                        //!< Mesh name/path
-    std::vector<VertexAttributes> vertices;  //!< Vertex data
-    std::vector<uint32_t> indices;           //!< Index data (32-bit)
-    std::vector<Submesh> parts;              //!< Submesh definitions
-    std::vector<Material> materials;         //!< Material definitions
+    Mesh() = default;
+    /** @brief Empty mesh whose vertex/index storage allocates from @p resource. */
+    explicit Mesh(std::pmr::memory_resource* resource)
+        : vertices(resource)
+        , indices(resource) {}
+
+    std::string name;                             //!< Mesh name/path
+    std::pmr::vector<VertexAttributes> vertices;  //!< Vertex data
+    std::pmr::vector<uint32_t> indices;           //!< Index data (32-bit)
+    std::vector<Submesh> parts;                   //!< Submesh definitions
+    std::vector<Material> materials;              //!< Material definitions
 
     bool has_normals = false;       //!< Whether mesh has normal vectors
     bool has_tangent = false;       //!< Whether mesh has tangent/bitangent vectors
@@ -22,6 +22,7 @@ namespace vne::mesh {
  *
  * Current exporters:
  *  - OBJ (+MTL): widely supported, good for debug and interchange.
+ *  - .vnemesh: versioned binary container that VneMeshLoader maps back with one bulk copy or none.
  *
  * Export is intentionally simple and deterministic. For advanced pipelines
  * (glTF, USD), integrate a dedicated library.
@@ -52,4 +53,35 @@ bool exportObj(const std::string& obj_path,
                const ObjExportOptions& opts = {},
                std::string* out_error = nullptr);
 
+/**
+ * @struct VneMeshExportOptions
+ * @brief Options for .vnemesh export.
+ */
+struct VneMeshExportOptions {
+    /**
+     * Store only the attributes the mesh has, one stream each, and 16-bit indices when they fit.
+     * Smaller files, but loading gathers the streams instead of copying (and loadView() rejects them).
+     */
+    bool compact = false;
+};
+
+/**
+ * @brief Export mesh to the binary .vnemesh format (see vnemesh_loader.h).
+ *
+ * The default layout stores VertexAttributes and 32-bit indices exactly as Mesh holds them,
+ * so VneMeshLoader restores each buffer with one copy. Meshes without indices (point clouds)
+ * are accepted; meshes the loader would reject (indices past the vertex count, submeshes past
+ * the index buffer or material list) are not.
+ *
+ * @param path       Output path to .vnemesh file.
+ * @param mesh       Source mesh to export.
+ * @param opts       Export options (default: interleaved layout).
+ * @param out_error  If non-null, receives an error description on failure.
+ * @return true if export succeeded, false otherwise (check out_error if provided).
+ */
+bool exportVneMesh(const std::string& path,
+                   const Mesh& mesh,
+                   const VneMeshExportOptions& opts = {},
+                   std::string* out_error = nullptr);
+
 }  // namespace vne::mesh
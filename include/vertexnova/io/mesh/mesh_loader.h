@@ -11,6 +11,7 @@
  */
 
 #include "vertexnova/io/asset_loader.h"
+#include "vertexnova/io/common/format_detect.h"
 #include "vertexnova/io/load_request.h"
 #include "vertexnova/io/mesh/mesh.h"
 
@@ -66,7 +67,11 @@ class IMeshLoader : public vne::io::IAssetLoader {
 };
 
 inline bool IMeshLoader::canLoad(const vne::io::LoadRequest& request) const {
-    return request.asset_type == vne::io::AssetType::eMesh && isExtensionSupported(request.uri);
+    if (request.asset_type != vne::io::AssetType::eMesh) {
+        return false;
+    }
+    const std::string format = vne::io::requestFormat(request);
+    return !format.empty() && isExtensionSupported("." + format);
 }
 
 }  // namespace mesh
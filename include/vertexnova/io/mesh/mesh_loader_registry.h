@@ -28,8 +28,9 @@ namespace mesh {
  * @brief Factory for mesh loaders by file path.
  *
  * getLoaderFor(path) returns a loader that supports the file extension,
- * or nullptr if none is available. The default build registers Assimp
- * for common formats (e.g. .obj, .stl, .fbx, .gltf). Caller owns the returned loader.
+ * or nullptr if none is available. STL, OBJ, PLY, glTF/GLB and .vnemesh go to the native StlLoader,
+ * ObjLoader, PlyLoader, GltfLoader and VneMeshLoader, other common formats (e.g. .fbx, .dae) to Assimp.
+ * Caller owns the returned loader.
  */
 class MeshLoaderRegistry {
    public:
@@ -0,0 +1,86 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/mesh.h"
+#include "vertexnova/io/mesh/mesh_loader.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace mesh {
+
+/**
+ * @file obj_loader.h
+ * @brief Native multithreaded Wavefront OBJ loader that bypasses Assimp (implements IMeshLoader).
+ */
+
+/**
+ * @struct ObjLoaderOptions
+ * @brief Options for native OBJ loading (defaults match AssimpLoaderOptions).
+ */
+struct ObjLoaderOptions {
+    bool flip_uvs = true;      //!< Flip texture V coordinate (v' = 1 - v).
+    bool gen_tangents = true;  //!< Generate tangent/bitangent where the mesh has UVs and normals.
+    uint32_t max_threads = 0;  //!< Threads for parsing and vertex deduplication (0 = hardware concurrency).
+};
+
+/**
+ * @class ObjLoader
+ * @brief Loads Wavefront OBJ (with its MTL materials) straight into Mesh.
+ *
+ * The file is memory-mapped (or used in place from a buffer or resident virtual file) and split
+ * into chunks at line boundaries. A first parallel pass counts the v/vt/vn records of each chunk
+ * so that a second parallel pass can parse them with std::from_chars directly into their final
+ * slots and resolve face indices (including negative ones) on the spot. Polygons are fanned into
+ * triangles. Corners are deduplicated by their (material, v, vt, vn) tuple through a lock-free
+ * hash table shared by all threads; vertices keep first-occurrence order, so the result does not
+ * depend on the thread count.
+ *
+ * The output matches AssimpLoader with its default options: one submesh per used material
+ * (ordered like the materials, "DefaultMaterial" first when faces precede any usemtl), each with
+ * its own vertex range; Kd and map_Kd as base color and texture; missing normals (0, 1, 0) and
+ * missing UVs (0, 0). mtllib files are resolved next to the OBJ through request.file_system, or
+ * the OS when there is none; a missing library leaves the default material.
+ */
+class ObjLoader : public IMeshLoader {
+   public:
+    ObjLoader() = default;
+    /**
+     * @brief Create a loader whose loads use @p options.
+     * @param options Options applied by loadMesh() and loadFile().
+     */
+    explicit ObjLoader(const ObjLoaderOptions& options)
+        : options_(options) {}
+    ~ObjLoader() override = default;
+
+    [[nodiscard]] vne::io::LoadResult<Mesh> loadMesh(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] bool loadFile(const std::string& path, Mesh& out_mesh) override;
+    [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+    /**
+     * @brief Loader version, UV flip and tangent generation (the thread count does not change the output).
+     *
+     * The mtllib files a load reads are listed in LoadRequest::dependencies, so the cook cache also
+     * notices edits to them.
+     */
+    [[nodiscard]] std::string optionsKey() const override;
+
+   private:
+    ObjLoaderOptions options_;
+    std::string last_error_;
+};
+
+}  // namespace mesh
+}  // namespace vne
@@ -0,0 +1,77 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/mesh.h"
+#include "vertexnova/io/mesh/mesh_loader.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace mesh {
+
+/**
+ * @file ply_loader.h
+ * @brief Native PLY loader (binary and ASCII) for scans and point clouds (implements IMeshLoader).
+ */
+
+/**
+ * @struct PlyLoaderOptions
+ * @brief Options for native PLY loading.
+ */
+struct PlyLoaderOptions {
+    bool flip_uvs = true;         //!< Flip texture V coordinate (v' = 1 - v), like AssimpLoaderOptions.
+    bool positions_only = false;  //!< Decode only x/y/z; normals and UVs keep their defaults.
+    uint32_t max_threads = 0;     //!< Threads for fixed-size vertex and face blocks (0 = hardware concurrency).
+};
+
+/**
+ * @class PlyLoader
+ * @brief Loads PLY (ascii, binary_little_endian, binary_big_endian) straight into Mesh.
+ *
+ * The header is compiled into a reader specialized for the declared property layout: a plain
+ * copy when x/y/z are the only decoded float32 properties in host byte order, otherwise one
+ * decoder per used property, chosen for its type and byte order. Properties without a
+ * Mesh field (colors, confidence, ...) and unknown elements are skipped. Binary vertex records
+ * of fixed size are decoded in parallel straight into Mesh::vertices; faces are fanned into
+ * Mesh::indices, in parallel when every face is a triangle.
+ *
+ * Files without faces (point clouds) load as vertices only: indices and parts stay empty, so
+ * Mesh::isEmpty() is true and getVertexCount() gives the point count.
+ */
+class PlyLoader : public IMeshLoader {
+   public:
+    PlyLoader() = default;
+    /**
+     * @brief Create a loader whose loads use @p options.
+     * @param options Options applied by loadMesh() and loadFile().
+     */
+    explicit PlyLoader(const PlyLoaderOptions& options)
+        : options_(options) {}
+    ~PlyLoader() override = default;
+
+    [[nodiscard]] vne::io::LoadResult<Mesh> loadMesh(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] bool loadFile(const std::string& path, Mesh& out_mesh) override;
+    [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+    /** @brief Loader version, UV flip and positions_only (the thread count does not change the output). */
+    [[nodiscard]] std::string optionsKey() const override;
+
+   private:
+    PlyLoaderOptions options_;
+    std::string last_error_;
+};
+
+}  // namespace mesh
+}  // namespace vne
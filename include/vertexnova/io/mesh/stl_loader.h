@@ -0,0 +1,75 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/mesh.h"
+#include "vertexnova/io/mesh/mesh_loader.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace mesh {
+
+/**
+ * @file stl_loader.h
+ * @brief Native STL loader (binary and ASCII) that bypasses Assimp (implements IMeshLoader).
+ */
+
+/**
+ * @struct StlLoaderOptions
+ * @brief Options for native STL loading.
+ */
+struct StlLoaderOptions {
+    bool weld_vertices = true;  //!< Merge corners with bit-identical position and normal (like Assimp's join).
+    uint32_t max_threads = 0;   //!< Threads for parsing and welding (0 = hardware concurrency).
+};
+
+/**
+ * @class StlLoader
+ * @brief Loads binary and ASCII STL straight into Mesh.
+ *
+ * Binary files are memory-mapped (or used in place from a buffer or resident virtual file)
+ * and their triangles are parsed in parallel chunks. Corners are welded with a hash table
+ * split into shards that are built in parallel; vertices keep first-occurrence order. ASCII
+ * files are parsed in one streaming pass over the mapping and then welded the same way.
+ * Zero (or non-finite) facet normals are replaced by the triangle's geometric normal.
+ *
+ * The output matches AssimpLoader for STL: one submesh over all triangles, a single default
+ * material, per-face normals, no UVs, and default tangents.
+ */
+class StlLoader : public IMeshLoader {
+   public:
+    StlLoader() = default;
+    /**
+     * @brief Create a loader whose loads use @p options.
+     * @param options Options applied by loadMesh() and loadFile().
+     */
+    explicit StlLoader(const StlLoaderOptions& options)
+        : options_(options) {}
+    ~StlLoader() override = default;
+
+    [[nodiscard]] vne::io::LoadResult<Mesh> loadMesh(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] bool loadFile(const std::string& path, Mesh& out_mesh) override;
+    [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+    /** @brief Loader version and the welding option (the thread count does not change the output). */
+    [[nodiscard]] std::string optionsKey() const override;
+
+   private:
+    StlLoaderOptions options_;
+    std::string last_error_;
+};
+
+}  // namespace mesh
+}  // namespace vne
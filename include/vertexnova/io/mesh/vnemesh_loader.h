@@ -0,0 +1,101 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/mesh/mesh.h"
+#include "vertexnova/io/mesh/mesh_loader.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace mesh {
+
+/**
+ * @file vnemesh_loader.h
+ * @brief Loader for the versioned binary ".vnemesh" mesh format written by exportVneMesh().
+ *
+ * A .vnemesh file is a fixed header (magic, version, byte-order mark, counts, flags, AABB and
+ * a table of 64-byte-aligned sections) followed by the sections: an attribute stream table,
+ * the vertex data the streams point into, the index stream, and the submesh, material and
+ * string tables. Data is stored in the writer's byte order; a file written on a host of the
+ * other byte order is rejected.
+ */
+
+/** Bump when the .vnemesh layout changes; older loaders reject newer files. */
+constexpr uint32_t kVneMeshVersion = 1;
+
+/**
+ * @struct VneMeshView
+ * @brief Read-only mesh mapped from a .vnemesh file.
+ *
+ * Vertex, index and submesh buffers point into the mapping. The name and materials hold
+ * strings and are decoded into owned storage (they are small).
+ */
+struct VneMeshView {
+    std::string name;                            //!< Mesh name/path.
+    std::span<const VertexAttributes> vertices;  //!< Vertex data.
+    std::span<const uint32_t> indices;           //!< Index data.
+    std::span<const Submesh> parts;              //!< Submesh definitions.
+    std::vector<Material> materials;             //!< Material definitions.
+    bool has_normals = false;                    //!< Whether mesh has normal vectors.
+    bool has_tangent = false;                    //!< Whether mesh has tangent/bitangent vectors.
+    bool has_uv0 = false;                        //!< Whether mesh has UV coordinates.
+    float aabb_min[3] = {0, 0, 0};               //!< Axis-aligned bounding box minimum.
+    float aabb_max[3] = {0, 0, 0};               //!< Axis-aligned bounding box maximum.
+    std::shared_ptr<const void> keep;            //!< Keeps the mapping alive.
+};
+
+/**
+ * @class VneMeshLoader
+ * @brief Loads ".vnemesh" files (implements IMeshLoader).
+ *
+ * The file is memory-mapped (or used in place from a buffer or resident virtual file) and
+ * validated against its header. Files in the default interleaved layout restore each Mesh
+ * buffer with one bulk copy, and loadView() exposes them with no copy at all. Compact files
+ * (VneMeshExportOptions::compact) are gathered per attribute stream, and their missing
+ * attributes get AssimpLoader's defaults.
+ *
+ * Every table is validated before use: submesh ranges, material indices and strings, and (in one
+ * parallel pass over the index section) every index against the vertex count.
+ */
+class VneMeshLoader : public IMeshLoader {
+   public:
+    VneMeshLoader() = default;
+    ~VneMeshLoader() override = default;
+
+    [[nodiscard]] vne::io::LoadResult<Mesh> loadMesh(const vne::io::LoadRequest& request) override;
+    [[nodiscard]] bool loadFile(const std::string& path, Mesh& out_mesh) override;
+    [[nodiscard]] bool isExtensionSupported(const std::string& path) const override;
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override;
+    [[nodiscard]] const std::string& getLastError() const override { return last_error_; }
+
+    /**
+     * @brief Map a .vnemesh file and return views of its buffers (no copy).
+     *
+     * With a request buffer the views point into that buffer, which must outlive them.
+     * @param request Load request (buffer, file_system or OS path).
+     * @return Result (file errors; eUnsupportedFormat for another format, version or byte order;
+     * eDataTruncated, eDataCorrupt; eUnsupportedFeature for compact files and misaligned buffers).
+     */
+    [[nodiscard]] vne::io::Result<VneMeshView> loadView(const vne::io::LoadRequest& request);
+
+   private:
+    std::string last_error_;
+};
+
+}  // namespace mesh
+}  // namespace vne
@@ -0,0 +1,132 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/image/image.h"
+#include "vertexnova/io/image/volume.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/mesh/mesh.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file shared_asset.h
+ * @brief Cross-process sharing of loaded assets through POSIX shared memory.
+ *
+ * A producer publishes an asset once with exportShared(); consumers in other processes map
+ * the segment read-only with importShared*() and use the buffers in place, with no copy and
+ * no re-parse. The segment starts with a self-describing header (magic, layout version,
+ * asset type, scalar metadata and a table of 64-byte-aligned sections), so a consumer needs
+ * only the segment name. Buffers are stored in host byte order for consumers on the same
+ * machine.
+ *
+ * Segments persist until unlinkShared() (or reboot); consumers that already mapped one keep
+ * their view after it is unlinked. Available where shm_open() exists; elsewhere every call
+ * fails with eNotImplemented.
+ */
+
+/** Bump when the shared segment layout changes. */
+constexpr uint32_t kSharedAssetVersion = 1;
+
+/**
+ * @struct SharedImageView
+ * @brief Read-only image mapped from a shared segment.
+ */
+struct SharedImageView {
+    int width = 0;                     //!< Width in pixels.
+    int height = 0;                    //!< Height in pixels.
+    int channels = 0;                  //!< Channels per pixel.
+    std::span<const uint8_t> pixels;   //!< Row-major 8-bit pixels (width * height * channels).
+    std::shared_ptr<const void> keep;  //!< Keeps the mapping alive; the spans are valid while it is held.
+
+    /** @brief Copy the pixels into an owning Image. */
+    [[nodiscard]] vne::image::Image toImage() const;
+};
+
+/**
+ * @struct SharedMeshView
+ * @brief Read-only mesh mapped from a shared segment.
+ *
+ * Vertex, index and submesh buffers point into the mapping. The name and materials hold
+ * strings and are decoded into owned storage (they are small).
+ */
+struct SharedMeshView {
+    std::string name;                                       //!< Mesh name/path.
+    std::span<const vne::mesh::VertexAttributes> vertices;  //!< Vertex data.
+    std::span<const uint32_t> indices;                      //!< Index data.
+    std::span<const vne::mesh::Submesh> parts;              //!< Submesh definitions.
+    std::vector<vne::mesh::Material> materials;             //!< Material definitions.
+    bool has_normals = false;                               //!< Whether mesh has normal vectors.
+    bool has_tangent = false;                               //!< Whether mesh has tangent/bitangent vectors.
+    bool has_uv0 = false;                                   //!< Whether mesh has UV coordinates.
+    float aabb_min[3] = {0, 0, 0};                          //!< Axis-aligned bounding box minimum.
+    float aabb_max[3] = {0, 0, 0};                          //!< Axis-aligned bounding box maximum.
+    std::shared_ptr<const void> keep;                       //!< Keeps the mapping alive.
+
+    /** @brief Copy the buffers into an owning Mesh. */
+    [[nodiscard]] vne::mesh::Mesh toMesh() const;
+};
+
+/** @brief True if shared segments are available on this platform. */
+[[nodiscard]] bool sharedAssetsSupported();
+
+/**
+ * @brief Publish an asset in a new shared segment.
+ *
+ * The segment is created exclusively, so an existing segment of the same name is an error
+ * (unlink it first to replace it). Consumers that open the segment before the copy finishes
+ * see it as not ready (eDataTruncated).
+ * @param name Segment name, POSIX style ("/name": one leading slash and no others).
+ * @param asset Asset to publish.
+ * @return Status (eInvalidArgument for a bad name or empty asset, eFileWriteFailed if the
+ * segment exists or cannot be created).
+ */
+[[nodiscard]] Status exportShared(const std::string& name, const vne::image::Image& asset);
+[[nodiscard]] Status exportShared(const std::string& name, const vne::mesh::Mesh& asset);
+[[nodiscard]] Status exportShared(const std::string& name, const vne::image::Volume& asset);
+
+/**
+ * @brief Remove a shared segment name; existing mappings stay valid until released.
+ * @return Status (eFileNotFound if no such segment).
+ */
+[[nodiscard]] Status unlinkShared(const std::string& name);
+
+/**
+ * @brief Asset type recorded in a shared segment's header.
+ * @return Result (eFileNotFound, eDataTruncated if not ready, eUnsupportedFormat if the
+ * header is not a vneio segment of this layout version).
+ */
+[[nodiscard]] Result<AssetType> sharedAssetType(const std::string& name);
+
+/** @brief Map a shared image read-only (eUnsupportedFormat if the segment holds another asset type). */
+[[nodiscard]] Result<SharedImageView> importSharedImage(const std::string& name);
+
+/** @brief Map a shared mesh read-only (eUnsupportedFormat if the segment holds another asset type). */
+[[nodiscard]] Result<SharedMeshView> importSharedMesh(const std::string& name);
+
+/**
+ * @brief Map a shared volume read-only.
+ *
+ * The voxels are external storage (Volume::hasExternalData()) that keeps the mapping alive,
+ * so the result works anywhere a loaded Volume does.
+ */
+[[nodiscard]] Result<vne::image::Volume> importSharedVolume(const std::string& name);
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,178 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/status.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file file_system.h
+ * @brief Virtual file system interface used by the loaders (native, in-memory and pack-file backends).
+ *
+ * Virtual paths use '/' separators. Backends other than the native one normalize
+ * paths with normalizeVirtualPath(), so "./a//b/../c.png" and "a/c.png" name the same file.
+ */
+
+/**
+ * @struct FileInfo
+ * @brief Size and modification stamp of a file.
+ */
+struct FileInfo {
+    uint64_t size = 0;          //!< File size in bytes.
+    int64_t modified_time = 0;  //!< Opaque modification stamp; changes when the contents change.
+};
+
+/**
+ * @class IFile
+ * @brief Read-only, random-access file handle.
+ *
+ * read() is positional and const, so one handle may be read from several threads.
+ */
+class IFile {
+   public:
+    virtual ~IFile() = default;
+
+    /** @brief File size in bytes. */
+    [[nodiscard]] virtual uint64_t size() const = 0;
+
+    /**
+     * @brief Read up to @p bytes starting at @p offset.
+     * @param offset Absolute byte offset.
+     * @param dst Destination buffer (at least @p bytes long).
+     * @param bytes Number of bytes to read.
+     * @return Bytes actually read (less than @p bytes at end of file or on error).
+     */
+    [[nodiscard]] virtual size_t read(uint64_t offset, void* dst, size_t bytes) const = 0;
+
+    /**
+     * @brief Read exactly [offset, offset + bytes), options.chunk_bytes at a time.
+     *
+     * The default loops over read(); the native backend overrides it with binaryio's
+     * pread / io_uring reader, which keeps options.queue_depth chunks in flight.
+     * @param options Backend, chunking and per-chunk progress hook.
+     * @return Status (eDataTruncated if the file ends early, eCancelled if options.on_chunk returned false).
+     */
+    [[nodiscard]] virtual Status readRange(uint64_t offset,
+                                           void* dst,
+                                           size_t bytes,
+                                           const binaryio::ReadOptions& options) const;
+
+    /**
+     * @brief Whole file contents, if the backend already holds them in memory.
+     *
+     * The returned pointer keeps the bytes alive independently of this handle, so
+     * loaders can reference them without copying. The in-memory and pack backends
+     * return their storage; the native backend returns nullptr (use read()).
+     * @return Pointer to size() bytes, or nullptr.
+     */
+    [[nodiscard]] virtual std::shared_ptr<const uint8_t> contents() const { return nullptr; }
+};
+
+/**
+ * @class BufferFile
+ * @brief IFile over caller-owned memory (non-owning).
+ *
+ * contents() returns nullptr because the view cannot keep the bytes alive, so
+ * loaders always copy out of it; the memory must outlive the handle.
+ */
+class BufferFile final : public IFile {
+   public:
+    BufferFile(const uint8_t* data, size_t size)
+        : data_(data)
+        , size_(size) {}
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+    [[nodiscard]] size_t read(uint64_t offset, void* dst, size_t bytes) const override;
+
+    /** @brief The viewed bytes. */
+    [[nodiscard]] const uint8_t* data() const { return data_; }
+
+   private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * @class IFileSystem
+ * @brief Source of files for loaders.
+ *
+ * Implementations must be safe to use from several threads at once (AssetIO loads
+ * on a worker pool).
+ */
+class IFileSystem {
+   public:
+    virtual ~IFileSystem() = default;
+
+    /** @brief True if @p path names a readable file. */
+    [[nodiscard]] virtual bool exists(const std::string& path) const = 0;
+
+    /**
+     * @brief Query size and modification stamp.
+     * @param path File path.
+     * @param out Output info.
+     * @return Status (eFileNotFound if the file does not exist).
+     */
+    [[nodiscard]] virtual Status stat(const std::string& path, FileInfo& out) const = 0;
+
+    /**
+     * @brief Open a file for reading.
+     * @param path File path.
+     * @param out Output handle (reset on failure).
+     * @return Status (eFileNotFound / eFileOpenFailed on failure).
+     */
+    [[nodiscard]] virtual Status openFile(const std::string& path, std::unique_ptr<IFile>& out) const = 0;
+};
+
+/**
+ * @brief Normalize a virtual path: '\\' becomes '/', empty, "." and leading '/' segments are dropped, ".." pops.
+ * @param path Path to normalize.
+ * @return Normalized relative path (e.g. "textures/a.png").
+ */
+[[nodiscard]] std::string normalizeVirtualPath(std::string_view path);
+
+/**
+ * @brief Resolve @p relative against the directory of @p base_file ("a/b.mhd" + "b.raw" = "a/b.raw").
+ *
+ * Absolute @p relative paths are returned unchanged.
+ */
+[[nodiscard]] std::string resolveSiblingPath(const std::string& base_file, const std::string& relative);
+
+/**
+ * @brief Read a whole file through a file system.
+ * @param fs File system.
+ * @param path File path.
+ * @param out Output vector (cleared and filled).
+ * @return Status (eOk on success).
+ */
+[[nodiscard]] Status readFile(const IFileSystem& fs, const std::string& path, std::vector<uint8_t>& out);
+
+/**
+ * @brief Read a text header terminated by the first blank line (IFile counterpart of
+ * binaryio::readHeaderUntilBlankLine).
+ * @param file Open file.
+ * @param header_text Output: header bytes up to and including the blank line (or the whole file if none).
+ * @param data_offset Output: offset of the first byte after the blank line.
+ * @return Status (eOk when a blank line was found, eDataTruncated otherwise).
+ */
+[[nodiscard]] Status readHeaderUntilBlankLine(const IFile& file, std::string& header_text, size_t& data_offset);
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,71 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file memory_file_system.h
+ * @brief IFileSystem over byte buffers held in memory.
+ */
+
+/**
+ * @class MemoryFileSystem
+ * @brief Thread-safe map of virtual path -> file contents.
+ *
+ * Open handles share the buffer they were opened on, so replacing or removing a
+ * file does not invalidate loads already in flight. Each addFile() bumps the
+ * file's modification stamp.
+ */
+class MemoryFileSystem final : public IFileSystem {
+   public:
+    MemoryFileSystem() = default;
+
+    /**
+     * @brief Add or replace a file.
+     * @param path Virtual path (normalized with normalizeVirtualPath()).
+     * @param bytes File contents.
+     */
+    void addFile(const std::string& path, std::vector<uint8_t> bytes);
+    /** @brief Add or replace a file with text contents. */
+    void addFile(const std::string& path, const std::string& text);
+    /** @brief Remove a file; returns false if it did not exist. */
+    bool removeFile(const std::string& path);
+    /** @brief Number of files. */
+    [[nodiscard]] size_t fileCount() const;
+
+    [[nodiscard]] bool exists(const std::string& path) const override;
+    [[nodiscard]] Status stat(const std::string& path, FileInfo& out) const override;
+    [[nodiscard]] Status openFile(const std::string& path, std::unique_ptr<IFile>& out) const override;
+
+   private:
+    struct Entry {
+        std::shared_ptr<const std::vector<uint8_t>> bytes;
+        int64_t modified_time = 0;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Entry> files_;
+    int64_t generation_ = 0;
+};
+
+}  // namespace io
+}  // namespace vne
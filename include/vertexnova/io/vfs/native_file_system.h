@@ -0,0 +1,57 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <string>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file native_file_system.h
+ * @brief IFileSystem over the OS file system.
+ */
+
+/**
+ * @class NativeFileSystem
+ * @brief Files on disk, optionally below a root directory.
+ *
+ * Paths are passed to the OS as given (joined to the root when one is set). Reads
+ * use pread() where available, so handles need no locking.
+ */
+class NativeFileSystem final : public IFileSystem {
+   public:
+    /**
+     * @brief Construct.
+     * @param root Directory relative paths are resolved against (empty = process working directory).
+     */
+    explicit NativeFileSystem(std::string root = {});
+
+    [[nodiscard]] bool exists(const std::string& path) const override;
+    [[nodiscard]] Status stat(const std::string& path, FileInfo& out) const override;
+    [[nodiscard]] Status openFile(const std::string& path, std::unique_ptr<IFile>& out) const override;
+
+    /** @brief Root directory (empty if none). */
+    [[nodiscard]] const std::string& root() const { return root_; }
+
+   private:
+    [[nodiscard]] std::string resolve(const std::string& path) const;
+
+    std::string root_;
+};
+
+/** @brief Process-wide NativeFileSystem without a root (for resolving OS paths through IFileSystem APIs). */
+[[nodiscard]] const NativeFileSystem& nativeFileSystem();
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,136 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+/**
+ * @file pack_file_system.h
+ * @brief Read-only IFileSystem over a single pack (archive) file, and the writer that builds one.
+ *
+ * Pack layout (little-endian):
+ * @code
+ *   header  : "VNEPACK\0" | u32 version (2) | u32 entry_count | u64 toc_offset | u32 alignment | u32 reserved
+ *   payload : file contents, each starting at a multiple of alignment
+ *   toc     : entry_count x { u64 path_hash | u64 offset | u64 size | u32 path_offset | u32 path_length }
+ *             sorted by (path_hash, path), followed by the path bytes (path_offset is relative to them)
+ * @endcode
+ * Paths are normalized virtual paths and path_hash is their 64-bit FNV-1a hash.
+ */
+
+/** URI prefix that AssetIO resolves through the pack installed with AssetIO::mountPack(). */
+inline constexpr std::string_view kPackUriScheme = "pack://";
+
+/** Default payload alignment of PackWriter (a cache line; keeps mapped arrays SIMD-aligned). */
+constexpr uint32_t kPackDefaultAlignment = 64;
+
+/**
+ * @class PackFileSystem
+ * @brief Serves every file of a pack from one memory mapping.
+ *
+ * open() maps the pack and validates its table of contents once without copying it;
+ * afterwards opening a file is a binary search over the mapped, hash-sorted table with
+ * no system call or allocation, and IFile::contents() points straight into the mapping.
+ * The mapping stays alive while any handle or contents() pointer does.
+ */
+class PackFileSystem final : public IFileSystem {
+   public:
+    PackFileSystem() = default;
+
+    /**
+     * @brief Map a pack file and validate its table of contents (replaces any previously opened pack).
+     * @param pack_path Path of the pack on disk.
+     * @return Status (eDataCorrupt if the header or table of contents is invalid,
+     *         eUnsupportedFormat for another pack version).
+     */
+    [[nodiscard]] Status open(const std::string& pack_path);
+
+    /** @brief True after a successful open(). */
+    [[nodiscard]] bool isOpen() const { return mapping_ != nullptr; }
+    /** @brief Number of files in the pack. */
+    [[nodiscard]] size_t fileCount() const { return entry_count_; }
+
+    [[nodiscard]] bool exists(const std::string& path) const override;
+    [[nodiscard]] Status stat(const std::string& path, FileInfo& out) const override;
+    [[nodiscard]] Status openFile(const std::string& path, std::unique_ptr<IFile>& out) const override;
+
+   private:
+    struct Entry {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    [[nodiscard]] std::optional<Entry> findEntry(const std::string& path) const;
+
+    std::shared_ptr<const binaryio::MappedFile> mapping_;
+    const uint8_t* toc_ = nullptr;    //!< First table of contents record (inside the mapping).
+    const uint8_t* paths_ = nullptr;  //!< Path bytes following the records.
+    size_t paths_size_ = 0;
+    uint32_t entry_count_ = 0;
+    std::string pack_path_;
+    int64_t modified_time_ = 0;
+};
+
+/**
+ * @class PackWriter
+ * @brief Collects files and writes them as a pack readable by PackFileSystem.
+ *
+ * Payloads are written in the order they were added. To ship pre-cooked assets, add
+ * CookCache::encode() output under a ".vnecook" path (loaded by the cooked asset loaders).
+ */
+class PackWriter {
+   public:
+    /**
+     * @brief Add a file from disk; it is read when write() runs.
+     * @param virtual_path Path inside the pack.
+     * @param source_path Path of the file on disk.
+     */
+    void addFile(const std::string& virtual_path, const std::string& source_path);
+    /** @brief Add a file from memory. */
+    void addBytes(const std::string& virtual_path, std::vector<uint8_t> bytes);
+
+    /**
+     * @brief Set the payload alignment (default kPackDefaultAlignment).
+     * @param alignment Power of two; use binaryio::kDirectIoAlignment for page-aligned payloads.
+     */
+    void setAlignment(uint32_t alignment) { alignment_ = alignment; }
+
+    /**
+     * @brief Write the pack.
+     * @param pack_path Output path.
+     * @return Status (eInvalidArgument on duplicate virtual paths or a bad alignment; IO errors otherwise).
+     */
+    [[nodiscard]] Status write(const std::string& pack_path) const;
+
+   private:
+    struct Source {
+        std::string virtual_path;
+        std::string source_path;     //!< Read from disk when non-empty.
+        std::vector<uint8_t> bytes;  //!< Used when source_path is empty.
+    };
+
+    std::vector<Source> sources_;
+    uint32_t alignment_ = kPackDefaultAlignment;
+};
+
+}  // namespace io
+}  // namespace vne
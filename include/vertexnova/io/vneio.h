@@ -15,19 +15,43 @@
  * @brief Umbrella header for VneIo: mesh, image, volume, DICOM, and asset IO.
  */
 
-// Common (Status, BinaryIO)
+// Common (Status, BinaryIO, worker pool)
 #include "vertexnova/io/common/status.h"
 #include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/codec.h"
+#include "vertexnova/io/common/thread_pool.h"
+#include "vertexnova/io/common/completion_queue.h"
+#include "vertexnova/io/common/single_flight.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/cancellation.h"
+#include "vertexnova/io/common/trace.h"
+
+// Virtual file system (native, in-memory and pack-file backends)
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/native_file_system.h"
+#include "vertexnova/io/vfs/memory_file_system.h"
+#include "vertexnova/io/vfs/pack_file_system.h"
 
 // Asset io (LoadRequest, registry, loader interfaces)
 #include "vertexnova/io/load_request.h"
+#include "vertexnova/io/load_handle.h"
 #include "vertexnova/io/asset_loader.h"
+#include "vertexnova/io/asset_cache.h"
+#include "vertexnova/io/cook_cache.h"
+#include "vertexnova/io/cooked_asset_loader.h"
 #include "vertexnova/io/asset_io.h"
+#include "vertexnova/io/asset_watcher.h"
+#include "vertexnova/io/shared_asset.h"
 
 // Mesh (requires Assimp when building)
 #include "vertexnova/io/mesh/mesh.h"
 #include "vertexnova/io/mesh/mesh_loader.h"
 #include "vertexnova/io/mesh/assimp_loader.h"
+#include "vertexnova/io/mesh/stl_loader.h"
+#include "vertexnova/io/mesh/obj_loader.h"
+#include "vertexnova/io/mesh/ply_loader.h"
+#include "vertexnova/io/mesh/gltf_loader.h"
+#include "vertexnova/io/mesh/vnemesh_loader.h"
 #include "vertexnova/io/mesh/mesh_loader_registry.h"
 #include "vertexnova/io/mesh/mesh_exporter.h"
 
@@ -0,0 +1,148 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/asset_cache.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <filesystem>
+#include <system_error>
+
+namespace vne {
+namespace io {
+
+size_t assetByteSize(const vne::image::Image& image) {
+    return static_cast<size_t>(image.getWidth()) * static_cast<size_t>(image.getHeight())
+           * static_cast<size_t>(image.getChannels());
+}
+
+size_t assetByteSize(const vne::mesh::Mesh& mesh) {
+    return mesh.vertices.size() * sizeof(vne::mesh::VertexAttributes) + mesh.indices.size() * sizeof(uint32_t);
+}
+
+size_t assetByteSize(const vne::image::Volume& volume) {
+    return volume.byteCount();
+}
+
+AssetCache::AssetCache(size_t byte_budget)
+    : byte_budget_(byte_budget) {}
+
+std::optional<std::string> AssetCache::makeKey(const LoadRequest& request) {
+    // Buffer loads have no stable identity (the caller may reuse the memory), and assets allocated from a
+    // caller's memory_resource die with it (e.g. a frame arena), so neither is ever cached.
+    if (request.uri.empty() || !request.buffer.empty() || request.memory_resource) {
+        return std::nullopt;
+    }
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    if (request.file_system) {
+        FileInfo info;
+        if (!request.file_system->stat(request.uri, info).ok()) {
+            return std::nullopt;
+        }
+        size = info.size;
+        mtime = info.modified_time;
+    } else {
+        std::error_code ec;
+        size = static_cast<uint64_t>(std::filesystem::file_size(request.uri, ec));
+        if (ec) {
+            return std::nullopt;
+        }
+        const auto write_time = std::filesystem::last_write_time(request.uri, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        mtime = static_cast<int64_t>(write_time.time_since_epoch().count());
+    }
+
+    std::string key;
+    key.reserve(request.uri.size() + request.hint_format.size() + 64);
+    key += std::to_string(static_cast<int>(request.asset_type));
+    key += '|';
+    key += request.uri;
+    key += '|';
+    key += std::to_string(size);
+    key += '|';
+    key += std::to_string(mtime);
+    key += '|';
+    // The same uri names different files in different file systems.
+    key += std::to_string(reinterpret_cast<uintptr_t>(request.file_system));
+    key += '|';
+    key += request.hint_format;
+    key += '|';
+    key += request.generate_mips ? '1' : '0';
+    key += request.force_srgb ? '1' : '0';
+    key += request.prefer_16bit ? '1' : '0';
+    key += request.memory_map ? '1' : '0';
+    key += request.direct_io ? '1' : '0';
+    return key;
+}
+
+std::optional<AssetCache::Value> AssetCache::findValue(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        ++misses_;
+        return std::nullopt;
+    }
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->value;
+}
+
+AssetCache::Value AssetCache::insertValue(const std::string& key, Value value, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->value;
+    }
+    if (bytes > byte_budget_) {
+        return value;
+    }
+    evictToFit(bytes);
+    lru_.push_front(Entry{key, value, bytes});
+    index_.emplace(key, lru_.begin());
+    bytes_in_use_ += bytes;
+    return value;
+}
+
+void AssetCache::evictToFit(size_t incoming_bytes) {
+    while (!lru_.empty() && bytes_in_use_ + incoming_bytes > byte_budget_) {
+        const Entry& victim = lru_.back();
+        bytes_in_use_ -= victim.bytes;
+        index_.erase(victim.key);
+        lru_.pop_back();
+        ++evictions_;
+    }
+}
+
+void AssetCache::setByteBudget(size_t byte_budget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    byte_budget_ = byte_budget;
+    evictToFit(0);
+}
+
+void AssetCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    index_.clear();
+    bytes_in_use_ = 0;
+}
+
+AssetCacheStats AssetCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AssetCacheStats stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    stats.entry_count = lru_.size();
+    stats.bytes_in_use = bytes_in_use_;
+    stats.byte_budget = byte_budget_;
+    return stats;
+}
+
+}  // namespace io
+}  // namespace vne
@@ -5,113 +5,573 @@
  */
 
 #include "vertexnova/io/asset_io.h"
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/format_detect.h"
 #include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <latch>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <vector>
 
 namespace vne {
 namespace io {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int poolPriority(LoadPriority priority) {
+    return static_cast<int>(priority) - static_cast<int>(LoadPriority::eNormal);
+}
+
+template<typename T>
+LoadResult<Asset> toAssetResult(LoadResult<T>&& typed) {
+    LoadResult<Asset> result;
+    result.status = std::move(typed.status);
+    if (result.status.ok()) {
+        result.value = std::move(typed.value);
+    }
+    return result;
+}
+
+}  // namespace
+
+AssetIO::AssetIO(uint32_t worker_count)
+    : worker_count_(worker_count) {}
+
+AssetIO::~AssetIO() {
+    // Join workers first: queued loads still reference the registered loaders.
+    pool_.reset();
+}
+
 void AssetIO::registerImageLoader(std::unique_ptr<vne::image::IImageLoader> loader) {
     if (loader) {
+        image_index_.add(image_loaders_.size(), loader->supportedExtensions());
         image_loaders_.push_back(std::move(loader));
     }
 }
 
 void AssetIO::registerMeshLoader(std::unique_ptr<vne::mesh::IMeshLoader> loader) {
     if (loader) {
+        mesh_index_.add(mesh_loaders_.size(), loader->supportedExtensions());
         mesh_loaders_.push_back(std::move(loader));
     }
 }
 
 void AssetIO::registerVolumeLoader(std::unique_ptr<vne::image::IVolumeLoader> loader) {
     if (loader) {
+        volume_index_.add(volume_loaders_.size(), loader->supportedExtensions());
         volume_loaders_.push_back(std::move(loader));
     }
 }
 
 void AssetIO::registerDicomLoader(std::unique_ptr<vne::dicom::IDicomLoader> loader) {
     if (loader) {
+        dicom_index_.add(dicom_loaders_.size(), loader->supportedExtensions());
         dicom_loaders_.push_back(std::move(loader));
     }
 }
 
-LoadResult<vne::image::Image> AssetIO::loadImage(const LoadRequest& request) {
-    LoadResult<vne::image::Image> result;
-    for (const auto& loader : image_loaders_) {
-        if (loader->canLoad(request)) {
-            result = loader->loadImage(request);
-            if (result.ok()) {
-                return result;
-            }
+void AssetIO::LoaderIndex::add(size_t position, const std::vector<std::string>& extensions) {
+    if (extensions.empty()) {
+        fallback.push_back(position);
+        return;
+    }
+    for (const std::string& extension : extensions) {
+        std::vector<size_t>& positions = by_format[normalizeFormat(extension)];
+        if (positions.empty() || positions.back() != position) {
+            positions.push_back(position);
         }
     }
-    if (!result.status.ok()) {
-        return result;
+}
+
+const std::vector<size_t>* AssetIO::LoaderIndex::find(const std::string& format) const {
+    if (format.empty()) {
+        return nullptr;
     }
-    result.status = Status::make(ErrorCode::eUnsupportedFormat,
-                                 "No image loader could load: " + request.uri,
-                                 request.uri,
-                                 "AssetIO");
-    return result;
+    auto it = by_format.find(format);
+    return it != by_format.end() ? &it->second : nullptr;
 }
 
-LoadResult<vne::mesh::Mesh> AssetIO::loadMesh(const LoadRequest& request) {
-    LoadResult<vne::mesh::Mesh> result;
-    for (const auto& loader : mesh_loaders_) {
-        if (loader->canLoad(request)) {
-            result = loader->loadMesh(request);
-            if (result.ok()) {
-                return result;
+template<typename Loader>
+std::vector<size_t> AssetIO::candidateLoaders(const std::vector<std::unique_ptr<Loader>>& loaders,
+                                              const LoaderIndex& index,
+                                              const LoadRequest& request,
+                                              const std::string& format) {
+    // Merge the indexed loaders with accepting fallback loaders, keeping registration order.
+    static const std::vector<size_t> kNone;
+    const std::vector<size_t>* indexed = index.find(format);
+    const std::vector<size_t>& matched = indexed ? *indexed : kNone;
+    std::vector<size_t> candidates;
+    candidates.reserve(matched.size() + index.fallback.size());
+    size_t m = 0;
+    for (const size_t position : index.fallback) {
+        while (m < matched.size() && matched[m] < position) {
+            candidates.push_back(matched[m++]);
+        }
+        if (loaders[position]->canLoad(request)) {
+            candidates.push_back(position);
+        }
+    }
+    candidates.insert(candidates.end(), matched.begin() + static_cast<std::ptrdiff_t>(m), matched.end());
+    return candidates;
+}
+
+template<typename Loader>
+int AssetIO::selectLoader(const std::vector<std::unique_ptr<Loader>>& loaders,
+                          const LoaderIndex& index,
+                          const LoadRequest& request) {
+    const std::vector<size_t> candidates = candidateLoaders(loaders, index, request, requestFormat(request));
+    if (!candidates.empty()) {
+        return static_cast<int>(candidates.front());
+    }
+    if (request.hint_format.empty()) {
+        if (const std::vector<size_t>* sniffed = index.find(sniffRequestFormat(request))) {
+            return static_cast<int>(sniffed->front());
+        }
+    }
+    return -1;
+}
+
+template<typename T, typename Loader, typename LoadFnT>
+LoadResult<T> AssetIO::dispatchLoad(const std::vector<std::unique_ptr<Loader>>& loaders,
+                                    const LoaderIndex& index,
+                                    const LoadRequest& request,
+                                    const char* kind,
+                                    LoadFnT load) {
+    VNEIO_TRACE_SPAN("AssetIO::load");
+    LoadResult<T> result;
+    // Requests cancelled while queued never reach a loader; a cancelled load is not retried elsewhere.
+    if (request.cancel_token.isCancelled()) {
+        result.status = Status::make(ErrorCode::eCancelled, "Load cancelled", request.uri, "AssetIO");
+        return result;
+    }
+    const std::string format = requestFormat(request);
+    const std::vector<size_t> candidates = candidateLoaders(loaders, index, request, format);
+    // Successful results are returned as constructed (not assigned), so assets keep the
+    // memory resource the loader allocated them from.
+    for (const size_t position : candidates) {
+        LoadResult<T> attempt = load(*loaders[position], request);
+        if (attempt.ok() || attempt.status.code == ErrorCode::eCancelled) {
+            return attempt;
+        }
+        result.status = std::move(attempt.status);
+    }
+
+    // Missing, unknown or wrong extension: identify the file by its leading bytes.
+    // An explicit hint_format is trusted as given.
+    if (request.hint_format.empty()) {
+        std::string sniffed;
+        {
+            VNEIO_TRACE_SPAN("AssetIO::sniff");
+            sniffed = sniffRequestFormat(request);
+        }
+        const std::vector<size_t>* positions = sniffed != format ? index.find(sniffed) : nullptr;
+        if (positions) {
+            for (const size_t position : *positions) {
+                if (std::find(candidates.begin(), candidates.end(), position) != candidates.end()) {
+                    continue;
+                }
+                LoadResult<T> attempt = load(*loaders[position], request);
+                if (attempt.ok() || attempt.status.code == ErrorCode::eCancelled) {
+                    return attempt;
+                }
+                result.status = std::move(attempt.status);
             }
         }
     }
+
     if (!result.status.ok()) {
         return result;
     }
     result.status = Status::make(ErrorCode::eUnsupportedFormat,
-                                 "No mesh loader could load: " + request.uri,
+                                 std::string("No ") + kind + " loader could load: " + request.uri,
                                  request.uri,
                                  "AssetIO");
     return result;
 }
 
-LoadResult<vne::image::Volume> AssetIO::loadVolume(const LoadRequest& request) {
-    LoadResult<vne::image::Volume> result;
-    for (const auto& loader : volume_loaders_) {
-        if (loader->canLoad(request)) {
-            result = loader->loadVolume(request);
-            if (result.ok()) {
-                return result;
+namespace {
+
+/** Wraps a loader call: restore the cook cache blob of (request, loader) if present, else load and store it. */
+template<typename T, typename LoadFnT>
+auto withCookCache(CookCache* cook, LoadFnT load) {
+    return [cook, load](auto& loader, const LoadRequest& request) -> LoadResult<T> {
+        const std::optional<std::string> key =
+            cook ? CookCache::makeKey(request, loader.optionsKey()) : std::optional<std::string>{};
+        if (!key) {
+            return load(loader, request);
+        }
+        // Record the files the loader reads besides the source, so the blob is checked against them.
+        std::vector<std::string> dependencies;
+        LoadRequest recorded = request;
+        if (!recorded.dependencies) {
+            recorded.dependencies = &dependencies;
+        }
+        LoadResult<T> cooked{T(assetMemoryResource(request))};
+        if (cook->load(*key, cooked.value, &recorded)) {
+            if constexpr (std::is_same_v<T, vne::mesh::Mesh>) {
+                cooked.value.name = request.uri;  // as the loaders name it; the blob may come from a copy elsewhere
             }
+            return cooked;
+        }
+        LoadResult<T> result = load(loader, recorded);
+        if (result.ok()) {
+            (void)cook->store(*key, result.value, &recorded);
         }
-    }
-    if (!result.status.ok()) {
         return result;
+    };
+}
+
+}  // namespace
+
+template<typename T>
+LoadResult<T> AssetIO::dispatch(const LoadRequest& request) {
+    CookCache* cook = cook_cache_.get();
+    if constexpr (std::is_same_v<T, vne::image::Image>) {
+        auto load = withCookCache<T>(
+            cook, [](vne::image::IImageLoader& loader, const LoadRequest& req) { return loader.loadImage(req); });
+        return dispatchLoad<T>(image_loaders_, image_index_, request, "image", load);
+    } else if constexpr (std::is_same_v<T, vne::mesh::Mesh>) {
+        auto load = withCookCache<T>(
+            cook, [](vne::mesh::IMeshLoader& loader, const LoadRequest& req) { return loader.loadMesh(req); });
+        return dispatchLoad<T>(mesh_loaders_, mesh_index_, request, "mesh", load);
+    } else if constexpr (std::is_same_v<T, vne::image::Volume>) {
+        auto load = withCookCache<T>(
+            cook, [](vne::image::IVolumeLoader& loader, const LoadRequest& req) { return loader.loadVolume(req); });
+        return dispatchLoad<T>(volume_loaders_, volume_index_, request, "volume", load);
+    } else {
+        static_assert(std::is_same_v<T, vne::dicom::DicomSeries>);
+        auto load = [](vne::dicom::IDicomLoader& loader, const LoadRequest& req) {
+            return loader.loadDicomSeries(req);
+        };
+        return dispatchLoad<T>(dicom_loaders_, dicom_index_, request, "DICOM", load);
     }
-    result.status = Status::make(ErrorCode::eUnsupportedFormat,
-                                 "No volume loader could load: " + request.uri,
-                                 request.uri,
-                                 "AssetIO");
-    return result;
+}
+
+template<typename T>
+LoadResult<T> AssetIO::load(const LoadRequest& request) {
+    const LoadRequest routed = route(request);
+    if (const std::optional<std::string> key = coalescingKey(routed)) {
+        return flights_.run<LoadResult<T>>(*key, [this, &routed] { return dispatch<T>(routed); });
+    }
+    return dispatch<T>(routed);
+}
+
+std::optional<std::string> AssetIO::coalescingKey(const LoadRequest& request) const {
+    // A shared load reports to one token, callback and dependency list and allocates from one resource.
+    if (!coalescing_.load(std::memory_order_relaxed) || !request.buffer.empty() || request.cancel_token.valid()
+        || request.on_progress || request.memory_resource || request.dependencies) {
+        return std::nullopt;
+    }
+    return AssetCache::makeKey(request);
+}
+
+LoadResult<vne::image::Image> AssetIO::loadImage(const LoadRequest& request) {
+    return load<vne::image::Image>(request);
+}
+
+LoadResult<vne::mesh::Mesh> AssetIO::loadMesh(const LoadRequest& request) {
+    return load<vne::mesh::Mesh>(request);
+}
+
+LoadResult<vne::image::Volume> AssetIO::loadVolume(const LoadRequest& request) {
+    return load<vne::image::Volume>(request);
 }
 
 LoadResult<vne::dicom::DicomSeries> AssetIO::loadDicomSeries(const LoadRequest& request) {
-    LoadResult<vne::dicom::DicomSeries> result;
-    for (const auto& loader : dicom_loaders_) {
-        if (loader->canLoad(request)) {
-            result = loader->loadDicomSeries(request);
-            if (result.ok()) {
-                return result;
+    return load<vne::dicom::DicomSeries>(request);
+}
+
+LoadResult<Asset> AssetIO::loadAsset(const LoadRequest& request) {
+    switch (request.asset_type) {
+        case AssetType::eImage:
+            return toAssetResult(loadImage(request));
+        case AssetType::eMesh:
+            return toAssetResult(loadMesh(request));
+        case AssetType::eVolume:
+            return toAssetResult(loadVolume(request));
+        case AssetType::eDicomSeries:
+            return toAssetResult(loadDicomSeries(request));
+    }
+    LoadResult<Asset> result;
+    result.status = Status::make(ErrorCode::eInvalidArgument, "Unknown asset type", request.uri, "AssetIO");
+    return result;
+}
+
+BatchLoadResult AssetIO::loadBatch(std::span<const LoadRequest> requests) {
+    VNEIO_TRACE_SPAN("AssetIO::loadBatch");
+    BatchLoadResult batch;
+    const size_t count = requests.size();
+    batch.results.resize(count);
+    batch.item_seconds.resize(count, 0.0);
+    if (count == 0) {
+        return batch;
+    }
+
+    const Clock::time_point batch_start = Clock::now();
+
+    // Group by (asset type, loader); inside a group, largest files first so long loads start early.
+    struct Item {
+        size_t index = 0;
+        uintmax_t file_size = 0;
+    };
+    std::map<std::pair<int, int>, std::vector<Item>> groups;
+    for (size_t i = 0; i < count; ++i) {
+        const LoadRequest request = route(requests[i]);
+        uintmax_t size = 0;
+        if (!request.buffer.empty()) {
+            size = request.buffer.size();
+        } else if (request.file_system) {
+            FileInfo info;
+            size = request.file_system->stat(request.uri, info).ok() ? info.size : 0;
+        } else {
+            std::error_code ec;
+            size = std::filesystem::file_size(request.uri, ec);
+            size = ec ? 0 : size;
+        }
+        groups[{static_cast<int>(request.asset_type), findLoaderIndex(request)}].push_back({i, size});
+    }
+    for (auto& [key, items] : groups) {
+        std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+            return a.file_size > b.file_size;
+        });
+    }
+
+    // Interleave groups round-robin so a slow or serialized loader does not occupy every worker.
+    std::vector<size_t> order;
+    order.reserve(count);
+    for (size_t round = 0; order.size() < count; ++round) {
+        for (const auto& [key, items] : groups) {
+            if (round < items.size()) {
+                order.push_back(items[round].index);
             }
         }
     }
-    if (!result.status.ok()) {
+
+    std::latch done(static_cast<std::ptrdiff_t>(count));
+    ThreadPool& pool = workerPool();
+    // Within a priority the pool keeps this order; higher-priority or earlier-deadline items run first.
+    for (const size_t index : order) {
+        auto task = [this, &batch, &done, &requests, index]() {
+            const Clock::time_point start = Clock::now();
+            try {
+                batch.results[index] = loadAsset(requests[index]);
+            } catch (const std::exception& e) {
+                batch.results[index].value = std::monostate{};
+                batch.results[index].status =
+                    Status::make(ErrorCode::eUnknown, e.what(), requests[index].uri, "AssetIO");
+            }
+            batch.item_seconds[index] = std::chrono::duration<double>(Clock::now() - start).count();
+            done.count_down();
+        };
+        pool.submit(std::move(task), poolPriority(requests[index].priority), requests[index].deadline);
+    }
+
+    // Workers pick items in queue order; read ahead the rest meanwhile (OS paths only).
+    for (const size_t index : order) {
+        const LoadRequest& request = requests[index];
+        if (!request.uri.empty() && request.buffer.empty() && !request.file_system && !file_system_) {
+            binaryio::adviseWillNeed(request.uri);
+        }
+    }
+
+    done.wait();
+
+    batch.stats.wall_seconds = std::chrono::duration<double>(Clock::now() - batch_start).count();
+    for (size_t i = 0; i < count; ++i) {
+        batch.stats.summed_item_seconds += batch.item_seconds[i];
+        if (batch.results[i].ok()) {
+            ++batch.stats.succeeded;
+        } else {
+            ++batch.stats.failed;
+        }
+    }
+    return batch;
+}
+
+LoadResult<std::shared_ptr<const vne::image::Image>> AssetIO::loadImageShared(const LoadRequest& request) {
+    return loadShared<vne::image::Image>(request);
+}
+
+LoadResult<std::shared_ptr<const vne::mesh::Mesh>> AssetIO::loadMeshShared(const LoadRequest& request) {
+    return loadShared<vne::mesh::Mesh>(request);
+}
+
+LoadResult<std::shared_ptr<const vne::image::Volume>> AssetIO::loadVolumeShared(const LoadRequest& request) {
+    return loadShared<vne::image::Volume>(request);
+}
+
+void AssetIO::setCacheBudget(size_t byte_budget) {
+    cache_.setByteBudget(byte_budget);
+}
+
+void AssetIO::clearCache() {
+    cache_.clear();
+}
+
+AssetCacheStats AssetIO::cacheStats() const {
+    return cache_.stats();
+}
+
+void AssetIO::setLoadCoalescing(bool enabled) {
+    coalescing_.store(enabled, std::memory_order_relaxed);
+}
+
+SingleFlightStats AssetIO::coalescingStats() const {
+    return flights_.stats();
+}
+
+void AssetIO::setCookCacheDirectory(const std::string& directory) {
+    cook_cache_ = directory.empty() ? nullptr : std::make_unique<CookCache>(directory);
+}
+
+CookCacheStats AssetIO::cookCacheStats() const {
+    return cook_cache_ ? cook_cache_->stats() : CookCacheStats{};
+}
+
+template<typename T>
+LoadResult<std::shared_ptr<const T>> AssetIO::loadShared(const LoadRequest& request) {
+    using SharedResult = LoadResult<std::shared_ptr<const T>>;
+    const LoadRequest routed = route(request);
+    const bool cached = cache_.stats().byte_budget > 0;
+    const std::optional<std::string> flight_key = coalescingKey(routed);
+    std::optional<std::string> key = flight_key;
+    if (!key && cached) {
+        key = AssetCache::makeKey(routed);
+    }
+    if (cached && key) {
+        if (std::shared_ptr<const T> hit = cache_.find<T>(*key)) {
+            SharedResult result;
+            result.value = std::move(hit);
+            return result;
+        }
+    }
+
+    auto load_and_insert = [this, &routed, &key, cached]() {
+        SharedResult result;
+        LoadResult<T> loaded = dispatch<T>(routed);
+        result.status = std::move(loaded.status);
+        if (!result.status.ok()) {
+            return result;
+        }
+        auto asset = std::make_shared<const T>(std::move(loaded.value));
+        result.value = cached && key ? cache_.insert<T>(*key, std::move(asset)) : std::move(asset);
         return result;
+    };
+    // Concurrent misses share one load, and so one asset instance.
+    if (flight_key) {
+        return flights_.run<SharedResult>(*flight_key, load_and_insert);
+    }
+    return load_and_insert();
+}
+
+void AssetIO::setFileSystem(std::shared_ptr<const IFileSystem> file_system) {
+    file_system_ = std::move(file_system);
+}
+
+void AssetIO::mountPack(std::shared_ptr<const PackFileSystem> pack) {
+    pack_ = std::move(pack);
+}
+
+LoadRequest AssetIO::route(const LoadRequest& request) const {
+    LoadRequest routed = request;
+    if (routed.uri.starts_with(kPackUriScheme)) {
+        // Without a mounted pack the uri resolves in an empty one, never as an OS path.
+        static const PackFileSystem kNoPack;
+        routed.uri.erase(0, kPackUriScheme.size());
+        routed.file_system = pack_ ? pack_.get() : &kNoPack;
+    } else if (!routed.file_system) {
+        routed.file_system = file_system_.get();
+    }
+    return routed;
+}
+
+int AssetIO::findLoaderIndex(const LoadRequest& request) const {
+    switch (request.asset_type) {
+        case AssetType::eImage:
+            return selectLoader(image_loaders_, image_index_, request);
+        case AssetType::eMesh:
+            return selectLoader(mesh_loaders_, mesh_index_, request);
+        case AssetType::eVolume:
+            return selectLoader(volume_loaders_, volume_index_, request);
+        case AssetType::eDicomSeries:
+            return selectLoader(dicom_loaders_, dicom_index_, request);
+    }
+    return -1;
+}
+
+ThreadPool& AssetIO::workerPool() {
+    std::call_once(pool_once_, [this] { pool_ = std::make_unique<ThreadPool>(worker_count_); });
+    return *pool_;
+}
+
+template<typename T>
+LoadHandle<T> AssetIO::submitLoad(LoadFn<T> load_fn, const LoadRequest& request, LoadCallback<T> on_complete) {
+    auto promise = std::make_shared<std::promise<LoadResult<T>>>();
+    std::shared_future<LoadResult<T>> future = promise->get_future().share();
+
+    auto task = [this, load_fn, request, promise, future, on_complete = std::move(on_complete)]() {
+        // Construct (rather than assign) the stored result so the asset keeps its memory resource.
+        auto run = [this, load_fn, &request]() -> LoadResult<T> {
+            try {
+                return (this->*load_fn)(request);
+            } catch (const std::exception& e) {
+                LoadResult<T> failed;
+                failed.status = Status::make(ErrorCode::eUnknown, e.what(), request.uri, "AssetIO");
+                return failed;
+            }
+        };
+        promise->set_value(run());
+        if (on_complete) {
+            completions_.push([on_complete, future]() { on_complete(future.get()); });
+        }
+    };
+    const ThreadPool::TaskId id =
+        workerPool().submit(std::move(task), poolPriority(request.priority), request.deadline);
+    return LoadHandle<T>(std::move(future), id);
+}
+
+LoadHandle<vne::image::Image> AssetIO::loadImageAsync(const LoadRequest& request,
+                                                      LoadCallback<vne::image::Image> on_complete) {
+    return submitLoad<vne::image::Image>(&AssetIO::loadImage, request, std::move(on_complete));
+}
+
+LoadHandle<vne::mesh::Mesh> AssetIO::loadMeshAsync(const LoadRequest& request,
+                                                   LoadCallback<vne::mesh::Mesh> on_complete) {
+    return submitLoad<vne::mesh::Mesh>(&AssetIO::loadMesh, request, std::move(on_complete));
+}
+
+LoadHandle<vne::image::Volume> AssetIO::loadVolumeAsync(const LoadRequest& request,
+                                                        LoadCallback<vne::image::Volume> on_complete) {
+    return submitLoad<vne::image::Volume>(&AssetIO::loadVolume, request, std::move(on_complete));
+}
+
+LoadHandle<vne::dicom::DicomSeries> AssetIO::loadDicomSeriesAsync(const LoadRequest& request,
+                                                                  LoadCallback<vne::dicom::DicomSeries> on_complete) {
+    return submitLoad<vne::dicom::DicomSeries>(&AssetIO::loadDicomSeries, request, std::move(on_complete));
+}
+
+size_t AssetIO::pollCompletions(size_t max_callbacks) {
+    return completions_.drain(max_callbacks);
+}
+
+bool AssetIO::reprioritize(uint64_t task_id, LoadPriority priority) {
+    return pool_ && task_id != ThreadPool::kInvalidTaskId && pool_->reprioritize(task_id, poolPriority(priority));
+}
+
+void AssetIO::waitIdle() {
+    if (pool_) {
+        pool_->waitIdle();
     }
-    result.status = Status::make(ErrorCode::eUnsupportedFormat,
-                                 "No DICOM loader could load: " + request.uri,
-                                 request.uri,
-                                 "AssetIO");
-    return result;
 }
 
 }  // namespace io
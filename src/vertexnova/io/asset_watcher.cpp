@@ -0,0 +1,294 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/asset_watcher.h"
+#include "vertexnova/io/common/trace.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#define VNEIO_HAS_INOTIFY 1
+#endif
+
+namespace vne {
+namespace io {
+
+namespace {
+
+#if defined(VNEIO_HAS_INOTIFY)
+// Saves land as a write-and-close in place or as a rename over the original.
+constexpr uint32_t kWatchMask = IN_CLOSE_WRITE | IN_MOVED_TO;
+constexpr size_t kEventBufferBytes = 16 * 1024;
+#endif
+
+}  // namespace
+
+AssetWatcher::AssetWatcher(AssetIO& io, std::chrono::milliseconds debounce)
+    : io_(io)
+    , debounce_(debounce) {
+#if defined(VNEIO_HAS_INOTIFY)
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inotify_fd_ >= 0 && wake_fd_ >= 0) {
+        thread_ = std::thread([this] { run(); });
+    }
+#endif
+}
+
+AssetWatcher::~AssetWatcher() {
+    stop_.store(true, std::memory_order_relaxed);
+#if defined(VNEIO_HAS_INOTIFY)
+    if (wake_fd_ >= 0) {
+        const uint64_t one = 1;
+        (void)!write(wake_fd_, &one, sizeof(one));
+    }
+#endif
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    for (auto& [id, watch] : watches_) {
+        watch.delivery->active.store(false, std::memory_order_relaxed);
+        watch.running.cancel();
+    }
+#if defined(VNEIO_HAS_INOTIFY)
+    if (inotify_fd_ >= 0) {
+        close(inotify_fd_);
+    }
+    if (wake_fd_ >= 0) {
+        close(wake_fd_);
+    }
+#endif
+}
+
+bool AssetWatcher::supported() {
+#if defined(VNEIO_HAS_INOTIFY)
+    return true;
+#else
+    return false;
+#endif
+}
+
+template<typename T>
+Result<uint64_t> AssetWatcher::watch(const LoadRequest& request, ReloadCallback<T> on_reload) {
+    Watch entry;
+    entry.delivery = std::make_shared<Delivery>();
+    entry.reload = [this, request, delivery = entry.delivery, on_reload = std::move(on_reload)](uint64_t generation) {
+        LoadRequest reload = request;
+        // A live token also keeps the reload out of load coalescing, which could hand back an
+        // in-flight load that started before the change.
+        reload.cancel_token = CancellationToken::make();
+        LoadCallback<T> deliver = [delivery, generation, on_reload](const LoadResult<T>& result) {
+            // Callbacks run in order on the pollCompletions() thread, so plain loads and stores suffice.
+            if (!delivery->active.load(std::memory_order_relaxed) || result.status.code == ErrorCode::eCancelled
+                || generation <= delivery->delivered.load(std::memory_order_relaxed)) {
+                return;
+            }
+            delivery->delivered.store(generation, std::memory_order_relaxed);
+            on_reload(generation, result);
+        };
+        if constexpr (std::is_same_v<T, vne::image::Image>) {
+            io_.loadImageAsync(reload, std::move(deliver));
+        } else if constexpr (std::is_same_v<T, vne::mesh::Mesh>) {
+            io_.loadMeshAsync(reload, std::move(deliver));
+        } else {
+            static_assert(std::is_same_v<T, vne::image::Volume>);
+            io_.loadVolumeAsync(reload, std::move(deliver));
+        }
+        return reload.cancel_token;
+    };
+    return addWatch(request, std::move(entry));
+}
+
+Result<uint64_t> AssetWatcher::watchImage(const LoadRequest& request, ReloadCallback<vne::image::Image> on_reload) {
+    return watch<vne::image::Image>(request, std::move(on_reload));
+}
+
+Result<uint64_t> AssetWatcher::watchMesh(const LoadRequest& request, ReloadCallback<vne::mesh::Mesh> on_reload) {
+    return watch<vne::mesh::Mesh>(request, std::move(on_reload));
+}
+
+Result<uint64_t> AssetWatcher::watchVolume(const LoadRequest& request, ReloadCallback<vne::image::Volume> on_reload) {
+    return watch<vne::image::Volume>(request, std::move(on_reload));
+}
+
+Result<uint64_t> AssetWatcher::addWatch(const LoadRequest& request, Watch watch) {
+    Result<uint64_t> result;
+    if (!thread_.joinable()) {
+        result.status = Status::make(
+            ErrorCode::eNotImplemented, "AssetWatcher: change notifications unavailable", request.uri, "AssetWatcher");
+        return result;
+    }
+    if (request.uri.empty() || !request.buffer.empty() || request.file_system || io_.fileSystem()
+        || request.uri.starts_with(kPackUriScheme)) {
+        result.status = Status::make(ErrorCode::eInvalidArgument,
+                                     "AssetWatcher: only OS paths can be watched",
+                                     request.uri,
+                                     "AssetWatcher");
+        return result;
+    }
+    std::error_code ec;
+    const std::filesystem::path path = std::filesystem::absolute(request.uri, ec).lexically_normal();
+    if (ec || !path.has_filename()) {
+        result.status = Status::make(
+            ErrorCode::eInvalidArgument, "AssetWatcher: invalid path", request.uri, "AssetWatcher");
+        return result;
+    }
+    watch.directory = path.parent_path().string();
+    watch.path = path.string();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+#if defined(VNEIO_HAS_INOTIFY)
+    if (directory_watches_.find(watch.directory) == directory_watches_.end()) {
+        const int descriptor = inotify_add_watch(inotify_fd_, watch.directory.c_str(), kWatchMask);
+        if (descriptor < 0) {
+            const ErrorCode code = errno == ENOENT ? ErrorCode::eFileNotFound : ErrorCode::eFileOpenFailed;
+            result.status = Status::make(code,
+                                         std::string("AssetWatcher: cannot watch directory: ") + std::strerror(errno),
+                                         watch.directory,
+                                         "AssetWatcher");
+            return result;
+        }
+        directory_watches_[watch.directory] = descriptor;
+        directories_[descriptor] = watch.directory;
+    }
+#endif
+    const uint64_t id = next_id_++;
+    by_path_[watch.path].push_back(id);
+    watches_.emplace(id, std::move(watch));
+    result.value = id;
+    result.status = Status::okStatus();
+    return result;
+}
+
+bool AssetWatcher::unwatch(uint64_t watch_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = watches_.find(watch_id);
+    if (it == watches_.end()) {
+        return false;
+    }
+    Watch& watch = it->second;
+    watch.delivery->active.store(false, std::memory_order_relaxed);
+    watch.running.cancel();
+
+    std::vector<uint64_t>& ids = by_path_[watch.path];
+    ids.erase(std::remove(ids.begin(), ids.end(), watch_id), ids.end());
+    if (ids.empty()) {
+        by_path_.erase(watch.path);
+    }
+    const std::string directory = watch.directory;
+    watches_.erase(it);
+    const bool directory_used = std::any_of(watches_.begin(), watches_.end(), [&directory](const auto& entry) {
+        return entry.second.directory == directory;
+    });
+    if (!directory_used) {
+        const auto descriptor = directory_watches_.find(directory);
+        if (descriptor != directory_watches_.end()) {
+#if defined(VNEIO_HAS_INOTIFY)
+            inotify_rm_watch(inotify_fd_, descriptor->second);
+#endif
+            directories_.erase(descriptor->second);
+            directory_watches_.erase(descriptor);
+        }
+    }
+    return true;
+}
+
+AssetWatcherStats AssetWatcher::stats() const {
+    AssetWatcherStats stats;
+    stats.events = events_.load(std::memory_order_relaxed);
+    stats.reloads = reloads_.load(std::memory_order_relaxed);
+    stats.superseded = superseded_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AssetWatcher::run() {
+#if defined(VNEIO_HAS_INOTIFY)
+    while (!stop_.load(std::memory_order_relaxed)) {
+        int timeout_ms = -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const Clock::time_point now = Clock::now();
+            for (const auto& [id, watch] : watches_) {
+                if (watch.due) {
+                    const auto wait = std::chrono::ceil<std::chrono::milliseconds>(*watch.due - now).count();
+                    const int wait_ms = static_cast<int>(std::max<int64_t>(wait, 0));
+                    timeout_ms = timeout_ms < 0 ? wait_ms : std::min(timeout_ms, wait_ms);
+                }
+            }
+        }
+        pollfd fds[2] = {{inotify_fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+        if (poll(fds, 2, timeout_ms) < 0 && errno != EINTR) {
+            break;
+        }
+        if (fds[0].revents & POLLIN) {
+            readEvents();
+        }
+        submitDue(Clock::now());
+    }
+#endif
+}
+
+void AssetWatcher::readEvents() {
+#if defined(VNEIO_HAS_INOTIFY)
+    alignas(inotify_event) char buffer[kEventBufferBytes];
+    for (;;) {
+        const ssize_t length = read(inotify_fd_, buffer, sizeof(buffer));
+        if (length <= 0) {
+            return;
+        }
+        const Clock::time_point due = Clock::now() + debounce_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            const auto directory = directories_.find(event->wd);
+            if (event->len == 0 || directory == directories_.end()) {
+                continue;
+            }
+            const std::string path = (std::filesystem::path(directory->second) / event->name).string();
+            const auto ids = by_path_.find(path);
+            if (ids == by_path_.end()) {
+                continue;
+            }
+            events_.fetch_add(1, std::memory_order_relaxed);
+            for (const uint64_t id : ids->second) {
+                watches_.at(id).due = due;  // Each event restarts the quiet period.
+            }
+        }
+    }
+#endif
+}
+
+void AssetWatcher::submitDue(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [id, watch] : watches_) {
+        if (!watch.due || *watch.due > now) {
+            continue;
+        }
+        VNEIO_TRACE_SPAN("AssetWatcher::reload");
+        watch.due.reset();
+        if (watch.generation > watch.delivery->delivered.load(std::memory_order_relaxed)) {
+            watch.running.cancel();
+            superseded_.fetch_add(1, std::memory_order_relaxed);
+        }
+        watch.running = watch.reload(++watch.generation);
+        reloads_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,179 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/binary_io.h"
+
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VNEIO_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+namespace {
+
+#if defined(VNEIO_HAS_MMAP)
+int toMadvise(MapAccess access) {
+    switch (access) {
+        case MapAccess::eSequential:
+            return MADV_SEQUENTIAL;
+        case MapAccess::eRandom:
+            return MADV_RANDOM;
+        case MapAccess::eWillNeed:
+            return MADV_WILLNEED;
+        case MapAccess::eNormal:
+            break;
+    }
+    return MADV_NORMAL;
+}
+#endif
+
+}  // namespace
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , is_open_(std::exchange(other.is_open_, false))
+    , is_mapped_(std::exchange(other.is_mapped_, false))
+    , fallback_(std::move(other.fallback_)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        is_open_ = std::exchange(other.is_open_, false);
+        is_mapped_ = std::exchange(other.is_mapped_, false);
+        fallback_ = std::move(other.fallback_);
+    }
+    return *this;
+}
+
+Status MappedFile::open(const std::string& path, MapAccess access) {
+    close();
+#if defined(VNEIO_HAS_MMAP)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, "BinaryIO");
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < 0) {
+        ::close(fd);
+        return Status::make(ErrorCode::eFileReadFailed, "Failed to determine file size", path, "BinaryIO");
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            size_ = 0;
+            return Status::make(ErrorCode::eFileReadFailed, "Failed to map file", path, "BinaryIO");
+        }
+        data_ = static_cast<const uint8_t*>(addr);
+        is_mapped_ = true;
+    }
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+    is_open_ = true;
+    advise(access);
+    return Status::okStatus();
+#else
+    Status status = readFile(path, fallback_);
+    if (!status) {
+        return status;
+    }
+    data_ = fallback_.empty() ? nullptr : fallback_.data();
+    size_ = fallback_.size();
+    is_open_ = true;
+    (void)access;
+    return status;
+#endif
+}
+
+void MappedFile::close() {
+#if defined(VNEIO_HAS_MMAP)
+    if (is_mapped_ && data_) {
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    fallback_.clear();
+    fallback_.shrink_to_fit();
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+    is_mapped_ = false;
+}
+
+void MappedFile::advise(MapAccess access, size_t offset, size_t length) const {
+#if defined(VNEIO_HAS_MMAP)
+    if (!is_mapped_ || offset >= size_) {
+        return;
+    }
+    if (length == 0 || length > size_ - offset) {
+        length = size_ - offset;
+    }
+    // madvise needs a page-aligned start address.
+    const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t aligned_offset = page > 0 ? offset - offset % page : offset;
+    (void)::madvise(const_cast<uint8_t*>(data_) + aligned_offset,
+                    length + (offset - aligned_offset),
+                    toMadvise(access));
+#else
+    (void)access;
+    (void)offset;
+    (void)length;
+#endif
+}
+
+Status mapFileRange(const std::string& path,
+                    size_t offset,
+                    size_t length,
+                    std::shared_ptr<const uint8_t>& out,
+                    MapAccess access) {
+    out.reset();
+    auto file = std::make_shared<MappedFile>();
+    Status status = file->open(path, MapAccess::eNormal);
+    if (!status) {
+        return status;
+    }
+    if (offset > file->size() || length > file->size() - offset) {
+        return Status::make(ErrorCode::eDataTruncated, "File is shorter than the requested range", path, "BinaryIO");
+    }
+    file->advise(access, offset, length);
+    const uint8_t* begin = file->data() ? file->data() + offset : nullptr;
+    out = std::shared_ptr<const uint8_t>(std::move(file), begin);
+    return Status::okStatus();
+}
+
+void adviseWillNeed(const std::string& path) {
+#if defined(__linux__)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
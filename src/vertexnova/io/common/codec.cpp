@@ -0,0 +1,421 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/codec.h"
+#include "vertexnova/io/common/codec_plugins.h"
+#include "vertexnova/io/common/trace.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+namespace {
+
+// LZ stream: independent blocks of up to kLzBlockBytes decoded bytes, each a little-endian
+// uint32 header (compressed size, kLzStoredFlag if stored as-is) followed by the block.
+// A block is a run of sequences: token (literal length << 4 | match length - kLzMinMatch,
+// 15 = more length bytes follow, 255 = keep adding), literals, little-endian uint16
+// offset, extra match length bytes. The last sequence of a block has no match.
+constexpr size_t kLzBlockBytes = size_t{1} << 20;
+constexpr uint32_t kLzStoredFlag = 0x80000000u;
+constexpr size_t kLzBlockHeaderBytes = sizeof(uint32_t);
+constexpr size_t kLzMinMatch = 4;
+constexpr size_t kLzMaxOffset = 65535;
+constexpr unsigned kLzHashBits = 14;
+constexpr unsigned kLzSkipShift = 6;  //!< Probe stride grows by one every 2^kLzSkipShift bytes without a match.
+
+uint32_t load32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint64_t load64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+void storeLe32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+uint32_t loadLe32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16)
+           | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint32_t lzHash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kLzHashBits);
+}
+
+/** Number of equal leading bytes of two 8-byte words that differ (@p diff = a ^ b, non-zero). */
+size_t equalBytes(uint64_t diff) {
+    if constexpr (std::endian::native == std::endian::little) {
+        return static_cast<size_t>(std::countr_zero(diff)) / 8;
+    } else {
+        return static_cast<size_t>(std::countl_zero(diff)) / 8;
+    }
+}
+
+/** Length of the common prefix of src[pos..size) and src[ref..) with ref < pos. */
+size_t commonLength(const uint8_t* src, size_t pos, size_t ref, size_t size) {
+    const size_t begin = pos;
+    while (pos + sizeof(uint64_t) <= size) {
+        const uint64_t diff = load64(src + pos) ^ load64(src + ref);
+        if (diff != 0) {
+            return pos - begin + equalBytes(diff);
+        }
+        pos += sizeof(uint64_t);
+        ref += sizeof(uint64_t);
+    }
+    while (pos < size && src[pos] == src[ref]) {
+        ++pos;
+        ++ref;
+    }
+    return pos - begin;
+}
+
+void writeLength(uint8_t*& op, size_t length) {
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+}
+
+/** Append one sequence; @p match_length 0 ends the block. False if it does not fit before @p oend. */
+bool writeSequence(uint8_t*& op,
+                   const uint8_t* oend,
+                   const uint8_t* literals,
+                   size_t literal_length,
+                   size_t offset,
+                   size_t match_length) {
+    const size_t need = 1 + literal_length / 255 + 1 + literal_length + (match_length ? 3 + match_length / 255 : 0);
+    if (need > static_cast<size_t>(oend - op)) {
+        return false;
+    }
+    uint8_t* token = op++;
+    const size_t literal_code = std::min<size_t>(literal_length, 15);
+    if (literal_code == 15) {
+        writeLength(op, literal_length - 15);
+    }
+    std::memcpy(op, literals, literal_length);
+    op += literal_length;
+    size_t match_code = 0;
+    if (match_length) {
+        *op++ = static_cast<uint8_t>(offset);
+        *op++ = static_cast<uint8_t>(offset >> 8);
+        match_code = std::min<size_t>(match_length - kLzMinMatch, 15);
+        if (match_code == 15) {
+            writeLength(op, match_length - kLzMinMatch - 15);
+        }
+    }
+    *token = static_cast<uint8_t>((literal_code << 4) | match_code);
+    return true;
+}
+
+/**
+ * Greedy single-probe LZ77 over one block.
+ * @return Compressed size, or 0 if the block does not fit in @p capacity (store it instead).
+ */
+size_t compressLzBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t capacity, uint32_t* table) {
+    std::fill(table, table + (size_t{1} << kLzHashBits), 0u);
+    uint8_t* op = dst;
+    const uint8_t* const oend = dst + capacity;
+    size_t anchor = 0;
+    if (size >= kLzMinMatch) {
+        const size_t last_start = size - kLzMinMatch;
+        size_t ip = 0;
+        while (ip <= last_start) {
+            const uint32_t sequence = load32(src + ip);
+            const uint32_t hash = lzHash(sequence);
+            const size_t candidate = table[hash];
+            table[hash] = static_cast<uint32_t>(ip);
+            if (candidate >= ip || ip - candidate > kLzMaxOffset || load32(src + candidate) != sequence) {
+                ip += 1 + ((ip - anchor) >> kLzSkipShift);
+                continue;
+            }
+            size_t start = ip;
+            size_t ref = candidate;
+            while (start > anchor && ref > 0 && src[start - 1] == src[ref - 1]) {
+                --start;
+                --ref;
+            }
+            const size_t end = ip + kLzMinMatch + commonLength(src, ip + kLzMinMatch, candidate + kLzMinMatch, size);
+            if (!writeSequence(op, oend, src + anchor, start - anchor, ip - candidate, end - start)) {
+                return 0;
+            }
+            if (end + 2 <= size && end >= 2) {
+                table[lzHash(load32(src + end - 2))] = static_cast<uint32_t>(end - 2);
+            }
+            ip = end;
+            anchor = end;
+        }
+    }
+    if (!writeSequence(op, oend, src + anchor, size - anchor, 0, 0)) {
+        return 0;
+    }
+    return static_cast<size_t>(op - dst);
+}
+
+bool readLength(const uint8_t*& ip, const uint8_t* iend, size_t& length) {
+    uint8_t byte = 0;
+    do {
+        if (ip == iend || length > (SIZE_MAX >> 1)) {
+            return false;
+        }
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+/** Copy a match that may overlap its own output (offset < length repeats the last @p offset bytes). */
+void copyMatch(uint8_t* op, size_t offset, size_t length) {
+    if (offset >= length) {
+        std::memcpy(op, op - offset, length);
+        return;
+    }
+    // Each copy doubles the distance, which stays a multiple of the period.
+    size_t distance = offset;
+    while (length > 0) {
+        const size_t n = std::min(distance, length);
+        std::memcpy(op, op - distance, n);
+        op += n;
+        length -= n;
+        distance += n;
+    }
+}
+
+bool decompressLzBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) {
+    const uint8_t* ip = src;
+    const uint8_t* const iend = src + size;
+    size_t op = 0;
+    for (;;) {
+        if (ip == iend) {
+            return false;
+        }
+        const uint8_t token = *ip++;
+        size_t literal_length = token >> 4;
+        if (literal_length == 15 && !readLength(ip, iend, literal_length)) {
+            return false;
+        }
+        if (literal_length > static_cast<size_t>(iend - ip) || literal_length > dst_size - op) {
+            return false;
+        }
+        std::memcpy(dst + op, ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+        if (ip == iend) {
+            return op == dst_size;
+        }
+        if (iend - ip < 2) {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        size_t match_length = token & 15;
+        if (match_length == 15 && !readLength(ip, iend, match_length)) {
+            return false;
+        }
+        match_length += kLzMinMatch;
+        if (offset == 0 || offset > op || match_length > dst_size - op) {
+            return false;
+        }
+        copyMatch(dst + op, offset, match_length);
+        op += match_length;
+    }
+}
+
+Status codecError(ErrorCode code, const std::string& message) {
+    return Status::make(code, message, {}, "Codec");
+}
+
+/** Built-in LZ77 block codec (LZ4-style sequences, 64 KiB window, 1 MiB independent blocks). */
+class LzCodec final : public ICodec {
+   public:
+    [[nodiscard]] CodecId id() const override { return CodecId::eLz; }
+    [[nodiscard]] std::string_view name() const override { return "lz"; }
+
+    [[nodiscard]] size_t maxCompressedSize(size_t size) const override {
+        return size + (size + kLzBlockBytes - 1) / kLzBlockBytes * kLzBlockHeaderBytes;
+    }
+
+    [[nodiscard]] Status compress(const uint8_t* src,
+                                  size_t size,
+                                  uint8_t* dst,
+                                  size_t capacity,
+                                  size_t& out_size,
+                                  int /*level*/) const override {
+        VNEIO_TRACE_SPAN("LzCodec::compress");
+        std::vector<uint32_t> table(size_t{1} << kLzHashBits);
+        size_t op = 0;
+        for (size_t offset = 0; offset < size; offset += kLzBlockBytes) {
+            const size_t n = std::min(kLzBlockBytes, size - offset);
+            if (capacity - op < kLzBlockHeaderBytes) {
+                return codecError(ErrorCode::eInvalidArgument, "lz: output buffer too small");
+            }
+            uint8_t* block = dst + op + kLzBlockHeaderBytes;
+            const size_t room = capacity - op - kLzBlockHeaderBytes;
+            // A block that does not shrink is stored, which bounds the output by maxCompressedSize().
+            size_t packed = compressLzBlock(src + offset, n, block, std::min(room, n - 1), table.data());
+            uint32_t header = static_cast<uint32_t>(packed);
+            if (packed == 0) {
+                if (room < n) {
+                    return codecError(ErrorCode::eInvalidArgument, "lz: output buffer too small");
+                }
+                std::memcpy(block, src + offset, n);
+                packed = n;
+                header = kLzStoredFlag | static_cast<uint32_t>(n);
+            }
+            storeLe32(dst + op, header);
+            op += kLzBlockHeaderBytes + packed;
+        }
+        out_size = op;
+        return Status::okStatus();
+    }
+
+    [[nodiscard]] Status decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) const override {
+        VNEIO_TRACE_SPAN("LzCodec::decompress");
+        size_t ip = 0;
+        for (size_t offset = 0; offset < dst_size; offset += kLzBlockBytes) {
+            const size_t n = std::min(kLzBlockBytes, dst_size - offset);
+            if (size - ip < kLzBlockHeaderBytes) {
+                return codecError(ErrorCode::eDataCorrupt, "lz: truncated stream");
+            }
+            const uint32_t header = loadLe32(src + ip);
+            ip += kLzBlockHeaderBytes;
+            const size_t packed = header & ~kLzStoredFlag;
+            if (packed > size - ip) {
+                return codecError(ErrorCode::eDataCorrupt, "lz: truncated stream");
+            }
+            if (header & kLzStoredFlag) {
+                if (packed != n) {
+                    return codecError(ErrorCode::eDataCorrupt, "lz: stored block size mismatch");
+                }
+                std::memcpy(dst + offset, src + ip, n);
+            } else if (!decompressLzBlock(src + ip, packed, dst + offset, n)) {
+                return codecError(ErrorCode::eDataCorrupt, "lz: corrupt block");
+            }
+            ip += packed;
+        }
+        if (ip != size) {
+            return codecError(ErrorCode::eDataCorrupt, "lz: stream does not match the decoded size");
+        }
+        return Status::okStatus();
+    }
+};
+
+constexpr size_t kCodecSlots = static_cast<size_t>(CodecId::eZstd) + 1;
+
+struct CodecRegistry {
+    std::mutex mutex;
+    std::array<std::shared_ptr<const ICodec>, kCodecSlots> codecs;
+
+    CodecRegistry() {
+        codecs[static_cast<size_t>(CodecId::eLz)] = std::make_shared<LzCodec>();
+#if defined(VNEIO_WITH_ZLIB)
+        codecs[static_cast<size_t>(CodecId::eZlib)] = makeZlibCodec(false);
+        codecs[static_cast<size_t>(CodecId::eGzip)] = makeZlibCodec(true);
+#endif
+#if defined(VNEIO_WITH_ZSTD)
+        codecs[static_cast<size_t>(CodecId::eZstd)] = makeZstdCodec();
+#endif
+    }
+};
+
+CodecRegistry& registry() {
+    static CodecRegistry instance;
+    return instance;
+}
+
+}  // namespace
+
+std::shared_ptr<const ICodec> findCodec(CodecId id) {
+    const auto slot = static_cast<size_t>(id);
+    if (slot >= kCodecSlots) {
+        return nullptr;
+    }
+    CodecRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.codecs[slot];
+}
+
+std::shared_ptr<const ICodec> findCodec(std::string_view name) {
+    CodecRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const std::shared_ptr<const ICodec>& codec : reg.codecs) {
+        if (codec && codec->name() == name) {
+            return codec;
+        }
+    }
+    return nullptr;
+}
+
+void registerCodec(std::shared_ptr<const ICodec> codec) {
+    if (!codec) {
+        return;
+    }
+    const auto slot = static_cast<size_t>(codec->id());
+    if (slot == 0 || slot >= kCodecSlots) {
+        return;
+    }
+    CodecRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.codecs[slot] = std::move(codec);
+}
+
+Status compressBuffer(CodecId id, const uint8_t* src, size_t size, std::vector<uint8_t>& out, int level) {
+    if (id == CodecId::eNone) {
+        out.assign(src, src + size);
+        return Status::okStatus();
+    }
+    const std::shared_ptr<const ICodec> codec = findCodec(id);
+    if (!codec) {
+        out.clear();
+        return codecError(ErrorCode::eUnsupportedFeature,
+                          "codec " + std::to_string(static_cast<int>(id)) + " is not available in this build");
+    }
+    out.resize(codec->maxCompressedSize(size));
+    size_t packed = 0;
+    Status status = codec->compress(src, size, out.data(), out.size(), packed, level);
+    out.resize(status ? packed : 0);
+    return status;
+}
+
+Status decompressBuffer(CodecId id, const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) {
+    if (id == CodecId::eNone) {
+        if (size != dst_size) {
+            return codecError(ErrorCode::eDataCorrupt, "stored payload size mismatch");
+        }
+        std::memcpy(dst, src, size);
+        return Status::okStatus();
+    }
+    const std::shared_ptr<const ICodec> codec = findCodec(id);
+    if (!codec) {
+        return codecError(ErrorCode::eUnsupportedFeature,
+                          "codec " + std::to_string(static_cast<int>(id)) + " is not available in this build");
+    }
+    return codec->decompress(src, size, dst, dst_size);
+}
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
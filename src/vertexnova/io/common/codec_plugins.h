@@ -0,0 +1,33 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Factories of the optional codecs compiled into vneio_common; not installed.
+
+#include "vertexnova/io/common/codec.h"
+
+#include <memory>
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+#if defined(VNEIO_WITH_ZLIB)
+/** @brief Deflate codec with a zlib (@p gzip false) or gzip wrapper; decoding accepts either. */
+[[nodiscard]] std::shared_ptr<const ICodec> makeZlibCodec(bool gzip);
+#endif
+
+#if defined(VNEIO_WITH_ZSTD)
+/** @brief Zstandard codec. */
+[[nodiscard]] std::shared_ptr<const ICodec> makeZstdCodec();
+#endif
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,94 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/completion_queue.h"
+
+namespace vne {
+namespace io {
+
+CompletionQueue::CompletionQueue()
+    : head_(&stub_)
+    , tail_(&stub_) {}
+
+CompletionQueue::~CompletionQueue() {
+    // Discard callbacks that were never drained.
+    while (Node* node = popNode()) {
+        delete node;
+    }
+}
+
+void CompletionQueue::push(Callback callback) {
+    if (!callback) {
+        return;
+    }
+    auto* node = new Node;
+    node->callback = std::move(callback);
+    pushNode(node);
+}
+
+size_t CompletionQueue::drain(size_t max_callbacks) {
+    size_t count = 0;
+    while (count < max_callbacks) {
+        Node* node = popNode();
+        if (!node) {
+            break;
+        }
+        Callback callback = std::move(node->callback);
+        delete node;
+        callback();
+        ++count;
+    }
+    return count;
+}
+
+bool CompletionQueue::empty() const {
+    const Node* tail = tail_;
+    const Node* next = tail->next.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+        return next == nullptr;
+    }
+    return false;
+}
+
+void CompletionQueue::pushNode(Node* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+CompletionQueue::Node* CompletionQueue::popNode() {
+    Node* tail = tail_;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+        if (!next) {
+            return nullptr;
+        }
+        tail_ = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next) {
+        tail_ = next;
+        return tail;
+    }
+    if (tail != head_.load(std::memory_order_acquire)) {
+        // A producer is between exchange() and linking; the node becomes visible shortly.
+        return nullptr;
+    }
+    pushNode(&stub_);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+        tail_ = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,168 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+constexpr size_t kDicomPreambleBytes = 128;
+constexpr size_t kStlHeaderBytes = 80;
+constexpr uint64_t kStlTriangleBytes = 50;
+
+bool startsWith(std::span<const uint8_t> bytes, std::string_view prefix, size_t offset = 0) {
+    return bytes.size() >= offset + prefix.size()
+           && std::memcmp(bytes.data() + offset, prefix.data(), prefix.size()) == 0;
+}
+
+bool isMetaImageHeader(std::span<const uint8_t> bytes) {
+    size_t pos = 0;
+    while (pos < bytes.size() && std::isspace(bytes[pos])) {
+        ++pos;
+    }
+    constexpr std::string_view kKey = "ObjectType";
+    if (!startsWith(bytes, kKey, pos)) {
+        return false;
+    }
+    pos += kKey.size();
+    while (pos < bytes.size() && (bytes[pos] == ' ' || bytes[pos] == '\t')) {
+        ++pos;
+    }
+    return pos < bytes.size() && bytes[pos] == '=';
+}
+
+bool isBinaryStl(std::span<const uint8_t> bytes, uint64_t file_size) {
+    if (bytes.size() < kStlHeaderBytes + sizeof(uint32_t)) {
+        return false;
+    }
+    const uint8_t* count_bytes = bytes.data() + kStlHeaderBytes;
+    const uint64_t triangles = static_cast<uint64_t>(count_bytes[0]) | (static_cast<uint64_t>(count_bytes[1]) << 8)
+                               | (static_cast<uint64_t>(count_bytes[2]) << 16)
+                               | (static_cast<uint64_t>(count_bytes[3]) << 24);
+    return file_size == kStlHeaderBytes + sizeof(uint32_t) + triangles * kStlTriangleBytes;
+}
+
+}  // namespace
+
+std::string normalizeFormat(std::string_view format) {
+    while (!format.empty() && (format.front() == '*' || format.front() == '.')) {
+        format.remove_prefix(1);
+    }
+    std::string out(format);
+    std::transform(out.begin(), out.end(), out.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return out;
+}
+
+std::string fileExtension(std::string_view path) {
+    const size_t slash = path.find_last_of("/\\");
+    const size_t dot = path.find_last_of('.');
+    if (dot == std::string_view::npos || (slash != std::string_view::npos && dot < slash)) {
+        return "";
+    }
+    return normalizeFormat(path.substr(dot + 1));
+}
+
+std::string requestFormat(const LoadRequest& request) {
+    if (!request.hint_format.empty()) {
+        return normalizeFormat(request.hint_format);
+    }
+    return fileExtension(request.uri);
+}
+
+std::string sniffFormat(std::span<const uint8_t> header, uint64_t file_size) {
+    static constexpr std::array<uint8_t, 8> kPngSignature = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (header.size() >= kPngSignature.size()
+        && std::equal(kPngSignature.begin(), kPngSignature.end(), header.begin())) {
+        return "png";
+    }
+    if (header.size() >= 3 && header[0] == 0xFF && header[1] == 0xD8 && header[2] == 0xFF) {
+        return "jpg";
+    }
+    if (startsWith(header, "GIF87a") || startsWith(header, "GIF89a")) {
+        return "gif";
+    }
+    if (startsWith(header, "NRRD000")) {
+        return "nrrd";
+    }
+    if (startsWith(header, "DICM", kDicomPreambleBytes)) {
+        return "dcm";
+    }
+    if (isMetaImageHeader(header)) {
+        return "mhd";
+    }
+    if (startsWith(header, "ply\n") || startsWith(header, "ply\r\n")) {
+        return "ply";
+    }
+    if (startsWith(header, "glTF")) {
+        return "glb";
+    }
+    // Binary STL headers may begin with "solid" too, so check the size invariant first.
+    if (isBinaryStl(header, file_size) || startsWith(header, "solid")) {
+        return "stl";
+    }
+    if (startsWith(header, std::string_view("VNECOOK\0", 8))) {
+        return "vnecook";
+    }
+    if (startsWith(header, std::string_view("VNEMESH\0", 8))) {
+        return "vnemesh";
+    }
+    if (startsWith(header, "BM")) {
+        return "bmp";
+    }
+    return "";
+}
+
+std::string sniffFileFormat(const std::string& path) {
+    std::ifstream f(path, std::ios::binary | std::ios::ate);
+    if (!f) {
+        return "";
+    }
+    const std::streamoff size = f.tellg();
+    if (size <= 0) {
+        return "";
+    }
+    f.seekg(0, std::ios::beg);
+    std::array<uint8_t, kSniffHeaderBytes> header{};
+    f.read(reinterpret_cast<char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    const auto read = static_cast<size_t>(f.gcount());
+    return sniffFormat(std::span<const uint8_t>(header.data(), read), static_cast<uint64_t>(size));
+}
+
+std::string sniffFileFormat(const IFileSystem& fs, const std::string& path) {
+    std::unique_ptr<IFile> file;
+    if (!fs.openFile(path, file).ok() || file->size() == 0) {
+        return "";
+    }
+    std::array<uint8_t, kSniffHeaderBytes> header{};
+    const size_t read = file->read(0, header.data(), header.size());
+    return sniffFormat(std::span<const uint8_t>(header.data(), read), file->size());
+}
+
+std::string sniffRequestFormat(const LoadRequest& request) {
+    if (!request.buffer.empty()) {
+        const size_t count = std::min(request.buffer.size(), kSniffHeaderBytes);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(request.buffer.data());
+        return sniffFormat(std::span<const uint8_t>(bytes, count), request.buffer.size());
+    }
+    return request.file_system ? sniffFileFormat(*request.file_system, request.uri) : sniffFileFormat(request.uri);
+}
+
+}  // namespace io
+}  // namespace vne
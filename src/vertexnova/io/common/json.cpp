@@ -0,0 +1,295 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/json.h"
+
+#include <charconv>
+#include <cmath>
+
+namespace vne {
+namespace io {
+namespace json {
+
+namespace {
+
+constexpr int kMaxDepth = 256;
+
+const Value& nullValue() {
+    static const Value kNull;
+    return kNull;
+}
+
+}  // namespace
+
+const Value& Value::operator[](std::string_view key) const {
+    if (type_ == Type::eObject) {
+        for (const auto& [name, value] : members_) {
+            if (name == key) {
+                return value;
+            }
+        }
+    }
+    return nullValue();
+}
+
+const Value& Value::operator[](size_t index) const {
+    return type_ == Type::eArray && index < items_.size() ? items_[index] : nullValue();
+}
+
+int64_t Value::asInt(int64_t fallback) const {
+    constexpr double kLimit = 9223372036854775807.0;  // 2^63
+    if (!isNumber() || std::trunc(number_) != number_ || number_ < -kLimit || number_ >= kLimit) {
+        return fallback;
+    }
+    return static_cast<int64_t>(number_);
+}
+
+/** Recursive-descent parser over the whole document. */
+class Parser {
+   public:
+    explicit Parser(std::string_view text)
+        : text_(text) {}
+
+    bool parseDocument(Value& out, std::string& error) {
+        skipSpace();
+        if (!parseValue(out, 0)) {
+            error = error_ + " at byte " + std::to_string(pos_);
+            return false;
+        }
+        skipSpace();
+        if (pos_ != text_.size()) {
+            error = "Unexpected trailing data at byte " + std::to_string(pos_);
+            return false;
+        }
+        return true;
+    }
+
+   private:
+    bool fail(const char* message) {
+        error_ = message;
+        return false;
+    }
+
+    void skipSpace() {
+        while (pos_ < text_.size()
+               && (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(std::string_view word) {
+        if (text_.substr(pos_, word.size()) != word) {
+            return false;
+        }
+        pos_ += word.size();
+        return true;
+    }
+
+    bool parseValue(Value& out, int depth) {
+        if (depth > kMaxDepth) {
+            return fail("JSON nesting too deep");
+        }
+        if (pos_ >= text_.size()) {
+            return fail("Unexpected end of JSON");
+        }
+        switch (text_[pos_]) {
+            case '{':
+                return parseObject(out, depth);
+            case '[':
+                return parseArray(out, depth);
+            case '"':
+                out.type_ = Value::Type::eString;
+                return parseString(out.string_);
+            case 't':
+            case 'f':
+                out.type_ = Value::Type::eBool;
+                out.bool_ = text_[pos_] == 't';
+                return consume(out.bool_ ? "true" : "false") || fail("Invalid literal");
+            case 'n':
+                return consume("null") || fail("Invalid literal");
+            default:
+                return parseNumber(out);
+        }
+    }
+
+    bool parseObject(Value& out, int depth) {
+        out.type_ = Value::Type::eObject;
+        ++pos_;
+        skipSpace();
+        if (consume("}")) {
+            return true;
+        }
+        for (;;) {
+            skipSpace();
+            std::string key;
+            if (pos_ >= text_.size() || text_[pos_] != '"' || !parseString(key)) {
+                return error_.empty() ? fail("Expected object key") : false;
+            }
+            skipSpace();
+            if (!consume(":")) {
+                return fail("Expected ':'");
+            }
+            skipSpace();
+            out.members_.emplace_back(std::move(key), Value{});
+            if (!parseValue(out.members_.back().second, depth + 1)) {
+                return false;
+            }
+            skipSpace();
+            if (consume("}")) {
+                return true;
+            }
+            if (!consume(",")) {
+                return fail("Expected ',' or '}'");
+            }
+        }
+    }
+
+    bool parseArray(Value& out, int depth) {
+        out.type_ = Value::Type::eArray;
+        ++pos_;
+        skipSpace();
+        if (consume("]")) {
+            return true;
+        }
+        for (;;) {
+            skipSpace();
+            if (!parseValue(out.items_.emplace_back(), depth + 1)) {
+                return false;
+            }
+            skipSpace();
+            if (consume("]")) {
+                return true;
+            }
+            if (!consume(",")) {
+                return fail("Expected ',' or ']'");
+            }
+        }
+    }
+
+    bool parseNumber(Value& out) {
+        // from_chars accepts forms JSON does not (inf, nan, hex floats); check the grammar's first character.
+        const char first = text_[pos_];
+        if (first != '-' && (first < '0' || first > '9')) {
+            return fail("Unexpected character");
+        }
+        const char* begin = text_.data() + pos_;
+        const auto [end, ec] = std::from_chars(begin, text_.data() + text_.size(), out.number_);
+        if (ec == std::errc::invalid_argument) {
+            return fail("Invalid number");
+        }
+        out.type_ = Value::Type::eNumber;
+        pos_ += static_cast<size_t>(end - begin);
+        return true;
+    }
+
+    bool parseHex4(uint32_t& out) {
+        if (pos_ + 4 > text_.size()) {
+            return fail("Truncated \\u escape");
+        }
+        const auto [end, ec] = std::from_chars(text_.data() + pos_, text_.data() + pos_ + 4, out, 16);
+        if (ec != std::errc() || end != text_.data() + pos_ + 4) {
+            return fail("Invalid \\u escape");
+        }
+        pos_ += 4;
+        return true;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    bool parseString(std::string& out) {
+        ++pos_;  // opening quote
+        for (;;) {
+            const size_t special = text_.find_first_of("\"\\", pos_);
+            if (special == std::string_view::npos) {
+                return fail("Unterminated string");
+            }
+            out.append(text_.data() + pos_, special - pos_);
+            pos_ = special + 1;
+            if (text_[special] == '"') {
+                return true;
+            }
+            if (pos_ >= text_.size()) {
+                return fail("Unterminated string");
+            }
+            const char escape = text_[pos_++];
+            switch (escape) {
+                case '"':
+                case '\\':
+                case '/':
+                    out += escape;
+                    break;
+                case 'b':
+                    out += '\b';
+                    break;
+                case 'f':
+                    out += '\f';
+                    break;
+                case 'n':
+                    out += '\n';
+                    break;
+                case 'r':
+                    out += '\r';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'u': {
+                    uint32_t cp = 0;
+                    if (!parseHex4(cp)) {
+                        return false;
+                    }
+                    if (cp >= 0xD800 && cp < 0xDC00 && consume("\\u")) {
+                        uint32_t low = 0;
+                        if (!parseHex4(low)) {
+                            return false;
+                        }
+                        if (low < 0xDC00 || low >= 0xE000) {
+                            return fail("Invalid surrogate pair");
+                        }
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, cp);
+                    break;
+                }
+                default:
+                    return fail("Invalid escape");
+            }
+        }
+    }
+
+    std::string_view text_;
+    size_t pos_ = 0;
+    std::string error_;
+};
+
+bool parse(std::string_view text, Value& out, std::string& error) {
+    out = Value{};
+    Parser parser(text);
+    return parser.parseDocument(out, error);
+}
+
+}  // namespace json
+}  // namespace io
+}  // namespace vne
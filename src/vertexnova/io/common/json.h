@@ -0,0 +1,79 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Minimal JSON document model for small metadata files (glTF); not installed.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace vne {
+namespace io {
+namespace json {
+
+/**
+ * @class Value
+ * @brief Parsed JSON value. Lookups on a missing key, an index out of range or a value of
+ * another type yield a shared null value, so chains like doc["a"][0]["b"] need no checks.
+ */
+class Value {
+   public:
+    enum class Type : uint8_t { eNull, eBool, eNumber, eString, eArray, eObject };
+
+    [[nodiscard]] Type type() const { return type_; }
+    [[nodiscard]] bool isNull() const { return type_ == Type::eNull; }
+    [[nodiscard]] bool isNumber() const { return type_ == Type::eNumber; }
+    [[nodiscard]] bool isString() const { return type_ == Type::eString; }
+    [[nodiscard]] bool isArray() const { return type_ == Type::eArray; }
+    [[nodiscard]] bool isObject() const { return type_ == Type::eObject; }
+
+    /** Member @p key of an object (null if absent). */
+    [[nodiscard]] const Value& operator[](std::string_view key) const;
+    /** Element @p index of an array (null if out of range). */
+    [[nodiscard]] const Value& operator[](size_t index) const;
+    /** Elements of an array, or members of an object; 0 otherwise. */
+    [[nodiscard]] size_t size() const { return type_ == Type::eObject ? members_.size() : items_.size(); }
+
+    [[nodiscard]] bool asBool(bool fallback = false) const { return type_ == Type::eBool ? bool_ : fallback; }
+    [[nodiscard]] double asNumber(double fallback = 0.0) const { return isNumber() ? number_ : fallback; }
+    /** The number if it is integral and fits int64_t, else @p fallback. */
+    [[nodiscard]] int64_t asInt(int64_t fallback = 0) const;
+    [[nodiscard]] std::string_view asString(std::string_view fallback = {}) const {
+        return isString() ? std::string_view(string_) : fallback;
+    }
+
+    [[nodiscard]] const std::vector<Value>& items() const { return items_; }
+    [[nodiscard]] const std::vector<std::pair<std::string, Value>>& members() const { return members_; }
+
+   private:
+    friend class Parser;
+
+    Type type_ = Type::eNull;
+    bool bool_ = false;
+    double number_ = 0.0;
+    std::string string_;
+    std::vector<Value> items_;
+    std::vector<std::pair<std::string, Value>> members_;
+};
+
+/**
+ * @brief Parse one JSON document (RFC 8259; nesting is limited to 256 levels).
+ * @param text Document text (UTF-8).
+ * @param out Parsed value.
+ * @param error On failure, the reason and byte offset.
+ * @return true on success.
+ */
+[[nodiscard]] bool parse(std::string_view text, Value& out, std::string& error);
+
+}  // namespace json
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,140 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Internal helpers that let loaders honor LoadRequest::cancel_token / on_progress; not installed.
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/cancellation.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace vne {
+namespace io {
+
+/** Granularity of cancellation checks and progress reports for byte swaps (raw reads use ReadOptions::chunk_bytes). */
+constexpr size_t kLoadChunkBytes = size_t{4} << 20;
+
+/**
+ * @class LoadMonitor
+ * @brief Cancellation, progress and direct-I/O view of a LoadRequest, passed down into the read loops.
+ *
+ * A default-constructed monitor never cancels and reports nothing (legacy load() paths).
+ * It references the request's callback, so the request must outlive it.
+ */
+class LoadMonitor {
+   public:
+    LoadMonitor() = default;
+    explicit LoadMonitor(const LoadRequest& request)
+        : token_(request.cancel_token)
+        , progress_(request.on_progress ? &request.on_progress : nullptr)
+        , direct_io_(request.direct_io) {}
+
+    /** @brief True if the request has been cancelled. */
+    [[nodiscard]] bool cancelled() const { return token_.isCancelled(); }
+
+    /** @brief True if there is a token or callback to honor. */
+    [[nodiscard]] bool active() const { return progress_ != nullptr || token_.valid(); }
+
+    /** @brief True if raw reads should bypass the page cache (LoadRequest::direct_io). */
+    [[nodiscard]] bool directIo() const { return direct_io_; }
+
+    /**
+     * @brief Report progress and poll for cancellation.
+     * @return false if the load should stop.
+     */
+    [[nodiscard]] bool update(std::string_view stage, uint64_t completed, uint64_t total) const {
+        if (progress_) {
+            (*progress_)(LoadProgress{stage, completed, total});
+        }
+        return !cancelled();
+    }
+
+   private:
+    CancellationToken token_;
+    const ProgressCallback* progress_ = nullptr;
+    bool direct_io_ = false;
+};
+
+/** @brief binaryio::ReadOptions for a monitored load: direct I/O if requested, "read" progress per chunk. */
+[[nodiscard]] inline binaryio::ReadOptions monitoredReadOptions(const LoadMonitor& monitor) {
+    binaryio::ReadOptions options;
+    options.direct = monitor.directIo();
+    if (monitor.active()) {
+        options.on_chunk = [&monitor](uint64_t done, uint64_t total) { return monitor.update("read", done, total); };
+    }
+    return options;
+}
+
+/** @brief Map a ranged-read status onto the loaders' read errors (eCancelled, or eFileReadFailed on a short read). */
+[[nodiscard]] inline Status monitoredReadStatus(const Status& status) {
+    if (status.ok() || status.code == ErrorCode::eFileOpenFailed) {
+        return status;
+    }
+    if (status.code == ErrorCode::eCancelled) {
+        return Status::make(ErrorCode::eCancelled, "Load cancelled");
+    }
+    return Status::make(ErrorCode::eFileReadFailed, "Short read");
+}
+
+/**
+ * @brief Read [offset, offset + bytes) of a file through IFile::readRange(), reporting "read" progress per chunk.
+ * @return eOk, eCancelled, or eFileReadFailed on a short read.
+ */
+[[nodiscard]] inline Status readChunked(
+    const IFile& file, uint64_t offset, uint8_t* dst, size_t bytes, const LoadMonitor& monitor) {
+    if (!monitor.update("read", 0, bytes)) {
+        return Status::make(ErrorCode::eCancelled, "Load cancelled");
+    }
+    return monitoredReadStatus(file.readRange(offset, dst, bytes, monitoredReadOptions(monitor)));
+}
+
+/**
+ * @brief readChunked() on a native path via binaryio::readFileRange() (io_uring or pread where available).
+ * @return As readChunked(), plus eFileOpenFailed.
+ */
+[[nodiscard]] inline Status readFileChunked(
+    const std::string& path, uint64_t offset, uint8_t* dst, size_t bytes, const LoadMonitor& monitor) {
+    if (!monitor.update("read", 0, bytes)) {
+        return Status::make(ErrorCode::eCancelled, "Load cancelled");
+    }
+    return monitoredReadStatus(binaryio::readFileRange(path, offset, dst, bytes, monitoredReadOptions(monitor)));
+}
+
+/**
+ * @brief Reverse the byte order of each @p elem_size element in chunks, reporting "swap" progress.
+ * @return false if cancelled (the buffer is then partially swapped).
+ */
+[[nodiscard]] inline bool byteSwapChunked(uint8_t* data, size_t bytes, size_t elem_size, const LoadMonitor& monitor) {
+    if (elem_size <= 1) {
+        return true;
+    }
+    const size_t chunk = kLoadChunkBytes - kLoadChunkBytes % elem_size;
+    for (size_t done = 0; done < bytes;) {
+        if (!monitor.update("swap", done, bytes)) {
+            return false;
+        }
+        const size_t end = std::min(bytes, done + chunk);
+        for (uint8_t* p = data + done; p + elem_size <= data + end; p += elem_size) {
+            std::reverse(p, p + elem_size);
+        }
+        done = end;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace vne
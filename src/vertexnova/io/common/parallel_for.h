@@ -0,0 +1,37 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Fork-join helper for loaders that split one large file across cores; not installed.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace vne {
+namespace io {
+
+/** @brief Threads parallelFor() uses when max_threads is 0: hardware concurrency, at least 1. */
+[[nodiscard]] uint32_t defaultParallelism();
+
+/**
+ * @brief Run body(i) for every i in [0, count) on up to @p max_threads threads and wait for all of them.
+ *
+ * The calling thread works too; helpers are short-lived threads rather than AssetIO's pool, so
+ * a loader already running on a pool worker cannot deadlock waiting for its own tasks. Tasks
+ * are claimed from a shared counter, so uneven tasks balance. If a task throws, the remaining
+ * tasks are skipped and the first exception is rethrown on the calling thread.
+ * @param count Number of tasks.
+ * @param body Task function; must be safe to call concurrently for different indices.
+ * @param max_threads Thread limit including the caller (0 = defaultParallelism()).
+ */
+void parallelFor(size_t count, const std::function<void(size_t)>& body, uint32_t max_threads = 0);
+
+}  // namespace io
+}  // namespace vne
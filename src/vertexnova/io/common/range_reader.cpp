@@ -0,0 +1,557 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/range_reader.h"
+#include "vertexnova/io/common/binary_io.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <vector>
+
+#if defined(VNEIO_HAS_RANGE_READER)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(O_DIRECT)
+#define VNEIO_HAS_O_DIRECT 1
+#endif
+#endif
+
+#if defined(VNEIO_WITH_IO_URING) && VNEIO_WITH_IO_URING && defined(__linux__)
+#define VNEIO_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+namespace {
+
+constexpr const char* kSubsystem = "BinaryIO";
+
+/** Multi-chunk reads only: below this the setup round trip outweighs the overlap. */
+constexpr size_t kMinIoUringChunks = 2;
+
+Status cancelledStatus(const std::string& path) {
+    return Status::make(ErrorCode::eCancelled, "Read cancelled", path, kSubsystem);
+}
+
+Status truncatedStatus(const std::string& path) {
+    return Status::make(ErrorCode::eDataTruncated, "File is shorter than the requested range", path, kSubsystem);
+}
+
+size_t chunkBytes(const ReadOptions& options) {
+    return std::max<size_t>(options.chunk_bytes, 4096);
+}
+
+/** Smallest chunk of a direct read: bounce-buffer reads are synchronous, so they stay large. */
+constexpr size_t kMinDirectChunkBytes = size_t{4} << 20;
+
+constexpr uint64_t alignDown(uint64_t value) {
+    return value - value % kDirectIoAlignment;
+}
+
+constexpr uint64_t alignUp(uint64_t value) {
+    return alignDown(value + kDirectIoAlignment - 1);
+}
+
+/** new/delete with every block aligned for direct I/O. */
+class DirectIoResource final : public std::pmr::memory_resource {
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return std::pmr::new_delete_resource()->allocate(bytes, std::max(alignment, kDirectIoAlignment));
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, std::max(alignment, kDirectIoAlignment));
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+Status readStream(const std::string& path, uint64_t offset, uint8_t* dst, size_t bytes, const ReadOptions& options) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, kSubsystem);
+    }
+    f.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+    const size_t chunk = chunkBytes(options);
+    for (size_t done = 0; done < bytes;) {
+        const size_t count = std::min(chunk, bytes - done);
+        f.read(reinterpret_cast<char*>(dst + done), static_cast<std::streamsize>(count));
+        if (static_cast<size_t>(f.gcount()) != count) {
+            return f.eof() ? truncatedStatus(path)
+                           : Status::make(ErrorCode::eFileReadFailed, "Failed to read file", path, kSubsystem);
+        }
+        done += count;
+        if (options.on_chunk && !options.on_chunk(done, bytes)) {
+            return cancelledStatus(path);
+        }
+    }
+    return Status::okStatus();
+}
+
+#if defined(VNEIO_HAS_RANGE_READER)
+Status readPread(
+    int fd, uint64_t offset, uint8_t* dst, size_t bytes, const ReadOptions& options, const std::string& path) {
+    const size_t chunk = chunkBytes(options);
+    for (size_t done = 0; done < bytes;) {
+        const size_t count = std::min(chunk, bytes - done);
+        for (size_t got = 0; got < count;) {
+            const ssize_t n = ::pread(fd, dst + done + got, count - got, static_cast<off_t>(offset + done + got));
+            if (n == 0) {
+                return truncatedStatus(path);
+            }
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return Status::make(ErrorCode::eFileReadFailed, "Failed to read file", path, kSubsystem);
+            }
+            got += static_cast<size_t>(n);
+        }
+        done += count;
+        if (options.on_chunk && !options.on_chunk(done, bytes)) {
+            return cancelledStatus(path);
+        }
+    }
+    return Status::okStatus();
+}
+#endif
+
+#if defined(VNEIO_HAS_IO_URING)
+/** Ring size; ReadOptions::queue_depth is clamped to it. */
+constexpr unsigned kIoUringEntries = 64;
+
+/**
+ * @class IoUring
+ * @brief Minimal io_uring instance over the raw syscalls (no liburing dependency), reads only.
+ */
+class IoUring {
+   public:
+    IoUring() = default;
+    ~IoUring() {
+        if (sqes_ != MAP_FAILED) {
+            ::munmap(sqes_, sqes_bytes_);
+        }
+        if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_bytes_);
+        }
+        if (sq_ring_ != MAP_FAILED) {
+            ::munmap(sq_ring_, sq_ring_bytes_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    bool init(unsigned entries) {
+        io_uring_params params{};
+        fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            return false;
+        }
+        sq_entries_ = params.sq_entries;
+        sq_ring_bytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_bytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_bytes_ = cq_ring_bytes_ = std::max(sq_ring_bytes_, cq_ring_bytes_);
+        }
+        sq_ring_ = ::mmap(nullptr, sq_ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                          IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED) {
+            return false;
+        }
+        cq_ring_ = single_mmap ? sq_ring_
+                               : ::mmap(nullptr, cq_ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                        fd_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            return false;
+        }
+        sqes_bytes_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = ::mmap(nullptr, sqes_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+        if (sqes_ == MAP_FAILED) {
+            return false;
+        }
+        auto* sq = static_cast<uint8_t*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        auto* cq = static_cast<uint8_t*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    [[nodiscard]] unsigned capacity() const { return sq_entries_; }
+
+    /** @brief Queue a single-iovec read; submitted by the next wait(). */
+    void queueRead(int fd, const iovec* iov, uint64_t offset, uint64_t user_data) {
+        const unsigned tail = *sq_tail_;  // only this thread advances the tail
+        const unsigned index = tail & sq_mask_;
+        io_uring_sqe& sqe = static_cast<io_uring_sqe*>(sqes_)[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READV;  // READV (5.1+) rather than READ (5.6+) for older kernels
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(iov);
+        sqe.len = 1;
+        sqe.off = offset;
+        sqe.user_data = user_data;
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        ++unsubmitted_;
+    }
+
+    /** @brief Submit queued reads and block for at least one completion. @return 0 or -errno. */
+    int wait() {
+        for (;;) {
+            const long submitted =
+                ::syscall(__NR_io_uring_enter, fd_, unsubmitted_, 1u, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (submitted >= 0) {
+                unsubmitted_ -= static_cast<unsigned>(submitted);
+                return 0;
+            }
+            if (errno != EINTR) {
+                return -errno;
+            }
+        }
+    }
+
+    /** @brief Call @p fn(user_data, res) for each available completion. */
+    template<typename Fn>
+    void reap(Fn&& fn) {
+        unsigned head = *cq_head_;
+        const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            fn(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+
+   private:
+    int fd_ = -1;
+    void* sq_ring_ = MAP_FAILED;
+    void* cq_ring_ = MAP_FAILED;
+    void* sqes_ = MAP_FAILED;
+    size_t sq_ring_bytes_ = 0;
+    size_t cq_ring_bytes_ = 0;
+    size_t sqes_bytes_ = 0;
+    unsigned sq_entries_ = 0;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+    unsigned unsubmitted_ = 0;
+};
+
+/** @brief The calling thread's ring (created on first use), or nullptr if io_uring cannot be used. */
+IoUring* threadRing() {
+    if (!ioUringAvailable()) {
+        return nullptr;
+    }
+    thread_local std::unique_ptr<IoUring> ring = [] {
+        auto created = std::make_unique<IoUring>();
+        return created->init(kIoUringEntries) ? std::move(created) : nullptr;
+    }();
+    return ring.get();
+}
+
+/**
+ * @brief Keep up to queue_depth chunk reads in flight; short reads are resubmitted for the remainder.
+ *
+ * Never returns while a read is still in flight, since the kernel writes into @p dst.
+ */
+Status readIoUring(IoUring& ring,
+                   int fd,
+                   uint64_t offset,
+                   uint8_t* dst,
+                   size_t bytes,
+                   const ReadOptions& options,
+                   const std::string& path) {
+    struct Slot {
+        iovec iov{};
+        uint64_t offset = 0;
+    };
+    const size_t chunk = chunkBytes(options);
+    const size_t depth = std::clamp<size_t>(options.queue_depth, 1, ring.capacity());
+    std::vector<Slot> slots(depth);
+    size_t next = 0;  // first byte not yet requested
+    size_t done = 0;
+    size_t in_flight = 0;
+    Status failure = Status::okStatus();
+
+    auto issue = [&](size_t slot, uint64_t file_offset, uint8_t* out, size_t count) {
+        slots[slot].iov.iov_base = out;
+        slots[slot].iov.iov_len = count;
+        slots[slot].offset = file_offset;
+        ring.queueRead(fd, &slots[slot].iov, file_offset, slot);
+        ++in_flight;
+    };
+    auto issueNext = [&](size_t slot) {
+        if (failure.ok() && next < bytes) {
+            const size_t count = std::min(chunk, bytes - next);
+            issue(slot, offset + next, dst + next, count);
+            next += count;
+        }
+    };
+    for (size_t slot = 0; slot < depth; ++slot) {
+        issueNext(slot);
+    }
+
+    while (in_flight > 0) {
+        if (const int rc = ring.wait(); rc < 0) {
+            if (rc == -EAGAIN || rc == -EBUSY) {
+                continue;  // transient: kernel short on resources or completions pending
+            }
+            // Only reachable with a broken ring (bad fd or mapping); nothing further can be submitted.
+            return Status::make(ErrorCode::eFileReadFailed, "io_uring_enter failed", path, kSubsystem);
+        }
+        ring.reap([&](uint64_t user_data, int res) {
+            --in_flight;
+            Slot& slot = slots[static_cast<size_t>(user_data)];
+            auto* out = static_cast<uint8_t*>(slot.iov.iov_base);
+            if (res == -EINTR || res == -EAGAIN) {
+                issue(static_cast<size_t>(user_data), slot.offset, out, slot.iov.iov_len);
+                return;
+            }
+            if (res <= 0) {
+                if (failure.ok()) {
+                    failure = res == 0 ? truncatedStatus(path)
+                                       : Status::make(ErrorCode::eFileReadFailed, "Failed to read file", path,
+                                                      kSubsystem);
+                }
+                return;
+            }
+            const auto got = static_cast<size_t>(res);
+            done += got;
+            if (got < slot.iov.iov_len) {
+                issue(static_cast<size_t>(user_data), slot.offset + got, out + got, slot.iov.iov_len - got);
+                return;
+            }
+            if (failure.ok() && options.on_chunk && !options.on_chunk(done, bytes)) {
+                failure = cancelledStatus(path);
+            }
+            issueNext(static_cast<size_t>(user_data));
+        });
+    }
+    return failure;
+}
+#endif
+
+#if defined(VNEIO_HAS_O_DIRECT)
+struct AlignedDelete {
+    void operator()(uint8_t* p) const { ::operator delete[](p, std::align_val_t{kDirectIoAlignment}); }
+};
+
+/** @brief pread on an O_DIRECT descriptor until @p count bytes or end of file. @return Bytes read, or -errno. */
+ssize_t preadDirect(int fd, uint8_t* dst, size_t count, uint64_t offset, uint64_t file_size) {
+    size_t got = 0;
+    // Stop at end of file: the last block comes back short, and a retry at that unaligned offset is EINVAL.
+    while (got < count && offset + got < file_size) {
+        const ssize_t n = ::pread(fd, dst + got, count - got, static_cast<off_t>(offset + got));
+        if (n == 0) {
+            break;
+        }
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -errno;
+        }
+        got += static_cast<size_t>(n);
+    }
+    return static_cast<ssize_t>(got);
+}
+
+/**
+ * @brief readDescriptorRange() on a descriptor opened with O_DIRECT.
+ *
+ * The aligned middle of an aligned range goes straight into @p dst (through io_uring when
+ * available); the unaligned head and tail, or the whole range if @p offset or @p dst is
+ * unaligned, go through an aligned bounce buffer.
+ * @param refused Set when the file system rejects direct reads; nothing was read, retry buffered.
+ */
+Status readDirect(int fd,
+                  uint64_t offset,
+                  uint8_t* dst,
+                  size_t bytes,
+                  const ReadOptions& options,
+                  const std::string& path,
+                  bool& refused) {
+    refused = false;
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        return Status::make(ErrorCode::eFileReadFailed, "Failed to stat file", path, kSubsystem);
+    }
+    const auto file_size = static_cast<uint64_t>(st.st_size);
+    if (offset > file_size || bytes > file_size - offset) {
+        return truncatedStatus(path);
+    }
+    if (bytes == 0) {
+        return Status::okStatus();
+    }
+    const auto chunk = static_cast<size_t>(alignUp(std::max(chunkBytes(options), kMinDirectChunkBytes)));
+    std::unique_ptr<uint8_t[], AlignedDelete> bounce(
+        static_cast<uint8_t*>(::operator new[](chunk, std::align_val_t{kDirectIoAlignment})));
+
+    // Some file systems accept O_DIRECT at open() and only fail the first read.
+    if (::pread(fd, bounce.get(), kDirectIoAlignment, static_cast<off_t>(alignDown(offset))) < 0 && errno == EINVAL) {
+        refused = true;
+        return Status::okStatus();
+    }
+    auto report = [&](uint64_t done) { return !options.on_chunk || options.on_chunk(done, bytes); };
+
+    size_t done = 0;
+    if (offset % kDirectIoAlignment == 0 && reinterpret_cast<uintptr_t>(dst) % kDirectIoAlignment == 0) {
+        const size_t body = bytes - bytes % kDirectIoAlignment;
+        if (body > 0) {
+            ReadOptions body_options = options;
+            body_options.chunk_bytes = chunk;
+            body_options.on_chunk = [&](uint64_t body_done, uint64_t) { return report(body_done); };
+            if (Status status = readDescriptorRange(fd, offset, dst, body, body_options, path); !status) {
+                return status;
+            }
+            done = body;
+        }
+    }
+    uint64_t block = alignDown(offset + done);
+    auto skip = static_cast<size_t>(offset + done - block);
+    while (done < bytes) {
+        const auto want = static_cast<size_t>(std::min<uint64_t>(chunk, alignUp(skip + (bytes - done))));
+        const ssize_t got = preadDirect(fd, bounce.get(), want, block, file_size);
+        if (got < 0) {
+            return Status::make(ErrorCode::eFileReadFailed, "Failed to read file", path, kSubsystem);
+        }
+        if (static_cast<size_t>(got) <= skip) {
+            return truncatedStatus(path);
+        }
+        const size_t count = std::min(bytes - done, static_cast<size_t>(got) - skip);
+        std::memcpy(dst + done, bounce.get() + skip, count);
+        done += count;
+        block += want;
+        skip = 0;
+        if (!report(done)) {
+            return cancelledStatus(path);
+        }
+    }
+    return Status::okStatus();
+}
+#endif
+
+#if defined(VNEIO_HAS_RANGE_READER)
+/** @brief readFileRange() with ReadOptions::direct: O_DIRECT, else buffered with the pages dropped afterwards. */
+Status readFileDirect(
+    const std::string& path, uint64_t offset, uint8_t* dst, size_t bytes, const ReadOptions& options) {
+#if defined(VNEIO_HAS_O_DIRECT)
+    if (const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT); fd >= 0) {
+        bool refused = false;
+        Status status = readDirect(fd, offset, dst, bytes, options, path, refused);
+        ::close(fd);
+        if (!refused) {
+            return status;
+        }
+    } else if (errno != EINVAL) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, kSubsystem);
+    }
+#endif
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, kSubsystem);
+    }
+#if defined(__APPLE__)
+    (void)::fcntl(fd, F_NOCACHE, 1);
+#endif
+    Status status = readDescriptorRange(fd, offset, dst, bytes, options, path);
+#if defined(POSIX_FADV_DONTNEED)
+    (void)::posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(bytes), POSIX_FADV_DONTNEED);
+#endif
+    ::close(fd);
+    return status;
+}
+#endif
+
+}  // namespace
+
+std::pmr::memory_resource* directIoMemoryResource() {
+    static DirectIoResource resource;
+    return &resource;
+}
+
+bool ioUringAvailable() {
+#if defined(VNEIO_HAS_IO_URING)
+    static const bool kAvailable = [] {
+        IoUring probe;
+        return probe.init(2);
+    }();
+    return kAvailable;
+#else
+    return false;
+#endif
+}
+
+#if defined(VNEIO_HAS_RANGE_READER)
+Status readDescriptorRange(
+    int fd, uint64_t offset, uint8_t* dst, size_t bytes, const ReadOptions& options, const std::string& path) {
+    if (bytes == 0) {
+        return Status::okStatus();
+    }
+#if defined(VNEIO_HAS_IO_URING)
+    const bool multi_chunk = bytes >= kMinIoUringChunks * chunkBytes(options);
+    if (options.backend == ReadBackend::eIoUring || (options.backend == ReadBackend::eAuto && multi_chunk)) {
+        if (IoUring* ring = threadRing()) {
+            return readIoUring(*ring, fd, offset, dst, bytes, options, path);
+        }
+    }
+#endif
+    return readPread(fd, offset, dst, bytes, options, path);
+}
+#endif
+
+Status readFileRange(const std::string& path, uint64_t offset, void* dst, size_t bytes, const ReadOptions& options) {
+    auto* out = static_cast<uint8_t*>(dst);
+#if defined(VNEIO_HAS_RANGE_READER)
+    if (options.direct) {
+        return readFileDirect(path, offset, out, bytes, options);
+    }
+    if (options.backend != ReadBackend::eStream) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, kSubsystem);
+        }
+        Status status = readDescriptorRange(fd, offset, out, bytes, options, path);
+        ::close(fd);
+        return status;
+    }
+#endif
+    return readStream(path, offset, out, bytes, options);
+}
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
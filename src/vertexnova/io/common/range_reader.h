@@ -0,0 +1,41 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Ranged reads on an already open POSIX descriptor (NativeFile, readFileRange); not installed.
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/status.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VNEIO_HAS_RANGE_READER 1
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+/**
+ * @brief readFileRange() on an open descriptor (eStream is treated as ePread).
+ *
+ * ReadOptions::direct is ignored: whether the page cache is bypassed depends on how @p fd was opened.
+ * @param fd Readable descriptor; not closed.
+ * @param path Name used in error statuses.
+ */
+[[nodiscard]] Status readDescriptorRange(
+    int fd, uint64_t offset, uint8_t* dst, size_t bytes, const ReadOptions& options, const std::string& path);
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
+
+#endif
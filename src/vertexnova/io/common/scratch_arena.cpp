@@ -0,0 +1,52 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/scratch_arena.h"
+
+#include <memory>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+struct ThreadScratch {
+    std::unique_ptr<std::byte[]> block;
+    bool in_use = false;
+};
+
+thread_local ThreadScratch t_scratch;
+
+/** Claim the calling thread's block, or nullptr if another arena on this thread holds it. */
+std::byte* claimBlock() {
+    if (t_scratch.in_use) {
+        return nullptr;
+    }
+    if (!t_scratch.block) {
+        t_scratch.block = std::make_unique<std::byte[]>(kScratchBlockBytes);
+    }
+    t_scratch.in_use = true;
+    return t_scratch.block.get();
+}
+
+}  // namespace
+
+ScratchArena::ScratchArena()
+    : owns_block_(!t_scratch.in_use)
+    , arena_(owns_block_ ? claimBlock() : nullptr, owns_block_ ? kScratchBlockBytes : 0) {}
+
+ScratchArena::~ScratchArena() {
+    arena_.release();
+    if (owns_block_) {
+        t_scratch.in_use = false;
+    }
+}
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,48 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Per-thread scratch memory for loader temporaries; not installed.
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace vne {
+namespace io {
+
+/** Bytes of the per-thread block a ScratchArena starts from before spilling to the heap. */
+constexpr size_t kScratchBlockBytes = size_t{1} << 20;
+
+/**
+ * @class ScratchArena
+ * @brief Monotonic arena for short-lived loader buffers (staging copies, de-indexing tables).
+ *
+ * The first arena alive on a thread bump-allocates from that thread's reusable block,
+ * so small loads never touch the heap for temporaries; overflow (and nested arenas)
+ * fall back to the default resource. Everything is released when the arena is destroyed,
+ * so containers using it must not outlive it. Not thread-safe; use on one thread.
+ */
+class ScratchArena {
+   public:
+    ScratchArena();
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /** @brief Resource to construct temporary std::pmr containers with. */
+    [[nodiscard]] std::pmr::memory_resource* resource() { return &arena_; }
+
+   private:
+    bool owns_block_ = false;
+    std::pmr::monotonic_buffer_resource arena_;
+};
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,57 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/single_flight.h"
+
+namespace vne {
+namespace io {
+
+std::shared_ptr<SingleFlight::Flight> SingleFlight::join(const std::string& key, std::shared_ptr<Flight>& started) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = flights_.find(key);
+    if (it != flights_.end()) {
+        ++it->second->waiters;
+        ++coalesced_;
+        return it->second;
+    }
+    started = std::make_shared<Flight>();
+    flights_.emplace(key, started);
+    ++executed_;
+    return nullptr;
+}
+
+size_t SingleFlight::finish(const std::string& key, Flight& flight) {
+    // After this no caller can join, so the waiter count is final.
+    std::lock_guard<std::mutex> lock(mutex_);
+    flights_.erase(key);
+    return flight.waiters;
+}
+
+void SingleFlight::publish(Flight& flight, std::shared_ptr<const void> result, std::exception_ptr error) {
+    {
+        std::lock_guard<std::mutex> lock(flight.mutex);
+        flight.result = std::move(result);
+        flight.error = std::move(error);
+        flight.done = true;
+    }
+    flight.done_cv.notify_all();
+}
+
+void SingleFlight::wait(Flight& flight) {
+    std::unique_lock<std::mutex> lock(flight.mutex);
+    flight.done_cv.wait(lock, [&flight] { return flight.done; });
+}
+
+SingleFlightStats SingleFlight::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return SingleFlightStats{executed_, coalesced_};
+}
+
+}  // namespace io
+}  // namespace vne
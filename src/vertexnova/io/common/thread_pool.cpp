@@ -0,0 +1,109 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/thread_pool.h"
+
+#include <algorithm>
+
+namespace vne {
+namespace io {
+
+ThreadPool::ThreadPool(uint32_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+    task_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+ThreadPool::TaskId ThreadPool::submit(Task task, int priority, std::optional<Clock::time_point> deadline) {
+    if (!task) {
+        return kInvalidTaskId;
+    }
+    TaskId id = kInvalidTaskId;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        id = next_id_++;
+        const QueueKey key{priority, deadline.value_or(Clock::time_point::max()), id};
+        tasks_.emplace(key, std::move(task));
+        queued_keys_.emplace(id, key);
+    }
+    task_cv_.notify_one();
+    return id;
+}
+
+bool ThreadPool::reprioritize(TaskId id, int priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto found = queued_keys_.find(id);
+    if (found == queued_keys_.end()) {
+        return false;
+    }
+    auto node = tasks_.extract(found->second);
+    node.key().priority = priority;
+    found->second = node.key();
+    tasks_.insert(std::move(node));
+    return true;
+}
+
+size_t ThreadPool::pendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return tasks_.empty() && active_tasks_ == 0; });
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_cv_.wait(lock, [this] { return is_stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                // Stopping and nothing left to drain.
+                return;
+            }
+            auto next = tasks_.begin();
+            task = std::move(next->second);
+            queued_keys_.erase(next->first.id);
+            tasks_.erase(next);
+            ++active_tasks_;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --active_tasks_;
+            if (tasks_.empty() && active_tasks_ == 0) {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace vne
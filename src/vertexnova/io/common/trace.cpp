@@ -0,0 +1,171 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/common/binary_io.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace vne {
+namespace io {
+namespace trace {
+
+namespace {
+
+/**
+ * Fixed-capacity ring of one thread's events. Only its owner thread writes; the mutex
+ * is uncontended except while snapshot()/clear() run.
+ */
+struct ThreadRing {
+    explicit ThreadRing(uint32_t id)
+        : thread_id(id)
+        , events(kTraceEventsPerThread) {}
+
+    std::mutex mutex;
+    uint32_t thread_id;
+    std::vector<TraceEvent> events;
+    size_t next = 0;   // slot the next event goes to
+    size_t count = 0;  // valid events (<= capacity)
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;  // kept after their threads exit
+    uint32_t next_thread_id = 1;
+};
+
+std::atomic<bool> g_enabled{true};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+ThreadRing& threadRing() {
+    thread_local std::shared_ptr<ThreadRing> ring = [] {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        auto created = std::make_shared<ThreadRing>(reg.next_thread_id++);
+        reg.rings.push_back(created);
+        return created;
+    }();
+    return *ring;
+}
+
+void appendJsonString(std::ostringstream& out, const char* text) {
+    out << '"';
+    for (const char* p = text; *p; ++p) {
+        const char c = *p;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+bool isEnabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void setEnabled(bool enabled) {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void record(const char* name, const char* category, uint64_t start_ns, uint64_t end_ns) {
+    ThreadRing& ring = threadRing();
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    TraceEvent& event = ring.events[ring.next];
+    event.name = name;
+    event.category = category;
+    event.start_ns = start_ns;
+    event.duration_ns = end_ns > start_ns ? end_ns - start_ns : 0;
+    event.thread_id = ring.thread_id;
+    ring.next = (ring.next + 1) % ring.events.size();
+    ring.count = std::min(ring.count + 1, ring.events.size());
+}
+
+std::vector<TraceEvent> snapshot() {
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        rings = reg.rings;
+    }
+    std::vector<TraceEvent> events;
+    for (const auto& ring : rings) {
+        std::lock_guard<std::mutex> lock(ring->mutex);
+        const size_t capacity = ring->events.size();
+        const size_t first = (ring->next + capacity - ring->count) % capacity;
+        for (size_t i = 0; i < ring->count; ++i) {
+            events.push_back(ring->events[(first + i) % capacity]);
+        }
+    }
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.start_ns < b.start_ns;
+    });
+    return events;
+}
+
+void clear() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& ring : reg.rings) {
+        std::lock_guard<std::mutex> ring_lock(ring->mutex);
+        ring->next = 0;
+        ring->count = 0;
+    }
+}
+
+std::string toChromeTraceJson() {
+    const std::vector<TraceEvent> events = snapshot();
+    const uint64_t base_ns = events.empty() ? 0 : events.front().start_ns;
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        appendJsonString(out, event.name);
+        out << ",\"cat\":";
+        appendJsonString(out, event.category);
+        // Chrome trace timestamps are microseconds; keep sub-microsecond precision as fractions.
+        out << ",\"ph\":\"X\",\"ts\":" << static_cast<double>(event.start_ns - base_ns) / 1000.0
+            << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0;
+        out << ",\"pid\":1,\"tid\":" << event.thread_id << '}';
+    }
+    out << "\n]}\n";
+    return out.str();
+}
+
+Status writeChromeTrace(const std::string& path) {
+    const std::string json = toChromeTraceJson();
+    return binaryio::writeFile(path, json.data(), json.size());
+}
+
+}  // namespace trace
+}  // namespace io
+}  // namespace vne
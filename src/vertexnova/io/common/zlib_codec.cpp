@@ -0,0 +1,142 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/codec_plugins.h"
+#include "vertexnova/io/common/trace.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <climits>
+#include <string>
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+namespace {
+
+constexpr int kZlibWindowBits = 15;
+constexpr int kGzipWindowBits = kZlibWindowBits + 16;
+constexpr int kAutoWindowBits = kZlibWindowBits + 32;  //!< inflate: detect a zlib or gzip wrapper.
+constexpr int kMemLevel = 8;
+constexpr size_t kGzipExtraBytes = 16;  //!< gzip header and trailer beyond the zlib wrapper.
+constexpr size_t kMaxZlibChunk = UINT_MAX;  //!< z_stream counts are uInt; larger buffers are fed in pieces.
+
+Status zlibError(ErrorCode code, std::string_view codec, const std::string& message) {
+    return Status::make(code, std::string(codec) + ": " + message, {}, "Codec");
+}
+
+/** Refill an empty z_stream window from the remaining bytes of a buffer. */
+void refill(uInt& avail, size_t& left) {
+    if (avail == 0 && left > 0) {
+        const size_t chunk = std::min(left, kMaxZlibChunk);
+        avail = static_cast<uInt>(chunk);
+        left -= chunk;
+    }
+}
+
+class ZlibCodec final : public ICodec {
+   public:
+    explicit ZlibCodec(bool gzip)
+        : gzip_(gzip) {}
+
+    [[nodiscard]] CodecId id() const override { return gzip_ ? CodecId::eGzip : CodecId::eZlib; }
+    [[nodiscard]] std::string_view name() const override { return gzip_ ? "gzip" : "zlib"; }
+
+    [[nodiscard]] size_t maxCompressedSize(size_t size) const override {
+        return static_cast<size_t>(compressBound(static_cast<uLong>(size))) + (gzip_ ? kGzipExtraBytes : 0);
+    }
+
+    [[nodiscard]] Status compress(
+        const uint8_t* src, size_t size, uint8_t* dst, size_t capacity, size_t& out_size, int level) const override {
+        VNEIO_TRACE_SPAN("ZlibCodec::compress");
+        z_stream zs{};
+        const int z_level = level == kDefaultCompressionLevel ? Z_DEFAULT_COMPRESSION : std::clamp(level, 1, 9);
+        if (deflateInit2(&zs, z_level, Z_DEFLATED, gzip_ ? kGzipWindowBits : kZlibWindowBits, kMemLevel,
+                         Z_DEFAULT_STRATEGY)
+            != Z_OK) {
+            return zlibError(ErrorCode::eThirdPartyError, name(), "deflateInit2 failed");
+        }
+        zs.next_in = const_cast<Bytef*>(src);
+        zs.next_out = dst;
+        size_t in_left = size;
+        size_t out_left = capacity;
+        int rc = Z_OK;
+        while (rc != Z_STREAM_END) {
+            refill(zs.avail_in, in_left);
+            if (zs.avail_out == 0 && out_left == 0) {
+                deflateEnd(&zs);
+                return zlibError(ErrorCode::eInvalidArgument, name(), "output buffer too small");
+            }
+            refill(zs.avail_out, out_left);
+            rc = deflate(&zs, in_left == 0 ? Z_FINISH : Z_NO_FLUSH);
+            if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) {
+                deflateEnd(&zs);
+                return zlibError(ErrorCode::eThirdPartyError, name(), "deflate failed");
+            }
+        }
+        out_size = static_cast<size_t>(zs.next_out - dst);
+        deflateEnd(&zs);
+        return Status::okStatus();
+    }
+
+    [[nodiscard]] Status decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) const override {
+        VNEIO_TRACE_SPAN("ZlibCodec::decompress");
+        z_stream zs{};
+        if (inflateInit2(&zs, kAutoWindowBits) != Z_OK) {
+            return zlibError(ErrorCode::eThirdPartyError, name(), "inflateInit2 failed");
+        }
+        zs.next_in = const_cast<Bytef*>(src);
+        zs.next_out = dst;
+        size_t in_left = size;
+        size_t out_left = dst_size;
+        // One spare byte past dst tells a stream that decodes to more than dst_size apart from one that ends.
+        Bytef spare = 0;
+        bool using_spare = false;
+        int rc = Z_OK;
+        while (rc != Z_STREAM_END) {
+            refill(zs.avail_in, in_left);
+            if (zs.avail_out == 0 && out_left == 0) {
+                if (using_spare) {
+                    break;
+                }
+                zs.next_out = &spare;
+                zs.avail_out = 1;
+                using_spare = true;
+            }
+            refill(zs.avail_out, out_left);
+            rc = inflate(&zs, Z_NO_FLUSH);
+            const bool starved = rc == Z_BUF_ERROR && zs.avail_in == 0 && in_left == 0;
+            if (starved || (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR)) {
+                break;
+            }
+        }
+        const bool exact = rc == Z_STREAM_END && out_left == 0
+                           && (using_spare ? zs.avail_out == 1 : zs.avail_out == 0);
+        inflateEnd(&zs);
+        if (!exact) {
+            return zlibError(ErrorCode::eDataCorrupt, name(), "stream is corrupt or does not match the decoded size");
+        }
+        return Status::okStatus();
+    }
+
+   private:
+    bool gzip_;
+};
+
+}  // namespace
+
+std::shared_ptr<const ICodec> makeZlibCodec(bool gzip) {
+    return std::make_shared<ZlibCodec>(gzip);
+}
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,63 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/codec_plugins.h"
+#include "vertexnova/io/common/trace.h"
+
+#include <zstd.h>
+
+#include <string>
+
+namespace vne {
+namespace io {
+namespace binaryio {
+
+namespace {
+
+class ZstdCodec final : public ICodec {
+   public:
+    [[nodiscard]] CodecId id() const override { return CodecId::eZstd; }
+    [[nodiscard]] std::string_view name() const override { return "zstd"; }
+
+    [[nodiscard]] size_t maxCompressedSize(size_t size) const override { return ZSTD_compressBound(size); }
+
+    [[nodiscard]] Status compress(
+        const uint8_t* src, size_t size, uint8_t* dst, size_t capacity, size_t& out_size, int level) const override {
+        VNEIO_TRACE_SPAN("ZstdCodec::compress");
+        // zstd treats level 0 as its own default, matching kDefaultCompressionLevel.
+        const size_t result = ZSTD_compress(dst, capacity, src, size, level);
+        if (ZSTD_isError(result)) {
+            return Status::make(
+                ErrorCode::eThirdPartyError, std::string("zstd: ") + ZSTD_getErrorName(result), {}, "Codec");
+        }
+        out_size = result;
+        return Status::okStatus();
+    }
+
+    [[nodiscard]] Status decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) const override {
+        VNEIO_TRACE_SPAN("ZstdCodec::decompress");
+        const size_t result = ZSTD_decompress(dst, dst_size, src, size);
+        if (ZSTD_isError(result) || result != dst_size) {
+            const std::string reason =
+                ZSTD_isError(result) ? ZSTD_getErrorName(result) : "stream does not match the decoded size";
+            return Status::make(ErrorCode::eDataCorrupt, "zstd: " + reason, {}, "Codec");
+        }
+        return Status::okStatus();
+    }
+};
+
+}  // namespace
+
+std::shared_ptr<const ICodec> makeZstdCodec() {
+    return std::make_shared<ZstdCodec>();
+}
+
+}  // namespace binaryio
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,685 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/cook_cache.h"
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/native_file_system.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+constexpr size_t kStripeBytes = 32;
+constexpr size_t kHashChunkBytes = size_t{1} << 20;
+constexpr std::array<char, 8> kBlobMagic = {'V', 'N', 'E', 'C', 'O', 'O', 'K', '\0'};
+constexpr uint64_t kAbsentFile = ~uint64_t{0};  //!< Recorded size of a dependency that did not exist.
+
+/**
+ * Streaming 64-bit hash over 32-byte stripes with four independent multiply-rotate lanes
+ * (the xxHash64 round), so the multiplies pipeline. Not cryptographic: it only has to tell
+ * edited sources apart.
+ */
+class ContentHasher {
+   public:
+    void update(const uint8_t* data, size_t size) {
+        length_ += size;
+        if (pending_size_ > 0) {
+            const size_t take = std::min(size, kStripeBytes - pending_size_);
+            std::memcpy(pending_.data() + pending_size_, data, take);
+            pending_size_ += take;
+            data += take;
+            size -= take;
+            if (pending_size_ < kStripeBytes) {
+                return;
+            }
+            consume(pending_.data());
+            pending_size_ = 0;
+        }
+        for (; size >= kStripeBytes; data += kStripeBytes, size -= kStripeBytes) {
+            consume(data);
+        }
+        std::memcpy(pending_.data(), data, size);
+        pending_size_ = size;
+    }
+
+    [[nodiscard]] uint64_t digest() const {
+        uint64_t h = std::rotl(lanes_[0], 1) + std::rotl(lanes_[1], 7) + std::rotl(lanes_[2], 12)
+                     + std::rotl(lanes_[3], 18);
+        for (size_t i = 0; i < pending_size_; ++i) {
+            h = std::rotl(h ^ (pending_[i] * kPrime3), 11) * kPrime1;
+        }
+        h ^= length_;
+        h ^= h >> 33;
+        h *= kPrime2;
+        h ^= h >> 29;
+        h *= kPrime3;
+        h ^= h >> 32;
+        return h;
+    }
+
+   private:
+    void consume(const uint8_t* stripe) {
+        for (size_t lane = 0; lane < lanes_.size(); ++lane) {
+            uint64_t word = 0;
+            std::memcpy(&word, stripe + lane * sizeof(word), sizeof(word));
+            lanes_[lane] = std::rotl(lanes_[lane] + word * kPrime2, 31) * kPrime1;
+        }
+    }
+
+    std::array<uint64_t, 4> lanes_ = {kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1};
+    std::array<uint8_t, kStripeBytes> pending_{};
+    size_t pending_size_ = 0;
+    uint64_t length_ = 0;
+};
+
+std::string toHex(uint64_t value) {
+    static constexpr char kDigits[] = "0123456789abcdef";
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; --i, value >>= 4) {
+        hex[static_cast<size_t>(i)] = kDigits[value & 0xF];
+    }
+    return hex;
+}
+
+/** Hash of every byte of @p file; false if a read comes up short. */
+bool hashFile(const IFile& file, uint64_t& out) {
+    ContentHasher hasher;
+    const uint64_t size = file.size();
+    if (const std::shared_ptr<const uint8_t> contents = file.contents()) {
+        hasher.update(contents.get(), static_cast<size_t>(size));
+    } else {
+        std::vector<uint8_t> chunk(static_cast<size_t>(std::min<uint64_t>(size, kHashChunkBytes)));
+        for (uint64_t offset = 0; offset < size;) {
+            const size_t want = static_cast<size_t>(std::min<uint64_t>(size - offset, chunk.size()));
+            if (file.read(offset, chunk.data(), want) != want) {
+                return false;
+            }
+            hasher.update(chunk.data(), want);
+            offset += want;
+        }
+    }
+    out = hasher.digest();
+    return true;
+}
+
+/** Size and content hash of @p path (size kAbsentFile if it cannot be opened); false if a read comes up short. */
+bool fingerprint(const IFileSystem& file_system, const std::string& path, uint64_t& size, uint64_t& hash) {
+    std::unique_ptr<IFile> file;
+    hash = 0;
+    if (!file_system.openFile(path, file).ok()) {
+        size = kAbsentFile;
+        return true;
+    }
+    size = file->size();
+    return hashFile(*file, hash);
+}
+
+/** A file other than the source that a cooked asset was built from, as recorded in its blob. */
+struct Dependency {
+    std::string path;  //!< Relative to the source's directory when `relative`, else as the loader named it.
+    bool relative = false;
+    uint64_t size = kAbsentFile;
+    uint64_t hash = 0;
+};
+
+const IFileSystem& requestFileSystem(const LoadRequest& request) {
+    return request.file_system ? *request.file_system : nativeFileSystem();
+}
+
+std::filesystem::path sourceDirectory(const LoadRequest& request) {
+    return std::filesystem::path(request.uri).parent_path();
+}
+
+/** Path of @p dependency for @p request (next to its source when recorded relative). */
+std::string resolve(const Dependency& dependency, const LoadRequest& request) {
+    if (!dependency.relative) {
+        return dependency.path;
+    }
+    return (sourceDirectory(request) / dependency.path).lexically_normal().generic_string();
+}
+
+/** Fingerprints of the files in request->dependencies, without duplicates or the source itself. */
+Status recordDependencies(const LoadRequest* request, std::vector<Dependency>& out) {
+    if (!request || !request->dependencies) {
+        return Status::okStatus();
+    }
+    std::vector<std::string> paths = *request->dependencies;
+    std::sort(paths.begin(), paths.end());
+    paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+    const std::filesystem::path base = sourceDirectory(*request);
+    for (const std::string& path : paths) {
+        if (path == request->uri) {
+            continue;
+        }
+        Dependency& dependency = out.emplace_back();
+        const std::filesystem::path relative = std::filesystem::path(path).lexically_relative(base);
+        dependency.relative = !relative.empty();
+        dependency.path = dependency.relative ? relative.generic_string() : path;
+        if (!fingerprint(requestFileSystem(*request), path, dependency.size, dependency.hash)) {
+            return Status::make(ErrorCode::eFileReadFailed, "CookCache: cannot read dependency", path, "CookCache");
+        }
+    }
+    return Status::okStatus();
+}
+
+/** True if every dependency still has its recorded size and hash for @p request; none always match. */
+bool dependenciesUnchanged(const std::vector<Dependency>& dependencies, const LoadRequest* request) {
+    if (dependencies.empty()) {
+        return true;
+    }
+    if (!request) {
+        return false;
+    }
+    for (const Dependency& dependency : dependencies) {
+        uint64_t size = 0;
+        uint64_t hash = 0;
+        if (!fingerprint(requestFileSystem(*request), resolve(dependency, *request), size, hash)
+            || size != dependency.size || hash != dependency.hash) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Appends host-order fields to a blob. */
+class BlobWriter {
+   public:
+    void reserve(size_t size) { bytes_.reserve(size); }
+
+    void raw(const void* data, size_t size) {
+        const size_t offset = bytes_.size();
+        bytes_.resize(offset + size);
+        std::memcpy(bytes_.data() + offset, data, size);
+    }
+
+    template<typename T>
+    void pod(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        raw(&value, sizeof(T));
+    }
+
+    void string(const std::string& value) {
+        pod<uint64_t>(value.size());
+        raw(value.data(), value.size());
+    }
+
+    /** Element count followed by the elements. */
+    template<typename T>
+    void array(const T* data, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        pod<uint64_t>(count);
+        raw(data, count * sizeof(T));
+    }
+
+    [[nodiscard]] const std::vector<uint8_t>& bytes() const { return bytes_; }
+    [[nodiscard]] std::vector<uint8_t> release() { return std::move(bytes_); }
+
+   private:
+    std::vector<uint8_t> bytes_;
+};
+
+/** Bounds-checked cursor over a mapped blob; every accessor fails once the blob runs out. */
+class BlobReader {
+   public:
+    BlobReader(const uint8_t* data, size_t size)
+        : data_(data)
+        , left_(size) {}
+
+    [[nodiscard]] const uint8_t* view(size_t size) {
+        if (size > left_) {
+            return nullptr;
+        }
+        const uint8_t* at = data_;
+        data_ += size;
+        left_ -= size;
+        return at;
+    }
+
+    template<typename T>
+    [[nodiscard]] bool pod(T& out) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const uint8_t* at = view(sizeof(T));
+        if (!at) {
+            return false;
+        }
+        std::memcpy(&out, at, sizeof(T));
+        return true;
+    }
+
+    [[nodiscard]] bool string(std::string& out) {
+        uint64_t size = 0;
+        if (!pod(size) || size > left_) {
+            return false;
+        }
+        const uint8_t* at = view(static_cast<size_t>(size));
+        out.assign(reinterpret_cast<const char*>(at), static_cast<size_t>(size));
+        return true;
+    }
+
+    /** Element count and a pointer to the (possibly unaligned) elements; copy them out with memcpy. */
+    template<typename T>
+    [[nodiscard]] bool array(const uint8_t*& out, size_t& count) {
+        uint64_t stored = 0;
+        if (!pod(stored) || stored > left_ / sizeof(T)) {
+            return false;
+        }
+        count = static_cast<size_t>(stored);
+        out = view(count * sizeof(T));
+        return out != nullptr;
+    }
+
+    [[nodiscard]] bool atEnd() const { return left_ == 0; }
+
+   private:
+    const uint8_t* data_;
+    size_t left_;
+};
+
+BlobWriter beginBlob(const std::string& key, AssetType type, const std::vector<Dependency>& dependencies) {
+    BlobWriter writer;
+    writer.reserve(kBlobMagic.size() + 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t) + key.size());
+    writer.raw(kBlobMagic.data(), kBlobMagic.size());
+    writer.pod<uint32_t>(CookCache::kFormatVersion);
+    writer.pod<uint32_t>(static_cast<uint32_t>(type));
+    writer.string(key);
+    writer.pod<uint64_t>(dependencies.size());
+    for (const Dependency& dependency : dependencies) {
+        writer.string(dependency.path);
+        writer.pod<uint8_t>(dependency.relative ? 1 : 0);
+        writer.pod(dependency.size);
+        writer.pod(dependency.hash);
+    }
+    return writer;
+}
+
+/**
+ * Checks the header of a blob (and its key unless @p key is null) and reads its dependencies;
+ * on success @p reader is at the payload.
+ */
+bool readHeader(BlobReader& reader, const std::string* key, AssetType type, std::vector<Dependency>& dependencies) {
+    const uint8_t* magic = reader.view(kBlobMagic.size());
+    uint32_t version = 0;
+    uint32_t stored_type = 0;
+    std::string stored_key;
+    uint64_t count = 0;
+    if (!magic || std::memcmp(magic, kBlobMagic.data(), kBlobMagic.size()) != 0 || !reader.pod(version)
+        || version != CookCache::kFormatVersion || !reader.pod(stored_type)
+        || stored_type != static_cast<uint32_t>(type) || !reader.string(stored_key) || (key && stored_key != *key)
+        || !reader.pod(count)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        Dependency& dependency = dependencies.emplace_back();
+        uint8_t relative = 0;
+        if (!reader.string(dependency.path) || !reader.pod(relative) || !reader.pod(dependency.size)
+            || !reader.pod(dependency.hash)) {
+            return false;
+        }
+        dependency.relative = relative != 0;
+    }
+    return true;
+}
+
+bool readPayload(BlobReader& reader, vne::image::Image& out) {
+    int32_t width = 0;
+    int32_t height = 0;
+    int32_t channels = 0;
+    const uint8_t* pixels = nullptr;
+    size_t count = 0;
+    if (!reader.pod(width) || !reader.pod(height) || !reader.pod(channels) || !reader.array<uint8_t>(pixels, count)
+        || !reader.atEnd()) {
+        return false;
+    }
+    const bool sized = width > 0 && height > 0 && channels > 0
+                       && count == static_cast<size_t>(width) * static_cast<size_t>(height)
+                                      * static_cast<size_t>(channels);
+    return sized && out.setPixels(pixels, width, height, channels);
+}
+
+/**
+ * True if every index addresses a vertex and every part lies inside the index buffer and the
+ * material list. Blobs can come from packs or other tools, so a decoded mesh must be safe to draw.
+ */
+bool meshRangesValid(const uint8_t* indices,
+                     size_t index_count,
+                     size_t vertex_count,
+                     const uint8_t* parts,
+                     size_t part_count,
+                     size_t material_count) {
+    for (size_t i = 0; i < index_count; ++i) {
+        uint32_t index = 0;
+        std::memcpy(&index, indices + i * sizeof(index), sizeof(index));
+        if (index >= vertex_count) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < part_count; ++i) {
+        vne::mesh::Submesh part;
+        std::memcpy(&part, parts + i * sizeof(part), sizeof(part));
+        if (uint64_t{part.first_index} + part.index_count > index_count || part.material_index >= material_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool readPayload(BlobReader& reader, vne::mesh::Mesh& out) {
+    std::string name;
+    uint8_t flags[3] = {};
+    float aabb[6] = {};
+    const uint8_t* vertices = nullptr;
+    const uint8_t* indices = nullptr;
+    const uint8_t* parts = nullptr;
+    size_t vertex_count = 0;
+    size_t index_count = 0;
+    size_t part_count = 0;
+    uint64_t material_count = 0;
+    if (!reader.string(name) || !reader.pod(flags) || !reader.pod(aabb)
+        || !reader.array<vne::mesh::VertexAttributes>(vertices, vertex_count)
+        || !reader.array<uint32_t>(indices, index_count) || !reader.array<vne::mesh::Submesh>(parts, part_count)
+        || !reader.pod(material_count)) {
+        return false;
+    }
+    std::vector<vne::mesh::Material> materials;
+    for (uint64_t i = 0; i < material_count; ++i) {
+        vne::mesh::Material& material = materials.emplace_back();
+        if (!reader.string(material.name) || !reader.string(material.base_color_tex)
+            || !reader.pod(material.base_color)) {
+            return false;
+        }
+    }
+    if (!reader.atEnd()
+        || !meshRangesValid(indices, index_count, vertex_count, parts, part_count, materials.size())) {
+        return false;
+    }
+    out.name = std::move(name);
+    out.has_normals = flags[0] != 0;
+    out.has_tangent = flags[1] != 0;
+    out.has_uv0 = flags[2] != 0;
+    std::memcpy(out.aabb_min, aabb, sizeof(out.aabb_min));
+    std::memcpy(out.aabb_max, aabb + 3, sizeof(out.aabb_max));
+    out.vertices.resize(vertex_count);
+    out.indices.resize(index_count);
+    out.parts.resize(part_count);
+    std::memcpy(out.vertices.data(), vertices, vertex_count * sizeof(vne::mesh::VertexAttributes));
+    std::memcpy(out.indices.data(), indices, index_count * sizeof(uint32_t));
+    std::memcpy(out.parts.data(), parts, part_count * sizeof(vne::mesh::Submesh));
+    out.materials = std::move(materials);
+    return true;
+}
+
+bool readPayload(BlobReader& reader, vne::image::Volume& out) {
+    vne::image::Volume header;
+    int32_t pixel_type = 0;
+    const uint8_t* voxels = nullptr;
+    size_t count = 0;
+    if (!reader.pod(header.dims) || !reader.pod(header.spacing) || !reader.pod(header.origin)
+        || !reader.pod(header.direction) || !reader.pod(pixel_type) || !reader.pod(header.components)
+        || !reader.array<uint8_t>(voxels, count) || !reader.atEnd()) {
+        return false;
+    }
+    header.pixel_type = static_cast<vne::image::VolumePixelType>(pixel_type);
+    if (count != header.byteCount()) {
+        return false;
+    }
+    std::memcpy(out.dims, header.dims, sizeof(out.dims));
+    std::memcpy(out.spacing, header.spacing, sizeof(out.spacing));
+    std::memcpy(out.origin, header.origin, sizeof(out.origin));
+    std::memcpy(out.direction, header.direction, sizeof(out.direction));
+    out.pixel_type = header.pixel_type;
+    out.components = header.components;
+    out.setExternalData(nullptr, 0);
+    out.data.resize(count);
+    std::memcpy(out.data.data(), voxels, count);
+    return true;
+}
+
+void writePayload(BlobWriter& writer, const vne::image::Image& asset) {
+    writer.pod<int32_t>(asset.getWidth());
+    writer.pod<int32_t>(asset.getHeight());
+    writer.pod<int32_t>(asset.getChannels());
+    writer.array(asset.getData(),
+                 static_cast<size_t>(asset.getWidth()) * static_cast<size_t>(asset.getHeight())
+                     * static_cast<size_t>(asset.getChannels()));
+}
+
+void writePayload(BlobWriter& writer, const vne::mesh::Mesh& asset) {
+    writer.string(asset.name);
+    const uint8_t flags[3] = {asset.has_normals, asset.has_tangent, asset.has_uv0};
+    writer.pod(flags);
+    writer.pod(asset.aabb_min);
+    writer.pod(asset.aabb_max);
+    writer.array(asset.vertices.data(), asset.vertices.size());
+    writer.array(asset.indices.data(), asset.indices.size());
+    writer.array(asset.parts.data(), asset.parts.size());
+    writer.pod<uint64_t>(asset.materials.size());
+    for (const vne::mesh::Material& material : asset.materials) {
+        writer.string(material.name);
+        writer.string(material.base_color_tex);
+        writer.pod(material.base_color);
+    }
+}
+
+void writePayload(BlobWriter& writer, const vne::image::Volume& asset) {
+    writer.pod(asset.dims);
+    writer.pod(asset.spacing);
+    writer.pod(asset.origin);
+    writer.pod(asset.direction);
+    writer.pod<int32_t>(static_cast<int32_t>(asset.pixel_type));
+    writer.pod<int32_t>(asset.components);
+    writer.array(asset.getData(), asset.dataSize());
+}
+
+template<typename T>
+constexpr AssetType kBlobAssetType = std::is_same_v<T, vne::image::Image> ? AssetType::eImage
+                                     : std::is_same_v<T, vne::mesh::Mesh> ? AssetType::eMesh
+                                                                          : AssetType::eVolume;
+
+template<typename T>
+BlobWriter encodeBlob(const std::string& key, const T& asset, const std::vector<Dependency>& dependencies = {}) {
+    BlobWriter writer = beginBlob(key, kBlobAssetType<T>, dependencies);
+    writePayload(writer, asset);
+    return writer;
+}
+
+/**
+ * Restores @p out from a whole blob whose dependencies are unchanged for @p request (unchecked
+ * when @p key is null, i.e. for a standalone blob); @p out is only modified when the blob is valid.
+ */
+template<typename T>
+bool decodeBlob(const uint8_t* data, size_t size, const std::string* key, const LoadRequest* request, T& out) {
+    BlobReader reader(data, size);
+    std::vector<Dependency> dependencies;
+    if (!readHeader(reader, key, kBlobAssetType<T>, dependencies)
+        || (key && !dependenciesUnchanged(dependencies, request)) || !readPayload(reader, out)) {
+        return false;
+    }
+    if (key && request && request->dependencies) {
+        for (const Dependency& dependency : dependencies) {
+            request->dependencies->push_back(resolve(dependency, *request));
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+CookCache::CookCache(std::string directory)
+    : directory_(std::move(directory)) {}
+
+std::optional<std::string> CookCache::makeKey(const LoadRequest& request, const std::string& loader_key) {
+    // Buffer loads have no stable identity and mapped volumes alias the source, so neither is cooked.
+    if (loader_key.empty() || request.uri.empty() || !request.buffer.empty() || request.memory_map) {
+        return std::nullopt;
+    }
+    VNEIO_TRACE_SPAN("CookCache::makeKey");
+    const IFileSystem& file_system = request.file_system ? *request.file_system : nativeFileSystem();
+    std::unique_ptr<IFile> file;
+    uint64_t content_hash = 0;
+    if (!file_system.openFile(request.uri, file).ok() || !hashFile(*file, content_hash)) {
+        return std::nullopt;
+    }
+
+    std::string key;
+    key.reserve(loader_key.size() + request.hint_format.size() + 64);
+    key += std::to_string(kFormatVersion);
+    key += '|';
+    key += std::to_string(static_cast<int>(request.asset_type));
+    key += '|';
+    key += toHex(content_hash);
+    key += '|';
+    key += std::to_string(file->size());
+    key += '|';
+    key += request.hint_format;
+    key += '|';
+    key += request.generate_mips ? '1' : '0';
+    key += request.force_srgb ? '1' : '0';
+    key += request.prefer_16bit ? '1' : '0';
+    key += '|';
+    key += loader_key;
+    return key;
+}
+
+std::string CookCache::blobPath(const std::string& key) const {
+    ContentHasher hasher;
+    hasher.update(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+    return (std::filesystem::path(directory_) / (toHex(hasher.digest()) + "." + std::string(kCookedFormat))).string();
+}
+
+namespace {
+
+Status writeBlob(const std::string& directory, const std::string& path, const BlobWriter& writer) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        return Status::make(ErrorCode::eFileWriteFailed,
+                            "CookCache: cannot create directory: " + ec.message(),
+                            directory,
+                            "CookCache");
+    }
+    // Unique temporary name per thread and call, then an atomic rename over any previous blob.
+    static std::atomic<uint64_t> sequence{0};
+    const std::string temp = path + ".tmp" + toHex(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "_"
+                             + std::to_string(sequence.fetch_add(1, std::memory_order_relaxed));
+    Status status = binaryio::writeFile(temp, writer.bytes().data(), writer.bytes().size());
+    if (!status) {
+        std::filesystem::remove(temp, ec);
+        return status;
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return Status::make(
+            ErrorCode::eFileWriteFailed, "CookCache: cannot rename blob: " + ec.message(), path, "CookCache");
+    }
+    return Status::okStatus();
+}
+
+}  // namespace
+
+template<typename T>
+bool CookCache::loadBlob(const std::string& key, T& out, const LoadRequest* request) {
+    VNEIO_TRACE_SPAN("CookCache::load");
+    binaryio::MappedFile mapping;
+    const bool hit = mapping.open(blobPath(key), binaryio::MapAccess::eSequential).ok()
+                     && decodeBlob(mapping.data(), mapping.size(), &key, request, out);
+    (hit ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+    return hit;
+}
+
+template<typename T>
+Status CookCache::storeBlob(const std::string& key, const T& asset, const LoadRequest* request) {
+    VNEIO_TRACE_SPAN("CookCache::store");
+    std::vector<Dependency> dependencies;
+    Status status = recordDependencies(request, dependencies);
+    if (!status) {
+        return status;
+    }
+    status = writeBlob(directory_, blobPath(key), encodeBlob(key, asset, dependencies));
+    if (status) {
+        stores_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return status;
+}
+
+bool CookCache::load(const std::string& key, vne::image::Image& out, const LoadRequest* request) {
+    return loadBlob(key, out, request);
+}
+
+bool CookCache::load(const std::string& key, vne::mesh::Mesh& out, const LoadRequest* request) {
+    return loadBlob(key, out, request);
+}
+
+bool CookCache::load(const std::string& key, vne::image::Volume& out, const LoadRequest* request) {
+    return loadBlob(key, out, request);
+}
+
+Status CookCache::store(const std::string& key, const vne::image::Image& asset, const LoadRequest* request) {
+    return storeBlob(key, asset, request);
+}
+
+Status CookCache::store(const std::string& key, const vne::mesh::Mesh& asset, const LoadRequest* request) {
+    return storeBlob(key, asset, request);
+}
+
+Status CookCache::store(const std::string& key, const vne::image::Volume& asset, const LoadRequest* request) {
+    return storeBlob(key, asset, request);
+}
+
+std::vector<uint8_t> CookCache::encode(const vne::image::Image& asset) {
+    return encodeBlob(std::string(), asset).release();
+}
+
+std::vector<uint8_t> CookCache::encode(const vne::mesh::Mesh& asset) {
+    return encodeBlob(std::string(), asset).release();
+}
+
+std::vector<uint8_t> CookCache::encode(const vne::image::Volume& asset) {
+    return encodeBlob(std::string(), asset).release();
+}
+
+bool CookCache::decode(const uint8_t* data, size_t size, vne::image::Image& out) {
+    return decodeBlob(data, size, nullptr, nullptr, out);
+}
+
+bool CookCache::decode(const uint8_t* data, size_t size, vne::mesh::Mesh& out) {
+    return decodeBlob(data, size, nullptr, nullptr, out);
+}
+
+bool CookCache::decode(const uint8_t* data, size_t size, vne::image::Volume& out) {
+    return decodeBlob(data, size, nullptr, nullptr, out);
+}
+
+CookCacheStats CookCache::stats() const {
+    CookCacheStats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.stores = stores_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,130 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/cooked_asset_loader.h"
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/cook_cache.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+const std::vector<std::string> kCookedExtensions = {std::string(kCookedFormat)};
+
+/** Decodes the blob of @p request from its buffer, file system entry or OS path. */
+template<typename T>
+LoadResult<T> loadCooked(const LoadRequest& request, const char* subsystem) {
+    VNEIO_TRACE_SPAN("CookedAssetLoader::load");
+    LoadResult<T> result{T(assetMemoryResource(request))};
+    bool decoded = false;
+    if (!request.buffer.empty()) {
+        decoded = CookCache::decode(
+            reinterpret_cast<const uint8_t*>(request.buffer.data()), request.buffer.size(), result.value);
+    } else if (request.file_system) {
+        std::unique_ptr<IFile> file;
+        result.status = request.file_system->openFile(request.uri, file);
+        if (!result.status) {
+            return result;
+        }
+        // Pack entries expose the mapping itself, so the blob is decoded in place.
+        if (const std::shared_ptr<const uint8_t> contents = file->contents()) {
+            decoded = CookCache::decode(contents.get(), static_cast<size_t>(file->size()), result.value);
+        } else {
+            std::vector<uint8_t> bytes;
+            result.status = readFile(*request.file_system, request.uri, bytes);
+            if (!result.status) {
+                return result;
+            }
+            decoded = CookCache::decode(bytes.data(), bytes.size(), result.value);
+        }
+    } else {
+        binaryio::MappedFile mapping;
+        result.status = mapping.open(request.uri, binaryio::MapAccess::eSequential);
+        if (!result.status) {
+            return result;
+        }
+        decoded = CookCache::decode(mapping.data(), mapping.size(), result.value);
+    }
+    if (!decoded) {
+        result.status = Status::make(ErrorCode::eDataCorrupt,
+                                     std::string(subsystem) + ": not a valid cooked asset: " + request.uri,
+                                     request.uri,
+                                     subsystem);
+        return result;
+    }
+    result.status = Status::okStatus();
+    return result;
+}
+
+bool isCookedRequest(const LoadRequest& request, AssetType type) {
+    return request.asset_type == type && requestFormat(request) == kCookedFormat;
+}
+
+}  // namespace
+
+bool CookedImageLoader::canLoad(const LoadRequest& request) const {
+    return isCookedRequest(request, AssetType::eImage);
+}
+
+LoadResult<vne::image::Image> CookedImageLoader::loadImage(const LoadRequest& request) {
+    return loadCooked<vne::image::Image>(request, "CookedImageLoader");
+}
+
+const std::vector<std::string>& CookedImageLoader::supportedExtensions() const {
+    return kCookedExtensions;
+}
+
+LoadResult<vne::mesh::Mesh> CookedMeshLoader::loadMesh(const LoadRequest& request) {
+    return loadCooked<vne::mesh::Mesh>(request, "CookedMeshLoader");
+}
+
+bool CookedMeshLoader::loadFile(const std::string& path, vne::mesh::Mesh& out_mesh) {
+    LoadRequest request;
+    request.asset_type = AssetType::eMesh;
+    request.uri = path;
+    LoadResult<vne::mesh::Mesh> result = loadMesh(request);
+    if (!result.ok()) {
+        last_error_ = result.status.message;
+        return false;
+    }
+    out_mesh = std::move(result.value);
+    last_error_.clear();
+    return true;
+}
+
+bool CookedMeshLoader::isExtensionSupported(const std::string& path) const {
+    return fileExtension(path) == kCookedFormat;
+}
+
+const std::vector<std::string>& CookedMeshLoader::supportedExtensions() const {
+    return kCookedExtensions;
+}
+
+bool CookedVolumeLoader::canLoad(const LoadRequest& request) const {
+    return isCookedRequest(request, AssetType::eVolume);
+}
+
+LoadResult<vne::image::Volume> CookedVolumeLoader::loadVolume(const LoadRequest& request) {
+    return loadCooked<vne::image::Volume>(request, "CookedVolumeLoader");
+}
+
+const std::vector<std::string>& CookedVolumeLoader::supportedExtensions() const {
+    return kCookedExtensions;
+}
+
+}  // namespace io
+}  // namespace vne
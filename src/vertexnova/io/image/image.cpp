@@ -10,10 +10,12 @@
  */
 
 #include "vertexnova/io/image/image.h"
+#include "vertexnova/io/vfs/file_system.h"
 
 #include <algorithm>
 #include <cstring>
-#include <mutex>
+#include <limits>
+#include <memory>
 
 /* When using external/stb_image we link to the library; when using FetchContent stb we embed the impl */
 #ifdef VNEIO_STB_HEADER_ONLY
@@ -34,6 +36,54 @@
 namespace vne {
 namespace image {
 
+namespace {
+
+/** @brief Read cursor over an IFile for stbi_io_callbacks. */
+struct StbFileCursor {
+    const vne::io::IFile* file = nullptr;
+    uint64_t position = 0;
+};
+
+int stbRead(void* user, char* data, int size) {
+    auto* cursor = static_cast<StbFileCursor*>(user);
+    if (size <= 0) {
+        return 0;
+    }
+    const size_t got = cursor->file->read(cursor->position, data, static_cast<size_t>(size));
+    cursor->position += got;
+    return static_cast<int>(got);
+}
+
+void stbSkip(void* user, int n) {
+    auto* cursor = static_cast<StbFileCursor*>(user);
+    // stb may skip backwards (negative n) when it un-reads bytes.
+    if (n < 0 && static_cast<uint64_t>(-static_cast<int64_t>(n)) > cursor->position) {
+        cursor->position = 0;
+        return;
+    }
+    cursor->position = static_cast<uint64_t>(static_cast<int64_t>(cursor->position) + n);
+}
+
+int stbEof(void* user) {
+    const auto* cursor = static_cast<StbFileCursor*>(user);
+    return cursor->position >= cursor->file->size() ? 1 : 0;
+}
+
+/**
+ * @brief Sets stb's per-thread flip flag for one decode and clears it afterwards, so later stbi_load
+ * calls on the thread (an AssetIO worker or the caller's) do not inherit this request's flip.
+ */
+class ScopedStbFlip {
+   public:
+    explicit ScopedStbFlip(bool flip_vertically) { stbi_set_flip_vertically_on_load_thread(flip_vertically ? 1 : 0); }
+    ~ScopedStbFlip() { stbi_set_flip_vertically_on_load_thread(0); }
+
+    ScopedStbFlip(const ScopedStbFlip&) = delete;
+    ScopedStbFlip& operator=(const ScopedStbFlip&) = delete;
+};
+
+}  // namespace
+
 Image::Image()
     : width_(0)
     , height_(0)
@@ -46,6 +96,12 @@ Image::Image(const std::string& file_path)
     (void)loadFromFile(file_path);
 }
 
+Image::Image(std::pmr::memory_resource* resource)
+    : data_(resource)
+    , width_(0)
+    , height_(0)
+    , channels_(0) {}
+
 Image::Image(const uint8_t* data, int width, int height, int channels)
     : width_(width)
     , height_(height)
@@ -68,7 +124,41 @@ bool Image::loadFromFile(const std::string& file_path, bool flip_vertically) {
     int height;
     int channels;
     uint8_t* data = image_utils::loadImage(file_path, &width, &height, &channels, 0, flip_vertically);
+    return assignDecoded(data, width, height, channels);
+}
+
+bool Image::loadFromFile(const vne::io::IFile& file, bool flip_vertically) {
+    clear();
+
+    int width;
+    int height;
+    int channels;
+    uint8_t* data = image_utils::loadImage(file, &width, &height, &channels, 0, flip_vertically);
+    return assignDecoded(data, width, height, channels);
+}
 
+bool Image::loadFromMemory(const uint8_t* data, size_t size, bool flip_vertically) {
+    clear();
+
+    int width;
+    int height;
+    int channels;
+    uint8_t* pixels = image_utils::loadImageFromMemory(data, size, &width, &height, &channels, 0, flip_vertically);
+    return assignDecoded(pixels, width, height, channels);
+}
+
+bool Image::setPixels(const uint8_t* data, int width, int height, int channels) {
+    if (!data || width <= 0 || height <= 0 || channels <= 0) {
+        return false;
+    }
+    width_ = width;
+    height_ = height;
+    channels_ = channels;
+    data_.assign(data, data + static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels));
+    return true;
+}
+
+bool Image::assignDecoded(uint8_t* data, int width, int height, int channels) {
     if (!data) {
         return false;
     }
@@ -116,7 +206,7 @@ bool Image::resize(int new_width, int new_height) {
 
     const size_t new_size =
         static_cast<size_t>(new_width) * static_cast<size_t>(new_height) * static_cast<size_t>(channels_);
-    std::vector<uint8_t> resized_data(new_size);
+    std::pmr::vector<uint8_t> resized_data(new_size, data_.get_allocator());
 
     // Prefer stb_image_resize if enabled; otherwise use a simple bilinear fallback.
 #if defined(VNEIO_USE_STB_IMAGE_RESIZE)
@@ -197,6 +287,10 @@ void Image::flipVertically() {
     }
 }
 
+std::pmr::memory_resource* Image::getMemoryResource() const {
+    return data_.get_allocator().resource();
+}
+
 bool Image::isEmpty() const {
     return data_.empty() || width_ <= 0 || height_ <= 0 || channels_ <= 0;
 }
@@ -210,20 +304,38 @@ void Image::clear() {
 
 namespace image_utils {
 
-namespace {
-// stb_image uses global state (e.g. stbi_set_flip_vertically_on_load).
-// Guard it for thread-safe asset loading.
-std::mutex g_stbi_mutex;
-}  // namespace
-
 uint8_t* loadImage(
     const std::string& file_path, int* width, int* height, int* channels, int desired_channels, bool flip_vertically) {
-    std::lock_guard<std::mutex> lock(g_stbi_mutex);
-    stbi_set_flip_vertically_on_load(flip_vertically);
-    uint8_t* data = stbi_load(file_path.c_str(), width, height, channels, desired_channels);
-    // Reset to default (false) so callers that don't request flipping are unaffected.
-    stbi_set_flip_vertically_on_load(false);
-    return data;
+    // Per-thread flip flag: concurrent decodes on AssetIO workers need no global lock.
+    const ScopedStbFlip flip(flip_vertically);
+    return stbi_load(file_path.c_str(), width, height, channels, desired_channels);
+}
+
+uint8_t* loadImageFromMemory(const uint8_t* buffer,
+                             size_t size,
+                             int* width,
+                             int* height,
+                             int* channels,
+                             int desired_channels,
+                             bool flip_vertically) {
+    if (!buffer || size == 0 || size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return nullptr;
+    }
+    const ScopedStbFlip flip(flip_vertically);
+    return stbi_load_from_memory(buffer, static_cast<int>(size), width, height, channels, desired_channels);
+}
+
+uint8_t* loadImage(
+    const vne::io::IFile& file, int* width, int* height, int* channels, int desired_channels, bool flip_vertically) {
+    // Resident files (memory, pack) decode in place; others stream through the callbacks.
+    if (const std::shared_ptr<const uint8_t> bytes = file.contents()) {
+        return loadImageFromMemory(
+            bytes.get(), static_cast<size_t>(file.size()), width, height, channels, desired_channels, flip_vertically);
+    }
+    const ScopedStbFlip flip(flip_vertically);
+    static const stbi_io_callbacks kCallbacks = {&stbRead, &stbSkip, &stbEof};
+    StbFileCursor cursor{&file, 0};
+    return stbi_load_from_callbacks(&kCallbacks, &cursor, width, height, channels, desired_channels);
 }
 
 void freeImage(uint8_t* data) {
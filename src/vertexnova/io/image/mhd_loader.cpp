@@ -9,20 +9,36 @@
 
 #include "vertexnova/io/image/mhd_loader.h"
 #include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
 #include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
 #include "vertexnova/io/load_request.h"
+#include "vertexnova/io/image/volume_mapping.h"
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/native_file_system.h"
 
 #include <algorithm>
+#include <charconv>
 #include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 namespace vne {
 namespace image {
 
 namespace {
 
+const std::vector<std::string> kMhdExtensions = {"mhd", "mha"};
+
+bool isMhdFormat(const std::string& format) {
+    return std::find(kMhdExtensions.begin(), kMhdExtensions.end(), format) != kMhdExtensions.end();
+}
+
 std::string trim(const std::string& s) {
     auto start = s.find_first_not_of(" \t\r\n");
     if (start == std::string::npos) {
@@ -89,71 +105,21 @@ std::string dirname(const std::string& path) {
     return p.parent_path().string();
 }
 
-}  // namespace
-
-bool MhdLoader::canLoad(const vne::io::LoadRequest& request) const {
-    if (request.asset_type != vne::io::AssetType::eVolume) {
-        return false;
-    }
-    return isExtensionSupported(request.uri);
-}
-
-vne::io::LoadResult<vne::image::Volume> MhdLoader::loadVolume(const vne::io::LoadRequest& request) {
-    vne::io::LoadResult<vne::image::Volume> result;
-    if (!load(request.uri, result.value)) {
-        result.status =
-            vne::io::Status::make(vne::io::ErrorCode::eParseError, getLastError(), request.uri, "MhdLoader");
-        return result;
-    }
-    result.status = vne::io::Status::okStatus();
-    return result;
-}
-
-bool MhdLoader::isExtensionSupported(const std::string& path) const {
-    auto pos = path.find_last_of('.');
-    if (pos == std::string::npos) {
-        return false;
-    }
-    std::string ext = path.substr(pos);
-    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {
-        return static_cast<char>(std::tolower(c));
-    });
-    return ext == ".mhd" || ext == ".mha";
-}
-
-bool MhdLoader::load(const std::string& path, Volume& out_volume) {
-    last_error_.clear();
-    out_volume = Volume{};
-
-    std::ifstream f(path, std::ios::binary);
-    if (!f) {
-        last_error_ = "MhdLoader: cannot open file: " + path;
-        return false;
-    }
-
-    int ndims = 0;
+/** @brief Layout fields of a MetaImage header. */
+struct MhdHeader {
     int dims[3] = {0, 0, 0};
     VolumePixelType pixel_type = VolumePixelType::eUnknown;
     float spacing[3] = {1.0f, 1.0f, 1.0f};
     std::string element_data_file;
     bool msb = false;
-    std::string line;
-
-    // For .mha (ElementDataFile = LOCAL), binary starts right after the header blank line.
-    // We therefore parse the header first (terminated by a blank line), then use the recorded offset.
-    std::streamoff data_start_offset = -1;
-
-    std::string header;
-    {
-        std::streamoff off = 0;
-        auto st = vne::io::binaryio::readHeaderUntilBlankLine(f, header, off);
-        if (!st) {
-            last_error_ = "MhdLoader: " + st.message;
-            return false;
-        }
-        data_start_offset = off;
-    }
+    bool compressed = false;       //!< CompressedData = True (zlib stream).
+    uint64_t compressed_size = 0;  //!< CompressedDataSize; 0 = to the end of the file.
+};
 
+bool parseMhdHeader(const std::string& header, MhdHeader& out, std::string& error) {
+    VNEIO_TRACE_SPAN("MhdLoader::parseHeader");
+    int ndims = 0;
+    std::string line;
     std::istringstream hs(header);
 
     while (std::getline(hs, line)) {
@@ -175,98 +141,344 @@ bool MhdLoader::load(const std::string& path, Volume& out_volume) {
         if (key == "NDIMS") {
             ndims = std::stoi(val);
             if (ndims != 3) {
-                last_error_ = "MhdLoader: only NDims 3 is supported, got " + std::to_string(ndims);
+                error = "MhdLoader: only NDims 3 is supported, got " + std::to_string(ndims);
                 return false;
             }
         } else if (key == "DIMSIZE") {
             // Some files place DimSize before NDims; parse as 3 regardless.
-            if (!parseDimSize(val, dims, 3)) {
-                last_error_ = "MhdLoader: invalid DimSize";
+            if (!parseDimSize(val, out.dims, 3)) {
+                error = "MhdLoader: invalid DimSize";
                 return false;
             }
         } else if (key == "ELEMENTTYPE") {
-            pixel_type = parseElementType(val);
-            if (pixel_type == VolumePixelType::eUnknown) {
-                last_error_ = "MhdLoader: unsupported ElementType: " + val;
+            out.pixel_type = parseElementType(val);
+            if (out.pixel_type == VolumePixelType::eUnknown) {
+                error = "MhdLoader: unsupported ElementType: " + val;
                 return false;
             }
         } else if (key == "ELEMENTSPACING") {
-            parseElementSpacing(val, spacing, (ndims > 0) ? ndims : 3);
+            parseElementSpacing(val, out.spacing, (ndims > 0) ? ndims : 3);
         } else if (key == "ELEMENTDATAFILE") {
-            element_data_file = trim(val);
+            out.element_data_file = trim(val);
         } else if (key == "ELEMENTBYTEORDERMSB") {
-            msb = (val.find("TRUE") != std::string::npos || val.find("True") != std::string::npos || val == "1");
+            out.msb = (val.find("TRUE") != std::string::npos || val.find("True") != std::string::npos || val == "1");
+        } else if (key == "COMPRESSEDDATA") {
+            out.compressed = (val.find("TRUE") != std::string::npos || val.find("True") != std::string::npos
+                              || val == "1");
+        } else if (key == "COMPRESSEDDATASIZE") {
+            const auto [end, ec] = std::from_chars(val.data(), val.data() + val.size(), out.compressed_size);
+            if (ec != std::errc() || end != val.data() + val.size()) {
+                error = "MhdLoader: invalid CompressedDataSize";
+                return false;
+            }
+        }
+    }
+
+    if (ndims != 3 || out.dims[0] <= 0 || out.dims[1] <= 0 || out.dims[2] <= 0) {
+        error = "MhdLoader: invalid NDims or DimSize";
+        return false;
+    }
+    if (out.pixel_type == VolumePixelType::eUnknown) {
+        error = "MhdLoader: ElementType not set";
+        return false;
+    }
+    return true;
+}
+
+void applyMhdHeader(const MhdHeader& header, Volume& out_volume) {
+    out_volume.dims[0] = header.dims[0];
+    out_volume.dims[1] = header.dims[1];
+    out_volume.dims[2] = header.dims[2];
+    out_volume.pixel_type = header.pixel_type;
+    out_volume.spacing[0] = header.spacing[0];
+    out_volume.spacing[1] = header.spacing[1];
+    out_volume.spacing[2] = header.spacing[2];
+}
+
+/** @brief True if the voxels follow the header in the same file (ElementDataFile = LOCAL or absent). */
+bool hasLocalData(const MhdHeader& header) {
+    std::string upper = header.element_data_file;
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) {
+        return static_cast<char>(std::toupper(c));
+    });
+    return upper == "LOCAL" || header.element_data_file.empty();
+}
+
+bool swapVoxelBytes(Volume& volume, const vne::io::LoadMonitor& monitor, std::string& error) {
+    VNEIO_TRACE_SPAN("MhdLoader::byteSwap");
+    const auto b = static_cast<size_t>(bytesPerVoxel(volume.pixel_type));
+    if (!vne::io::byteSwapChunked(volume.data.data(), volume.voxelCount() * b, b, monitor)) {
+        error = "MhdLoader: load cancelled";
+        return false;
+    }
+    return true;
+}
+
+/** @brief Read @p num_bytes of voxels at @p offset of @p data_path in chunks, polling @p monitor. */
+bool readVoxels(const std::string& data_path,
+                uint64_t offset,
+                size_t num_bytes,
+                Volume& out_volume,
+                const vne::io::LoadMonitor& monitor,
+                std::string& error,
+                const std::string& what) {
+    VNEIO_TRACE_SPAN("MhdLoader::readRaw");
+    out_volume.data.resize(num_bytes);
+    const vne::io::Status st =
+        vne::io::readFileChunked(data_path, offset, out_volume.data.data(), num_bytes, monitor);
+    if (!st) {
+        if (st.code == vne::io::ErrorCode::eCancelled) {
+            error = "MhdLoader: load cancelled";
+        } else if (st.code == vne::io::ErrorCode::eFileOpenFailed) {
+            error = "MhdLoader: cannot open " + what + ": " + data_path;
+        } else {
+            error = "MhdLoader: failed to read " + what;
         }
+        return false;
     }
+    return true;
+}
 
-    if (ndims != 3 || dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0) {
-        last_error_ = "MhdLoader: invalid NDims or DimSize";
+/** @brief Inflate CompressedData voxels at @p offset of @p file (CompressedDataSize bytes, or to the end). */
+bool readCompressedVoxels(const vne::io::IFile& file,
+                          uint64_t offset,
+                          const MhdHeader& header,
+                          Volume& out_volume,
+                          const vne::io::LoadMonitor& monitor,
+                          std::string& error) {
+    VNEIO_TRACE_SPAN("MhdLoader::inflate");
+    const uint64_t available = offset < file.size() ? file.size() - offset : 0;
+    const uint64_t length = header.compressed_size ? header.compressed_size : available;
+    if (!decodeVoxels(file, offset, length, vne::io::binaryio::CodecId::eZlib, out_volume, error, monitor)) {
+        error = "MhdLoader: " + error + " (CompressedData)";
         return false;
     }
-    if (pixel_type == VolumePixelType::eUnknown) {
-        last_error_ = "MhdLoader: ElementType not set";
+    return rawVoxelsMatchHost(header.pixel_type, header.msb) || swapVoxelBytes(out_volume, monitor, error);
+}
+
+bool loadMhdFile(const std::string& path,
+                 Volume& out_volume,
+                 std::string& error,
+                 bool map_data = false,
+                 const vne::io::LoadMonitor& monitor = {}) {
+    error.clear();
+    out_volume = Volume{};
+
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        error = "MhdLoader: cannot open file: " + path;
         return false;
     }
 
-    out_volume.dims[0] = dims[0];
-    out_volume.dims[1] = dims[1];
-    out_volume.dims[2] = dims[2];
-    out_volume.pixel_type = pixel_type;
-    out_volume.spacing[0] = spacing[0];
-    out_volume.spacing[1] = spacing[1];
-    out_volume.spacing[2] = spacing[2];
+    // For .mha (ElementDataFile = LOCAL), binary starts right after the header blank line.
+    // We therefore parse the header first (terminated by a blank line), then use the recorded offset.
+    std::streamoff data_start_offset = -1;
+
+    std::string header_text;
+    {
+        std::streamoff off = 0;
+        auto st = vne::io::binaryio::readHeaderUntilBlankLine(f, header_text, off);
+        if (!st) {
+            error = "MhdLoader: " + st.message;
+            return false;
+        }
+        data_start_offset = off;
+    }
+
+    MhdHeader header;
+    if (!parseMhdHeader(header_text, header, error)) {
+        return false;
+    }
+    applyMhdHeader(header, out_volume);
+    const VolumePixelType pixel_type = header.pixel_type;
+    const bool msb = header.msb;
 
     size_t num_bytes = out_volume.byteCount();
 
-    std::string element_data_file_upper = element_data_file;
-    std::transform(element_data_file_upper.begin(),
-                   element_data_file_upper.end(),
-                   element_data_file_upper.begin(),
-                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
-    if (element_data_file_upper == "LOCAL" || element_data_file.empty()) {
-        if (data_start_offset < 0) {
-            last_error_ = "MhdLoader: ElementDataFile LOCAL but could not determine data start";
+    if (header.compressed) {
+        f.close();
+        const bool local = hasLocalData(header);
+        if (local && data_start_offset < 0) {
+            error = "MhdLoader: ElementDataFile LOCAL but could not determine data start";
             return false;
         }
-        f.clear();
-        f.seekg(data_start_offset, std::ios::beg);
-        out_volume.data.resize(num_bytes);
-        if (!f.read(reinterpret_cast<char*>(out_volume.data.data()), static_cast<std::streamsize>(num_bytes))) {
-            last_error_ = "MhdLoader: failed to read inline data (ElementDataFile = LOCAL)";
+        const std::string data_path = local ? path : vne::io::resolveSiblingPath(path, header.element_data_file);
+        const vne::io::IFileSystem& native = vne::io::nativeFileSystem();
+        std::unique_ptr<vne::io::IFile> data_file;
+        if (!native.openFile(data_path, data_file).ok()) {
+            error = "MhdLoader: cannot open data file: " + data_path;
             return false;
         }
-        return true;
+        const uint64_t offset = local ? static_cast<uint64_t>(data_start_offset) : 0;
+        return readCompressedVoxels(*data_file, offset, header, out_volume, monitor, error);
+    }
+
+    if (hasLocalData(header)) {
+        if (data_start_offset < 0) {
+            error = "MhdLoader: ElementDataFile LOCAL but could not determine data start";
+            return false;
+        }
+        if (map_data && rawVoxelsMatchHost(pixel_type, msb)) {
+            VNEIO_TRACE_SPAN("MhdLoader::map");
+            f.close();
+            if (!mapRawVoxels(path, static_cast<size_t>(data_start_offset), out_volume, error)) {
+                error = "MhdLoader: " + error;
+                return false;
+            }
+            return true;
+        }
+        f.close();
+        return readVoxels(path, static_cast<uint64_t>(data_start_offset), num_bytes, out_volume, monitor, error,
+                          "inline data (ElementDataFile = LOCAL)");
     }
 
     f.close();
 
+    const std::string& element_data_file = header.element_data_file;
     std::string data_path = element_data_file;
     std::string base_dir = dirname(path);
     if (!base_dir.empty() && !element_data_file.empty()) {
         data_path = base_dir + "/" + element_data_file;
     }
 
-    std::ifstream df(data_path, std::ios::binary);
-    if (!df) {
-        last_error_ = "MhdLoader: cannot open data file: " + data_path;
+    if (map_data && rawVoxelsMatchHost(pixel_type, msb)) {
+        VNEIO_TRACE_SPAN("MhdLoader::map");
+        if (!mapRawVoxels(data_path, 0, out_volume, error)) {
+            error = "MhdLoader: " + error;
+            return false;
+        }
+        return true;
+    }
+
+    if (!readVoxels(data_path, 0, num_bytes, out_volume, monitor, error, "data file")) {
         return false;
     }
-    out_volume.data.resize(num_bytes);
-    if (!df.read(reinterpret_cast<char*>(out_volume.data.data()), static_cast<std::streamsize>(num_bytes))) {
-        last_error_ = "MhdLoader: failed to read data file";
+    return !msb || swapVoxelBytes(out_volume, monitor, error);
+}
+
+/**
+ * @brief loadMhdFile() reading the header (and LOCAL data) from @p file.
+ * @param path Name of @p file; a detached ElementDataFile is resolved next to it in @p fs.
+ */
+bool loadMhdFromFile(const vne::io::IFile& file,
+                     const std::string& path,
+                     const vne::io::IFileSystem& fs,
+                     Volume& out_volume,
+                     std::string& error,
+                     bool share_data,
+                     const vne::io::LoadMonitor& monitor) {
+    error.clear();
+    out_volume = Volume{};
+
+    std::string header_text;
+    size_t data_start_offset = 0;
+    const vne::io::Status st = vne::io::readHeaderUntilBlankLine(file, header_text, data_start_offset);
+    if (!st) {
+        error = "MhdLoader: " + st.message;
         return false;
     }
-    if (msb && bytesPerVoxel(pixel_type) > 1) {
-        int b = bytesPerVoxel(pixel_type);
-        size_t n = out_volume.voxelCount();
-        for (size_t i = 0; i < n; ++i) {
-            uint8_t* p = out_volume.data.data() + i * static_cast<size_t>(b);
-            for (int j = 0; j < b / 2; ++j) {
-                std::swap(p[j], p[b - 1 - j]);
-            }
+
+    MhdHeader header;
+    if (!parseMhdHeader(header_text, header, error)) {
+        return false;
+    }
+    applyMhdHeader(header, out_volume);
+    const bool share = share_data && rawVoxelsMatchHost(header.pixel_type, header.msb);
+
+    if (header.compressed && hasLocalData(header)) {
+        return readCompressedVoxels(file, data_start_offset, header, out_volume, monitor, error);
+    }
+    if (hasLocalData(header)) {
+        VNEIO_TRACE_SPAN("MhdLoader::readRaw");
+        if (!readRawVoxels(file, data_start_offset, share, out_volume, error, monitor)) {
+            error = "MhdLoader: " + error + " (ElementDataFile = LOCAL)";
+            return false;
         }
+        return true;
     }
-    return true;
+
+    const std::string data_path = vne::io::resolveSiblingPath(path, header.element_data_file);
+    std::unique_ptr<vne::io::IFile> data_file;
+    if (!fs.openFile(data_path, data_file).ok()) {
+        error = "MhdLoader: cannot open data file: " + data_path;
+        return false;
+    }
+    if (header.compressed) {
+        return readCompressedVoxels(*data_file, 0, header, out_volume, monitor, error);
+    }
+    {
+        VNEIO_TRACE_SPAN("MhdLoader::readRaw");
+        if (!readRawVoxels(*data_file, 0, share, out_volume, error, monitor)) {
+            error = "MhdLoader: " + error + ": " + data_path;
+            return false;
+        }
+    }
+    return rawVoxelsMatchHost(header.pixel_type, header.msb) || swapVoxelBytes(out_volume, monitor, error);
+}
+
+/** @brief loadMhdFile() reading header and data through a virtual file system. */
+bool loadMhdFromFileSystem(const vne::io::IFileSystem& fs,
+                           const std::string& path,
+                           Volume& out_volume,
+                           std::string& error,
+                           bool share_data,
+                           const vne::io::LoadMonitor& monitor) {
+    std::unique_ptr<vne::io::IFile> file;
+    if (!fs.openFile(path, file).ok()) {
+        error = "MhdLoader: cannot open file: " + path;
+        out_volume = Volume{};
+        return false;
+    }
+    return loadMhdFromFile(*file, path, fs, out_volume, error, share_data, monitor);
+}
+
+}  // namespace
+
+bool MhdLoader::canLoad(const vne::io::LoadRequest& request) const {
+    if (request.asset_type != vne::io::AssetType::eVolume) {
+        return false;
+    }
+    return isMhdFormat(vne::io::requestFormat(request));
+}
+
+vne::io::LoadResult<vne::image::Volume> MhdLoader::loadVolume(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("MhdLoader::loadVolume");
+    vne::io::LoadResult<vne::image::Volume> result{Volume(volumeMemoryResource(request))};
+    std::string error;
+    bool loaded = false;
+    const vne::io::LoadMonitor monitor(request);
+    if (!request.buffer.empty()) {
+        // Caller-owned bytes are copied, never referenced; detached data resolves next to uri.
+        const vne::io::BufferFile file(reinterpret_cast<const uint8_t*>(request.buffer.data()), request.buffer.size());
+        const vne::io::IFileSystem& fs = request.file_system ? *request.file_system : vne::io::nativeFileSystem();
+        loaded = loadMhdFromFile(file, request.uri, fs, result.value, error, false, monitor);
+    } else if (request.file_system) {
+        loaded = loadMhdFromFileSystem(
+            *request.file_system, request.uri, result.value, error, request.memory_map, monitor);
+    } else {
+        loaded = loadMhdFile(request.uri, result.value, error, request.memory_map, monitor);
+    }
+    if (!loaded) {
+        const vne::io::ErrorCode code =
+            monitor.cancelled() ? vne::io::ErrorCode::eCancelled : vne::io::ErrorCode::eParseError;
+        result.value = Volume{};
+        result.status = vne::io::Status::make(code, error, request.uri, "MhdLoader");
+        return result;
+    }
+    result.status = vne::io::Status::okStatus();
+    return result;
+}
+
+const std::vector<std::string>& MhdLoader::supportedExtensions() const {
+    return kMhdExtensions;
+}
+
+bool MhdLoader::isExtensionSupported(const std::string& path) const {
+    return isMhdFormat(vne::io::fileExtension(path));
+}
+
+bool MhdLoader::load(const std::string& path, Volume& out_volume) {
+    return loadMhdFile(path, out_volume, last_error_);
 }
 
 }  // namespace image
@@ -8,74 +8,395 @@
  */
 
 #include "vertexnova/io/image/nrrd_loader.h"
+#include "vertexnova/io/common/format_detect.h"
 #include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/scratch_arena.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/image/volume_mapping.h"
 #include "vertexnova/io/load_request.h"
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/native_file_system.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <NrrdIO.h>
 
 namespace vne {
 namespace image {
 
-bool NrrdLoader::canLoad(const vne::io::LoadRequest& request) const {
-    if (request.asset_type != vne::io::AssetType::eVolume) {
+namespace {
+
+const std::vector<std::string> kNrrdExtensions = {"nrrd", "nhdr"};
+
+bool isNrrdFormat(const std::string& format) {
+    return std::find(kNrrdExtensions.begin(), kNrrdExtensions.end(), format) != kNrrdExtensions.end();
+}
+
+std::mutex g_nrrdio_mutex;
+
+// ---------------------------------------------------------------------------
+// Native header parser for the zero-copy and virtual file system paths. Handles
+// raw-encoded NRRDs with one attached or detached data file (the zero-copy path
+// also requires host byte order); everything else is reported as not eligible
+// and goes through NrrdIO. Metadata mirrors what volumeFromNrrd() extracts.
+// ---------------------------------------------------------------------------
+
+enum class MappedLoad { eLoaded, eNotEligible, eFailed };
+
+constexpr double kNan = std::numeric_limits<double>::quiet_NaN();
+
+struct RawNrrdHeader {
+    VolumePixelType pixel_type = VolumePixelType::eUnknown;
+    unsigned int dimension = 0;
+    int sizes[3] = {1, 1, 1};
+    double spacings[3] = {kNan, kNan, kNan};
+    unsigned int space_dim = 0;
+    double origin[3] = {kNan, kNan, kNan};
+    double directions[3][3] = {{kNan, kNan, kNan}, {kNan, kNan, kNan}, {kNan, kNan, kNan}};
+    std::string encoding;
+    std::string endian;
+    std::string data_file;
+    long long byte_skip = 0;
+    long long line_skip = 0;
+};
+
+std::string trimNrrd(const std::string& s) {
+    const auto start = s.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) {
+        return "";
+    }
+    const auto end = s.find_last_not_of(" \t\r\n");
+    return s.substr(start, end - start + 1);
+}
+
+VolumePixelType parseNrrdType(const std::string& type) {
+    static const std::unordered_map<std::string, VolumePixelType> kTypes = {
+        {"uchar", VolumePixelType::eUint8},
+        {"unsigned char", VolumePixelType::eUint8},
+        {"uint8", VolumePixelType::eUint8},
+        {"uint8_t", VolumePixelType::eUint8},
+        {"signed char", VolumePixelType::eInt8},
+        {"int8", VolumePixelType::eInt8},
+        {"int8_t", VolumePixelType::eInt8},
+        {"short", VolumePixelType::eInt16},
+        {"short int", VolumePixelType::eInt16},
+        {"signed short", VolumePixelType::eInt16},
+        {"signed short int", VolumePixelType::eInt16},
+        {"int16", VolumePixelType::eInt16},
+        {"int16_t", VolumePixelType::eInt16},
+        {"ushort", VolumePixelType::eUint16},
+        {"unsigned short", VolumePixelType::eUint16},
+        {"unsigned short int", VolumePixelType::eUint16},
+        {"uint16", VolumePixelType::eUint16},
+        {"uint16_t", VolumePixelType::eUint16},
+        {"int", VolumePixelType::eInt32},
+        {"signed int", VolumePixelType::eInt32},
+        {"int32", VolumePixelType::eInt32},
+        {"int32_t", VolumePixelType::eInt32},
+        {"uint", VolumePixelType::eUint32},
+        {"unsigned int", VolumePixelType::eUint32},
+        {"uint32", VolumePixelType::eUint32},
+        {"uint32_t", VolumePixelType::eUint32},
+        {"float", VolumePixelType::eFloat32},
+        {"double", VolumePixelType::eFloat64},
+    };
+    auto it = kTypes.find(type);
+    return it != kTypes.end() ? it->second : VolumePixelType::eUnknown;
+}
+
+unsigned int spaceDimensionOf(const std::string& space) {
+    static const std::unordered_map<std::string, unsigned int> kSpaces = {
+        {"right-anterior-superior", 3}, {"RAS", 3}, {"left-anterior-superior", 3}, {"LAS", 3},
+        {"left-posterior-superior", 3}, {"LPS", 3}, {"scanner-xyz", 3}, {"3D-right-handed", 3},
+        {"3D-left-handed", 3}, {"right-anterior-superior-time", 4}, {"RAST", 4},
+        {"left-anterior-superior-time", 4}, {"LAST", 4}, {"left-posterior-superior-time", 4},
+        {"LPST", 4}, {"scanner-xyz-time", 4}, {"3D-right-handed-time", 4}, {"3D-left-handed-time", 4},
+    };
+    auto it = kSpaces.find(space);
+    return it != kSpaces.end() ? it->second : 0;
+}
+
+/** @brief Parse "(x,y,z)" into up to 3 components; "none" yields NaNs. */
+bool parseNrrdVector(const std::string& text, double out[3]) {
+    const std::string value = trimNrrd(text);
+    if (value == "none") {
+        return true;
+    }
+    if (value.size() < 2 || value.front() != '(' || value.back() != ')') {
         return false;
     }
-    return isExtensionSupported(request.uri);
+    std::istringstream iss(value.substr(1, value.size() - 2));
+    std::string component;
+    for (int i = 0; std::getline(iss, component, ','); ++i) {
+        if (i >= 3) {
+            return false;
+        }
+        try {
+            out[i] = std::stod(trimNrrd(component));
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return true;
 }
 
-vne::io::LoadResult<vne::image::Volume> NrrdLoader::loadVolume(const vne::io::LoadRequest& request) {
-    vne::io::LoadResult<vne::image::Volume> result;
-    if (!load(request.uri, result.value)) {
-        result.status =
-            vne::io::Status::make(vne::io::ErrorCode::eParseError, getLastError(), request.uri, "NrrdLoader");
-        return result;
+/** @brief Split "(a,b,c) none (d,e,f)" into per-axis vector tokens. */
+std::vector<std::string> splitNrrdVectors(const std::string& text) {
+    std::vector<std::string> tokens;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        pos = text.find_first_not_of(" \t", pos);
+        if (pos == std::string::npos) {
+            break;
+        }
+        size_t end = text[pos] == '(' ? text.find(')', pos) : text.find_first_of(" \t", pos);
+        end = end == std::string::npos ? text.size() : end + (text[pos] == '(' ? 1 : 0);
+        tokens.push_back(text.substr(pos, end - pos));
+        pos = end;
     }
-    result.status = vne::io::Status::okStatus();
-    return result;
+    return tokens;
 }
 
-bool NrrdLoader::isExtensionSupported(const std::string& path) const {
-    auto pos = path.find_last_of('.');
-    if (pos == std::string::npos) {
+bool parseRawNrrdHeader(const std::string& header_text, RawNrrdHeader& header) {
+    std::istringstream hs(header_text);
+    std::string line;
+    if (!std::getline(hs, line) || line.rfind("NRRD000", 0) != 0) {
         return false;
     }
-    std::string ext = path.substr(pos);
-    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {
-        return static_cast<char>(std::tolower(c));
-    });
-    return ext == ".nrrd" || ext == ".nhdr";
+    while (std::getline(hs, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            break;
+        }
+        if (line[0] == '#') {
+            continue;
+        }
+        const size_t field_sep = line.find(": ");
+        const size_t kv_sep = line.find(":=");
+        if (kv_sep != std::string::npos && (field_sep == std::string::npos || kv_sep < field_sep)) {
+            continue;  // key/value pair, no effect on layout
+        }
+        if (field_sep == std::string::npos) {
+            return false;
+        }
+        const std::string field = line.substr(0, field_sep);
+        const std::string value = trimNrrd(line.substr(field_sep + 2));
+        try {
+            if (field == "type") {
+                header.pixel_type = parseNrrdType(value);
+            } else if (field == "dimension") {
+                header.dimension = static_cast<unsigned int>(std::stoul(value));
+            } else if (field == "sizes") {
+                std::istringstream iss(value);
+                for (unsigned int i = 0; i < header.dimension; ++i) {
+                    if (i >= 3 || !(iss >> header.sizes[i])) {
+                        return false;
+                    }
+                }
+            } else if (field == "spacings") {
+                std::istringstream iss(value);
+                std::string token;
+                for (unsigned int i = 0; i < header.dimension && i < 3 && (iss >> token); ++i) {
+                    header.spacings[i] = token == "nan" || token == "NaN" ? kNan : std::stod(token);
+                }
+            } else if (field == "encoding") {
+                header.encoding = value;
+            } else if (field == "endian") {
+                header.endian = value;
+            } else if (field == "data file" || field == "datafile") {
+                header.data_file = value;
+            } else if (field == "byte skip" || field == "byteskip") {
+                header.byte_skip = std::stoll(value);
+            } else if (field == "line skip" || field == "lineskip") {
+                header.line_skip = std::stoll(value);
+            } else if (field == "space") {
+                header.space_dim = spaceDimensionOf(value);
+                if (header.space_dim == 0) {
+                    return false;
+                }
+            } else if (field == "space dimension") {
+                header.space_dim = static_cast<unsigned int>(std::stoul(value));
+            } else if (field == "space origin") {
+                if (!parseNrrdVector(value, header.origin)) {
+                    return false;
+                }
+            } else if (field == "space directions") {
+                const std::vector<std::string> axes = splitNrrdVectors(value);
+                for (size_t i = 0; i < axes.size() && i < 3; ++i) {
+                    if (!parseNrrdVector(axes[i], header.directions[i])) {
+                        return false;
+                    }
+                }
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return true;
 }
 
-bool NrrdLoader::load(const std::string& path, Volume& out_volume) {
-    last_error_.clear();
-    out_volume = Volume{};
+/** @brief Where the voxels of a raw NRRD live. */
+struct RawNrrdLayout {
+    std::string data_file;  //!< Detached data file as written in the header; empty = attached.
+    vne::io::binaryio::CodecId codec = vne::io::binaryio::CodecId::eNone;  //!< eGzip: stream runs to EOF.
+    bool from_end = false;  //!< "byte skip: -1": voxels are the last byteCount() bytes of the data file.
+    size_t offset = 0;      //!< Byte offset of the first voxel (unless from_end).
+    bool big_endian = false;
+};
 
-    Nrrd* nin = nrrdNew();
-    if (!nin) {
-        last_error_ = "NrrdLoader: failed to create Nrrd struct";
-        return false;
+/**
+ * @brief Parse a raw NRRD header, fill the volume's geometry and describe where its voxels are.
+ * @param require_host_order Report files whose byte order differs from the host as not eligible.
+ * @return eLoaded if the layout is handled natively, eNotEligible otherwise (use NrrdIO).
+ */
+MappedLoad describeRawNrrd(const std::string& header_text,
+                           bool has_blank_line,
+                           size_t data_offset,
+                           bool require_host_order,
+                           Volume& out_volume,
+                           RawNrrdLayout& layout) {
+    RawNrrdHeader header;
+    if (!parseRawNrrdHeader(header_text, header)) {
+        return MappedLoad::eNotEligible;
+    }
+    const bool multi_byte = bytesPerVoxel(header.pixel_type) > 1;
+    // gzip is inflated natively when the codec is built in; byte skips then apply to the
+    // decompressed data, which is left to NrrdIO.
+    const bool gzip = (header.encoding == "gzip" || header.encoding == "gz")
+                      && vne::io::binaryio::findCodec(vne::io::binaryio::CodecId::eGzip) != nullptr;
+    if ((header.encoding != "raw" && !(gzip && header.byte_skip == 0)) || header.dimension < 1 || header.dimension > 3
+        || header.pixel_type == VolumePixelType::eUnknown || header.line_skip != 0 || header.byte_skip < -1
+        || (multi_byte && header.endian != "little" && header.endian != "big")
+        || (require_host_order && !rawVoxelsMatchHost(header.pixel_type, header.endian == "big"))) {
+        return MappedLoad::eNotEligible;
+    }
+    for (const int size : header.sizes) {
+        if (size <= 0) {
+            return MappedLoad::eNotEligible;
+        }
     }
 
-    char* err = nullptr;
-    if (nrrdLoad(nin, const_cast<char*>(path.c_str()), nullptr)) {
-        err = biffGetDone(NRRD);
-        last_error_ = std::string("NrrdLoader: ") + (err ? err : "unknown error");
-        if (err) {
-            free(err);
+    layout = RawNrrdLayout{};
+    layout.big_endian = header.endian == "big";
+    if (gzip) {
+        layout.codec = vne::io::binaryio::CodecId::eGzip;
+    }
+    if (!header.data_file.empty()) {
+        // Multi-file ("LIST", printf-style patterns) and relative-to-LIST layouts go through NrrdIO.
+        if (header.data_file == "LIST" || header.data_file.find_first_of("% \t") != std::string::npos) {
+            return MappedLoad::eNotEligible;
         }
-        nrrdNuke(nin);
-        return false;
+        layout.data_file = header.data_file;
+    } else {
+        if (!has_blank_line) {
+            return MappedLoad::eNotEligible;
+        }
+        layout.offset = data_offset;
+    }
+    if (header.byte_skip == -1) {
+        layout.from_end = true;
+    } else {
+        layout.offset += static_cast<size_t>(header.byte_skip);
     }
 
+    out_volume.dims[0] = header.sizes[0];
+    out_volume.dims[1] = header.sizes[1];
+    out_volume.dims[2] = header.sizes[2];
+    out_volume.pixel_type = header.pixel_type;
+
+    for (unsigned int i = 0; i < header.dimension && i < 3u; ++i) {
+        if (!std::isnan(header.spacings[i]) && header.spacings[i] > 0) {
+            out_volume.spacing[i] = static_cast<float>(header.spacings[i]);
+        }
+    }
+    if (header.space_dim > 0 && header.space_dim <= 3) {
+        for (unsigned int i = 0; i < header.space_dim; ++i) {
+            out_volume.origin[i] = static_cast<float>(header.origin[i]);
+        }
+    }
+    if (header.space_dim == 3) {
+        for (int i = 0; i < 3; ++i) {
+            const double* d = header.directions[i];
+            if (!std::isnan(d[0]) && !std::isnan(d[1]) && !std::isnan(d[2])) {
+                out_volume.direction[i * 3 + 0] = static_cast<float>(d[0]);
+                out_volume.direction[i * 3 + 1] = static_cast<float>(d[1]);
+                out_volume.direction[i * 3 + 2] = static_cast<float>(d[2]);
+            }
+        }
+    }
+    return MappedLoad::eLoaded;
+}
+
+MappedLoad loadNrrdMapped(const std::string& path, Volume& out_volume, std::string& error) {
+    VNEIO_TRACE_SPAN("NrrdLoader::map");
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        return MappedLoad::eNotEligible;  // let NrrdIO report the error
+    }
+    std::string header_text;
+    std::streamoff data_offset = 0;
+    // Detached headers (.nhdr) may end at EOF without a blank line.
+    const vne::io::Status header_status = vne::io::binaryio::readHeaderUntilBlankLine(f, header_text, data_offset);
+    f.close();
+
+    RawNrrdLayout layout;
+    if (describeRawNrrd(header_text, header_status.ok(), static_cast<size_t>(data_offset), true, out_volume, layout)
+            != MappedLoad::eLoaded
+        || layout.codec != vne::io::binaryio::CodecId::eNone) {
+        return MappedLoad::eNotEligible;
+    }
+
+    std::string data_path = path;
+    if (!layout.data_file.empty()) {
+        std::filesystem::path data_file(layout.data_file);
+        if (data_file.is_relative()) {
+            data_file = std::filesystem::path(path).parent_path() / data_file;
+        }
+        data_path = data_file.string();
+    }
+
+    size_t offset = layout.offset;
+    if (layout.from_end) {
+        // Data is the last byteCount() bytes of the file.
+        std::error_code ec;
+        const uintmax_t file_size = std::filesystem::file_size(data_path, ec);
+        if (ec || file_size < out_volume.byteCount()) {
+            error = "NrrdLoader: data file shorter than volume: " + data_path;
+            return MappedLoad::eFailed;
+        }
+        offset = static_cast<size_t>(file_size - out_volume.byteCount());
+    }
+
+    if (!mapRawVoxels(data_path, offset, out_volume, error)) {
+        error = "NrrdLoader: " + error;
+        return MappedLoad::eFailed;
+    }
+    return MappedLoad::eLoaded;
+}
+
+/** @brief Copy a loaded Nrrd into a Volume (1D/2D are stored as 3D with unused dims = 1). */
+bool volumeFromNrrd(const Nrrd* nin, Volume& out_volume, std::string& error) {
     // Support 1D, 2D, or 3D; store as 3D volume (unused dims = 1)
     if (nin->dim < 1 || nin->dim > 3) {
-        last_error_ = "NrrdLoader: dimension 1, 2, or 3 supported, got " + std::to_string(nin->dim);
-        nrrdNuke(nin);
+        error = "NrrdLoader: dimension 1, 2, or 3 supported, got " + std::to_string(nin->dim);
         return false;
     }
 
@@ -107,8 +428,7 @@ bool NrrdLoader::load(const std::string& path, Volume& out_volume) {
             pixel_type = VolumePixelType::eFloat64;
             break;
         default:
-            last_error_ = "NrrdLoader: unsupported pixel type";
-            nrrdNuke(nin);
+            error = "NrrdLoader: unsupported pixel type";
             return false;
     }
 
@@ -118,8 +438,7 @@ bool NrrdLoader::load(const std::string& path, Volume& out_volume) {
         sizes[i] = static_cast<int>(nin->axis[i].size);
     }
     if (sizes[0] <= 0 || sizes[1] <= 0 || sizes[2] <= 0) {
-        last_error_ = "NrrdLoader: invalid sizes";
-        nrrdNuke(nin);
+        error = "NrrdLoader: invalid sizes";
         return false;
     }
 
@@ -155,12 +474,301 @@ bool NrrdLoader::load(const std::string& path, Volume& out_volume) {
     }
 
     // Copy data
+    VNEIO_TRACE_SPAN("NrrdLoader::copyVoxels");
     size_t num_bytes = out_volume.byteCount();
     out_volume.data.resize(num_bytes);
     std::memcpy(out_volume.data.data(), nin->data, num_bytes);
+    return true;
+}
+
+/** @brief Take the biff error message after a failed NrrdIO call (g_nrrdio_mutex held). */
+std::string takeNrrdError() {
+    char* err = biffGetDone(NRRD);
+    std::string error = std::string("NrrdLoader: ") + (err ? err : "unknown error");
+    if (err) {
+        free(err);
+    }
+    return error;
+}
+
+MappedLoad loadRawNrrd(const vne::io::IFile& file,
+                       const std::string& path,
+                       const vne::io::IFileSystem& fs,
+                       Volume& out_volume,
+                       std::string& error,
+                       bool share_data,
+                       const vne::io::LoadMonitor& monitor);
 
+bool loadNrrdFile(const std::string& path,
+                  Volume& out_volume,
+                  std::string& error,
+                  bool map_data = false,
+                  const vne::io::LoadMonitor& monitor = {}) {
+    error.clear();
+    out_volume = Volume{};
+
+    if (map_data) {
+        const MappedLoad mapped = loadNrrdMapped(path, out_volume, error);
+        if (mapped != MappedLoad::eNotEligible) {
+            return mapped == MappedLoad::eLoaded;
+        }
+        out_volume = Volume{};
+    }
+    {
+        // Read raw and gzip encodings natively: chunks go through binaryio's io_uring / pread reader, and
+        // unlike nrrdLoad() the read honors cancellation per chunk.
+        const vne::io::IFileSystem& native = vne::io::nativeFileSystem();
+        std::unique_ptr<vne::io::IFile> file;
+        if (native.openFile(path, file).ok()) {
+            const MappedLoad raw = loadRawNrrd(*file, path, native, out_volume, error, false, monitor);
+            if (raw != MappedLoad::eNotEligible) {
+                return raw == MappedLoad::eLoaded;
+            }
+            out_volume = Volume{};
+        }
+    }
+    if (!monitor.update("decode", 0, 1)) {
+        error = "NrrdLoader: load cancelled";
+        return false;
+    }
+
+    Nrrd* nin = nrrdNew();
+    if (!nin) {
+        error = "NrrdLoader: failed to create Nrrd struct";
+        return false;
+    }
+
+    {
+        // biff keeps a process-global error stack; serialize NrrdIO reads so concurrent loads stay safe.
+        std::lock_guard<std::mutex> lock(g_nrrdio_mutex);
+        VNEIO_TRACE_SPAN("NrrdLoader::nrrdLoad");
+        if (nrrdLoad(nin, const_cast<char*>(path.c_str()), nullptr)) {
+            error = takeNrrdError();
+            nrrdNuke(nin);
+            return false;
+        }
+    }
+
+    const bool converted = volumeFromNrrd(nin, out_volume, error);
     nrrdNuke(nin);
-    return true;
+    return converted && monitor.update("decode", 1, 1);
+}
+
+/**
+ * @brief Decode a single-file NRRD held in memory with NrrdIO (non-raw encodings from a VFS or buffer).
+ *
+ * NrrdIO reads from a FILE*, so the bytes are exposed through fmemopen(); detached data
+ * files cannot be resolved this way. Not available where fmemopen() is missing.
+ */
+bool loadNrrdFromMemory(const uint8_t* bytes, size_t size, Volume& out_volume, std::string& error) {
+#if defined(__unix__) || defined(__APPLE__)
+    FILE* stream = size > 0 ? fmemopen(const_cast<uint8_t*>(bytes), size, "rb") : nullptr;
+    if (!stream) {
+        error = "NrrdLoader: cannot open in-memory stream";
+        return false;
+    }
+    Nrrd* nin = nrrdNew();
+    if (!nin) {
+        std::fclose(stream);
+        error = "NrrdLoader: failed to create Nrrd struct";
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_nrrdio_mutex);
+        VNEIO_TRACE_SPAN("NrrdLoader::nrrdRead");
+        if (nrrdRead(nin, stream, nullptr)) {
+            error = takeNrrdError();
+            nrrdNuke(nin);
+            std::fclose(stream);
+            return false;
+        }
+    }
+    std::fclose(stream);
+    const bool converted = volumeFromNrrd(nin, out_volume, error);
+    nrrdNuke(nin);
+    return converted;
+#else
+    (void)bytes;
+    (void)size;
+    (void)out_volume;
+    error = "NrrdLoader: only raw encodings can be read through a virtual file system on this platform";
+    return false;
+#endif
+}
+
+/**
+ * @brief Read a raw-encoded NRRD from @p file, its data chunk by chunk through @p monitor.
+ * @param path Name of @p file; a detached data file is resolved next to it in @p fs.
+ * @return eNotEligible (volume untouched) for encodings NrrdIO has to decode.
+ */
+MappedLoad loadRawNrrd(const vne::io::IFile& file,
+                       const std::string& path,
+                       const vne::io::IFileSystem& fs,
+                       Volume& out_volume,
+                       std::string& error,
+                       bool share_data,
+                       const vne::io::LoadMonitor& monitor) {
+    RawNrrdLayout layout;
+    {
+        VNEIO_TRACE_SPAN("NrrdLoader::parseHeader");
+        std::string header_text;
+        size_t data_offset = 0;
+        const vne::io::Status header_status = vne::io::readHeaderUntilBlankLine(file, header_text, data_offset);
+        Volume described;
+        if (describeRawNrrd(header_text, header_status.ok(), data_offset, false, described, layout)
+            != MappedLoad::eLoaded) {
+            return MappedLoad::eNotEligible;
+        }
+        out_volume = std::move(described);
+    }
+
+    std::unique_ptr<vne::io::IFile> data_file;
+    std::string data_path = path;
+    if (!layout.data_file.empty()) {
+        data_path = vne::io::resolveSiblingPath(path, layout.data_file);
+        if (!fs.openFile(data_path, data_file).ok()) {
+            error = "NrrdLoader: cannot open data file: " + data_path;
+            return MappedLoad::eFailed;
+        }
+    }
+    const vne::io::IFile& source = data_file ? *data_file : file;
+    const bool host_order = rawVoxelsMatchHost(out_volume.pixel_type, layout.big_endian);
+    if (layout.codec != vne::io::binaryio::CodecId::eNone) {
+        VNEIO_TRACE_SPAN("NrrdLoader::inflate");
+        const uint64_t offset = std::min<uint64_t>(layout.offset, source.size());
+        if (!decodeVoxels(source, offset, source.size() - offset, layout.codec, out_volume, error, monitor)) {
+            error = "NrrdLoader: " + error + ": " + data_path;
+            return MappedLoad::eFailed;
+        }
+    } else {
+        uint64_t offset = layout.offset;
+        if (layout.from_end) {
+            if (source.size() < out_volume.byteCount()) {
+                error = "NrrdLoader: data file shorter than volume: " + data_path;
+                return MappedLoad::eFailed;
+            }
+            offset = source.size() - out_volume.byteCount();
+        }
+        VNEIO_TRACE_SPAN("NrrdLoader::readRaw");
+        if (!readRawVoxels(source, offset, share_data && host_order, out_volume, error, monitor)) {
+            error = "NrrdLoader: " + error + ": " + data_path;
+            return MappedLoad::eFailed;
+        }
+    }
+    if (!host_order) {
+        VNEIO_TRACE_SPAN("NrrdLoader::byteSwap");
+        const auto elem_size = static_cast<size_t>(bytesPerVoxel(out_volume.pixel_type));
+        if (!vne::io::byteSwapChunked(out_volume.data.data(), out_volume.data.size(), elem_size, monitor)) {
+            error = "NrrdLoader: load cancelled";
+            return MappedLoad::eFailed;
+        }
+    }
+    return MappedLoad::eLoaded;
+}
+
+/**
+ * @brief loadNrrdFile() reading the header (and attached data) from @p file.
+ * @param path Name of @p file; a detached data file is resolved next to it in @p fs.
+ */
+bool loadNrrdFromFile(const vne::io::IFile& file,
+                      const std::string& path,
+                      const vne::io::IFileSystem& fs,
+                      Volume& out_volume,
+                      std::string& error,
+                      bool share_data,
+                      const vne::io::LoadMonitor& monitor) {
+    error.clear();
+    out_volume = Volume{};
+
+    const MappedLoad raw = loadRawNrrd(file, path, fs, out_volume, error, share_data, monitor);
+    if (raw != MappedLoad::eNotEligible) {
+        return raw == MappedLoad::eLoaded;
+    }
+
+    if (!monitor.update("decode", 0, 1)) {
+        error = "NrrdLoader: load cancelled";
+        return false;
+    }
+    bool decoded = false;
+    if (const std::shared_ptr<const uint8_t> contents = file.contents()) {
+        decoded = loadNrrdFromMemory(contents.get(), static_cast<size_t>(file.size()), out_volume, error);
+    } else {
+        vne::io::ScratchArena scratch;
+        std::pmr::vector<uint8_t> bytes(static_cast<size_t>(file.size()), scratch.resource());
+        const vne::io::Status st = vne::io::readChunked(file, 0, bytes.data(), bytes.size(), monitor);
+        if (!st) {
+            error = st.code == vne::io::ErrorCode::eCancelled ? std::string("NrrdLoader: load cancelled")
+                                                               : "NrrdLoader: failed to read file: " + path;
+            return false;
+        }
+        decoded = loadNrrdFromMemory(bytes.data(), bytes.size(), out_volume, error);
+    }
+    return decoded && monitor.update("decode", 1, 1);
+}
+
+/** @brief loadNrrdFile() reading through a virtual file system. */
+bool loadNrrdFromFileSystem(const vne::io::IFileSystem& fs,
+                            const std::string& path,
+                            Volume& out_volume,
+                            std::string& error,
+                            bool share_data,
+                            const vne::io::LoadMonitor& monitor) {
+    std::unique_ptr<vne::io::IFile> file;
+    if (!fs.openFile(path, file).ok()) {
+        error = "NrrdLoader: cannot open file: " + path;
+        out_volume = Volume{};
+        return false;
+    }
+    return loadNrrdFromFile(*file, path, fs, out_volume, error, share_data, monitor);
+}
+
+}  // namespace
+
+bool NrrdLoader::canLoad(const vne::io::LoadRequest& request) const {
+    if (request.asset_type != vne::io::AssetType::eVolume) {
+        return false;
+    }
+    return isNrrdFormat(vne::io::requestFormat(request));
+}
+
+vne::io::LoadResult<vne::image::Volume> NrrdLoader::loadVolume(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("NrrdLoader::loadVolume");
+    vne::io::LoadResult<vne::image::Volume> result{Volume(volumeMemoryResource(request))};
+    std::string error;
+    bool loaded = false;
+    const vne::io::LoadMonitor monitor(request);
+    if (!request.buffer.empty()) {
+        // Caller-owned bytes are copied, never referenced; detached data resolves next to uri.
+        const vne::io::BufferFile file(reinterpret_cast<const uint8_t*>(request.buffer.data()), request.buffer.size());
+        const vne::io::IFileSystem& fs = request.file_system ? *request.file_system : vne::io::nativeFileSystem();
+        loaded = loadNrrdFromFile(file, request.uri, fs, result.value, error, false, monitor);
+    } else if (request.file_system) {
+        loaded = loadNrrdFromFileSystem(
+            *request.file_system, request.uri, result.value, error, request.memory_map, monitor);
+    } else {
+        loaded = loadNrrdFile(request.uri, result.value, error, request.memory_map, monitor);
+    }
+    if (!loaded) {
+        const vne::io::ErrorCode code =
+            monitor.cancelled() ? vne::io::ErrorCode::eCancelled : vne::io::ErrorCode::eParseError;
+        result.value = Volume{};
+        result.status = vne::io::Status::make(code, error, request.uri, "NrrdLoader");
+        return result;
+    }
+    result.status = vne::io::Status::okStatus();
+    return result;
+}
+
+const std::vector<std::string>& NrrdLoader::supportedExtensions() const {
+    return kNrrdExtensions;
+}
+
+bool NrrdLoader::isExtensionSupported(const std::string& path) const {
+    return isNrrdFormat(vne::io::fileExtension(path));
+}
+
+bool NrrdLoader::load(const std::string& path, Volume& out_volume) {
+    return loadNrrdFile(path, out_volume, last_error_);
 }
 
 }  // namespace image
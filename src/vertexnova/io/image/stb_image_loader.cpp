@@ -5,51 +5,89 @@
  */
 
 #include "vertexnova/io/image/stb_image_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
 #include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
 #include "vertexnova/io/load_request.h"
+#include "vertexnova/io/vfs/file_system.h"
 #include <algorithm>
-#include <cctype>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace vne {
 namespace image {
 
 namespace {
 
-std::string lowerExtension(const std::string& path) {
-    auto pos = path.find_last_of('.');
-    if (pos == std::string::npos) {
-        return "";
-    }
-    std::string ext = path.substr(pos);
-    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {
-        return static_cast<char>(std::tolower(c));
-    });
-    return ext;
+const std::vector<std::string> kStbExtensions = {"png", "jpg", "jpeg", "bmp", "tga", "gif", "psd", "hdr"};
+
+bool isStbFormat(const std::string& format) {
+    return std::find(kStbExtensions.begin(), kStbExtensions.end(), format) != kStbExtensions.end();
 }
 
 }  // namespace
 
 bool StbImageLoader::isExtensionSupported(const std::string& path) {
-    std::string ext = lowerExtension(path);
-    return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".tga" || ext == ".gif"
-           || ext == ".psd" || ext == ".hdr";
+    return isStbFormat(vne::io::fileExtension(path));
+}
+
+const std::vector<std::string>& StbImageLoader::supportedExtensions() const {
+    return kStbExtensions;
+}
+
+std::string StbImageLoader::optionsKey() const {
+    return "stb_image|flip";
 }
 
 bool StbImageLoader::canLoad(const vne::io::LoadRequest& request) const {
     if (request.asset_type != vne::io::AssetType::eImage) {
         return false;
     }
-    return isExtensionSupported(request.uri);
+    return isStbFormat(vne::io::requestFormat(request));
 }
 
 vne::io::LoadResult<Image> StbImageLoader::loadImage(const vne::io::LoadRequest& request) {
-    vne::io::LoadResult<Image> result;
-    last_error_.clear();
-    if (!result.value.loadFromFile(request.uri)) {
-        last_error_ = "StbImageLoader: failed to load image: " + request.uri;
-        result.status =
-            vne::io::Status::make(vne::io::ErrorCode::eFileReadFailed, last_error_, request.uri, "StbImageLoader");
+    VNEIO_TRACE_SPAN("StbImageLoader::loadImage");
+    vne::io::LoadResult<Image> result{Image(vne::io::assetMemoryResource(request))};
+    // stb decodes in one call, so cancellation is only observed before and after it.
+    const vne::io::LoadMonitor monitor(request);
+    auto cancelled = [&request]() {
+        return vne::io::Status::make(
+            vne::io::ErrorCode::eCancelled, "StbImageLoader: load cancelled", request.uri, "StbImageLoader");
+    };
+    if (!monitor.update("decode", 0, 1)) {
+        result.status = cancelled();
+        return result;
+    }
+    bool loaded = false;
+    {
+        VNEIO_TRACE_SPAN("StbImageLoader::decode");
+        if (!request.buffer.empty()) {
+            loaded = result.value.loadFromMemory(reinterpret_cast<const uint8_t*>(request.buffer.data()),
+                                                 request.buffer.size());
+        } else if (request.file_system) {
+            std::unique_ptr<vne::io::IFile> file;
+            result.status = request.file_system->openFile(request.uri, file);
+            if (!result.status) {
+                return result;
+            }
+            loaded = result.value.loadFromFile(*file);
+        } else {
+            loaded = result.value.loadFromFile(request.uri);
+        }
+    }
+    if (!loaded) {
+        result.status = vne::io::Status::make(vne::io::ErrorCode::eFileReadFailed,
+                                              "StbImageLoader: failed to load image: " + request.uri,
+                                              request.uri,
+                                              "StbImageLoader");
+        return result;
+    }
+    if (!monitor.update("decode", 1, 1)) {
+        result.value = Image{};
+        result.status = cancelled();
         return result;
     }
     result.status = vne::io::Status::okStatus();
@@ -8,9 +8,13 @@
 
 #include "vertexnova/io/image/volume_exporter.h"
 #include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/codec.h"
+#include "vertexnova/io/common/trace.h"
 
+#include <cstdint>
 #include <fstream>
 #include <filesystem>
+#include <vector>
 
 namespace vne::image {
 
@@ -57,6 +61,7 @@ bool exportMhd(const std::string& mhd_or_mha_path,
                const Volume& vol,
                const MhdExportOptions& opts,
                std::string* out_error) {
+    VNEIO_TRACE_SPAN("VolumeExporter::exportMhd");
     if (vol.isEmpty()) {
         setError(out_error, "exportMhd: volume is empty");
         return false;
@@ -71,12 +76,33 @@ bool exportMhd(const std::string& mhd_or_mha_path,
         return false;
     }
 
+    using vne::io::binaryio::CodecId;
+    if (opts.codec != CodecId::eNone && opts.codec != CodecId::eZlib) {
+        setError(out_error, "exportMhd: MetaImage payloads are raw or zlib (CompressedData)");
+        return false;
+    }
+    const bool compressed_data = opts.codec == CodecId::eZlib;
+
+    // Compress before touching the output so a missing codec leaves no partial files.
+    const auto* payload = static_cast<const uint8_t*>(vol.getData());
+    size_t bytes = vol.byteCount();
+    std::vector<uint8_t> compressed;
+    if (compressed_data) {
+        auto st = vne::io::binaryio::compressBuffer(opts.codec, payload, bytes, compressed, opts.compression_level);
+        if (!st) {
+            setError(out_error, "exportMhd: " + st.message);
+            return false;
+        }
+        payload = compressed.data();
+        bytes = compressed.size();
+    }
+
     const std::string ext = std::filesystem::path(mhd_or_mha_path).extension().string();
     const bool writing_mha = (ext == ".mha" || ext == ".MHA") || opts.inline_data;
 
     std::string raw_name = opts.raw_data_name;
     if (raw_name.empty()) {
-        raw_name = std::filesystem::path(mhd_or_mha_path).stem().string() + ".raw";
+        raw_name = std::filesystem::path(mhd_or_mha_path).stem().string() + (compressed_data ? ".zraw" : ".raw");
     }
     const std::string raw_path =
         (dirname(mhd_or_mha_path).empty() ? raw_name : (dirname(mhd_or_mha_path) + "/" + raw_name));
@@ -94,11 +120,14 @@ bool exportMhd(const std::string& mhd_or_mha_path,
     h << "ElementSpacing = " << vol.spacing[0] << " " << vol.spacing[1] << " " << vol.spacing[2] << "\n";
     h << "Position = " << vol.origin[0] << " " << vol.origin[1] << " " << vol.origin[2] << "\n";
     h << "ElementByteOrderMSB = False\n";
+    if (compressed_data) {
+        h << "CompressedData = True\n";
+        h << "CompressedDataSize = " << bytes << "\n";
+    }
 
     if (writing_mha) {
         h << "ElementDataFile = LOCAL\n\n";
-        const size_t bytes = vol.byteCount();
-        h.write(reinterpret_cast<const char*>(vol.data.data()), static_cast<std::streamsize>(bytes));
+        h.write(reinterpret_cast<const char*>(payload), static_cast<std::streamsize>(bytes));
         if (!h) {
             setError(out_error, "exportMhd: failed while writing inline payload");
             return false;
@@ -112,8 +141,7 @@ bool exportMhd(const std::string& mhd_or_mha_path,
         return false;
     }
 
-    const size_t bytes = vol.byteCount();
-    auto st = vne::io::binaryio::writeFile(raw_path, vol.data.data(), bytes);
+    auto st = vne::io::binaryio::writeFile(raw_path, payload, bytes);
     if (!st) {
         setError(out_error, "exportMhd: " + st.message);
         return false;
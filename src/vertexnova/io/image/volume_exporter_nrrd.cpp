@@ -2,15 +2,19 @@
  * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
  * Licensed under the Apache License, Version 2.0 (the "License").
  *
- * NRRD exporter (raw encoding only).
+ * NRRD exporter (raw or gzip encoding).
  * ----------------------------------------------------------------------
  */
 
 #include "vertexnova/io/image/volume_exporter.h"
 #include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/codec.h"
+#include "vertexnova/io/common/trace.h"
 
+#include <cstdint>
 #include <fstream>
 #include <filesystem>
+#include <vector>
 
 namespace vne::image {
 
@@ -57,6 +61,7 @@ bool exportNrrd(const std::string& nrrd_or_nhdr_path,
                const Volume& vol,
                const NrrdExportOptions& opts,
                std::string* out_error) {
+    VNEIO_TRACE_SPAN("VolumeExporter::exportNrrd");
     if (vol.isEmpty()) {
         setError(out_error, "exportNrrd: volume is empty");
         return false;
@@ -71,6 +76,27 @@ bool exportNrrd(const std::string& nrrd_or_nhdr_path,
         return false;
     }
 
+    using vne::io::binaryio::CodecId;
+    if (opts.codec != CodecId::eNone && opts.codec != CodecId::eGzip) {
+        setError(out_error, "exportNrrd: NRRD payloads are raw or gzip");
+        return false;
+    }
+    const bool gzip = opts.codec == CodecId::eGzip;
+
+    // Compress before touching the output so a missing codec leaves no partial files.
+    const auto* payload = static_cast<const uint8_t*>(vol.getData());
+    size_t bytes = vol.byteCount();
+    std::vector<uint8_t> compressed;
+    if (gzip) {
+        auto st = vne::io::binaryio::compressBuffer(opts.codec, payload, bytes, compressed, opts.compression_level);
+        if (!st) {
+            setError(out_error, "exportNrrd: " + st.message);
+            return false;
+        }
+        payload = compressed.data();
+        bytes = compressed.size();
+    }
+
     const bool detached = opts.detached_data;
     const std::string header_ext = std::filesystem::path(nrrd_or_nhdr_path).extension().string();
     const bool writing_nhdr = (header_ext == ".nhdr" || header_ext == ".NHDR");
@@ -78,7 +104,7 @@ bool exportNrrd(const std::string& nrrd_or_nhdr_path,
     // Determine raw payload path/name
     std::string raw_name = opts.detached_data_name;
     if (raw_name.empty()) {
-        raw_name = std::filesystem::path(nrrd_or_nhdr_path).stem().string() + ".raw";
+        raw_name = std::filesystem::path(nrrd_or_nhdr_path).stem().string() + (gzip ? ".raw.gz" : ".raw");
     }
     const std::string raw_path =
         (dirname(nrrd_or_nhdr_path).empty() ? raw_name : (dirname(nrrd_or_nhdr_path) + "/" + raw_name));
@@ -93,7 +119,7 @@ bool exportNrrd(const std::string& nrrd_or_nhdr_path,
     h << "type: " << type << "\n";
     h << "dimension: 3\n";
     h << "sizes: " << vol.dims[0] << " " << vol.dims[1] << " " << vol.dims[2] << "\n";
-    h << "encoding: raw\n";
+    h << "encoding: " << (gzip ? "gzip" : "raw") << "\n";
     h << "endian: little\n";
     h << "spacings: " << vol.spacing[0] << " " << vol.spacing[1] << " " << vol.spacing[2] << "\n";
     h << "space origin: (" << vol.origin[0] << "," << vol.origin[1] << "," << vol.origin[2] << ")\n";
@@ -115,9 +141,8 @@ bool exportNrrd(const std::string& nrrd_or_nhdr_path,
         return false;
     }
 
-    const size_t bytes = vol.byteCount();
     if (detached || writing_nhdr) {
-        auto st = vne::io::binaryio::writeFile(raw_path, vol.data.data(), bytes);
+        auto st = vne::io::binaryio::writeFile(raw_path, payload, bytes);
         if (!st) {
             setError(out_error, "exportNrrd: " + st.message);
             return false;
@@ -126,7 +151,7 @@ bool exportNrrd(const std::string& nrrd_or_nhdr_path,
     }
 
     // Attached data: append payload right after header terminator
-    h.write(reinterpret_cast<const char*>(vol.data.data()), static_cast<std::streamsize>(bytes));
+    h.write(reinterpret_cast<const char*>(payload), static_cast<std::streamsize>(bytes));
     if (!h) {
         setError(out_error, "exportNrrd: failed while writing payload");
         return false;
@@ -0,0 +1,192 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Internal helpers shared by the raw volume loaders (NRRD, MHD); not installed.
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/codec.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/scratch_arena.h"
+#include "vertexnova/io/image/volume.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace vne {
+namespace image {
+
+/**
+ * @brief Resource for a loaded volume's voxels: assetMemoryResource(), or aligned heap memory for
+ * a direct_io request without its own resource so direct reads land in Volume::data in place.
+ */
+[[nodiscard]] inline std::pmr::memory_resource* volumeMemoryResource(const vne::io::LoadRequest& request) {
+    if (request.direct_io && !request.memory_resource) {
+        return vne::io::binaryio::directIoMemoryResource();
+    }
+    return vne::io::assetMemoryResource(request);
+}
+
+/**
+ * @brief True if raw voxels stored with the given byte order can be used as-is on this host.
+ * @param pixel_type Voxel scalar type.
+ * @param big_endian_data True if the file stores multi-byte values most significant byte first.
+ */
+[[nodiscard]] inline bool rawVoxelsMatchHost(VolumePixelType pixel_type, bool big_endian_data) {
+    if (bytesPerVoxel(pixel_type) <= 1) {
+        return true;
+    }
+    return big_endian_data == (std::endian::native == std::endian::big);
+}
+
+/**
+ * @brief Back a volume's voxels by a read-only mapping of [offset, offset + byteCount()) of a file.
+ *
+ * Dimensions and pixel type must already be set. If the mapped address is not aligned
+ * to the voxel size (e.g. an attached header of odd length), the voxels are copied
+ * once out of the mapping instead, so typed access stays aligned.
+ * @param path Data file path.
+ * @param offset Byte offset of the first voxel.
+ * @param volume Volume to fill.
+ * @param error Output error message on failure.
+ * @return true on success.
+ */
+[[nodiscard]] inline bool mapRawVoxels(const std::string& path, size_t offset, Volume& volume, std::string& error) {
+    const size_t num_bytes = volume.byteCount();
+    std::shared_ptr<const uint8_t> storage;
+    vne::io::Status status = vne::io::binaryio::mapFileRange(path, offset, num_bytes, storage);
+    if (!status) {
+        error = status.message + ": " + path;
+        return false;
+    }
+    const auto alignment = static_cast<uintptr_t>(bytesPerVoxel(volume.pixel_type));
+    if (alignment <= 1 || reinterpret_cast<uintptr_t>(storage.get()) % alignment == 0) {
+        volume.setExternalData(std::move(storage), num_bytes);
+        return true;
+    }
+    volume.data.assign(storage.get(), storage.get() + num_bytes);
+    return true;
+}
+
+/**
+ * @brief Fill a volume's voxels from [offset, offset + byteCount()) of a virtual file.
+ *
+ * Dimensions and pixel type must already be set. With @p share set and a resident
+ * file (IFile::contents(), e.g. memory or pack backends), the voxels reference the
+ * file's storage instead of being copied, subject to the same alignment rule as mapRawVoxels().
+ * @param file Data file.
+ * @param offset Byte offset of the first voxel.
+ * @param share Reference resident storage instead of copying when possible.
+ * @param volume Volume to fill.
+ * @param error Output error message on failure.
+ * @param monitor Cancellation / progress for the copy ("read" stage, polled per chunk).
+ * @return true on success.
+ */
+[[nodiscard]] inline bool readRawVoxels(const vne::io::IFile& file,
+                                        uint64_t offset,
+                                        bool share,
+                                        Volume& volume,
+                                        std::string& error,
+                                        const vne::io::LoadMonitor& monitor = {}) {
+    const size_t num_bytes = volume.byteCount();
+    if (offset > file.size() || num_bytes > file.size() - offset) {
+        error = "data file shorter than volume";
+        return false;
+    }
+    if (share) {
+        if (std::shared_ptr<const uint8_t> contents = file.contents()) {
+            const uint8_t* begin = contents.get() + offset;
+            const auto alignment = static_cast<uintptr_t>(bytesPerVoxel(volume.pixel_type));
+            if (alignment <= 1 || reinterpret_cast<uintptr_t>(begin) % alignment == 0) {
+                volume.setExternalData(std::shared_ptr<const uint8_t>(std::move(contents), begin), num_bytes);
+                return true;
+            }
+        }
+    }
+    volume.data.resize(num_bytes);
+    const vne::io::Status status = vne::io::readChunked(file, offset, volume.data.data(), num_bytes, monitor);
+    if (!status) {
+        volume.data.clear();
+        error = status.code == vne::io::ErrorCode::eCancelled ? "load cancelled" : "failed to read voxel data";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Fill a volume's voxels by decompressing [offset, offset + length) of a virtual file.
+ *
+ * Dimensions and pixel type must already be set, and the stream must decode to exactly
+ * byteCount() bytes. Resident files are decoded in place; others are read into scratch
+ * memory first.
+ * @param file Data file.
+ * @param offset Byte offset of the compressed stream.
+ * @param length Compressed size in bytes.
+ * @param codec Codec of the stream.
+ * @param volume Volume to fill.
+ * @param error Output error message on failure.
+ * @param monitor Cancellation / progress ("read" stage for the compressed bytes, then "decode").
+ * @return true on success.
+ */
+[[nodiscard]] inline bool decodeVoxels(const vne::io::IFile& file,
+                                       uint64_t offset,
+                                       uint64_t length,
+                                       vne::io::binaryio::CodecId codec,
+                                       Volume& volume,
+                                       std::string& error,
+                                       const vne::io::LoadMonitor& monitor = {}) {
+    if (offset > file.size() || length > file.size() - offset) {
+        error = "data file shorter than compressed payload";
+        return false;
+    }
+    const size_t num_bytes = volume.byteCount();
+    const auto packed_bytes = static_cast<size_t>(length);
+    vne::io::ScratchArena scratch;
+    std::pmr::vector<uint8_t> packed(scratch.resource());
+    const uint8_t* source = nullptr;
+    const std::shared_ptr<const uint8_t> contents = file.contents();
+    if (contents) {
+        source = contents.get() + offset;
+    } else {
+        packed.resize(packed_bytes);
+        const vne::io::Status status = vne::io::readChunked(file, offset, packed.data(), packed_bytes, monitor);
+        if (!status) {
+            error = status.code == vne::io::ErrorCode::eCancelled ? "load cancelled" : "failed to read voxel data";
+            return false;
+        }
+        source = packed.data();
+    }
+    if (!monitor.update("decode", 0, 1)) {
+        error = "load cancelled";
+        return false;
+    }
+    volume.data.resize(num_bytes);
+    const vne::io::Status status =
+        vne::io::binaryio::decompressBuffer(codec, source, packed_bytes, volume.data.data(), num_bytes);
+    if (!status) {
+        volume.data.clear();
+        error = status.message;
+        return false;
+    }
+    if (!monitor.update("decode", 1, 1)) {
+        volume.data.clear();
+        error = "load cancelled";
+        return false;
+    }
+    return true;
+}
+
+}  // namespace image
+}  // namespace vne
@@ -10,11 +10,19 @@
  */
 
 #include "vertexnova/io/mesh/assimp_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
 #include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
 #include "vertexnova/io/load_request.h"
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/native_file_system.h"
 #include "vertexnova/logging/logging.h"
 
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/ProgressHandler.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/version.h>
@@ -22,7 +30,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -31,6 +48,105 @@ constexpr float kMinNormalizeRadius = 1e-6f;
 
 CREATE_VNE_LOGGER_CATEGORY("vne.core.mesh.assimp");
 
+/** Read-only Assimp stream over a virtual file system handle. */
+class VfsIOStream final : public Assimp::IOStream {
+   public:
+    explicit VfsIOStream(std::unique_ptr<vne::io::IFile> file)
+        : file_(std::move(file)) {}
+
+    size_t Read(void* buffer, size_t size, size_t count) override {
+        if (size == 0 || count == 0) {
+            return 0;
+        }
+        const size_t got = file_->read(position_, buffer, size * count);
+        position_ += got;
+        return got / size;
+    }
+
+    size_t Write(const void*, size_t, size_t) override { return 0; }
+
+    aiReturn Seek(size_t offset, aiOrigin origin) override {
+        uint64_t target = offset;
+        if (origin == aiOrigin_CUR) {
+            target = position_ + offset;
+        } else if (origin == aiOrigin_END) {
+            if (offset > file_->size()) {
+                return AI_FAILURE;
+            }
+            target = file_->size() - offset;
+        }
+        if (target > file_->size()) {
+            return AI_FAILURE;
+        }
+        position_ = target;
+        return AI_SUCCESS;
+    }
+
+    size_t Tell() const override { return static_cast<size_t>(position_); }
+    size_t FileSize() const override { return static_cast<size_t>(file_->size()); }
+    void Flush() override {}
+
+   private:
+    std::unique_ptr<vne::io::IFile> file_;
+    uint64_t position_ = 0;
+};
+
+/**
+ * Assimp IO handler that resolves every path (including referenced files such as .mtl) through an IFileSystem.
+ * Every path Assimp probes or opens, found or not, is appended to @p dependencies when set.
+ */
+class VfsIOSystem final : public Assimp::IOSystem {
+   public:
+    explicit VfsIOSystem(const vne::io::IFileSystem& fs, std::vector<std::string>* dependencies = nullptr)
+        : fs_(fs)
+        , dependencies_(dependencies) {}
+
+    bool Exists(const char* file) const override {
+        record(file);
+        return file && fs_.exists(file);
+    }
+    char getOsSeparator() const override { return '/'; }
+
+    Assimp::IOStream* Open(const char* file, const char* mode) override {
+        if (!file || (mode && (std::strchr(mode, 'w') || std::strchr(mode, 'a')))) {
+            return nullptr;  // read-only
+        }
+        record(file);
+        std::unique_ptr<vne::io::IFile> handle;
+        if (!fs_.openFile(file, handle).ok()) {
+            return nullptr;
+        }
+        return new VfsIOStream(std::move(handle));
+    }
+
+    void Close(Assimp::IOStream* stream) override { delete stream; }
+
+   private:
+    void record(const char* file) const {
+        if (dependencies_ && file) {
+            dependencies_->emplace_back(file);
+        }
+    }
+
+    const vne::io::IFileSystem& fs_;
+    std::vector<std::string>* dependencies_;
+};
+
+/** Forwards Assimp import progress to a LoadMonitor ("decode" stage, percent) and aborts the import on cancel. */
+class MonitorProgressHandler final : public Assimp::ProgressHandler {
+   public:
+    explicit MonitorProgressHandler(const vne::io::LoadMonitor& monitor)
+        : monitor_(monitor) {}
+
+    bool Update(float percentage) override {
+        const auto percent = static_cast<uint64_t>(std::clamp(percentage, 0.0f, 1.0f) * 100.0f);
+        return monitor_.update("decode", percent, 100);
+    }
+
+   private:
+    const vne::io::LoadMonitor& monitor_;
+};
+
 /**
  * @brief Build Assimp processing flags from options
  * @param opts Loading options
@@ -78,25 +194,27 @@ uint32_t BuildAssimpFlags(const vne::mesh::AssimpLoaderOptions& opts) {
 namespace vne {
 namespace mesh {
 
-vne::io::LoadResult<Mesh> AssimpLoader::loadMesh(const vne::io::LoadRequest& request) {
-    vne::io::LoadResult<Mesh> result;
-    if (!loadFile(request.uri, result.value)) {
-        result.status =
-            vne::io::Status::make(vne::io::ErrorCode::eParseError, getLastError(), request.uri, "AssimpLoader");
-        return result;
-    }
-    result.status = vne::io::Status::okStatus();
-    return result;
-}
-
-bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh) {
-    return loadFile(path, out_mesh, AssimpLoaderOptions{});
-}
+namespace {
 
-bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const AssimpLoaderOptions& opts) {
-    last_error_.clear();
+bool loadAssimpFile(const std::string& path,
+                    Mesh& out_mesh,
+                    const AssimpLoaderOptions& opts,
+                    std::string& error,
+                    const vne::io::IFileSystem* fs = nullptr,
+                    std::span<const std::byte> buffer = {},
+                    const std::string& format_hint = {},
+                    const vne::io::LoadMonitor& monitor = {},
+                    std::vector<std::string>* dependencies = nullptr) {
+    error.clear();
 
     Assimp::Importer importer;
+    // Recording the files an import reads needs our handler, so OS paths then go through nativeFileSystem().
+    if (fs || dependencies) {
+        importer.SetIOHandler(new VfsIOSystem(fs ? *fs : vne::io::nativeFileSystem(), dependencies));  // owned
+    }
+    if (monitor.active()) {
+        importer.SetProgressHandler(new MonitorProgressHandler(monitor));  // owned by the importer
+    }
     const unsigned int flags = BuildAssimpFlags(opts);
 
     VNE_LOG_INFO << "Loading mesh from: " << path;
@@ -104,16 +222,29 @@ bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const Assim
                  << aiGetVersionRevision();
     VNE_LOG_DEBUG << "Assimp processing flags: 0x" << std::hex << flags << std::dec;
 
-    const aiScene* scene = importer.ReadFile(path, flags);
+    // Caller buffers are parsed in place; the hint picks the importer when there is no file name.
+    const aiScene* scene = nullptr;
+    {
+        VNEIO_TRACE_SPAN("AssimpLoader::readFile");
+        scene = buffer.empty() ? importer.ReadFile(path, flags)
+                               : importer.ReadFileFromMemory(buffer.data(), buffer.size(), flags, format_hint.c_str());
+    }
+    if (monitor.cancelled()) {
+        error = "Assimp load cancelled";
+        return false;
+    }
     if (!scene || !scene->mRootNode) {
-        last_error_ = "Assimp failed to load file: " + std::string(importer.GetErrorString());
-        VNE_LOG_ERROR << last_error_;
+        error = "Assimp failed to load file: " + std::string(importer.GetErrorString());
+        VNE_LOG_ERROR << error;
         return false;
     }
 
     VNE_LOG_INFO << "Successfully loaded scene with " << scene->mNumMeshes << " meshes and " << scene->mNumMaterials
                  << " materials";
 
+    // Conversion into out_mesh; normalize/barycentrics below record nested spans.
+    VNEIO_TRACE_SPAN("AssimpLoader::convert");
+
     // Clear output mesh
     out_mesh.vertices.clear();
     out_mesh.indices.clear();
@@ -166,6 +297,10 @@ bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const Assim
     uint32_t base_vertex = 0;
 
     for (unsigned m = 0; m < scene->mNumMeshes; ++m) {
+        if (!monitor.update("convert", m, scene->mNumMeshes)) {
+            error = "Assimp load cancelled";
+            return false;
+        }
         const aiMesh* am = scene->mMeshes[m];
 
         // Skip non-triangle meshes or empty meshes
@@ -285,6 +420,7 @@ bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const Assim
 
         base_vertex += vcount;
     }
+    (void)monitor.update("convert", scene->mNumMeshes, scene->mNumMeshes);
 
     const bool success = !out_mesh.vertices.empty() && !out_mesh.indices.empty();
 
@@ -296,13 +432,14 @@ bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const Assim
                      << out_mesh.aabb_min[2] << "], max: [" << out_mesh.aabb_max[0] << ", " << out_mesh.aabb_max[1]
                      << ", " << out_mesh.aabb_max[2] << "]";
     } else {
-        last_error_ = "Failed to load any valid mesh data";
-        VNE_LOG_ERROR << last_error_;
+        error = "Failed to load any valid mesh data";
+        VNE_LOG_ERROR << error;
         return false;
     }
 
     // ---- Optional: normalize mesh to a canonical size ----
     if (opts.normalize_to_unit_sphere && !out_mesh.vertices.empty()) {
+        VNEIO_TRACE_SPAN("AssimpLoader::normalize");
         const float min_x = out_mesh.aabb_min[0];
         const float min_y = out_mesh.aabb_min[1];
         const float min_z = out_mesh.aabb_min[2];
@@ -351,13 +488,15 @@ bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const Assim
 
     // ---- Optional: generate barycentrics for wireframe rendering ----
     if (opts.generate_barycentrics) {
+        VNEIO_TRACE_SPAN("AssimpLoader::barycentrics");
         if (out_mesh.indices.size() % 3 != 0) {
             VNE_LOG_WARN << "generate_barycentrics requested, but index count is not divisible by 3. Skipping.";
         } else {
             VNE_LOG_INFO << "Generating barycentrics (de-indexing triangles) for wireframe support";
 
-            std::vector<VertexAttributes> new_vertices;
-            std::vector<uint32_t> new_indices;
+            // The de-indexed arrays become the mesh's, so they share its memory resource (O(1) move below).
+            std::pmr::vector<VertexAttributes> new_vertices(out_mesh.vertices.get_allocator());
+            std::pmr::vector<uint32_t> new_indices(out_mesh.indices.get_allocator());
             std::vector<Submesh> new_parts;
 
             new_vertices.reserve(out_mesh.indices.size());
@@ -429,19 +568,106 @@ bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const Assim
     return success;
 }
 
-namespace {
-bool assimpIsExtensionSupported(const std::string& path) {
-    const auto pos = path.find_last_of('.');
-    if (pos == std::string::npos) {
-        return false;
+}  // namespace
+
+vne::io::LoadResult<Mesh> AssimpLoader::loadMesh(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("AssimpLoader::loadMesh");
+    vne::io::LoadResult<Mesh> result{Mesh(vne::io::assetMemoryResource(request))};
+    std::string error;
+    std::string hint;
+    if (!request.buffer.empty()) {
+        hint = vne::io::requestFormat(request);
+        hint = hint.empty() ? vne::io::sniffRequestFormat(request) : hint;
     }
-    Assimp::Importer importer;
-    return importer.IsExtensionSupported(path.substr(pos));
+    const vne::io::LoadMonitor monitor(request);
+    if (!loadAssimpFile(request.uri,
+                        result.value,
+                        options_,
+                        error,
+                        request.file_system,
+                        request.buffer,
+                        hint,
+                        monitor,
+                        request.dependencies)) {
+        const vne::io::ErrorCode code =
+            monitor.cancelled() ? vne::io::ErrorCode::eCancelled : vne::io::ErrorCode::eParseError;
+        result.value = Mesh{};
+        result.status = vne::io::Status::make(code, error, request.uri, "AssimpLoader");
+        return result;
+    }
+    result.status = vne::io::Status::okStatus();
+    return result;
 }
+
+std::string AssimpLoader::optionsKey() const {
+    std::string key = "assimp";
+    key += std::to_string(aiGetVersionMajor());
+    key += '.';
+    key += std::to_string(aiGetVersionMinor());
+    key += '.';
+    key += std::to_string(aiGetVersionRevision());
+    key += '|';
+    for (const bool flag : {options_.flip_uvs,
+                            options_.gen_tangents,
+                            options_.triangulate,
+                            options_.calc_normals_if_missing,
+                            options_.pre_transform_vertices,
+                            options_.ensure_ccw_winding,
+                            options_.normalize_to_unit_sphere,
+                            options_.generate_barycentrics}) {
+        key += flag ? '1' : '0';
+    }
+    key += '|';
+    key += std::to_string(options_.normalize_target_radius);
+    key += '|';
+    key += std::to_string(options_.normalize_fill);
+    return key;
+}
+
+bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh) {
+    return loadFile(path, out_mesh, AssimpLoaderOptions{});
+}
+
+bool AssimpLoader::loadFile(const std::string& path, Mesh& out_mesh, const AssimpLoaderOptions& opts) {
+    return loadAssimpFile(path, out_mesh, opts, last_error_);
+}
+
+namespace {
+
+/** Assimp's import extension list, queried once (constructing an Importer registers every importer). */
+struct AssimpExtensions {
+    std::vector<std::string> list;
+    std::unordered_set<std::string> set;
+};
+
+const AssimpExtensions& assimpExtensions() {
+    static const AssimpExtensions kExtensions = [] {
+        AssimpExtensions extensions;
+        std::string joined;
+        Assimp::Importer importer;
+        importer.GetExtensionList(joined);  // "*.3ds;*.obj;..."
+        size_t start = 0;
+        while (start <= joined.size()) {
+            const size_t end = std::min(joined.find(';', start), joined.size());
+            std::string ext = vne::io::normalizeFormat(std::string_view(joined).substr(start, end - start));
+            if (!ext.empty() && extensions.set.insert(ext).second) {
+                extensions.list.push_back(std::move(ext));
+            }
+            start = end + 1;
+        }
+        return extensions;
+    }();
+    return kExtensions;
+}
+
 }  // namespace
 
 bool AssimpLoader::isExtensionSupported(const std::string& path) const {
-    return assimpIsExtensionSupported(path);
+    return assimpExtensions().set.count(vne::io::fileExtension(path)) != 0;
+}
+
+const std::vector<std::string>& AssimpLoader::supportedExtensions() const {
+    return assimpExtensions().list;
 }
 
 }  // namespace mesh
@@ -0,0 +1,1040 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/gltf_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/json.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/parallel_for.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/mesh/mesh_source.h"
+#include "vertexnova/io/mesh/point_bounds.h"
+#include "vertexnova/logging/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+namespace vne {
+namespace mesh {
+
+namespace {
+
+CREATE_VNE_LOGGER_CATEGORY("vne.core.mesh.gltf");
+
+constexpr uint32_t kGlbMagic = 0x46546C67;      //!< "glTF"
+constexpr uint32_t kGlbJsonChunk = 0x4E4F534A;  //!< "JSON"
+constexpr uint32_t kGlbBinChunk = 0x004E4942;   //!< "BIN\0"
+constexpr size_t kGlbHeaderBytes = 12;
+constexpr size_t kGlbChunkHeaderBytes = 8;
+constexpr int64_t kTrianglesMode = 4;
+constexpr int64_t kMinByteStride = 4;  //!< glTF bufferView.byteStride range (multiples of 4).
+constexpr int64_t kMaxByteStride = 252;
+constexpr size_t kVerticesPerTask = size_t{1} << 16;
+constexpr size_t kIndicesPerTask = size_t{3} << 16;
+constexpr uint64_t kProgressPhases = 3;
+constexpr const char* kDefaultMaterialName = "DefaultMaterial";
+constexpr const char* kSubsystem = "GltfLoader";
+const std::vector<std::string> kGltfExtensions = {"gltf", "glb"};
+
+vne::io::Status gltfError(vne::io::ErrorCode code, const std::string& message, const std::string& uri) {
+    return vne::io::Status::make(code, message, uri, kSubsystem);
+}
+
+uint32_t loadLe32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16)
+           | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/** Non-negative integer member, or @p fallback when absent; -1 when present but not a valid count/index. */
+int64_t indexOf(const vne::io::json::Value& value, int64_t fallback = -1) {
+    if (value.isNull()) {
+        return fallback;
+    }
+    const int64_t index = value.asInt(-1);
+    return index < 0 ? -1 : index;
+}
+
+std::string dirname(const std::string& path) {
+    return std::filesystem::path(path).parent_path().string();
+}
+
+/** Decode %XX escapes of a relative URI reference. */
+std::string decodeUri(std::string_view uri) {
+    std::string out;
+    out.reserve(uri.size());
+    for (size_t i = 0; i < uri.size(); ++i) {
+        uint8_t value = 0;
+        if (uri[i] == '%' && i + 2 < uri.size()
+            && std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr == uri.data() + i + 3) {
+            out += static_cast<char>(value);
+            i += 2;
+        } else {
+            out += uri[i];
+        }
+    }
+    return out;
+}
+
+/** Decode standard base64 (padding optional); false on any other character. */
+bool decodeBase64(std::string_view text, std::vector<uint8_t>& out) {
+    out.clear();
+    out.reserve(text.size() / 4 * 3);
+    uint32_t bits = 0;
+    int count = 0;
+    for (const char c : text) {
+        int value = -1;
+        if (c >= 'A' && c <= 'Z') {
+            value = c - 'A';
+        } else if (c >= 'a' && c <= 'z') {
+            value = c - 'a' + 26;
+        } else if (c >= '0' && c <= '9') {
+            value = c - '0' + 52;
+        } else if (c == '+') {
+            value = 62;
+        } else if (c == '/') {
+            value = 63;
+        } else if (c == '=') {
+            break;
+        } else {
+            return false;
+        }
+        bits = (bits << 6) | static_cast<uint32_t>(value);
+        if (++count == 4) {
+            out.push_back(static_cast<uint8_t>(bits >> 16));
+            out.push_back(static_cast<uint8_t>(bits >> 8));
+            out.push_back(static_cast<uint8_t>(bits));
+            bits = 0;
+            count = 0;
+        }
+    }
+    if (count == 2) {
+        out.push_back(static_cast<uint8_t>(bits >> 4));
+    } else if (count == 3) {
+        out.push_back(static_cast<uint8_t>(bits >> 10));
+        out.push_back(static_cast<uint8_t>(bits >> 2));
+    }
+    return count != 1;
+}
+
+size_t componentSize(GltfComponentType type) {
+    switch (type) {
+        case GltfComponentType::eInt8:
+        case GltfComponentType::eUint8:
+            return 1;
+        case GltfComponentType::eInt16:
+        case GltfComponentType::eUint16:
+            return 2;
+        case GltfComponentType::eUint32:
+        case GltfComponentType::eFloat:
+            break;
+    }
+    return 4;
+}
+
+bool parseComponentType(int64_t value, GltfComponentType& out) {
+    switch (value) {
+        case 5120:
+        case 5121:
+        case 5122:
+        case 5123:
+        case 5125:
+        case 5126:
+            out = static_cast<GltfComponentType>(value);
+            return true;
+        default:
+            return false;
+    }
+}
+
+uint32_t componentCount(std::string_view type) {
+    static constexpr std::pair<std::string_view, uint32_t> kTypes[] = {
+        {"SCALAR", 1}, {"VEC2", 2}, {"VEC3", 3}, {"VEC4", 4}, {"MAT2", 4}, {"MAT3", 9}, {"MAT4", 16}};
+    for (const auto& [name, count] : kTypes) {
+        if (type == name) {
+            return count;
+        }
+    }
+    return 0;
+}
+
+// ---- Transforms -----------------------------------------------------------------------------------------------
+
+/** Affine node transform (column-major 4x4) with its normal matrix. */
+struct Transform {
+    float m[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    float normal[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};  //!< Cofactor of the upper 3x3, signed by its determinant.
+    bool identity = true;
+    bool flip_winding = false;  //!< Negative determinant: mirrored, so triangles change orientation.
+
+    void point(const float in[3], float out[3]) const {
+        for (int r = 0; r < 3; ++r) {
+            out[r] = m[r] * in[0] + m[4 + r] * in[1] + m[8 + r] * in[2] + m[12 + r];
+        }
+    }
+
+    /** Column-major 3x3 @p matrix times @p in, normalized. */
+    static void direction(const float (&matrix)[9], const float in[3], float out[3]) {
+        float v[3];
+        for (int r = 0; r < 3; ++r) {
+            v[r] = matrix[r] * in[0] + matrix[3 + r] * in[1] + matrix[6 + r] * in[2];
+        }
+        const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+        for (int r = 0; r < 3; ++r) {
+            out[r] = v[r] * scale;
+        }
+    }
+
+    void transformNormal(const float in[3], float out[3]) const { direction(normal, in, out); }
+
+    void transformTangent(const float in[3], float out[3]) const {
+        const float linear[9] = {m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9], m[10]};
+        direction(linear, in, out);
+    }
+
+    /** Recompute the identity flag, normal matrix and winding after m changed. */
+    void finish() {
+        static const float kIdentity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+        identity = std::equal(m, m + 16, kIdentity);
+        // Rows of the upper 3x3 are (a b c), (d e f), (g h i); its cofactors, row-major.
+        const float a = m[0], b = m[4], c = m[8];
+        const float d = m[1], e = m[5], f = m[9];
+        const float g = m[2], h = m[6], i = m[10];
+        const float cofactor[9] = {e * i - f * h, f * g - d * i, d * h - e * g,
+                                   c * h - b * i, a * i - c * g, b * g - a * h,
+                                   b * f - c * e, c * d - a * f, a * e - b * d};
+        const float det = a * cofactor[0] + b * cofactor[1] + c * cofactor[2];
+        flip_winding = det < 0.0f;
+        const float sign = flip_winding ? -1.0f : 1.0f;
+        for (int r = 0; r < 3; ++r) {
+            for (int col = 0; col < 3; ++col) {
+                normal[col * 3 + r] = cofactor[r * 3 + col] * sign;  // the cofactor matrix is det * inverse-transpose
+            }
+        }
+    }
+};
+
+Transform multiply(const Transform& parent, const float (&local)[16]) {
+    Transform out;
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                sum += parent.m[k * 4 + r] * local[c * 4 + k];
+            }
+            out.m[c * 4 + r] = sum;
+        }
+    }
+    out.finish();
+    return out;
+}
+
+/** Local matrix of a node: "matrix", or translation * rotation * scale. */
+void nodeMatrix(const vne::io::json::Value& node, float (&out)[16]) {
+    const vne::io::json::Value& matrix = node["matrix"];
+    if (matrix.size() == 16) {
+        for (size_t k = 0; k < 16; ++k) {
+            out[k] = static_cast<float>(matrix[k].asNumber());
+        }
+        return;
+    }
+    const vne::io::json::Value& t = node["translation"];
+    const vne::io::json::Value& r = node["rotation"];
+    const vne::io::json::Value& s = node["scale"];
+    const float x = static_cast<float>(r[size_t{0}].asNumber(0.0));
+    const float y = static_cast<float>(r[1].asNumber(0.0));
+    const float z = static_cast<float>(r[2].asNumber(0.0));
+    const float w = static_cast<float>(r[3].asNumber(1.0));
+    const float scale[3] = {static_cast<float>(s[size_t{0}].asNumber(1.0)),
+                            static_cast<float>(s[1].asNumber(1.0)),
+                            static_cast<float>(s[2].asNumber(1.0))};
+    const float rotation[9] = {1 - 2 * (y * y + z * z), 2 * (x * y + z * w),     2 * (x * z - y * w),
+                               2 * (x * y - z * w),     1 - 2 * (x * x + z * z), 2 * (y * z + x * w),
+                               2 * (x * z + y * w),     2 * (y * z - x * w),     1 - 2 * (x * x + y * y)};
+    for (int c = 0; c < 3; ++c) {
+        for (int row = 0; row < 3; ++row) {
+            out[c * 4 + row] = rotation[c * 3 + row] * scale[c];
+        }
+        out[c * 4 + 3] = 0.0f;
+    }
+    out[12] = static_cast<float>(t[size_t{0}].asNumber(0.0));
+    out[13] = static_cast<float>(t[1].asNumber(0.0));
+    out[14] = static_cast<float>(t[2].asNumber(0.0));
+    out[15] = 1.0f;
+}
+
+// ---- Accessor decoding ----------------------------------------------------------------------------------------
+
+float componentAsFloat(const std::byte* p, GltfComponentType type, bool normalized) {
+    switch (type) {
+        case GltfComponentType::eInt8: {
+            const auto v = static_cast<int8_t>(*p);
+            return normalized ? std::max(static_cast<float>(v) / 127.0f, -1.0f) : static_cast<float>(v);
+        }
+        case GltfComponentType::eUint8: {
+            const auto v = static_cast<uint8_t>(*p);
+            return normalized ? static_cast<float>(v) / 255.0f : static_cast<float>(v);
+        }
+        case GltfComponentType::eInt16: {
+            int16_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return normalized ? std::max(static_cast<float>(v) / 32767.0f, -1.0f) : static_cast<float>(v);
+        }
+        case GltfComponentType::eUint16: {
+            uint16_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return normalized ? static_cast<float>(v) / 65535.0f : static_cast<float>(v);
+        }
+        case GltfComponentType::eUint32: {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return static_cast<float>(v);
+        }
+        case GltfComponentType::eFloat:
+            break;
+    }
+    float v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/** Element @p i of @p view as @p n floats (zeros for an accessor without a bufferView). */
+void readFloats(const GltfAccessorView& view, size_t i, float* out, uint32_t n) {
+    if (view.data == nullptr) {
+        std::fill(out, out + n, 0.0f);
+        return;
+    }
+    const std::byte* element = view.data + i * view.stride;
+    if (view.component_type == GltfComponentType::eFloat) {
+        std::memcpy(out, element, n * sizeof(float));  // the common case: a plain copy
+        return;
+    }
+    const size_t size = componentSize(view.component_type);
+    for (uint32_t c = 0; c < n; ++c) {
+        out[c] = componentAsFloat(element + c * size, view.component_type, view.normalized);
+    }
+}
+
+uint32_t readIndex(const GltfAccessorView& view, size_t i) {
+    if (view.data == nullptr) {
+        return 0;
+    }
+    const std::byte* element = view.data + i * view.stride;
+    switch (view.component_type) {
+        case GltfComponentType::eUint8:
+            return static_cast<uint8_t>(*element);
+        case GltfComponentType::eUint16: {
+            uint16_t v;
+            std::memcpy(&v, element, sizeof(v));
+            return v;
+        }
+        default: {
+            uint32_t v;
+            std::memcpy(&v, element, sizeof(v));
+            return v;
+        }
+    }
+}
+
+// ---- Document -------------------------------------------------------------------------------------------------
+
+/** Bytes backing a glTF asset: the file itself, external buffers and decoded data: URIs. */
+struct GltfStorage {
+    std::vector<std::unique_ptr<MeshSource>> sources;
+    std::vector<std::vector<uint8_t>> decoded;
+    std::vector<std::span<const uint8_t>> buffers;  //!< glTF buffers, by index.
+};
+
+/** Glb/JSON container, buffers, materials and triangle primitives of one glTF asset. */
+class GltfDocument {
+   public:
+    GltfDocument(const vne::io::LoadRequest& request, const vne::io::LoadMonitor& monitor)
+        : request_(request)
+        , monitor_(monitor)
+        , storage_(std::make_shared<GltfStorage>()) {}
+
+    /**
+     * Map the file and resolve everything but node transforms.
+     * @param views_only Fail on accessors without a bufferView instead of reading them as zeros.
+     */
+    [[nodiscard]] vne::io::Status open(bool views_only) {
+        VNEIO_TRACE_SPAN("GltfLoader::open");
+        views_only_ = views_only;
+        auto source = std::make_unique<MeshSource>();
+        vne::io::Status status = source->open(request_, monitor_);
+        if (!status) {
+            return status;
+        }
+        std::span<const uint8_t> bin;
+        std::string_view text;
+        status = splitContainer(source->data(), source->size(), text, bin);
+        storage_->sources.push_back(std::move(source));
+        if (!status) {
+            return status;
+        }
+        std::string parse_error;
+        if (!vne::io::json::parse(text, doc_, parse_error) || !doc_.isObject()) {
+            return error(vne::io::ErrorCode::eParseError, "Invalid glTF JSON: " + parse_error);
+        }
+        const std::string_view version = doc_["asset"]["version"].asString();
+        if (version.empty() || version[0] != '2') {
+            return error(vne::io::ErrorCode::eUnsupportedFormat, "Only glTF 2.0 is supported");
+        }
+        const vne::io::json::Value& required = doc_["extensionsRequired"];
+        if (required.size() != 0) {
+            std::string message = "Required glTF extension not supported: ";
+            message += required[size_t{0}].asString();
+            return error(vne::io::ErrorCode::eUnsupportedFeature, message);
+        }
+        if (!(status = resolveBuffers(bin)) || !(status = resolveMaterials()) || !(status = resolvePrimitives())) {
+            return status;
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    [[nodiscard]] const std::vector<GltfPrimitiveView>& primitives() const { return primitives_; }
+    [[nodiscard]] const std::vector<size_t>& meshPrimitives(size_t mesh) const { return mesh_primitives_[mesh]; }
+    [[nodiscard]] std::vector<Material>& materials() { return materials_; }
+    [[nodiscard]] std::shared_ptr<const void> storage() const { return storage_; }
+
+    /** Mesh instances to emit: every node with a mesh in the default scene, or each mesh once. */
+    [[nodiscard]] vne::io::Status instances(bool pre_transform,
+                                            std::vector<std::pair<size_t, Transform>>& out) const {
+        out.clear();
+        const vne::io::json::Value& scenes = doc_["scenes"];
+        if (!pre_transform || scenes.size() == 0) {
+            for (size_t m = 0; m < mesh_primitives_.size(); ++m) {
+                out.emplace_back(m, Transform{});
+            }
+            return vne::io::Status::okStatus();
+        }
+        const int64_t scene = indexOf(doc_["scene"], 0);
+        if (scene < 0 || static_cast<size_t>(scene) >= scenes.size()) {
+            return error(vne::io::ErrorCode::eParseError, "glTF scene index out of range");
+        }
+        return walkScene(scenes[static_cast<size_t>(scene)]["nodes"], out);
+    }
+
+   private:
+    [[nodiscard]] vne::io::Status error(vne::io::ErrorCode code, const std::string& message) const {
+        return gltfError(code, message, request_.uri);
+    }
+
+    /** JSON text and BIN chunk of a GLB, or the whole file as JSON. */
+    [[nodiscard]] vne::io::Status splitContainer(const uint8_t* data,
+                                                 size_t size,
+                                                 std::string_view& text,
+                                                 std::span<const uint8_t>& bin) const {
+        if (size < 4 || loadLe32(data) != kGlbMagic) {
+            text = std::string_view(reinterpret_cast<const char*>(data), size);
+            if (text.substr(0, 3) == "\xEF\xBB\xBF") {
+                text.remove_prefix(3);  // UTF-8 byte order mark
+            }
+            return vne::io::Status::okStatus();
+        }
+        if (size < kGlbHeaderBytes + kGlbChunkHeaderBytes) {
+            return error(vne::io::ErrorCode::eDataTruncated, "GLB header is truncated");
+        }
+        if (loadLe32(data + 4) != 2) {
+            return error(vne::io::ErrorCode::eUnsupportedFormat, "Only GLB version 2 is supported");
+        }
+        const size_t length = loadLe32(data + 8);
+        if (length > size) {
+            return error(vne::io::ErrorCode::eDataTruncated, "GLB is shorter than its header declares");
+        }
+        size_t pos = kGlbHeaderBytes;
+        for (int chunk = 0; pos + kGlbChunkHeaderBytes <= length; ++chunk) {
+            const size_t chunk_length = loadLe32(data + pos);
+            const uint32_t chunk_type = loadLe32(data + pos + 4);
+            pos += kGlbChunkHeaderBytes;
+            if (chunk_length > length - pos) {
+                return error(vne::io::ErrorCode::eDataTruncated, "GLB chunk is truncated");
+            }
+            if (chunk == 0 && chunk_type != kGlbJsonChunk) {
+                return error(vne::io::ErrorCode::eParseError, "GLB does not start with a JSON chunk");
+            }
+            if (chunk == 0) {
+                text = std::string_view(reinterpret_cast<const char*>(data + pos), chunk_length);
+            } else if (chunk == 1 && chunk_type == kGlbBinChunk) {
+                bin = std::span<const uint8_t>(data + pos, chunk_length);
+            }
+            pos += chunk_length;
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    [[nodiscard]] vne::io::Status resolveBuffers(std::span<const uint8_t> bin) {
+        const vne::io::json::Value& buffers = doc_["buffers"];
+        const std::string base_dir = dirname(request_.uri);
+        for (size_t b = 0; b < buffers.size(); ++b) {
+            const vne::io::json::Value& buffer = buffers[b];
+            const int64_t length = indexOf(buffer["byteLength"]);
+            const std::string_view uri = buffer["uri"].asString();
+            if (length < 0) {
+                return error(vne::io::ErrorCode::eParseError, "glTF buffer has no valid byteLength");
+            }
+            std::span<const uint8_t> bytes;
+            if (uri.empty()) {
+                if (b != 0 || bin.data() == nullptr) {
+                    return error(vne::io::ErrorCode::eParseError, "glTF buffer has no uri and no GLB BIN chunk");
+                }
+                bytes = bin;
+            } else if (uri.substr(0, 5) == "data:") {
+                const size_t comma = uri.find(',');
+                if (comma == std::string_view::npos || uri.substr(0, comma).find(";base64") == std::string_view::npos
+                    || !decodeBase64(uri.substr(comma + 1), storage_->decoded.emplace_back())) {
+                    return error(vne::io::ErrorCode::eParseError, "glTF data URI is not valid base64");
+                }
+                bytes = storage_->decoded.back();
+            } else {
+                vne::io::LoadRequest buffer_request;
+                const std::string name = decodeUri(uri);
+                buffer_request.uri = base_dir.empty() ? name : base_dir + "/" + name;
+                buffer_request.file_system = request_.file_system;
+                if (request_.dependencies) {
+                    request_.dependencies->push_back(buffer_request.uri);  // the cook cache re-checks it
+                }
+                auto source = std::make_unique<MeshSource>();
+                vne::io::Status status = source->open(buffer_request, monitor_);
+                if (!status) {
+                    return status;
+                }
+                bytes = std::span<const uint8_t>(source->data(), source->size());
+                storage_->sources.push_back(std::move(source));
+            }
+            if (bytes.size() < static_cast<uint64_t>(length)) {
+                return error(vne::io::ErrorCode::eDataTruncated, "glTF buffer is shorter than its byteLength");
+            }
+            storage_->buffers.push_back(bytes.first(static_cast<size_t>(length)));
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    [[nodiscard]] vne::io::Status resolveMaterials() {
+        const vne::io::json::Value& textures = doc_["textures"];
+        const vne::io::json::Value& images = doc_["images"];
+        for (const vne::io::json::Value& source : doc_["materials"].items()) {
+            Material material;
+            material.name = std::string(source["name"].asString());
+            const vne::io::json::Value& pbr = source["pbrMetallicRoughness"];
+            for (size_t c = 0; c < 4; ++c) {
+                material.base_color[c] = static_cast<float>(pbr["baseColorFactor"][c].asNumber(1.0));
+            }
+            const int64_t texture = indexOf(pbr["baseColorTexture"]["index"]);
+            const int64_t image = texture < 0 ? -1 : indexOf(textures[static_cast<size_t>(texture)]["source"]);
+            if (image >= 0 && static_cast<size_t>(image) < images.size()) {
+                const std::string_view uri = images[static_cast<size_t>(image)]["uri"].asString();
+                // Embedded images (bufferView or data: URI) get Assimp's "*<index>" name.
+                if (uri.empty() || uri.substr(0, 5) == "data:") {
+                    material.base_color_tex = '*' + std::to_string(image);
+                } else {
+                    material.base_color_tex = decodeUri(uri);
+                }
+            }
+            materials_.push_back(std::move(material));
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    /** View of accessor @p index, checked against its bufferView and buffer. */
+    [[nodiscard]] vne::io::Status accessor(int64_t index, GltfAccessorView& out) const {
+        const vne::io::json::Value& accessors = doc_["accessors"];
+        if (index < 0 || static_cast<size_t>(index) >= accessors.size()) {
+            return error(vne::io::ErrorCode::eParseError, "glTF accessor index out of range");
+        }
+        const vne::io::json::Value& source = accessors[static_cast<size_t>(index)];
+        const int64_t count = indexOf(source["count"]);
+        const int64_t offset = indexOf(source["byteOffset"], 0);
+        out = GltfAccessorView{};
+        out.components = componentCount(source["type"].asString());
+        out.normalized = source["normalized"].asBool();
+        if (count < 0 || offset < 0 || out.components == 0
+            || !parseComponentType(source["componentType"].asInt(), out.component_type)) {
+            return error(vne::io::ErrorCode::eParseError, "Invalid glTF accessor");
+        }
+        if (!source["sparse"].isNull()) {
+            return error(vne::io::ErrorCode::eUnsupportedFeature, "Sparse glTF accessors are not supported");
+        }
+        out.count = static_cast<size_t>(count);
+        out.stride = out.elementSize();
+        if (source["bufferView"].isNull()) {
+            return views_only_ ? error(vne::io::ErrorCode::eUnsupportedFeature,
+                                       "glTF accessor without a bufferView cannot be viewed")
+                               : vne::io::Status::okStatus();
+        }
+        const vne::io::json::Value& view = doc_["bufferViews"][static_cast<size_t>(indexOf(source["bufferView"]))];
+        const int64_t buffer = indexOf(view["buffer"]);
+        const int64_t view_offset = indexOf(view["byteOffset"], 0);
+        const int64_t view_length = indexOf(view["byteLength"]);
+        const int64_t stride = indexOf(view["byteStride"], 0);
+        if (view.isNull() || buffer < 0 || static_cast<size_t>(buffer) >= storage_->buffers.size() || view_offset < 0
+            || view_length < 0 || stride < 0) {
+            return error(vne::io::ErrorCode::eParseError, "Invalid glTF bufferView");
+        }
+        const std::span<const uint8_t> bytes = storage_->buffers[static_cast<size_t>(buffer)];
+        if (static_cast<uint64_t>(view_offset) + static_cast<uint64_t>(view_length) > bytes.size()) {
+            return error(vne::io::ErrorCode::eParseError, "glTF bufferView exceeds its buffer");
+        }
+        if (stride != 0) {
+            if (stride < kMinByteStride || stride > kMaxByteStride || stride % 4 != 0) {
+                return error(vne::io::ErrorCode::eParseError, "Invalid glTF byteStride");
+            }
+            if (static_cast<size_t>(stride) < out.elementSize()) {
+                return error(vne::io::ErrorCode::eParseError, "glTF byteStride is smaller than its elements");
+            }
+            out.stride = static_cast<size_t>(stride);
+        }
+        // Divide instead of multiplying: count comes from the file and (count - 1) * stride can overflow.
+        const auto length = static_cast<uint64_t>(view_length);
+        const auto start = static_cast<uint64_t>(offset);
+        const uint64_t element_size = out.elementSize();
+        if (out.count > 0
+            && (start > length || element_size > length - start
+                || out.count - 1 > (length - start - element_size) / out.stride)) {
+            return error(vne::io::ErrorCode::eParseError, "glTF accessor exceeds its bufferView");
+        }
+        out.data = reinterpret_cast<const std::byte*>(bytes.data() + view_offset + offset);
+        return vne::io::Status::okStatus();
+    }
+
+    /** Accessor of attribute @p name, checked for its allowed types; absent attributes stay empty. */
+    [[nodiscard]] vne::io::Status attribute(const vne::io::json::Value& attributes,
+                                            const char* name,
+                                            uint32_t components,
+                                            bool allow_normalized,
+                                            size_t count,
+                                            GltfAccessorView& out) const {
+        const vne::io::json::Value& index = attributes[name];
+        if (index.isNull()) {
+            return vne::io::Status::okStatus();
+        }
+        vne::io::Status status = accessor(indexOf(index), out);
+        if (!status) {
+            return status;
+        }
+        const bool float_data = out.component_type == GltfComponentType::eFloat;
+        const bool normalized_data = allow_normalized && out.normalized
+                                     && (out.component_type == GltfComponentType::eUint8
+                                         || out.component_type == GltfComponentType::eUint16);
+        if (out.components != components || !(float_data || normalized_data)) {
+            return error(vne::io::ErrorCode::eParseError, std::string("Unsupported glTF accessor type for ") + name);
+        }
+        if (out.count != count) {
+            return error(vne::io::ErrorCode::eParseError, std::string("glTF ") + name + " count differs from POSITION");
+        }
+        return status;
+    }
+
+    [[nodiscard]] vne::io::Status resolvePrimitives() {
+        const vne::io::json::Value& meshes = doc_["meshes"];
+        mesh_primitives_.resize(meshes.size());
+        int64_t default_material = -1;
+        for (size_t m = 0; m < meshes.size(); ++m) {
+            for (const vne::io::json::Value& source : meshes[m]["primitives"].items()) {
+                const vne::io::json::Value& attributes = source["attributes"];
+                if (indexOf(source["mode"], kTrianglesMode) != kTrianglesMode || attributes["POSITION"].isNull()) {
+                    VNE_LOG_WARN << "Skipping glTF primitive of mesh " << m << " - not triangles or no POSITION";
+                    continue;
+                }
+                GltfPrimitiveView primitive;
+                primitive.mesh_index = static_cast<uint32_t>(m);
+                vne::io::Status status = accessor(indexOf(attributes["POSITION"]), primitive.positions);
+                if (status && (primitive.positions.components != 3
+                               || primitive.positions.component_type != GltfComponentType::eFloat)) {
+                    status = error(vne::io::ErrorCode::eParseError, "glTF POSITION must be VEC3 float");
+                }
+                const size_t count = primitive.positions.count;
+                if (!status || !(status = attribute(attributes, "NORMAL", 3, false, count, primitive.normals))
+                    || !(status = attribute(attributes, "TANGENT", 4, false, count, primitive.tangents))
+                    || !(status = attribute(attributes, "TEXCOORD_0", 2, true, count, primitive.texcoord0))) {
+                    return status;
+                }
+                if (!source["indices"].isNull()) {
+                    status = accessor(indexOf(source["indices"]), primitive.indices);
+                    if (status && (primitive.indices.components != 1
+                                   || primitive.indices.component_type == GltfComponentType::eFloat
+                                   || primitive.indices.component_type == GltfComponentType::eInt8
+                                   || primitive.indices.component_type == GltfComponentType::eInt16)) {
+                        status = error(vne::io::ErrorCode::eParseError, "glTF indices must be unsigned SCALAR");
+                    }
+                    if (!status) {
+                        return status;
+                    }
+                }
+                const int64_t material = indexOf(source["material"]);
+                const size_t declared = doc_["materials"].size();  // materials_ may already hold the default
+                if (!source["material"].isNull() && (material < 0 || static_cast<size_t>(material) >= declared)) {
+                    return error(vne::io::ErrorCode::eParseError, "glTF material index out of range");
+                }
+                if (material < 0 && default_material < 0) {
+                    default_material = static_cast<int64_t>(materials_.size());
+                    materials_.push_back(Material{kDefaultMaterialName, "", {1.0f, 1.0f, 1.0f, 1.0f}});
+                }
+                primitive.material_index = static_cast<uint32_t>(material < 0 ? default_material : material);
+                mesh_primitives_[m].push_back(primitives_.size());
+                primitives_.push_back(primitive);
+            }
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    /**
+     * Depth-first walk of the node tree from @p roots, with an explicit stack (chains can be long).
+     * glTF nodes have at most one parent, so a node reached twice (shared child or cycle) is an error;
+     * this also bounds the walk to one visit per node.
+     */
+    [[nodiscard]] vne::io::Status walkScene(const vne::io::json::Value& roots,
+                                            std::vector<std::pair<size_t, Transform>>& out) const {
+        const vne::io::json::Value& nodes = doc_["nodes"];
+        std::vector<bool> visited(nodes.size(), false);
+        std::vector<std::pair<int64_t, Transform>> pending;
+        const auto push = [&pending](const vne::io::json::Value& children, const Transform& parent) {
+            const std::vector<vne::io::json::Value>& items = children.items();
+            for (auto it = items.rbegin(); it != items.rend(); ++it) {
+                pending.emplace_back(indexOf(*it), parent);  // reversed, so children pop in document order
+            }
+        };
+        push(roots, Transform{});
+        while (!pending.empty()) {
+            const int64_t node_index = pending.back().first;
+            const Transform parent = pending.back().second;
+            pending.pop_back();
+            if (node_index < 0 || static_cast<size_t>(node_index) >= nodes.size()) {
+                return error(vne::io::ErrorCode::eParseError, "glTF node index out of range");
+            }
+            if (visited[static_cast<size_t>(node_index)]) {
+                return error(vne::io::ErrorCode::eParseError, "glTF node has several parents or is part of a cycle");
+            }
+            visited[static_cast<size_t>(node_index)] = true;
+            const vne::io::json::Value& node = nodes[static_cast<size_t>(node_index)];
+            float local[16];
+            nodeMatrix(node, local);
+            const Transform world = multiply(parent, local);
+            if (!node["mesh"].isNull()) {
+                const int64_t mesh = indexOf(node["mesh"]);
+                if (mesh < 0 || static_cast<size_t>(mesh) >= mesh_primitives_.size()) {
+                    return error(vne::io::ErrorCode::eParseError, "glTF node mesh index out of range");
+                }
+                out.emplace_back(static_cast<size_t>(mesh), world);
+            }
+            push(node["children"], world);
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    const vne::io::LoadRequest& request_;
+    const vne::io::LoadMonitor& monitor_;
+    std::shared_ptr<GltfStorage> storage_;
+    vne::io::json::Value doc_;
+    std::vector<Material> materials_;
+    std::vector<GltfPrimitiveView> primitives_;
+    std::vector<std::vector<size_t>> mesh_primitives_;  //!< Indices into primitives_, per glTF mesh.
+    bool views_only_ = false;
+};
+
+// ---- Conversion -----------------------------------------------------------------------------------------------
+
+/** One emitted primitive instance: its source views, transform and ranges in the Mesh buffers. */
+struct Part {
+    const GltfPrimitiveView* primitive;
+    const Transform* transform;
+    size_t first_vertex;
+    size_t first_index;
+    size_t index_count;
+};
+
+/** Vertex or index range of one part, converted by one parallel task. */
+struct Task {
+    size_t part;
+    bool indices;
+    size_t begin;
+    size_t end;
+};
+
+class GltfMeshBuilder {
+   public:
+    GltfMeshBuilder(const vne::io::LoadRequest& request,
+                    const GltfLoaderOptions& options,
+                    const vne::io::LoadMonitor& monitor)
+        : request_(request)
+        , options_(options)
+        , monitor_(monitor) {}
+
+    [[nodiscard]] vne::io::Status build(GltfDocument& document, Mesh& mesh) {
+        VNEIO_TRACE_SPAN("GltfLoader::convert");
+        vne::io::Status status = document.instances(options_.pre_transform_vertices, instances_);
+        if (!status) {
+            return status;
+        }
+        uint64_t vertex_total = 0;
+        uint64_t index_total = 0;
+        for (const auto& [mesh_index, transform] : instances_) {
+            for (const size_t p : document.meshPrimitives(mesh_index)) {
+                const GltfPrimitiveView& primitive = document.primitives()[p];
+                const size_t corners = primitive.indices.empty() ? primitive.positions.count : primitive.indices.count;
+                parts_.push_back(Part{&primitive, &transform, static_cast<size_t>(vertex_total),
+                                      static_cast<size_t>(index_total), corners / 3 * 3});
+                vertex_total += primitive.positions.count;
+                index_total += parts_.back().index_count;
+            }
+        }
+        if (vertex_total > std::numeric_limits<uint32_t>::max() || index_total > std::numeric_limits<uint32_t>::max()) {
+            return gltfError(vne::io::ErrorCode::eUnsupportedFeature, "glTF asset too large for 32-bit indices",
+                             request_.uri);
+        }
+        if (vertex_total == 0 || index_total == 0) {
+            return gltfError(vne::io::ErrorCode::eParseError, "glTF asset has no triangle primitives", request_.uri);
+        }
+        mesh.vertices.resize(static_cast<size_t>(vertex_total));
+        mesh.indices.resize(static_cast<size_t>(index_total));
+        planTasks();
+        bounds_.resize(tasks_.size());
+        vne::io::parallelFor(
+            tasks_.size(),
+            [&](size_t t) {
+                if (!monitor_.cancelled()) {
+                    runTask(t, mesh);
+                }
+            },
+            options_.max_threads);
+        if (monitor_.cancelled()) {
+            return gltfError(vne::io::ErrorCode::eCancelled, "glTF load cancelled", request_.uri);
+        }
+        if (bad_index_.load()) {
+            return gltfError(vne::io::ErrorCode::eParseError, "glTF index references a missing vertex", request_.uri);
+        }
+
+        mesh.name = request_.uri;
+        mesh.materials = std::move(document.materials());
+        mesh.parts.clear();
+        mesh.has_normals = mesh.has_uv0 = mesh.has_tangent = false;
+        for (const Part& part : parts_) {
+            const GltfPrimitiveView& primitive = *part.primitive;
+            if (part.index_count != 0) {
+                mesh.parts.push_back(Submesh{static_cast<uint32_t>(part.first_index),
+                                             static_cast<uint32_t>(part.index_count), primitive.material_index});
+            }
+            // OR across submeshes, like AssimpLoader.
+            mesh.has_normals = mesh.has_normals || !primitive.normals.empty();
+            mesh.has_uv0 = mesh.has_uv0 || !primitive.texcoord0.empty();
+            mesh.has_tangent = mesh.has_tangent || hasTangents(primitive);
+        }
+        PointBounds all;
+        for (const PointBounds& b : bounds_) {
+            all.merge(b);
+        }
+        all.storeXyz(mesh.aabb_min, mesh.aabb_max);
+        return vne::io::Status::okStatus();
+    }
+
+   private:
+    static bool hasTangents(const GltfPrimitiveView& primitive) {
+        return !primitive.tangents.empty() && !primitive.normals.empty() && !primitive.texcoord0.empty();
+    }
+
+    void planTasks() {
+        for (size_t p = 0; p < parts_.size(); ++p) {
+            const size_t vertices = parts_[p].primitive->positions.count;
+            for (size_t begin = 0; begin < vertices; begin += kVerticesPerTask) {
+                tasks_.push_back(Task{p, false, begin, std::min(vertices, begin + kVerticesPerTask)});
+            }
+            for (size_t begin = 0; begin < parts_[p].index_count; begin += kIndicesPerTask) {
+                tasks_.push_back(Task{p, true, begin, std::min(parts_[p].index_count, begin + kIndicesPerTask)});
+            }
+        }
+    }
+
+    void runTask(size_t t, Mesh& mesh) {
+        const Task& task = tasks_[t];
+        const Part& part = parts_[task.part];
+        if (task.indices) {
+            convertIndices(part, task.begin, task.end, mesh.indices.data() + part.first_index);
+        } else {
+            convertVertices(part, task.begin, task.end, mesh.vertices.data() + part.first_vertex, bounds_[t]);
+        }
+    }
+
+    void convertVertices(const Part& part, size_t begin, size_t end, VertexAttributes* out, PointBounds& bounds) const {
+        const GltfPrimitiveView& primitive = *part.primitive;
+        const Transform& transform = *part.transform;
+        const bool tangents = hasTangents(primitive);
+        for (size_t v = begin; v < end; ++v) {
+            VertexAttributes& vertex = out[v];
+            vertex = VertexAttributes{};
+            readFloats(primitive.positions, v, vertex.position, 3);
+            if (!primitive.normals.empty()) {
+                readFloats(primitive.normals, v, vertex.normal, 3);
+            } else {
+                vertex.normal[1] = 1.0f;
+            }
+            if (tangents) {
+                float tangent[4];
+                readFloats(primitive.tangents, v, tangent, 4);
+                std::copy(tangent, tangent + 3, vertex.tangent);
+                const float* n = vertex.normal;
+                const float w = tangent[3] < 0.0f ? -1.0f : 1.0f;
+                vertex.bitangent[0] = (n[1] * tangent[2] - n[2] * tangent[1]) * w;
+                vertex.bitangent[1] = (n[2] * tangent[0] - n[0] * tangent[2]) * w;
+                vertex.bitangent[2] = (n[0] * tangent[1] - n[1] * tangent[0]) * w;
+            } else {
+                vertex.tangent[0] = 1.0f;
+                vertex.bitangent[2] = 1.0f;
+            }
+            if (!primitive.texcoord0.empty()) {
+                readFloats(primitive.texcoord0, v, vertex.texcoord0, 2);
+                if (!options_.flip_uvs) {
+                    vertex.texcoord0[1] = 1.0f - vertex.texcoord0[1];
+                }
+            }
+            if (!transform.identity) {
+                const float position[3] = {vertex.position[0], vertex.position[1], vertex.position[2]};
+                transform.point(position, vertex.position);
+                if (!primitive.normals.empty()) {
+                    const float normal[3] = {vertex.normal[0], vertex.normal[1], vertex.normal[2]};
+                    transform.transformNormal(normal, vertex.normal);
+                }
+                if (tangents) {
+                    const float tangent[3] = {vertex.tangent[0], vertex.tangent[1], vertex.tangent[2]};
+                    const float bitangent[3] = {vertex.bitangent[0], vertex.bitangent[1], vertex.bitangent[2]};
+                    transform.transformTangent(tangent, vertex.tangent);
+                    transform.transformTangent(bitangent, vertex.bitangent);
+                }
+            }
+            bounds.add(vertex.position);
+        }
+    }
+
+    void convertIndices(const Part& part, size_t begin, size_t end, uint32_t* out) {
+        const GltfPrimitiveView& primitive = *part.primitive;
+        const size_t vertex_count = primitive.positions.count;
+        const auto base = static_cast<uint32_t>(part.first_vertex);
+        if (primitive.indices.empty()) {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = base + static_cast<uint32_t>(i);
+            }
+        } else if (const std::span<const uint32_t> tight = primitive.indices.tight<uint32_t>(); !tight.empty()) {
+            // Tightly packed 32-bit indices: one bulk copy, then validate and rebase in place.
+            std::memcpy(out + begin, tight.data() + begin, (end - begin) * sizeof(uint32_t));
+            bool in_range = true;
+            for (size_t i = begin; i < end; ++i) {
+                in_range = in_range && out[i] < vertex_count;
+                out[i] += base;
+            }
+            if (!in_range) {
+                bad_index_.store(true, std::memory_order_relaxed);
+            }
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t index = readIndex(primitive.indices, i);
+                if (index >= vertex_count) {
+                    bad_index_.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                out[i] = base + index;
+            }
+        }
+        if (part.transform->flip_winding) {
+            for (size_t i = begin; i + 2 < end; i += 3) {
+                std::swap(out[i + 1], out[i + 2]);
+            }
+        }
+    }
+
+    const vne::io::LoadRequest& request_;
+    const GltfLoaderOptions& options_;
+    const vne::io::LoadMonitor& monitor_;
+    std::vector<std::pair<size_t, Transform>> instances_;
+    std::vector<Part> parts_;
+    std::vector<Task> tasks_;
+    std::vector<PointBounds> bounds_;  //!< Per task (index tasks leave theirs empty).
+    std::atomic<bool> bad_index_{false};
+};
+
+}  // namespace
+
+size_t GltfAccessorView::elementSize() const {
+    return components * componentSize(component_type);
+}
+
+vne::io::LoadResult<Mesh> GltfLoader::loadMesh(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("GltfLoader::loadMesh");
+    vne::io::LoadResult<Mesh> result{Mesh(vne::io::assetMemoryResource(request))};
+    const vne::io::LoadMonitor monitor(request);
+    GltfDocument document(request, monitor);
+    result.status = document.open(false);
+    if (result.status && !monitor.update("decode", 1, kProgressPhases)) {
+        result.status = gltfError(vne::io::ErrorCode::eCancelled, "glTF load cancelled", request.uri);
+    }
+    if (result.status) {
+        GltfMeshBuilder builder(request, options_, monitor);
+        result.status = builder.build(document, result.value);
+    }
+    if (!result.status) {
+        result.value = Mesh{};
+        return result;
+    }
+    (void)monitor.update("decode", kProgressPhases, kProgressPhases);
+    return result;
+}
+
+vne::io::Result<GltfView> GltfLoader::loadView(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("GltfLoader::loadView");
+    vne::io::Result<GltfView> result;
+    const vne::io::LoadMonitor monitor(request);
+    GltfDocument document(request, monitor);
+    result.status = document.open(true);
+    if (result.status) {
+        result.value.primitives = document.primitives();
+        result.value.materials = std::move(document.materials());
+        result.value.keep = document.storage();
+    }
+    return result;
+}
+
+bool GltfLoader::loadFile(const std::string& path, Mesh& out_mesh) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = path;
+    vne::io::LoadResult<Mesh> result = loadMesh(request);
+    if (!result.ok()) {
+        last_error_ = result.status.message;
+        return false;
+    }
+    out_mesh = std::move(result.value);
+    last_error_.clear();
+    return true;
+}
+
+bool GltfLoader::isExtensionSupported(const std::string& path) const {
+    const std::string extension = vne::io::fileExtension(path);
+    return extension == "gltf" || extension == "glb";
+}
+
+const std::vector<std::string>& GltfLoader::supportedExtensions() const {
+    return kGltfExtensions;
+}
+
+std::string GltfLoader::optionsKey() const {
+    std::string key = "gltf1|";
+    key += options_.flip_uvs ? '1' : '0';
+    key += options_.pre_transform_vertices ? '1' : '0';
+    return key;
+}
+
+}  // namespace mesh
+}  // namespace vne
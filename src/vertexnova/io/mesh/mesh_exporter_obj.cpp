@@ -7,6 +7,7 @@
  */
 
 #include "vertexnova/io/mesh/mesh_exporter.h"
+#include "vertexnova/io/common/trace.h"
 
 #include <fstream>
 #include <sstream>
@@ -35,6 +36,7 @@ void setError(std::string* out_error, const std::string& msg) {
 }  // namespace
 
 bool exportObj(const std::string& obj_path, const Mesh& mesh, const ObjExportOptions& opts, std::string* out_error) {
+    VNEIO_TRACE_SPAN("MeshExporter::exportObj");
     if (mesh.vertices.empty() || mesh.indices.empty()) {
         setError(out_error, "ExportObj: mesh is empty");
         return false;
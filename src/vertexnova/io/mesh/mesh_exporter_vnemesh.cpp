@@ -0,0 +1,250 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * .vnemesh exporter.
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/mesh_exporter.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/mesh/vnemesh_format.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace vne::mesh {
+
+namespace {
+
+constexpr size_t kGatherElements = size_t{1} << 14;  //!< Vertices or indices converted per write.
+
+void setError(std::string* out_error, const std::string& msg) {
+    if (out_error) {
+        *out_error = msg;
+    }
+}
+
+/** Sequential writer that tracks its offset and zero-pads up to section boundaries. */
+class SectionWriter {
+   public:
+    explicit SectionWriter(std::ofstream& out)
+        : out_(out) {}
+
+    void write(const void* data, uint64_t size) {
+        out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        position_ += size;
+    }
+
+    void padTo(uint64_t offset) {
+        static constexpr char kZeros[vnemesh::kSectionAlignment] = {};
+        while (position_ < offset) {
+            write(kZeros, std::min(offset - position_, vnemesh::kSectionAlignment));
+        }
+    }
+
+   private:
+    std::ofstream& out_;
+    uint64_t position_ = 0;
+};
+
+/** Next aligned section of @p size bytes after @p end; advances @p end past it. */
+vnemesh::Section placeSection(uint64_t& end, uint64_t size) {
+    const vnemesh::Section section{vnemesh::alignUp(end), size};
+    end = section.offset + size;
+    return section;
+}
+
+bool hasBarycentrics(const Mesh& mesh) {
+    return std::any_of(mesh.vertices.begin(), mesh.vertices.end(), [](const VertexAttributes& v) {
+        return v.barycentric[0] != 0.0f || v.barycentric[1] != 0.0f || v.barycentric[2] != 0.0f;
+    });
+}
+
+/** Attributes written by a compact export: the ones the mesh has (positions always). */
+std::vector<vnemesh::Semantic> compactSemantics(const Mesh& mesh) {
+    std::vector<vnemesh::Semantic> semantics = {vnemesh::Semantic::ePosition};
+    if (mesh.has_normals) {
+        semantics.push_back(vnemesh::Semantic::eNormal);
+    }
+    if (mesh.has_tangent) {
+        semantics.push_back(vnemesh::Semantic::eTangent);
+        semantics.push_back(vnemesh::Semantic::eBitangent);
+    }
+    if (mesh.has_uv0) {
+        semantics.push_back(vnemesh::Semantic::eTexcoord0);
+    }
+    if (hasBarycentrics(mesh)) {
+        semantics.push_back(vnemesh::Semantic::eBarycentric);
+    }
+    return semantics;
+}
+
+/** Write one attribute of every vertex as a tightly packed stream. */
+void writeStream(SectionWriter& out, const Mesh& mesh, const vnemesh::Stream& stream) {
+    const size_t offset = vnemesh::kSemanticOffsets[stream.semantic];
+    std::vector<float> chunk(kGatherElements * stream.components);
+    for (size_t first = 0; first < mesh.vertices.size(); first += kGatherElements) {
+        const size_t count = std::min(kGatherElements, mesh.vertices.size() - first);
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(chunk.data() + i * stream.components,
+                        reinterpret_cast<const char*>(&mesh.vertices[first + i]) + offset,
+                        stream.components * sizeof(float));
+        }
+        out.write(chunk.data(), count * stream.stride);
+    }
+}
+
+void writeIndices16(SectionWriter& out, const Mesh& mesh) {
+    std::vector<uint16_t> chunk(kGatherElements);
+    for (size_t first = 0; first < mesh.indices.size(); first += kGatherElements) {
+        const size_t count = std::min(kGatherElements, mesh.indices.size() - first);
+        std::transform(mesh.indices.begin() + static_cast<std::ptrdiff_t>(first),
+                       mesh.indices.begin() + static_cast<std::ptrdiff_t>(first + count),
+                       chunk.begin(),
+                       [](uint32_t index) { return static_cast<uint16_t>(index); });
+        out.write(chunk.data(), count * sizeof(uint16_t));
+    }
+}
+
+}  // namespace
+
+bool exportVneMesh(const std::string& path,
+                   const Mesh& mesh,
+                   const VneMeshExportOptions& opts,
+                   std::string* out_error) {
+    VNEIO_TRACE_SPAN("MeshExporter::exportVneMesh");
+    if (mesh.vertices.empty()) {
+        setError(out_error, "ExportVneMesh: mesh has no vertices");
+        return false;
+    }
+
+    // Mesh name first, then each material's name and texture path.
+    std::string strings = mesh.name;
+    std::vector<vnemesh::MaterialRecord> materials;
+    materials.reserve(mesh.materials.size());
+    for (const Material& material : mesh.materials) {
+        vnemesh::MaterialRecord& record = materials.emplace_back();
+        record.name_offset = static_cast<uint32_t>(strings.size());
+        record.name_size = static_cast<uint32_t>(material.name.size());
+        strings += material.name;
+        record.texture_offset = static_cast<uint32_t>(strings.size());
+        record.texture_size = static_cast<uint32_t>(material.base_color_tex.size());
+        strings += material.base_color_tex;
+        std::copy(material.base_color, material.base_color + 4, record.base_color);
+    }
+    if (strings.size() > std::numeric_limits<uint32_t>::max()
+        || mesh.indices.size() > std::numeric_limits<uint32_t>::max()) {
+        setError(out_error, "ExportVneMesh: mesh too large");
+        return false;
+    }
+
+    const std::vector<vnemesh::Semantic> semantics =
+        opts.compact ? compactSemantics(mesh)
+                     : std::vector<vnemesh::Semantic>{vnemesh::Semantic::ePosition,
+                                                      vnemesh::Semantic::eNormal,
+                                                      vnemesh::Semantic::eTangent,
+                                                      vnemesh::Semantic::eBitangent,
+                                                      vnemesh::Semantic::eTexcoord0,
+                                                      vnemesh::Semantic::eBarycentric};
+    // VneMeshLoader rejects out-of-range indices, parts and materials; refuse to write such a file.
+    const uint32_t max_index = mesh.indices.empty() ? 0 : *std::max_element(mesh.indices.begin(), mesh.indices.end());
+    if (!mesh.indices.empty() && max_index >= mesh.vertices.size()) {
+        setError(out_error, "ExportVneMesh: index out of range");
+        return false;
+    }
+    for (const Submesh& part : mesh.parts) {
+        if (uint64_t{part.first_index} + part.index_count > mesh.indices.size()
+            || part.material_index >= mesh.materials.size()) {
+            setError(out_error, "ExportVneMesh: submesh index range or material out of range");
+            return false;
+        }
+    }
+
+    vnemesh::Header header;
+    header.header_size = sizeof(vnemesh::Header);
+    header.flags = (mesh.has_normals ? vnemesh::kHasNormals : 0u) | (mesh.has_tangent ? vnemesh::kHasTangent : 0u)
+                   | (mesh.has_uv0 ? vnemesh::kHasUv0 : 0u);
+    header.vertex_count = mesh.vertices.size();
+    header.index_count = mesh.indices.size();
+    header.index_size = opts.compact && max_index <= std::numeric_limits<uint16_t>::max() ? 2 : 4;
+    header.stream_count = static_cast<uint32_t>(semantics.size());
+    header.submesh_count = static_cast<uint32_t>(mesh.parts.size());
+    header.material_count = static_cast<uint32_t>(mesh.materials.size());
+    header.name_size = static_cast<uint32_t>(mesh.name.size());
+    std::copy(mesh.aabb_min, mesh.aabb_min + 3, header.aabb_min);
+    std::copy(mesh.aabb_max, mesh.aabb_max + 3, header.aabb_max);
+
+    // Lay out every section up front so the file is written front to back in one pass.
+    uint64_t end = sizeof(vnemesh::Header);
+    header.streams = placeSection(end, semantics.size() * sizeof(vnemesh::Stream));
+    std::vector<vnemesh::Stream> streams;
+    if (!opts.compact) {
+        header.vertices = placeSection(end, mesh.vertices.size() * sizeof(VertexAttributes));
+        for (const vnemesh::Semantic semantic : semantics) {
+            const auto s = static_cast<uint32_t>(semantic);
+            streams.push_back({s,
+                               vnemesh::kSemanticComponents[s],
+                               sizeof(VertexAttributes),
+                               0,
+                               header.vertices.offset + vnemesh::kSemanticOffsets[s]});
+        }
+    } else {
+        header.vertices.offset = vnemesh::alignUp(end);
+        for (const vnemesh::Semantic semantic : semantics) {
+            const auto s = static_cast<uint32_t>(semantic);
+            const uint32_t components = vnemesh::kSemanticComponents[s];
+            streams.push_back({s, components, components * 4, 0, vnemesh::alignUp(end)});
+            end = streams.back().offset + mesh.vertices.size() * streams.back().stride;
+        }
+        header.vertices.size = end - header.vertices.offset;
+    }
+    header.indices = placeSection(end, mesh.indices.size() * header.index_size);
+    header.submeshes = placeSection(end, mesh.parts.size() * sizeof(Submesh));
+    header.materials = placeSection(end, materials.size() * sizeof(vnemesh::MaterialRecord));
+    header.strings = placeSection(end, strings.size());
+    header.file_size = end;
+
+    std::ofstream f(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!f) {
+        setError(out_error, "ExportVneMesh: cannot open output file");
+        return false;
+    }
+    SectionWriter out(f);
+    out.write(&header, sizeof(header));
+    out.padTo(header.streams.offset);
+    out.write(streams.data(), header.streams.size);
+    out.padTo(header.vertices.offset);
+    if (!opts.compact) {
+        out.write(mesh.vertices.data(), header.vertices.size);
+    } else {
+        for (const vnemesh::Stream& stream : streams) {
+            out.padTo(stream.offset);
+            writeStream(out, mesh, stream);
+        }
+    }
+    out.padTo(header.indices.offset);
+    if (header.index_size == 4) {
+        out.write(mesh.indices.data(), header.indices.size);
+    } else {
+        writeIndices16(out, mesh);
+    }
+    out.padTo(header.submeshes.offset);
+    out.write(mesh.parts.data(), header.submeshes.size);
+    out.padTo(header.materials.offset);
+    out.write(materials.data(), header.materials.size);
+    out.padTo(header.strings.offset);
+    out.write(strings.data(), header.strings.size);
+
+    f.flush();
+    if (!f) {
+        setError(out_error, "ExportVneMesh: write failed");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace vne::mesh
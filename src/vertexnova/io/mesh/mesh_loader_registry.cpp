@@ -9,11 +9,38 @@
 
 #include "vertexnova/io/mesh/mesh_loader_registry.h"
 #include "vertexnova/io/mesh/assimp_loader.h"
+#include "vertexnova/io/mesh/gltf_loader.h"
+#include "vertexnova/io/mesh/obj_loader.h"
+#include "vertexnova/io/mesh/ply_loader.h"
+#include "vertexnova/io/mesh/stl_loader.h"
+#include "vertexnova/io/mesh/vnemesh_loader.h"
 
 namespace vne {
 namespace mesh {
 
 std::unique_ptr<IMeshLoader> MeshLoaderRegistry::getLoaderFor(const std::string& path) {
+    // Native loaders first; Assimp covers every other format.
+    StlLoader stl;
+    if (stl.isExtensionSupported(path)) {
+        return std::make_unique<StlLoader>();
+    }
+    ObjLoader obj;
+    if (obj.isExtensionSupported(path)) {
+        return std::make_unique<ObjLoader>();
+    }
+    PlyLoader ply;
+    if (ply.isExtensionSupported(path)) {
+        return std::make_unique<PlyLoader>();
+    }
+    GltfLoader gltf;
+    if (gltf.isExtensionSupported(path)) {
+        return std::make_unique<GltfLoader>();
+    }
+    VneMeshLoader vnemesh;
+    if (vnemesh.isExtensionSupported(path)) {
+        return std::make_unique<VneMeshLoader>();
+    }
+    // AssimpLoader caches Assimp's extension list, so this check does not construct an Importer.
     AssimpLoader checker;
     if (checker.isExtensionSupported(path)) {
         return std::make_unique<AssimpLoader>();
@@ -0,0 +1,81 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Internal helpers shared by the native mesh loaders (STL, ...); not installed.
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/load_request.h"
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vne {
+namespace mesh {
+
+/**
+ * @class MeshSource
+ * @brief Whole encoded file of a mesh request as one contiguous read-only byte range.
+ *
+ * Caller buffers and resident files (memory / pack backends) are used in place, OS paths
+ * are memory-mapped, and only other virtual files are read into an owned copy.
+ */
+class MeshSource {
+   public:
+    /**
+     * @brief Resolve @p request (buffer, file_system or OS path).
+     * @param request Load request.
+     * @param monitor Cancellation / progress for the copy of non-resident files ("read" stage).
+     * @return Status (file errors, or eCancelled).
+     */
+    [[nodiscard]] vne::io::Status open(const vne::io::LoadRequest& request, const vne::io::LoadMonitor& monitor) {
+        if (!request.buffer.empty()) {
+            data_ = reinterpret_cast<const uint8_t*>(request.buffer.data());
+            size_ = request.buffer.size();
+            return vne::io::Status::okStatus();
+        }
+        if (!request.file_system) {
+            vne::io::Status status = mapping_.open(request.uri, vne::io::binaryio::MapAccess::eSequential);
+            data_ = mapping_.data();
+            size_ = mapping_.size();
+            return status;
+        }
+        std::unique_ptr<vne::io::IFile> file;
+        vne::io::Status status = request.file_system->openFile(request.uri, file);
+        if (!status) {
+            return status;
+        }
+        size_ = static_cast<size_t>(file->size());
+        if ((contents_ = file->contents())) {
+            data_ = contents_.get();
+            return status;
+        }
+        copy_.resize(size_);
+        status = vne::io::readChunked(*file, 0, copy_.data(), size_, monitor);
+        data_ = copy_.data();
+        return status;
+    }
+
+    [[nodiscard]] const uint8_t* data() const { return data_; }
+    [[nodiscard]] size_t size() const { return size_; }
+
+   private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    vne::io::binaryio::MappedFile mapping_;
+    std::shared_ptr<const uint8_t> contents_;
+    std::vector<uint8_t> copy_;
+};
+
+}  // namespace mesh
+}  // namespace vne
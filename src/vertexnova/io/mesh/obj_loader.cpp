@@ -0,0 +1,937 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/obj_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/parallel_for.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/mesh/mesh_source.h"
+#include "vertexnova/io/mesh/point_bounds.h"
+#include "vertexnova/logging/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace vne {
+namespace mesh {
+
+namespace {
+
+CREATE_VNE_LOGGER_CATEGORY("vne.core.mesh.obj");
+
+constexpr size_t kChunkBytes = size_t{1} << 21;
+constexpr size_t kCornersPerTask = size_t{1} << 16;
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();  //!< Absent vt/vn, or an empty table slot.
+constexpr uint64_t kMaxCorners = std::numeric_limits<uint32_t>::max() / 2;  //!< Keeps table slots in 32 bits.
+constexpr uint64_t kProgressPhases = 5;
+constexpr float kDefaultMaterialGray = 0.6f;  //!< Assimp's OBJ default diffuse color.
+constexpr float kMinTangentLengthSq = 1e-20f;
+constexpr const char* kDefaultMaterialName = "DefaultMaterial";
+constexpr const char* kSubsystem = "ObjLoader";
+const std::vector<std::string> kObjExtensions = {"obj"};
+
+vne::io::Status objError(vne::io::ErrorCode code, const std::string& message, const std::string& uri) {
+    return vne::io::Status::make(code, message, uri, kSubsystem);
+}
+
+// ---- Text -----------------------------------------------------------------------------------------------------
+
+/** End of the logical line starting at @p pos (its '\n', or @p end); "\\\n" and "\\\r\n" continue the line. */
+const char* lineEnd(const char* data, const char* pos, const char* end) {
+    for (;;) {
+        const auto* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+        if (!newline) {
+            return end;
+        }
+        const char* before = newline;
+        if (before > data && before[-1] == '\r') {
+            --before;
+        }
+        if (before > data && before[-1] == '\\') {
+            pos = newline + 1;
+            continue;
+        }
+        return newline;
+    }
+}
+
+/** Tokenizer over one logical OBJ/MTL line; line continuations count as white space. */
+class LineReader {
+   public:
+    LineReader(const char* begin, const char* end)
+        : pos_(begin)
+        , end_(end) {}
+
+    [[nodiscard]] std::string_view token() {
+        skipSpace();
+        const char* start = pos_;
+        while (pos_ < end_ && !isSpace(*pos_) && !isContinuation(pos_)) {
+            ++pos_;
+        }
+        return {start, static_cast<size_t>(pos_ - start)};
+    }
+
+    [[nodiscard]] bool number(float& out) {
+        skipSpace();
+        if (pos_ < end_ && *pos_ == '+') {
+            ++pos_;  // from_chars rejects an explicit plus sign
+        }
+        const auto [next, ec] = std::from_chars(pos_, end_, out);
+        if (ec != std::errc() || (next < end_ && !isSpace(*next) && !isContinuation(next))) {
+            return false;
+        }
+        pos_ = next;
+        return true;
+    }
+
+    /** Remaining text without surrounding white space (names and paths may contain spaces). */
+    [[nodiscard]] std::string_view rest() {
+        skipSpace();
+        const char* last = end_;
+        while (last > pos_ && isSpace(last[-1])) {
+            --last;
+        }
+        return {pos_, static_cast<size_t>(last - pos_)};
+    }
+
+    [[nodiscard]] bool atEnd() {
+        skipSpace();
+        return pos_ == end_ || *pos_ == '#';
+    }
+
+   private:
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+
+    [[nodiscard]] bool isContinuation(const char* p) const {
+        return *p == '\\' && (p + 1 == end_ || p[1] == '\n' || p[1] == '\r');
+    }
+
+    void skipSpace() {
+        while (pos_ < end_ && (isSpace(*pos_) || isContinuation(pos_))) {
+            ++pos_;
+        }
+    }
+
+    const char* pos_;
+    const char* end_;
+};
+
+enum class Record { eOther, ePosition, eTexcoord, eNormal, eFace, eUseMaterial, eMaterialLibrary };
+
+Record classify(std::string_view keyword) {
+    if (keyword == "v") {
+        return Record::ePosition;
+    }
+    if (keyword == "vt") {
+        return Record::eTexcoord;
+    }
+    if (keyword == "vn") {
+        return Record::eNormal;
+    }
+    if (keyword == "f") {
+        return Record::eFace;
+    }
+    if (keyword == "usemtl") {
+        return Record::eUseMaterial;
+    }
+    if (keyword == "mtllib") {
+        return Record::eMaterialLibrary;
+    }
+    return Record::eOther;  // o, g, s, l, p, comments, ...
+}
+
+/** Split [0, size) into chunks of about kChunkBytes that end right after a line break. */
+std::vector<size_t> splitAtLines(const char* data, size_t size) {
+    std::vector<size_t> bounds{0};
+    while (bounds.back() < size) {
+        const size_t target = bounds.back() + kChunkBytes;
+        if (target >= size) {
+            bounds.push_back(size);
+            break;
+        }
+        const char* end = lineEnd(data, data + target, data + size);
+        bounds.push_back(end == data + size ? size : static_cast<size_t>(end - data) + 1);
+    }
+    return bounds;
+}
+
+// ---- Materials ------------------------------------------------------------------------------------------------
+
+/** Materials of the mtllib files in definition order; a repeated newmtl edits the existing entry (like Assimp). */
+class MaterialLibrary {
+   public:
+    void parse(const uint8_t* bytes, size_t size) {
+        const char* data = reinterpret_cast<const char*>(bytes);
+        const char* end = data + size;
+        Material* current = nullptr;
+        for (const char* pos = data; pos < end;) {
+            const char* line_end = lineEnd(data, pos, end);
+            LineReader line(pos, line_end);
+            pos = line_end < end ? line_end + 1 : end;
+            const std::string_view keyword = line.token();
+            if (keyword == "newmtl") {
+                current = &materials_[add(std::string(line.rest()))];
+            } else if (current && keyword == "Kd") {
+                float rgb[3] = {};
+                if (line.number(rgb[0]) && line.number(rgb[1]) && line.number(rgb[2])) {
+                    std::copy(rgb, rgb + 3, current->base_color);
+                }
+            } else if (current && keyword == "map_Kd") {
+                std::string_view path = line.rest();
+                const size_t last_space = path.find_last_of(" \t");
+                if (!path.empty() && path[0] == '-' && last_space != std::string_view::npos) {
+                    path = path.substr(last_space + 1);  // "-o u v w file": with options, the file is the last token
+                }
+                current->base_color_tex = std::string(path);
+            }
+        }
+    }
+
+    /** @return Slot of @p name: 0 is the default material, library materials follow from 1. */
+    [[nodiscard]] uint32_t slotOf(std::string_view name) const {
+        const auto it = index_.find(std::string(name));
+        return it == index_.end() ? 0u : it->second + 1;
+    }
+
+    [[nodiscard]] size_t slotCount() const { return materials_.size() + 1; }
+
+    [[nodiscard]] Material slotMaterial(size_t slot) const {
+        return slot == 0 ? defaultMaterial(kDefaultMaterialName) : materials_[slot - 1];
+    }
+
+   private:
+    static Material defaultMaterial(std::string name) {
+        return Material{std::move(name), "", {kDefaultMaterialGray, kDefaultMaterialGray, kDefaultMaterialGray, 1.0f}};
+    }
+
+    uint32_t add(std::string name) {
+        const auto [it, inserted] = index_.emplace(name, static_cast<uint32_t>(materials_.size()));
+        if (inserted) {
+            materials_.push_back(defaultMaterial(std::move(name)));
+        }
+        return it->second;
+    }
+
+    std::vector<Material> materials_;
+    std::unordered_map<std::string, uint32_t> index_;
+};
+
+std::string dirname(const std::string& path) {
+    return std::filesystem::path(path).parent_path().string();
+}
+
+/**
+ * Load every referenced mtllib next to @p request's uri; missing libraries are skipped with a warning.
+ * Each library path, found or not, is appended to request.dependencies when set.
+ */
+MaterialLibrary loadLibraries(const std::vector<std::string_view>& names,
+                              const vne::io::LoadRequest& request,
+                              const vne::io::LoadMonitor& monitor) {
+    VNEIO_TRACE_SPAN("ObjLoader::loadMaterials");
+    MaterialLibrary library;
+    const std::string base_dir = dirname(request.uri);
+    std::vector<std::string_view> loaded;
+    for (const std::string_view name : names) {
+        if (name.empty() || std::find(loaded.begin(), loaded.end(), name) != loaded.end()) {
+            continue;
+        }
+        loaded.push_back(name);
+        vne::io::LoadRequest mtl_request;
+        mtl_request.uri = base_dir.empty() ? std::string(name) : base_dir + "/" + std::string(name);
+        mtl_request.file_system = request.file_system;
+        if (request.dependencies) {
+            request.dependencies->push_back(mtl_request.uri);
+        }
+        MeshSource source;
+        const vne::io::Status status = source.open(mtl_request, monitor);
+        if (!status) {
+            VNE_LOG_WARN << "OBJ material library not loaded: " << mtl_request.uri << " (" << status.message << ")";
+            continue;
+        }
+        library.parse(source.data(), source.size());
+    }
+    return library;
+}
+
+// ---- Parsing --------------------------------------------------------------------------------------------------
+
+/** Resolved 0-based attribute indices of one triangle corner (kNone when vt / vn is absent). */
+struct ObjCorner {
+    uint32_t v;
+    uint32_t vt;
+    uint32_t vn;
+};
+
+/** Deduplication key of a corner: its material slot and attribute indices. */
+struct CornerKey {
+    uint32_t material;
+    uint32_t v;
+    uint32_t vt;
+    uint32_t vn;
+
+    bool operator==(const CornerKey& other) const {
+        return material == other.material && v == other.v && vt == other.vt && vn == other.vn;
+    }
+};
+
+uint32_t hashKey(const CornerKey& key) {
+    uint64_t h = 0x9E3779B97F4A7C15ull;
+    for (const uint32_t value : {key.material, key.v, key.vt, key.vn}) {
+        h = (h ^ value) * 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 31;
+    }
+    return static_cast<uint32_t>(h ^ (h >> 32));
+}
+
+/** usemtl at a triangle of a chunk. */
+struct MaterialRun {
+    size_t first_triangle;
+    std::string_view name;
+};
+
+/** One line-aligned slice of the file: record counts and bases, then its triangles and material runs. */
+struct Chunk {
+    size_t begin = 0;
+    size_t end = 0;
+    uint64_t counts[3] = {};  //!< v, vt, vn records in the chunk.
+    uint64_t bases[3] = {};   //!< v, vt, vn records before the chunk.
+    std::vector<ObjCorner> corners;
+    std::vector<MaterialRun> runs;
+    std::vector<std::string_view> libraries;
+    bool has_uv = false;
+    bool has_normals = false;
+    size_t error_offset = std::numeric_limits<size_t>::max();
+    const char* error = nullptr;
+};
+
+/** Vertex attribute arrays, written by all chunks at their bases. */
+struct Attributes {
+    std::vector<float> positions;  //!< xyz per v
+    std::vector<float> texcoords;  //!< uv per vt
+    std::vector<float> normals;    //!< xyz per vn
+    uint64_t totals[3] = {};
+};
+
+void countRecords(const char* data, Chunk& chunk) {
+    const char* end = data + chunk.end;
+    for (const char* pos = data + chunk.begin; pos < end;) {
+        const char* line_end = lineEnd(data, pos, end);
+        LineReader line(pos, line_end);
+        pos = line_end < end ? line_end + 1 : end;
+        const Record record = classify(line.token());
+        if (record == Record::ePosition || record == Record::eTexcoord || record == Record::eNormal) {
+            ++chunk.counts[static_cast<int>(record) - static_cast<int>(Record::ePosition)];
+        }
+    }
+}
+
+/** 0-based index of a 1-based (or negative, relative) OBJ reference; false if 0 or out of range. */
+bool resolveIndex(int64_t raw, uint64_t defined_so_far, uint64_t total, uint32_t& out) {
+    const int64_t index = raw > 0 ? raw - 1 : static_cast<int64_t>(defined_so_far) + raw;
+    if (raw == 0 || index < 0 || static_cast<uint64_t>(index) >= total) {
+        return false;
+    }
+    out = static_cast<uint32_t>(index);
+    return true;
+}
+
+bool parseInteger(const char*& pos, const char* end, int64_t& out) {
+    if (pos < end && *pos == '+') {
+        ++pos;
+    }
+    const auto [next, ec] = std::from_chars(pos, end, out);
+    pos = next;
+    return ec == std::errc();
+}
+
+/** Parse one "v", "v/vt", "v//vn" or "v/vt/vn" face token against the counts defined so far. */
+bool parseCorner(std::string_view token, const uint64_t (&defined)[3], const uint64_t (&totals)[3], ObjCorner& out) {
+    const char* pos = token.data();
+    const char* end = pos + token.size();
+    int64_t raw = 0;
+    out = {kNone, kNone, kNone};
+    if (!parseInteger(pos, end, raw) || !resolveIndex(raw, defined[0], totals[0], out.v)) {
+        return false;
+    }
+    if (pos < end && *pos == '/') {
+        ++pos;
+        if (pos < end && *pos != '/'
+            && (!parseInteger(pos, end, raw) || !resolveIndex(raw, defined[1], totals[1], out.vt))) {
+            return false;
+        }
+        if (pos < end && *pos == '/') {
+            ++pos;
+            if (pos < end && (!parseInteger(pos, end, raw) || !resolveIndex(raw, defined[2], totals[2], out.vn))) {
+                return false;
+            }
+        }
+    }
+    return pos == end;
+}
+
+/** Parse the records of one chunk into the shared attribute arrays and the chunk's triangle corners. */
+void parseChunk(const char* data, Attributes& attributes, Chunk& chunk) {
+    uint64_t defined[3] = {chunk.bases[0], chunk.bases[1], chunk.bases[2]};
+    std::vector<ObjCorner> polygon;
+    const char* end = data + chunk.end;
+    for (const char* pos = data + chunk.begin; pos < end;) {
+        const char* line_begin = pos;
+        const char* line_end = lineEnd(data, pos, end);
+        LineReader line(pos, line_end);
+        pos = line_end < end ? line_end + 1 : end;
+        bool valid = true;
+        switch (classify(line.token())) {
+            case Record::ePosition: {
+                float* xyz = attributes.positions.data() + 3 * defined[0]++;
+                valid = line.number(xyz[0]) && line.number(xyz[1]) && line.number(xyz[2]);
+                break;  // optional w and vertex colors are ignored
+            }
+            case Record::eTexcoord: {
+                float* uv = attributes.texcoords.data() + 2 * defined[1]++;
+                valid = line.number(uv[0]);
+                uv[1] = 0.0f;
+                valid = valid && (line.atEnd() || line.number(uv[1]));
+                break;
+            }
+            case Record::eNormal: {
+                float* xyz = attributes.normals.data() + 3 * defined[2]++;
+                valid = line.number(xyz[0]) && line.number(xyz[1]) && line.number(xyz[2]);
+                break;
+            }
+            case Record::eFace: {
+                polygon.clear();
+                while (valid && !line.atEnd()) {
+                    ObjCorner corner{};
+                    valid = parseCorner(line.token(), defined, attributes.totals, corner);
+                    polygon.push_back(corner);
+                }
+                if (!valid) {
+                    chunk.error = "Malformed or out-of-range OBJ face";
+                    break;
+                }
+                // Fan into triangles; faces with fewer than three corners (like lines and points) are skipped.
+                for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+                    chunk.corners.insert(chunk.corners.end(), {polygon[0], polygon[i], polygon[i + 1]});
+                }
+                for (const ObjCorner& corner : polygon) {
+                    chunk.has_uv = chunk.has_uv || corner.vt != kNone;
+                    chunk.has_normals = chunk.has_normals || corner.vn != kNone;
+                }
+                break;
+            }
+            case Record::eUseMaterial:
+                chunk.runs.push_back({chunk.corners.size() / 3, line.rest()});
+                break;
+            case Record::eMaterialLibrary:
+                chunk.libraries.push_back(line.rest());
+                break;
+            case Record::eOther:
+                break;
+        }
+        if (!valid) {
+            chunk.error_offset = static_cast<size_t>(line_begin - data);
+            chunk.error = chunk.error ? chunk.error : "Malformed OBJ vertex record";
+            return;
+        }
+    }
+}
+
+// ---- Tangents -------------------------------------------------------------------------------------------------
+
+/** Unit face tangent and bitangent from positions and UVs (Assimp's CalcTangentSpace formulation). */
+void faceTangents(const VertexAttributes* const (&corners)[3], float (&tangent)[3], float (&bitangent)[3]) {
+    const float* p0 = corners[0]->position;
+    const float* uv0 = corners[0]->texcoord0;
+    const float v[3] = {corners[1]->position[0] - p0[0], corners[1]->position[1] - p0[1],
+                        corners[1]->position[2] - p0[2]};
+    const float w[3] = {corners[2]->position[0] - p0[0], corners[2]->position[1] - p0[1],
+                        corners[2]->position[2] - p0[2]};
+    float sx = corners[1]->texcoord0[0] - uv0[0];
+    float sy = corners[1]->texcoord0[1] - uv0[1];
+    float tx = corners[2]->texcoord0[0] - uv0[0];
+    float ty = corners[2]->texcoord0[1] - uv0[1];
+    const float direction = (tx * sy - ty * sx) < 0.0f ? -1.0f : 1.0f;
+    if (sx * ty == sy * tx) {  // degenerate UVs
+        sx = 0.0f;
+        sy = 1.0f;
+        tx = 1.0f;
+        ty = 0.0f;
+    }
+    for (int i = 0; i < 3; ++i) {
+        tangent[i] = (w[i] * sy - v[i] * ty) * direction;
+        bitangent[i] = (w[i] * sx - v[i] * tx) * direction;
+    }
+    for (float* axis : {tangent, bitangent}) {
+        const float length_sq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+        const float scale = length_sq > kMinTangentLengthSq && std::isfinite(length_sq) ? 1.0f / std::sqrt(length_sq)
+                                                                                         : 0.0f;
+        for (int i = 0; i < 3; ++i) {
+            axis[i] *= scale;
+        }
+    }
+}
+
+/** Make an accumulated axis orthogonal to @p normal and unit length; false if nothing is left. */
+bool orthonormalize(const float* normal, float* axis) {
+    const float along = normal[0] * axis[0] + normal[1] * axis[1] + normal[2] * axis[2];
+    for (int i = 0; i < 3; ++i) {
+        axis[i] -= normal[i] * along;
+    }
+    const float length_sq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    if (!(length_sq > kMinTangentLengthSq) || !std::isfinite(length_sq)) {
+        return false;
+    }
+    const float scale = 1.0f / std::sqrt(length_sq);
+    for (int i = 0; i < 3; ++i) {
+        axis[i] *= scale;
+    }
+    return true;
+}
+
+void setDefaultTangents(VertexAttributes& vertex) {
+    std::fill(vertex.tangent, vertex.tangent + 3, 0.0f);
+    std::fill(vertex.bitangent, vertex.bitangent + 3, 0.0f);
+    vertex.tangent[0] = 1.0f;
+    vertex.bitangent[2] = 1.0f;
+}
+
+// ---- Corners to Mesh ------------------------------------------------------------------------------------------
+
+/**
+ * Parse the chunks and turn their corners into an indexed Mesh.
+ * Corners are regrouped by material slot (file order within a slot) into one key array, which
+ * is split into tasks of kCornersPerTask corners. Each corner is inserted into a lock-free open
+ * addressing table shared by all tasks; a slot keeps the smallest corner with its key, so the
+ * first occurrences (and thus the vertex numbering) are the same for any thread count.
+ */
+class ObjBuilder {
+   public:
+    ObjBuilder(const uint8_t* data,
+               size_t size,
+               const vne::io::LoadRequest& request,
+               const ObjLoaderOptions& options,
+               const vne::io::LoadMonitor& monitor)
+        : data_(reinterpret_cast<const char*>(data))
+        , size_(size)
+        , request_(request)
+        , options_(options)
+        , monitor_(monitor) {}
+
+    [[nodiscard]] vne::io::Status build(Mesh& mesh) {
+        vne::io::Status status = parse();
+        if (!status) {
+            return status;
+        }
+        if (!monitor_.update("decode", 2, kProgressPhases)) {
+            return cancelled();
+        }
+        const MaterialLibrary library = loadLibraries(libraries_, request_, monitor_);
+        status = group(library, mesh);
+        if (!status) {
+            return status;
+        }
+        if (!monitor_.update("decode", 3, kProgressPhases)) {
+            return cancelled();
+        }
+        weld(mesh);
+        if (!monitor_.update("decode", 4, kProgressPhases)) {
+            return cancelled();
+        }
+        emit(mesh);
+        if (monitor_.cancelled()) {
+            return cancelled();
+        }
+        mesh.name = request_.uri;
+        mesh.has_uv0 = has_uv_;
+        mesh.has_normals = has_normals_;
+        mesh.has_tangent = tangents_;
+        PointBounds all;
+        for (const PointBounds& b : bounds_) {
+            all.merge(b);
+        }
+        all.storeXyz(mesh.aabb_min, mesh.aabb_max);
+        (void)monitor_.update("decode", kProgressPhases, kProgressPhases);
+        return vne::io::Status::okStatus();
+    }
+
+   private:
+    [[nodiscard]] vne::io::Status cancelled() const {
+        return objError(vne::io::ErrorCode::eCancelled, "OBJ load cancelled", request_.uri);
+    }
+
+    template<typename Fn>
+    void parallel(size_t count, Fn&& body) {
+        vne::io::parallelFor(
+            count,
+            [this, &body](size_t i) {
+                if (!monitor_.cancelled()) {
+                    body(i);
+                }
+            },
+            options_.max_threads);
+    }
+
+    [[nodiscard]] std::pair<size_t, size_t> cornerRange(size_t task) const {
+        return {task * kCornersPerTask, std::min(keys_.size(), (task + 1) * kCornersPerTask)};
+    }
+
+    /** Count records per chunk, place each chunk's attributes, then parse all chunks. */
+    [[nodiscard]] vne::io::Status parse() {
+        using vne::io::ErrorCode;
+        const std::vector<size_t> bounds = splitAtLines(data_, size_);
+        chunks_.resize(bounds.size() - 1);
+        for (size_t i = 0; i < chunks_.size(); ++i) {
+            chunks_[i].begin = bounds[i];
+            chunks_[i].end = bounds[i + 1];
+        }
+        {
+            VNEIO_TRACE_SPAN("ObjLoader::count");
+            parallel(chunks_.size(), [this](size_t i) { countRecords(data_, chunks_[i]); });
+        }
+        if (!monitor_.update("decode", 1, kProgressPhases)) {
+            return cancelled();
+        }
+        for (Chunk& chunk : chunks_) {
+            for (int a = 0; a < 3; ++a) {
+                chunk.bases[a] = attributes_.totals[a];
+                attributes_.totals[a] += chunk.counts[a];
+            }
+        }
+        if (std::max({attributes_.totals[0], attributes_.totals[1], attributes_.totals[2]}) >= kNone) {
+            return objError(ErrorCode::eUnsupportedFeature, "OBJ file has too many vertex records", request_.uri);
+        }
+        attributes_.positions.resize(3 * attributes_.totals[0]);
+        attributes_.texcoords.resize(2 * attributes_.totals[1]);
+        attributes_.normals.resize(3 * attributes_.totals[2]);
+        {
+            VNEIO_TRACE_SPAN("ObjLoader::parse");
+            parallel(chunks_.size(), [this](size_t i) { parseChunk(data_, attributes_, chunks_[i]); });
+        }
+        if (monitor_.cancelled()) {
+            return cancelled();
+        }
+        uint64_t corners = 0;
+        for (Chunk& chunk : chunks_) {
+            if (chunk.error) {
+                return objError(ErrorCode::eParseError,
+                                std::string(chunk.error) + " near byte " + std::to_string(chunk.error_offset),
+                                request_.uri);
+            }
+            corners += chunk.corners.size();
+            has_uv_ = has_uv_ || chunk.has_uv;
+            has_normals_ = has_normals_ || chunk.has_normals;
+            libraries_.insert(libraries_.end(), chunk.libraries.begin(), chunk.libraries.end());
+        }
+        if (corners == 0) {
+            return objError(ErrorCode::eParseError, "OBJ file has no faces", request_.uri);
+        }
+        if (corners > kMaxCorners) {
+            return objError(ErrorCode::eUnsupportedFeature, "OBJ file has too many triangles", request_.uri);
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    /** Triangles [first, last) of one chunk that use one material slot. */
+    struct Segment {
+        size_t chunk;
+        size_t first;
+        size_t last;
+        uint32_t slot;
+        size_t destination = 0;  //!< First triangle in the grouped order.
+        uint32_t material = 0;   //!< Index into Mesh::materials.
+    };
+
+    /** Order triangles by material slot into keys_ and emit one Submesh per used material. */
+    [[nodiscard]] vne::io::Status group(const MaterialLibrary& library, Mesh& mesh) {
+        VNEIO_TRACE_SPAN("ObjLoader::group");
+        std::vector<Segment> segments;
+        uint32_t slot = 0;  // faces before the first usemtl use the default material
+        for (size_t c = 0; c < chunks_.size(); ++c) {
+            size_t first = 0;
+            const size_t triangles = chunks_[c].corners.size() / 3;
+            for (const MaterialRun& run : chunks_[c].runs) {
+                if (run.first_triangle > first) {
+                    segments.push_back({c, first, run.first_triangle, slot});
+                }
+                first = run.first_triangle;
+                slot = library.slotOf(run.name);
+            }
+            if (triangles > first) {
+                segments.push_back({c, first, triangles, slot});
+            }
+        }
+        std::stable_sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) {
+            return a.slot < b.slot;
+        });
+
+        mesh.parts.clear();
+        mesh.materials.clear();
+        size_t next = 0;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (i == 0 || segments[i].slot != segments[i - 1].slot) {
+                mesh.parts.push_back(
+                    Submesh{static_cast<uint32_t>(next * 3), 0, static_cast<uint32_t>(mesh.materials.size())});
+                mesh.materials.push_back(library.slotMaterial(segments[i].slot));
+            }
+            segments[i].destination = next;
+            segments[i].material = mesh.parts.back().material_index;
+            next += segments[i].last - segments[i].first;
+            mesh.parts.back().index_count = static_cast<uint32_t>(next * 3) - mesh.parts.back().first_index;
+        }
+
+        keys_.resize(next * 3);
+        parallel(segments.size(), [this, &segments](size_t i) {
+            const Segment& segment = segments[i];
+            const ObjCorner* source = chunks_[segment.chunk].corners.data() + 3 * segment.first;
+            CornerKey* out = keys_.data() + 3 * segment.destination;
+            for (size_t c = 0; c < 3 * (segment.last - segment.first); ++c) {
+                out[c] = {segment.material, source[c].v, source[c].vt, source[c].vn};
+            }
+        });
+        chunks_.clear();  // corners now live in keys_
+        tasks_ = (keys_.size() + kCornersPerTask - 1) / kCornersPerTask;
+        bounds_.resize(tasks_);
+        return monitor_.cancelled() ? cancelled() : vne::io::Status::okStatus();
+    }
+
+    /** Insert every corner into the shared table; mesh.indices temporarily holds each corner's table slot. */
+    void weld(Mesh& mesh) {
+        VNEIO_TRACE_SPAN("ObjLoader::weld");
+        const int bits = std::max(4, static_cast<int>(std::bit_width(keys_.size() + keys_.size() / 2)));
+        table_.assign(size_t{1} << bits, kNone);
+        mesh.indices.resize(keys_.size());
+        parallel(tasks_, [this, bits, &mesh](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            for (size_t c = begin; c < end; ++c) {
+                mesh.indices[c] = insert(static_cast<uint32_t>(c), bits);
+            }
+        });
+    }
+
+    /**
+     * Find or claim the slot of a corner's key. Keys are read-only here, so relaxed ordering
+     * suffices; a slot that already holds the key is lowered to the smaller corner index.
+     */
+    uint32_t insert(uint32_t corner, int bits) {
+        const CornerKey& key = keys_[corner];
+        const size_t mask = table_.size() - 1;
+        size_t slot = static_cast<size_t>((uint64_t{hashKey(key)} * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+        for (;;) {
+            std::atomic_ref<uint32_t> cell(table_[slot]);
+            uint32_t other = cell.load(std::memory_order_relaxed);
+            if (other == kNone && cell.compare_exchange_strong(other, corner, std::memory_order_relaxed)) {
+                return static_cast<uint32_t>(slot);
+            }
+            if (keys_[other] == key) {
+                while (corner < other && !cell.compare_exchange_weak(other, corner, std::memory_order_relaxed)) {
+                }
+                return static_cast<uint32_t>(slot);
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    /** Number first occurrences in corner order, write their vertices, remap indices and add tangents. */
+    void emit(Mesh& mesh) {
+        VNEIO_TRACE_SPAN("ObjLoader::emit");
+        std::vector<uint32_t> unique_base(tasks_ + 1, 0);
+        parallel(tasks_, [this, &mesh, &unique_base](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            uint32_t count = 0;
+            for (size_t c = begin; c < end; ++c) {
+                count += table_[mesh.indices[c]] == c ? 1u : 0u;
+            }
+            unique_base[task + 1] = count;
+        });
+        for (size_t task = 0; task < tasks_; ++task) {
+            unique_base[task + 1] += unique_base[task];
+        }
+        tangents_ = options_.gen_tangents && has_uv_ && has_normals_;
+        mesh.vertices.resize(unique_base[tasks_]);
+        // The first corner of each vertex keeps the vertex id in its (no longer needed) material field.
+        parallel(tasks_, [this, &mesh, &unique_base](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            uint32_t id = unique_base[task];
+            for (size_t c = begin; c < end; ++c) {
+                if (table_[mesh.indices[c]] == c) {
+                    writeVertex(keys_[c], mesh.vertices[id]);
+                    bounds_[task].add(mesh.vertices[id].position);
+                    keys_[c].material = id++;
+                }
+            }
+        });
+        parallel(tasks_, [this, &mesh](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            for (size_t c = begin; c < end; ++c) {
+                mesh.indices[c] = keys_[table_[mesh.indices[c]]].material;
+            }
+        });
+        if (tangents_) {
+            addTangents(mesh, unique_base);
+        }
+    }
+
+    void writeVertex(const CornerKey& key, VertexAttributes& out) const {
+        out = VertexAttributes{};
+        std::copy_n(attributes_.positions.data() + 3 * size_t{key.v}, 3, out.position);
+        if (key.vn != kNone) {
+            std::copy_n(attributes_.normals.data() + 3 * size_t{key.vn}, 3, out.normal);
+        } else {
+            out.normal[1] = 1.0f;
+        }
+        if (key.vt != kNone) {
+            const float* uv = attributes_.texcoords.data() + 2 * size_t{key.vt};
+            out.texcoord0[0] = uv[0];
+            out.texcoord0[1] = options_.flip_uvs ? 1.0f - uv[1] : uv[1];
+        }
+        if (!tangents_) {
+            setDefaultTangents(out);  // otherwise the fields accumulate face tangents first
+        }
+    }
+
+    /**
+     * Accumulate unit face tangents into the vertices, then orthonormalize them against the normal.
+     * A triangle can only reference vertices first seen in its own task or earlier ones: each task
+     * adds into the vertices it numbered and spills the rest, which are applied in task order
+     * afterwards, so the sums do not depend on the thread count.
+     */
+    void addTangents(Mesh& mesh, const std::vector<uint32_t>& unique_base) {
+        VNEIO_TRACE_SPAN("ObjLoader::tangents");
+        struct Spill {
+            uint32_t vertex;
+            float tangent[3];
+            float bitangent[3];
+        };
+        std::vector<std::vector<Spill>> spills(tasks_);
+        parallel(tasks_, [this, &mesh, &unique_base, &spills](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            for (size_t c = begin; c < end; c += 3) {
+                if (keys_[c].vt == kNone || keys_[c + 1].vt == kNone || keys_[c + 2].vt == kNone
+                    || keys_[c].vn == kNone || keys_[c + 1].vn == kNone || keys_[c + 2].vn == kNone) {
+                    continue;
+                }
+                const VertexAttributes* const corners[3] = {
+                    &mesh.vertices[mesh.indices[c]], &mesh.vertices[mesh.indices[c + 1]],
+                    &mesh.vertices[mesh.indices[c + 2]]};
+                float tangent[3];
+                float bitangent[3];
+                faceTangents(corners, tangent, bitangent);
+                for (size_t k = 0; k < 3; ++k) {
+                    const uint32_t vertex = mesh.indices[c + k];
+                    if (vertex < unique_base[task]) {
+                        spills[task].push_back({vertex, {tangent[0], tangent[1], tangent[2]},
+                                                {bitangent[0], bitangent[1], bitangent[2]}});
+                        continue;
+                    }
+                    for (int i = 0; i < 3; ++i) {
+                        mesh.vertices[vertex].tangent[i] += tangent[i];
+                        mesh.vertices[vertex].bitangent[i] += bitangent[i];
+                    }
+                }
+            }
+        });
+        for (const std::vector<Spill>& task_spills : spills) {
+            for (const Spill& spill : task_spills) {
+                for (int i = 0; i < 3; ++i) {
+                    mesh.vertices[spill.vertex].tangent[i] += spill.tangent[i];
+                    mesh.vertices[spill.vertex].bitangent[i] += spill.bitangent[i];
+                }
+            }
+        }
+        parallel(tasks_, [&mesh, &unique_base](size_t task) {
+            for (uint32_t v = unique_base[task]; v < unique_base[task + 1]; ++v) {
+                VertexAttributes& vertex = mesh.vertices[v];
+                const bool valid = orthonormalize(vertex.normal, vertex.tangent)
+                                   && orthonormalize(vertex.normal, vertex.bitangent);
+                if (!valid) {
+                    setDefaultTangents(vertex);
+                }
+            }
+        });
+    }
+
+    const char* data_;
+    size_t size_;
+    const vne::io::LoadRequest& request_;
+    const ObjLoaderOptions& options_;
+    const vne::io::LoadMonitor& monitor_;
+    std::vector<Chunk> chunks_;
+    Attributes attributes_;
+    std::vector<std::string_view> libraries_;
+    std::vector<CornerKey> keys_;      //!< Corners grouped by material; a first corner's material becomes its id.
+    std::vector<uint32_t> table_;      //!< Open addressing slots: smallest corner with the slot's key.
+    std::vector<PointBounds> bounds_;  //!< Per task.
+    size_t tasks_ = 0;
+    bool has_uv_ = false;
+    bool has_normals_ = false;
+    bool tangents_ = false;
+};
+
+}  // namespace
+
+vne::io::LoadResult<Mesh> ObjLoader::loadMesh(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("ObjLoader::loadMesh");
+    vne::io::LoadResult<Mesh> result{Mesh(vne::io::assetMemoryResource(request))};
+    const vne::io::LoadMonitor monitor(request);
+    MeshSource source;
+    result.status = source.open(request, monitor);
+    if (result.status) {
+        ObjBuilder builder(source.data(), source.size(), request, options_, monitor);
+        result.status = builder.build(result.value);
+    }
+    if (!result.status) {
+        result.value = Mesh{};
+    }
+    return result;
+}
+
+bool ObjLoader::loadFile(const std::string& path, Mesh& out_mesh) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = path;
+    vne::io::LoadResult<Mesh> result = loadMesh(request);
+    if (!result.ok()) {
+        last_error_ = result.status.message;
+        return false;
+    }
+    out_mesh = std::move(result.value);
+    last_error_.clear();
+    return true;
+}
+
+bool ObjLoader::isExtensionSupported(const std::string& path) const {
+    return vne::io::fileExtension(path) == "obj";
+}
+
+const std::vector<std::string>& ObjLoader::supportedExtensions() const {
+    return kObjExtensions;
+}
+
+std::string ObjLoader::optionsKey() const {
+    std::string key = "obj1|";
+    key += options_.flip_uvs ? '1' : '0';
+    key += options_.gen_tangents ? '1' : '0';
+    return key;
+}
+
+}  // namespace mesh
+}  // namespace vne
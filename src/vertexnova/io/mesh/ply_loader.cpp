@@ -0,0 +1,873 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/ply_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/parallel_for.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/mesh/mesh_source.h"
+#include "vertexnova/io/mesh/point_bounds.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+namespace vne {
+namespace mesh {
+
+namespace {
+
+constexpr size_t kVerticesPerTask = size_t{1} << 16;
+constexpr size_t kFacesPerTask = size_t{1} << 16;
+constexpr uint64_t kRecordsPerCancelCheck = uint64_t{1} << 16;  //!< Serial paths poll cancellation this often.
+constexpr size_t kTriangleRecordBytes = 1 + 3 * sizeof(uint32_t);  //!< uchar count 3 and three 32-bit indices.
+constexpr uint64_t kProgressPhases = 2;
+constexpr float kDefaultMaterialGray = 0.6f;
+constexpr const char* kSubsystem = "PlyLoader";
+const std::vector<std::string> kPlyExtensions = {"ply"};
+
+vne::io::Status plyError(vne::io::ErrorCode code, const std::string& message, const std::string& uri) {
+    return vne::io::Status::make(code, message, uri, kSubsystem);
+}
+
+// ---- Header ---------------------------------------------------------------------------------------------------
+
+enum class PlyFormat { eAscii, eBinaryLittleEndian, eBinaryBigEndian };
+
+enum class PlyType : uint8_t { eInt8, eUint8, eInt16, eUint16, eInt32, eUint32, eFloat32, eFloat64 };
+
+bool parseType(std::string_view name, PlyType& out) {
+    static constexpr std::pair<std::string_view, PlyType> kNames[] = {
+        {"char", PlyType::eInt8},     {"int8", PlyType::eInt8},       {"uchar", PlyType::eUint8},
+        {"uint8", PlyType::eUint8},   {"short", PlyType::eInt16},     {"int16", PlyType::eInt16},
+        {"ushort", PlyType::eUint16}, {"uint16", PlyType::eUint16},   {"int", PlyType::eInt32},
+        {"int32", PlyType::eInt32},   {"uint", PlyType::eUint32},     {"uint32", PlyType::eUint32},
+        {"float", PlyType::eFloat32}, {"float32", PlyType::eFloat32}, {"double", PlyType::eFloat64},
+        {"float64", PlyType::eFloat64}};
+    for (const auto& [type_name, type] : kNames) {
+        if (name == type_name) {
+            out = type;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t typeSize(PlyType type) {
+    static constexpr size_t kSizes[] = {1, 1, 2, 2, 4, 4, 4, 8};
+    return kSizes[static_cast<size_t>(type)];
+}
+
+struct PlyProperty {
+    std::string name;
+    PlyType type = PlyType::eFloat32;  //!< Value type (list items for lists).
+    bool is_list = false;
+    PlyType count_type = PlyType::eUint8;
+};
+
+struct PlyElement {
+    std::string name;
+    uint64_t count = 0;
+    std::vector<PlyProperty> properties;
+
+    /** Record size when no property is a list, else 0. */
+    [[nodiscard]] size_t fixedSize() const {
+        size_t size = 0;
+        for (const PlyProperty& property : properties) {
+            if (property.is_list) {
+                return 0;
+            }
+            size += typeSize(property.type);
+        }
+        return size;
+    }
+};
+
+struct PlyHeader {
+    PlyFormat format = PlyFormat::eAscii;
+    std::vector<PlyElement> elements;
+    size_t data_offset = 0;  //!< First byte after "end_header".
+};
+
+std::vector<std::string_view> splitWords(std::string_view line) {
+    std::vector<std::string_view> words;
+    size_t pos = 0;
+    while (pos < line.size()) {
+        const size_t start = line.find_first_not_of(" \t\r", pos);
+        if (start == std::string_view::npos) {
+            break;
+        }
+        pos = std::min(line.find_first_of(" \t\r", start), line.size());
+        words.push_back(line.substr(start, pos - start));
+    }
+    return words;
+}
+
+vne::io::Status parseHeader(const uint8_t* data, size_t size, const std::string& uri, PlyHeader& header) {
+    using vne::io::ErrorCode;
+    const std::string_view text(reinterpret_cast<const char*>(data), size);
+    size_t pos = 0;
+    for (bool first = true;; first = false) {
+        const size_t newline = text.find('\n', pos);
+        if (newline == std::string_view::npos) {
+            return plyError(ErrorCode::eParseError, "PLY header has no end_header", uri);
+        }
+        const std::vector<std::string_view> words = splitWords(text.substr(pos, newline - pos));
+        pos = newline + 1;
+        if (first) {
+            if (words.size() != 1 || words[0] != "ply") {
+                return plyError(ErrorCode::eParseError, "Not a PLY file", uri);
+            }
+            continue;
+        }
+        if (words.empty() || words[0] == "comment" || words[0] == "obj_info") {
+            continue;
+        }
+        bool valid = true;
+        if (words[0] == "end_header") {
+            header.data_offset = pos;
+            return vne::io::Status::okStatus();
+        }
+        if (words[0] == "format" && words.size() >= 2) {
+            if (words[1] == "ascii") {
+                header.format = PlyFormat::eAscii;
+            } else if (words[1] == "binary_little_endian") {
+                header.format = PlyFormat::eBinaryLittleEndian;
+            } else if (words[1] == "binary_big_endian") {
+                header.format = PlyFormat::eBinaryBigEndian;
+            } else {
+                return plyError(ErrorCode::eUnsupportedFeature, "Unknown PLY format " + std::string(words[1]), uri);
+            }
+        } else if (words[0] == "element" && words.size() == 3) {
+            PlyElement& element = header.elements.emplace_back();
+            element.name = std::string(words[1]);
+            const auto [end, ec] = std::from_chars(words[2].data(), words[2].data() + words[2].size(), element.count);
+            valid = ec == std::errc() && end == words[2].data() + words[2].size();
+        } else if (words[0] == "property" && !header.elements.empty()) {
+            PlyProperty property;
+            if (words.size() == 5 && words[1] == "list") {
+                property.is_list = true;
+                valid = parseType(words[2], property.count_type) && parseType(words[3], property.type);
+                property.name = std::string(words[4]);
+            } else {
+                valid = words.size() == 3 && parseType(words[1], property.type);
+                property.name = std::string(words[2]);
+            }
+            header.elements.back().properties.push_back(std::move(property));
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            return plyError(ErrorCode::eParseError, "Malformed PLY header line near byte " + std::to_string(pos), uri);
+        }
+    }
+}
+
+// ---- Value decoding -------------------------------------------------------------------------------------------
+
+using FloatDecoder = float (*)(const uint8_t*);
+using IndexDecoder = int64_t (*)(const uint8_t*);
+
+template<typename T, bool Swap, typename Out>
+Out decodeAs(const uint8_t* p) {
+    std::array<uint8_t, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), p, sizeof(T));
+    if constexpr (Swap) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    return static_cast<Out>(std::bit_cast<T>(bytes));
+}
+
+/** Decoder for one value of @p type, specialized for the file's byte order relative to the host. */
+template<typename Out, bool Swap>
+Out (*decoderFor(PlyType type))(const uint8_t*) {
+    switch (type) {
+        case PlyType::eInt8:
+            return &decodeAs<int8_t, Swap, Out>;
+        case PlyType::eUint8:
+            return &decodeAs<uint8_t, Swap, Out>;
+        case PlyType::eInt16:
+            return &decodeAs<int16_t, Swap, Out>;
+        case PlyType::eUint16:
+            return &decodeAs<uint16_t, Swap, Out>;
+        case PlyType::eInt32:
+            return &decodeAs<int32_t, Swap, Out>;
+        case PlyType::eUint32:
+            return &decodeAs<uint32_t, Swap, Out>;
+        case PlyType::eFloat32:
+            return &decodeAs<float, Swap, Out>;
+        case PlyType::eFloat64:
+            break;
+    }
+    return &decodeAs<double, Swap, Out>;
+}
+
+template<typename Out>
+Out (*decoderFor(PlyType type, bool swap))(const uint8_t*) {
+    return swap ? decoderFor<Out, true>(type) : decoderFor<Out, false>(type);
+}
+
+bool needsSwap(PlyFormat format) {
+    return format == (std::endian::native == std::endian::little ? PlyFormat::eBinaryBigEndian
+                                                                  : PlyFormat::eBinaryLittleEndian);
+}
+
+/** Whitespace-separated values of an ASCII body. */
+class AsciiValues {
+   public:
+    AsciiValues(const char* begin, const char* end)
+        : pos_(begin)
+        , begin_(begin)
+        , end_(end) {}
+
+    [[nodiscard]] bool next(double& out) {
+        while (pos_ < end_ && isSpace(*pos_)) {
+            ++pos_;
+        }
+        if (pos_ < end_ && *pos_ == '+') {
+            ++pos_;  // from_chars rejects an explicit plus sign
+        }
+        const auto [next, ec] = std::from_chars(pos_, end_, out);
+        if (ec != std::errc() || (next < end_ && !isSpace(*next))) {
+            return false;
+        }
+        pos_ = next;
+        return true;
+    }
+
+    [[nodiscard]] size_t offset() const { return static_cast<size_t>(pos_ - begin_); }
+
+   private:
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+
+    const char* pos_;
+    const char* begin_;
+    const char* end_;
+};
+
+// ---- Vertices -------------------------------------------------------------------------------------------------
+
+enum Field : uint8_t { eX, eY, eZ, eNx, eNy, eNz, eU, eV, kFieldCount, kSkipped = kFieldCount };
+
+Field fieldOf(std::string_view name) {
+    static constexpr std::pair<std::string_view, Field> kNames[] = {
+        {"x", eX},         {"y", eY},         {"z", eZ},         {"nx", eNx},       {"ny", eNy},
+        {"nz", eNz},       {"u", eU},         {"s", eU},         {"texture_u", eU}, {"texture_s", eU},
+        {"v", eV},         {"t", eV},         {"texture_v", eV}, {"texture_t", eV}};
+    for (const auto& [field_name, field] : kNames) {
+        if (name == field_name) {
+            return field;
+        }
+    }
+    return kSkipped;
+}
+
+/**
+ * Reader specialized for the vertex element's declared layout. Fixed-size records are decoded
+ * through a list of (offset, field, decoder) operations, or by a plain copy when x/y/z are the
+ * only used properties and contiguous float32 in host order; records with list properties are
+ * walked property by property.
+ */
+class VertexReader {
+   public:
+    VertexReader(const PlyElement& element, PlyFormat format, const PlyLoaderOptions& options)
+        : stride_(element.fixedSize())
+        , flip_uvs_(options.flip_uvs) {
+        const bool swap = needsSwap(format);
+        uint32_t mask = 0;
+        size_t offset = 0;
+        for (const PlyProperty& property : element.properties) {
+            Field field = property.is_list ? kSkipped : fieldOf(property.name);
+            if (options.positions_only && field > eZ) {
+                field = kSkipped;
+            }
+            if (field != kSkipped && (mask & (1u << field)) == 0) {
+                mask |= 1u << field;
+                ops_.push_back(
+                    {static_cast<uint32_t>(offset), field, property.type, decoderFor<float>(property.type, swap)});
+            } else {
+                field = kSkipped;
+            }
+            walk_.push_back({property, field, decoderFor<float>(property.type, swap),
+                             decoderFor<int64_t>(property.count_type, swap)});
+            offset += typeSize(property.type);
+        }
+        has_position_ = (mask & 0x7u) == 0x7u;
+        has_normals_ = (mask & (0x7u << eNx)) == (0x7u << eNx);
+        has_uv_ = (mask & (0x3u << eU)) == (0x3u << eU);
+        if (has_position_ && ops_.size() == 3 && stride_ != 0 && !swap) {
+            xyz_offset_ = ops_[0].offset;
+            copy_xyz_ = true;
+            for (size_t i = 0; i < 3; ++i) {
+                copy_xyz_ = copy_xyz_ && ops_[i].field == eX + i && ops_[i].type == PlyType::eFloat32
+                            && ops_[i].offset == xyz_offset_ + i * sizeof(float);
+            }
+        }
+    }
+
+    [[nodiscard]] bool hasPosition() const { return has_position_; }
+    [[nodiscard]] bool hasNormals() const { return has_normals_; }
+    [[nodiscard]] bool hasUv() const { return has_uv_; }
+    /** Record size, or 0 when records contain lists. */
+    [[nodiscard]] size_t stride() const { return stride_; }
+
+    /** Decode one fixed-size record. */
+    void read(const uint8_t* record, VertexAttributes& out) const {
+        if (copy_xyz_) {
+            out = defaults();
+            std::memcpy(out.position, record + xyz_offset_, 3 * sizeof(float));
+            return;
+        }
+        float values[kFieldCount] = {};
+        for (const Op& op : ops_) {
+            values[op.field] = op.decode(record + op.offset);
+        }
+        assign(values, out);
+    }
+
+    /** Decode one record with list properties; false if it runs past @p end. */
+    [[nodiscard]] bool readVariable(const uint8_t*& pos, const uint8_t* end, VertexAttributes& out) const {
+        float values[kFieldCount] = {};
+        for (const WalkStep& step : walk_) {
+            if (step.property.is_list) {
+                const size_t count_size = typeSize(step.property.count_type);
+                if (static_cast<size_t>(end - pos) < count_size) {
+                    return false;
+                }
+                const int64_t count = step.decode_count(pos);
+                pos += count_size;
+                const uint64_t items = static_cast<uint64_t>(std::max<int64_t>(count, 0));
+                const uint64_t bytes = items * typeSize(step.property.type);
+                if (static_cast<uint64_t>(end - pos) < bytes) {
+                    return false;
+                }
+                pos += bytes;
+                continue;
+            }
+            const size_t size = typeSize(step.property.type);
+            if (static_cast<size_t>(end - pos) < size) {
+                return false;
+            }
+            if (step.field != kSkipped) {
+                values[step.field] = step.decode(pos);
+            }
+            pos += size;
+        }
+        assign(values, out);
+        return true;
+    }
+
+    /** Decode one ASCII record; false on a malformed value. */
+    [[nodiscard]] bool readAscii(AsciiValues& in, VertexAttributes& out) const {
+        float values[kFieldCount] = {};
+        for (const WalkStep& step : walk_) {
+            double value = 0.0;
+            if (!in.next(value)) {
+                return false;
+            }
+            if (step.property.is_list) {
+                for (int64_t i = 0; i < static_cast<int64_t>(value); ++i) {
+                    double item = 0.0;
+                    if (!in.next(item)) {
+                        return false;
+                    }
+                }
+            } else if (step.field != kSkipped) {
+                values[step.field] = static_cast<float>(value);
+            }
+        }
+        assign(values, out);
+        return true;
+    }
+
+   private:
+    struct Op {
+        uint32_t offset;
+        Field field;
+        PlyType type;
+        FloatDecoder decode;
+    };
+
+    struct WalkStep {
+        const PlyProperty& property;
+        Field field;
+        FloatDecoder decode;
+        IndexDecoder decode_count;
+    };
+
+    static VertexAttributes defaults() {
+        VertexAttributes vertex{};
+        vertex.normal[1] = 1.0f;
+        vertex.tangent[0] = 1.0f;
+        vertex.bitangent[2] = 1.0f;
+        return vertex;
+    }
+
+    void assign(const float (&values)[kFieldCount], VertexAttributes& out) const {
+        out = defaults();
+        std::copy(values + eX, values + eZ + 1, out.position);
+        if (has_normals_) {
+            std::copy(values + eNx, values + eNz + 1, out.normal);
+        }
+        if (has_uv_) {
+            out.texcoord0[0] = values[eU];
+            out.texcoord0[1] = flip_uvs_ ? 1.0f - values[eV] : values[eV];
+        }
+    }
+
+    std::vector<Op> ops_;
+    std::vector<WalkStep> walk_;
+    size_t stride_;
+    size_t xyz_offset_ = 0;
+    bool copy_xyz_ = false;
+    bool flip_uvs_;
+    bool has_position_ = false;
+    bool has_normals_ = false;
+    bool has_uv_ = false;
+};
+
+// ---- Decoding -------------------------------------------------------------------------------------------------
+
+/** Streams the elements of a PLY body into a Mesh, in declaration order. */
+class PlyDecoder {
+   public:
+    PlyDecoder(const uint8_t* data,
+               size_t size,
+               const PlyHeader& header,
+               const std::string& uri,
+               const PlyLoaderOptions& options,
+               const vne::io::LoadMonitor& monitor)
+        : pos_(data + header.data_offset)
+        , end_(data + size)
+        , header_(header)
+        , uri_(uri)
+        , options_(options)
+        , monitor_(monitor)
+        , swap_(needsSwap(header.format))
+        , ascii_(reinterpret_cast<const char*>(pos_), reinterpret_cast<const char*>(end_)) {}
+
+    [[nodiscard]] vne::io::Status decode(Mesh& mesh) {
+        using vne::io::ErrorCode;
+        const auto vertex_element =
+            std::find_if(header_.elements.begin(), header_.elements.end(), [](const PlyElement& element) {
+                return element.name == "vertex";
+            });
+        if (vertex_element == header_.elements.end() || vertex_element->count == 0) {
+            return plyError(ErrorCode::eParseError, "PLY file has no vertices", uri_);
+        }
+        if (vertex_element->count > std::numeric_limits<uint32_t>::max()) {
+            return plyError(ErrorCode::eUnsupportedFeature, "PLY file has too many vertices for 32-bit indices", uri_);
+        }
+        vertex_count_ = vertex_element->count;
+        const VertexReader reader(*vertex_element, header_.format, options_);
+        if (!reader.hasPosition()) {
+            return plyError(ErrorCode::eParseError, "PLY vertex element has no x/y/z properties", uri_);
+        }
+        mesh.vertices.clear();
+        mesh.indices.clear();
+        for (const PlyElement& element : header_.elements) {
+            vne::io::Status status;
+            if (&element == &*vertex_element) {
+                status = readVertices(element, reader, mesh);
+                if (status && !monitor_.update("decode", 1, kProgressPhases)) {
+                    status = cancelled();
+                }
+            } else if (element.name == "face") {
+                status = readFaces(element, mesh);
+            } else {
+                status = skip(element);
+            }
+            if (!status) {
+                return status;
+            }
+        }
+        mesh.name = uri_;
+        mesh.materials = {Material{"DefaultMaterial",
+                                   "",
+                                   {kDefaultMaterialGray, kDefaultMaterialGray, kDefaultMaterialGray, 1.0f}}};
+        mesh.parts.clear();
+        if (!mesh.indices.empty()) {
+            mesh.parts.push_back(Submesh{0, static_cast<uint32_t>(mesh.indices.size()), 0});
+        }
+        mesh.has_normals = reader.hasNormals();
+        mesh.has_uv0 = reader.hasUv();
+        mesh.has_tangent = false;
+        PointBounds all;
+        for (const PointBounds& b : bounds_) {
+            all.merge(b);
+        }
+        all.storeXyz(mesh.aabb_min, mesh.aabb_max);
+        (void)monitor_.update("decode", kProgressPhases, kProgressPhases);
+        return vne::io::Status::okStatus();
+    }
+
+   private:
+    [[nodiscard]] vne::io::Status cancelled() const {
+        return plyError(vne::io::ErrorCode::eCancelled, "PLY load cancelled", uri_);
+    }
+
+    [[nodiscard]] vne::io::Status truncated() const {
+        return plyError(vne::io::ErrorCode::eDataTruncated, "PLY body is shorter than its header declares", uri_);
+    }
+
+    [[nodiscard]] vne::io::Status malformed() const {
+        return plyError(vne::io::ErrorCode::eParseError,
+                        "Malformed PLY value near byte " + std::to_string(header_.data_offset + ascii_.offset()),
+                        uri_);
+    }
+
+    [[nodiscard]] vne::io::Status badIndex() const {
+        return plyError(vne::io::ErrorCode::eParseError, "PLY face references a missing vertex", uri_);
+    }
+
+    template<typename Fn>
+    void parallel(size_t count, Fn&& body) {
+        vne::io::parallelFor(
+            count,
+            [this, &body](size_t i) {
+                if (!monitor_.cancelled()) {
+                    body(i);
+                }
+            },
+            options_.max_threads);
+    }
+
+    [[nodiscard]] bool binary() const { return header_.format != PlyFormat::eAscii; }
+
+    /** False when the load was cancelled (checked every kRecordsPerCancelCheck records). */
+    [[nodiscard]] bool tick(uint64_t record) const {
+        return record % kRecordsPerCancelCheck != 0 || !monitor_.cancelled();
+    }
+
+    vne::io::Status readVertices(const PlyElement& element, const VertexReader& reader, Mesh& mesh) {
+        VNEIO_TRACE_SPAN("PlyLoader::vertices");
+        const size_t count = static_cast<size_t>(element.count);
+        mesh.vertices.resize(count);
+        if (binary() && reader.stride() != 0) {
+            if (static_cast<uint64_t>(end_ - pos_) / reader.stride() < count) {
+                return truncated();
+            }
+            const size_t tasks = (count + kVerticesPerTask - 1) / kVerticesPerTask;
+            bounds_.resize(tasks);
+            const uint8_t* base = pos_;
+            parallel(tasks, [&](size_t task) {
+                const size_t last = std::min(count, (task + 1) * kVerticesPerTask);
+                for (size_t v = task * kVerticesPerTask; v < last; ++v) {
+                    reader.read(base + v * reader.stride(), mesh.vertices[v]);
+                    bounds_[task].add(mesh.vertices[v].position);
+                }
+            });
+            pos_ += count * reader.stride();
+            return monitor_.cancelled() ? cancelled() : vne::io::Status::okStatus();
+        }
+        PointBounds& bounds = bounds_.emplace_back();
+        for (size_t v = 0; v < count; ++v) {
+            const bool valid = binary() ? reader.readVariable(pos_, end_, mesh.vertices[v])
+                                        : reader.readAscii(ascii_, mesh.vertices[v]);
+            if (!valid) {
+                return binary() ? truncated() : malformed();
+            }
+            bounds.add(mesh.vertices[v].position);
+            if (!tick(v)) {
+                return cancelled();
+            }
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    /** Position of the index list, or the element's property count if there is none. */
+    static size_t indexList(const PlyElement& element) {
+        for (size_t i = 0; i < element.properties.size(); ++i) {
+            const PlyProperty& property = element.properties[i];
+            if (property.is_list && (property.name == "vertex_indices" || property.name == "vertex_index")) {
+                return i;
+            }
+        }
+        return element.properties.size();
+    }
+
+    vne::io::Status readFaces(const PlyElement& element, Mesh& mesh) {
+        VNEIO_TRACE_SPAN("PlyLoader::faces");
+        const size_t list = indexList(element);
+        if (list == element.properties.size()) {
+            return plyError(vne::io::ErrorCode::eParseError, "PLY face element has no vertex_indices list", uri_);
+        }
+        if (element.count > std::numeric_limits<uint32_t>::max() / 3) {
+            return plyError(vne::io::ErrorCode::eUnsupportedFeature, "PLY file has too many faces", uri_);
+        }
+        const PlyProperty& indices = element.properties[list];
+        if (binary() && element.properties.size() == 1 && typeSize(indices.count_type) == 1
+            && (indices.type == PlyType::eInt32 || indices.type == PlyType::eUint32)) {
+            bool all_triangles = true;
+            vne::io::Status status = readTriangles(element, mesh, all_triangles);
+            if (!status || all_triangles) {
+                return status;
+            }
+        }
+        return readPolygons(element, list, mesh);
+    }
+
+    /**
+     * Fast path for faces that are all "3 i j k" records (uchar count, 32-bit indices): every record
+     * is 13 bytes, so the block is decoded in parallel; any other count clears @p all_triangles.
+     */
+    vne::io::Status readTriangles(const PlyElement& element, Mesh& mesh, bool& all_triangles) {
+        const size_t count = static_cast<size_t>(element.count);
+        if (static_cast<uint64_t>(end_ - pos_) / kTriangleRecordBytes < count) {
+            all_triangles = false;  // may still be valid with smaller polygons
+            return vne::io::Status::okStatus();
+        }
+        const size_t first_index = mesh.indices.size();
+        mesh.indices.resize(first_index + 3 * count);
+        uint32_t* out = mesh.indices.data() + first_index;
+        const uint8_t* base = pos_;
+        const IndexDecoder decode = decoderFor<int64_t>(element.properties[0].type, swap_);
+        std::atomic<bool> triangles{true};
+        std::atomic<bool> in_range{true};
+        const size_t tasks = (count + kFacesPerTask - 1) / kFacesPerTask;
+        parallel(tasks, [&](size_t task) {
+            const size_t last = std::min(count, (task + 1) * kFacesPerTask);
+            for (size_t f = task * kFacesPerTask; f < last; ++f) {
+                const uint8_t* record = base + f * kTriangleRecordBytes;
+                if (record[0] != 3) {
+                    triangles.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                for (size_t k = 0; k < 3; ++k) {
+                    const int64_t index = decode(record + 1 + k * sizeof(uint32_t));
+                    if (index < 0 || static_cast<uint64_t>(index) >= vertex_count_) {
+                        in_range.store(false, std::memory_order_relaxed);
+                        return;
+                    }
+                    out[3 * f + k] = static_cast<uint32_t>(index);
+                }
+            }
+        });
+        if (monitor_.cancelled()) {
+            return cancelled();
+        }
+        all_triangles = triangles.load();
+        if (!all_triangles) {
+            mesh.indices.resize(first_index);
+            return vne::io::Status::okStatus();
+        }
+        if (!in_range.load()) {
+            return badIndex();
+        }
+        pos_ += count * kTriangleRecordBytes;
+        return vne::io::Status::okStatus();
+    }
+
+    /** General face path: walk every record, fan the index list into triangles and skip other properties. */
+    vne::io::Status readPolygons(const PlyElement& element, size_t list, Mesh& mesh) {
+        mesh.indices.reserve(mesh.indices.size() + 3 * static_cast<size_t>(element.count));
+        std::vector<uint32_t> polygon;
+        for (uint64_t f = 0; f < element.count; ++f) {
+            for (size_t p = 0; p < element.properties.size(); ++p) {
+                if (p != list) {
+                    if (!skipProperty(element.properties[p])) {
+                        return binary() ? truncated() : malformed();
+                    }
+                    continue;
+                }
+                polygon.clear();
+                int64_t corners = 0;
+                if (!readListCount(element.properties[p], corners)) {
+                    return binary() ? truncated() : malformed();
+                }
+                for (int64_t k = 0; k < corners; ++k) {
+                    int64_t index = 0;
+                    if (!readListItem(element.properties[p], index)) {
+                        return binary() ? truncated() : malformed();
+                    }
+                    if (index < 0 || static_cast<uint64_t>(index) >= vertex_count_) {
+                        return badIndex();
+                    }
+                    polygon.push_back(static_cast<uint32_t>(index));
+                }
+                for (size_t k = 1; k + 1 < polygon.size(); ++k) {
+                    mesh.indices.insert(mesh.indices.end(), {polygon[0], polygon[k], polygon[k + 1]});
+                }
+            }
+            if (!tick(f)) {
+                return cancelled();
+            }
+        }
+        if (mesh.indices.size() > std::numeric_limits<uint32_t>::max()) {
+            return plyError(vne::io::ErrorCode::eUnsupportedFeature, "PLY file has too many triangles", uri_);
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    [[nodiscard]] bool readListCount(const PlyProperty& property, int64_t& count) {
+        if (!binary()) {
+            double value = 0.0;
+            if (!ascii_.next(value)) {
+                return false;
+            }
+            count = static_cast<int64_t>(value);
+            return count >= 0;
+        }
+        const size_t size = typeSize(property.count_type);
+        if (static_cast<size_t>(end_ - pos_) < size) {
+            return false;
+        }
+        count = decoderFor<int64_t>(property.count_type, swap_)(pos_);
+        pos_ += size;
+        return count >= 0;
+    }
+
+    [[nodiscard]] bool readListItem(const PlyProperty& property, int64_t& value) {
+        if (!binary()) {
+            double number = 0.0;
+            if (!ascii_.next(number)) {
+                return false;
+            }
+            value = static_cast<int64_t>(number);
+            return true;
+        }
+        const size_t size = typeSize(property.type);
+        if (static_cast<size_t>(end_ - pos_) < size) {
+            return false;
+        }
+        value = decoderFor<int64_t>(property.type, swap_)(pos_);
+        pos_ += size;
+        return true;
+    }
+
+    [[nodiscard]] bool skipProperty(const PlyProperty& property) {
+        int64_t items = 1;
+        if (property.is_list && !readListCount(property, items)) {
+            return false;
+        }
+        if (!binary()) {
+            double value = 0.0;
+            for (int64_t i = 0; i < items; ++i) {
+                if (!ascii_.next(value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        const uint64_t bytes = static_cast<uint64_t>(items) * typeSize(property.type);
+        if (static_cast<uint64_t>(end_ - pos_) < bytes) {
+            return false;
+        }
+        pos_ += bytes;
+        return true;
+    }
+
+    /** Skip an element that has no Mesh counterpart (edges, materials, ...). */
+    vne::io::Status skip(const PlyElement& element) {
+        const size_t fixed = element.fixedSize();
+        if (binary() && fixed != 0) {
+            if (static_cast<uint64_t>(end_ - pos_) / fixed < element.count) {
+                return truncated();
+            }
+            pos_ += static_cast<size_t>(element.count) * fixed;
+            return vne::io::Status::okStatus();
+        }
+        for (uint64_t r = 0; r < element.count; ++r) {
+            for (const PlyProperty& property : element.properties) {
+                if (!skipProperty(property)) {
+                    return binary() ? truncated() : malformed();
+                }
+            }
+            if (!tick(r)) {
+                return cancelled();
+            }
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    const uint8_t* pos_;  //!< Binary read position.
+    const uint8_t* end_;
+    const PlyHeader& header_;
+    const std::string& uri_;
+    const PlyLoaderOptions& options_;
+    const vne::io::LoadMonitor& monitor_;
+    bool swap_;
+    AsciiValues ascii_;  //!< ASCII read position.
+    uint64_t vertex_count_ = 0;
+    std::vector<PointBounds> bounds_;
+};
+
+vne::io::Status decodePly(const uint8_t* data,
+                          size_t size,
+                          const std::string& uri,
+                          const PlyLoaderOptions& options,
+                          const vne::io::LoadMonitor& monitor,
+                          Mesh& mesh) {
+    PlyHeader header;
+    vne::io::Status status = parseHeader(data, size, uri, header);
+    if (!status) {
+        return status;
+    }
+    PlyDecoder decoder(data, size, header, uri, options, monitor);
+    return decoder.decode(mesh);
+}
+
+}  // namespace
+
+vne::io::LoadResult<Mesh> PlyLoader::loadMesh(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("PlyLoader::loadMesh");
+    vne::io::LoadResult<Mesh> result{Mesh(vne::io::assetMemoryResource(request))};
+    const vne::io::LoadMonitor monitor(request);
+    MeshSource source;
+    result.status = source.open(request, monitor);
+    if (result.status) {
+        result.status = decodePly(source.data(), source.size(), request.uri, options_, monitor, result.value);
+    }
+    if (!result.status) {
+        result.value = Mesh{};
+    }
+    return result;
+}
+
+bool PlyLoader::loadFile(const std::string& path, Mesh& out_mesh) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = path;
+    vne::io::LoadResult<Mesh> result = loadMesh(request);
+    if (!result.ok()) {
+        last_error_ = result.status.message;
+        return false;
+    }
+    out_mesh = std::move(result.value);
+    last_error_.clear();
+    return true;
+}
+
+bool PlyLoader::isExtensionSupported(const std::string& path) const {
+    return vne::io::fileExtension(path) == "ply";
+}
+
+const std::vector<std::string>& PlyLoader::supportedExtensions() const {
+    return kPlyExtensions;
+}
+
+std::string PlyLoader::optionsKey() const {
+    std::string key = "ply1|";
+    key += options_.flip_uvs ? '1' : '0';
+    key += options_.positions_only ? '1' : '0';
+    return key;
+}
+
+}  // namespace mesh
+}  // namespace vne
@@ -0,0 +1,100 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// Internal AABB accumulator shared by the native mesh loaders; not installed.
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define VNEIO_MESH_SSE 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define VNEIO_MESH_NEON 1
+#endif
+
+namespace vne {
+namespace mesh {
+
+/** Running AABB over points read as four floats (the fourth lane is ignored; NaN coordinates are skipped). */
+class PointBounds {
+   public:
+    void add(const float* p) {
+#if defined(VNEIO_MESH_SSE)
+        const __m128 v = _mm_loadu_ps(p);
+        min_ = _mm_min_ps(v, min_);  // the second operand wins when either is NaN
+        max_ = _mm_max_ps(v, max_);
+#elif defined(VNEIO_MESH_NEON)
+        const float32x4_t v = vld1q_f32(p);
+        min_ = vminnmq_f32(min_, v);
+        max_ = vmaxnmq_f32(max_, v);
+#else
+        for (int i = 0; i < 3; ++i) {
+            min_[i] = std::min(min_[i], p[i]);
+            max_[i] = std::max(max_[i], p[i]);
+        }
+#endif
+    }
+
+    void merge(const PointBounds& other) {
+#if defined(VNEIO_MESH_SSE)
+        min_ = _mm_min_ps(other.min_, min_);
+        max_ = _mm_max_ps(other.max_, max_);
+#elif defined(VNEIO_MESH_NEON)
+        min_ = vminnmq_f32(min_, other.min_);
+        max_ = vmaxnmq_f32(max_, other.max_);
+#else
+        for (int i = 0; i < 3; ++i) {
+            min_[i] = std::min(min_[i], other.min_[i]);
+            max_[i] = std::max(max_[i], other.max_[i]);
+        }
+#endif
+    }
+
+    /** Writes four floats to each of @p lo and @p hi. */
+    void store(float* lo, float* hi) const {
+#if defined(VNEIO_MESH_SSE)
+        _mm_storeu_ps(lo, min_);
+        _mm_storeu_ps(hi, max_);
+#elif defined(VNEIO_MESH_NEON)
+        vst1q_f32(lo, min_);
+        vst1q_f32(hi, max_);
+#else
+        std::copy(min_, min_ + 4, lo);
+        std::copy(max_, max_ + 4, hi);
+#endif
+    }
+
+    /** Writes the xyz bounds to @p lo and @p hi (e.g. Mesh::aabb_min / aabb_max). */
+    void storeXyz(float* lo, float* hi) const {
+        float lo4[4];
+        float hi4[4];
+        store(lo4, hi4);
+        std::copy(lo4, lo4 + 3, lo);
+        std::copy(hi4, hi4 + 3, hi);
+    }
+
+   private:
+    static constexpr float kInf = std::numeric_limits<float>::infinity();
+#if defined(VNEIO_MESH_SSE)
+    __m128 min_ = _mm_set1_ps(kInf);
+    __m128 max_ = _mm_set1_ps(-kInf);
+#elif defined(VNEIO_MESH_NEON)
+    float32x4_t min_ = vdupq_n_f32(kInf);
+    float32x4_t max_ = vdupq_n_f32(-kInf);
+#else
+    float min_[4] = {kInf, kInf, kInf, kInf};
+    float max_[4] = {-kInf, -kInf, -kInf, -kInf};
+#endif
+};
+
+}  // namespace mesh
+}  // namespace vne
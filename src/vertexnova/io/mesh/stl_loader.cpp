@@ -0,0 +1,593 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/stl_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/parallel_for.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/mesh/mesh_source.h"
+#include "vertexnova/io/mesh/point_bounds.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+namespace vne {
+namespace mesh {
+
+namespace {
+
+constexpr size_t kBinaryHeaderBytes = 80;
+constexpr size_t kBinaryPrefixBytes = kBinaryHeaderBytes + sizeof(uint32_t);
+constexpr size_t kBinaryTriangleBytes = 50;  //!< Normal, three corners (12 floats) and a 16-bit attribute.
+constexpr size_t kTriangleFloats = 12;
+constexpr size_t kTrianglesPerTask = size_t{1} << 15;
+constexpr uint32_t kWeldShardBits = 8;
+constexpr size_t kWeldShards = size_t{1} << kWeldShardBits;
+constexpr uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+constexpr uint64_t kProgressPhases = 4;
+constexpr float kDefaultMaterialGray = 0.6f;  //!< Assimp's STL default material color.
+constexpr const char* kSubsystem = "StlLoader";
+const std::vector<std::string> kStlExtensions = {"stl"};
+
+/** Copy floats out of a record, byte-swapping little-endian file data on big-endian hosts. */
+void loadFloats(const uint8_t* src, float* dst, size_t count, bool little_endian_file) {
+    std::memcpy(dst, src, count * sizeof(float));
+    if (std::endian::native == std::endian::big && little_endian_file) {
+        for (size_t i = 0; i < count; ++i) {
+            const auto bits = std::bit_cast<uint32_t>(dst[i]);
+            dst[i] = std::bit_cast<float>((bits >> 24) | ((bits >> 8) & 0xFF00u) | ((bits << 8) & 0xFF0000u)
+                                          | (bits << 24));
+        }
+    }
+}
+
+/**
+ * Triangle records at a fixed stride, each a facet normal followed by three corners (12 floats):
+ * the mapped binary file itself (little-endian), or the host-order records of an ASCII parse.
+ */
+struct TriangleSource {
+    const uint8_t* base = nullptr;
+    size_t stride = 0;
+    size_t count = 0;
+    bool little_endian = false;
+
+    void load(size_t triangle, float* out) const {
+        loadFloats(base + triangle * stride, out, kTriangleFloats, little_endian);
+    }
+
+    void loadCorner(size_t corner, float* out) const {
+        loadFloats(base + corner / 3 * stride + (3 + 3 * (corner % 3)) * sizeof(float), out, 3, little_endian);
+    }
+};
+
+/** The file's facet normal, or the geometric one if the file stores zero (common) or garbage. */
+void facetNormal(const float* record, float* normal) {
+    const float* n = record;
+    const float length_sq = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+    if (length_sq > 0.0f && std::isfinite(length_sq)) {
+        std::copy(n, n + 3, normal);
+        return;
+    }
+    const float* a = record + 3;
+    const float* b = record + 6;
+    const float* c = record + 9;
+    const float e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    float cross[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+    const float length = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+    const float scale = length > 0.0f && std::isfinite(length) ? 1.0f / length : 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        normal[i] = cross[i] * scale;
+    }
+}
+
+/** Welding key of a corner: position and normal, with -0.0 folded into +0.0. */
+struct CornerKey {
+    float values[6];
+
+    bool operator==(const CornerKey& other) const {
+        return std::memcmp(values, other.values, sizeof(values)) == 0;
+    }
+};
+
+/** Position and effective normal of every corner, read from the source and the normals computed once. */
+class Corners {
+   public:
+    Corners(const TriangleSource& source, const std::vector<float>& normals)
+        : source_(source)
+        , normals_(normals) {}
+
+    [[nodiscard]] CornerKey key(size_t corner) const {
+        const size_t triangle = corner / 3;
+        CornerKey key{};
+        source_.loadCorner(corner, key.values);
+        std::copy(normals_.data() + 3 * triangle, normals_.data() + 3 * triangle + 3, key.values + 3);
+        for (float& value : key.values) {
+            value += 0.0f;
+        }
+        return key;
+    }
+
+   private:
+    const TriangleSource& source_;
+    const std::vector<float>& normals_;
+};
+
+uint32_t hashKey(const CornerKey& key) {
+    uint64_t h = 0x9E3779B97F4A7C15ull;
+    for (const float value : key.values) {
+        h = (h ^ std::bit_cast<uint32_t>(value)) * 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 31;
+    }
+    return static_cast<uint32_t>(h ^ (h >> 32));
+}
+
+/** Fill @p out with the position and normal of a corner and AssimpLoader's defaults for the rest. */
+void writeVertex(const CornerKey& key, VertexAttributes& out) {
+    out = VertexAttributes{};
+    std::copy(key.values, key.values + 3, out.position);
+    std::copy(key.values + 3, key.values + 6, out.normal);
+    out.tangent[0] = 1.0f;
+    out.bitangent[2] = 1.0f;
+}
+
+vne::io::Status stlError(vne::io::ErrorCode code, const std::string& message, const std::string& uri) {
+    return vne::io::Status::make(code, message, uri, kSubsystem);
+}
+
+// ---- ASCII ----------------------------------------------------------------------------------------------------
+
+/** Streaming tokenizer over an ASCII STL; keywords compare case-insensitively. */
+class AsciiReader {
+   public:
+    AsciiReader(const char* begin, const char* end)
+        : pos_(begin)
+        , begin_(begin)
+        , end_(end) {}
+
+    [[nodiscard]] std::string_view token() {
+        skipSpace();
+        const char* start = pos_;
+        while (pos_ < end_ && !isSpace(*pos_)) {
+            ++pos_;
+        }
+        return {start, static_cast<size_t>(pos_ - start)};
+    }
+
+    [[nodiscard]] bool expect(std::string_view keyword) { return equalsKeyword(token(), keyword); }
+
+    [[nodiscard]] bool number(float& out) {
+        skipSpace();
+        if (pos_ < end_ && *pos_ == '+') {
+            ++pos_;  // from_chars rejects an explicit plus sign
+        }
+        const auto [next, ec] = std::from_chars(pos_, end_, out);
+        if (ec != std::errc() || (next < end_ && !isSpace(*next))) {
+            return false;
+        }
+        pos_ = next;
+        return true;
+    }
+
+    void skipLine() {
+        while (pos_ < end_ && *pos_ != '\n') {
+            ++pos_;
+        }
+    }
+
+    [[nodiscard]] size_t offset() const { return static_cast<size_t>(pos_ - begin_); }
+
+    static bool equalsKeyword(std::string_view token, std::string_view keyword) {
+        return token.size() == keyword.size()
+               && std::equal(token.begin(), token.end(), keyword.begin(), [](char a, char b) {
+                      return (a >= 'A' && a <= 'Z' ? static_cast<char>(a - 'A' + 'a') : a) == b;
+                  });
+    }
+
+   private:
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+
+    void skipSpace() {
+        while (pos_ < end_ && isSpace(*pos_)) {
+            ++pos_;
+        }
+    }
+
+    const char* pos_;
+    const char* begin_;
+    const char* end_;
+};
+
+/** Parse an ASCII STL into 12-float triangle records; polygons with more corners are fanned. */
+vne::io::Status parseAscii(const uint8_t* data,
+                           size_t size,
+                           const std::string& uri,
+                           const vne::io::LoadMonitor& monitor,
+                           std::vector<float>& records) {
+    VNEIO_TRACE_SPAN("StlLoader::parseAscii");
+    AsciiReader reader(reinterpret_cast<const char*>(data), reinterpret_cast<const char*>(data) + size);
+    std::vector<float> polygon;
+    size_t facets = 0;
+    for (std::string_view token = reader.token(); !token.empty(); token = reader.token()) {
+        if (AsciiReader::equalsKeyword(token, "solid") || AsciiReader::equalsKeyword(token, "endsolid")) {
+            reader.skipLine();  // optional solid name
+            continue;
+        }
+        float normal[3] = {};
+        bool valid = AsciiReader::equalsKeyword(token, "facet") && reader.expect("normal")
+                     && reader.number(normal[0]) && reader.number(normal[1]) && reader.number(normal[2])
+                     && reader.expect("outer") && reader.expect("loop");
+        polygon.clear();
+        while (valid) {
+            token = reader.token();
+            if (AsciiReader::equalsKeyword(token, "endloop")) {
+                break;
+            }
+            float corner[3] = {};
+            valid = AsciiReader::equalsKeyword(token, "vertex") && reader.number(corner[0])
+                    && reader.number(corner[1]) && reader.number(corner[2]);
+            polygon.insert(polygon.end(), corner, corner + 3);
+        }
+        if (!valid || !reader.expect("endfacet") || polygon.size() < 9) {
+            return stlError(vne::io::ErrorCode::eParseError,
+                            "Malformed ASCII STL facet near byte " + std::to_string(reader.offset()),
+                            uri);
+        }
+        for (size_t i = 3; i + 3 < polygon.size(); i += 3) {
+            records.insert(records.end(), normal, normal + 3);
+            records.insert(records.end(), polygon.begin(), polygon.begin() + 3);
+            records.insert(records.end(), polygon.begin() + static_cast<std::ptrdiff_t>(i),
+                           polygon.begin() + static_cast<std::ptrdiff_t>(i + 6));
+        }
+        if (++facets % kTrianglesPerTask == 0 && !monitor.update("parse", reader.offset(), size)) {
+            return stlError(vne::io::ErrorCode::eCancelled, "STL load cancelled", uri);
+        }
+    }
+    return vne::io::Status::okStatus();
+}
+
+// ---- Triangles to Mesh ----------------------------------------------------------------------------------------
+
+/**
+ * Turn triangle records into indexed vertices (welded or one per corner) with per-task bounds.
+ * Work is split into tasks of kTrianglesPerTask triangles; welding hashes every corner, groups
+ * corners by hash shard (keeping corner order inside a shard), dedups each shard in parallel
+ * and then numbers the first occurrences in corner order.
+ */
+class StlBuilder {
+   public:
+    StlBuilder(const TriangleSource& source, const StlLoaderOptions& options, const vne::io::LoadMonitor& monitor)
+        : source_(source)
+        , options_(options)
+        , monitor_(monitor)
+        , tasks_((source.count + kTrianglesPerTask - 1) / kTrianglesPerTask)
+        , bounds_(tasks_) {}
+
+    /** @return false if cancelled. */
+    [[nodiscard]] bool build(Mesh& mesh) {
+        const size_t corners = source_.count * 3;
+        normals_.resize(source_.count * 3);
+        mesh.indices.resize(corners);
+        if (options_.weld_vertices) {
+            hashes_.resize(corners);
+            shard_counts_.assign(tasks_ * kWeldShards, 0);
+        }
+        {
+            VNEIO_TRACE_SPAN("StlLoader::parse");
+            run([this](size_t task) { parseTask(task); });
+        }
+        if (!monitor_.update("decode", 1, kProgressPhases)) {
+            return false;
+        }
+        if (!options_.weld_vertices) {
+            VNEIO_TRACE_SPAN("StlLoader::emit");
+            mesh.vertices.resize(corners);
+            run([this, &mesh](size_t task) { emitUnweldedTask(task, mesh); });
+            return !monitor_.cancelled();
+        }
+        const Corners view(source_, normals_);
+        {
+            VNEIO_TRACE_SPAN("StlLoader::weld");
+            order_.resize(corners);
+            std::vector<size_t> shard_begin(kWeldShards + 1, 0);
+            size_t running = 0;
+            for (size_t shard = 0; shard < kWeldShards; ++shard) {
+                shard_begin[shard] = running;
+                for (size_t task = 0; task < tasks_; ++task) {
+                    const uint32_t count = shard_counts_[task * kWeldShards + shard];
+                    shard_counts_[task * kWeldShards + shard] = static_cast<uint32_t>(running);
+                    running += count;
+                }
+            }
+            shard_begin[kWeldShards] = running;
+            run([this](size_t task) { scatterTask(task); });
+            if (!monitor_.update("decode", 2, kProgressPhases)) {
+                return false;
+            }
+            uint32_t* representative = mesh.indices.data();
+            parallel(kWeldShards, [&](size_t shard) {
+                dedupShard(view, shard_begin[shard], shard_begin[shard + 1], representative);
+            });
+        }
+        if (!monitor_.update("decode", 3, kProgressPhases)) {
+            return false;
+        }
+        VNEIO_TRACE_SPAN("StlLoader::emit");
+        std::vector<uint32_t> unique_base(tasks_ + 1, 0);
+        run([this, &mesh, &unique_base](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            uint32_t count = 0;
+            for (size_t c = begin; c < end; ++c) {
+                count += mesh.indices[c] == c ? 1u : 0u;
+            }
+            unique_base[task + 1] = count;
+        });
+        for (size_t task = 0; task < tasks_; ++task) {
+            unique_base[task + 1] += unique_base[task];
+        }
+        mesh.vertices.resize(unique_base[tasks_]);
+        std::vector<uint32_t>& slot = hashes_;  // hashes are no longer needed
+        run([this, &mesh, &unique_base, &slot, &view](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            uint32_t id = unique_base[task];
+            for (size_t c = begin; c < end; ++c) {
+                if (mesh.indices[c] == c) {
+                    slot[c] = id;
+                    writeVertex(view.key(c), mesh.vertices[id]);
+                    bounds_[task].add(mesh.vertices[id].position);
+                    ++id;
+                }
+            }
+        });
+        run([this, &mesh, &slot](size_t task) {
+            const auto [begin, end] = cornerRange(task);
+            for (size_t c = begin; c < end; ++c) {
+                mesh.indices[c] = slot[mesh.indices[c]];
+            }
+        });
+        return !monitor_.cancelled();
+    }
+
+    [[nodiscard]] PointBounds bounds() const {
+        PointBounds all;
+        for (const PointBounds& b : bounds_) {
+            all.merge(b);
+        }
+        return all;
+    }
+
+   private:
+    [[nodiscard]] std::pair<size_t, size_t> triangleRange(size_t task) const {
+        return {task * kTrianglesPerTask, std::min(source_.count, (task + 1) * kTrianglesPerTask)};
+    }
+
+    [[nodiscard]] std::pair<size_t, size_t> cornerRange(size_t task) const {
+        const auto [begin, end] = triangleRange(task);
+        return {begin * 3, end * 3};
+    }
+
+    template<typename Fn>
+    void parallel(size_t count, Fn&& body) {
+        vne::io::parallelFor(
+            count,
+            [this, &body](size_t i) {
+                if (!monitor_.cancelled()) {
+                    body(i);
+                }
+            },
+            options_.max_threads);
+    }
+
+    template<typename Fn>
+    void run(Fn&& body) {
+        parallel(tasks_, std::forward<Fn>(body));
+    }
+
+    void parseTask(size_t task) {
+        const auto [begin, end] = triangleRange(task);
+        float record[kTriangleFloats];
+        for (size_t t = begin; t < end; ++t) {
+            source_.load(t, record);
+            facetNormal(record, normals_.data() + 3 * t);
+        }
+        if (!options_.weld_vertices) {
+            return;
+        }
+        const Corners view(source_, normals_);
+        uint32_t* counts = shard_counts_.data() + task * kWeldShards;
+        for (size_t c = begin * 3; c < end * 3; ++c) {
+            const uint32_t hash = hashKey(view.key(c));
+            hashes_[c] = hash;
+            ++counts[hash >> (32 - kWeldShardBits)];
+        }
+    }
+
+    void scatterTask(size_t task) {
+        const auto [begin, end] = cornerRange(task);
+        uint32_t* next = shard_counts_.data() + task * kWeldShards;  // now this task's write offsets
+        for (size_t c = begin; c < end; ++c) {
+            order_[next[hashes_[c] >> (32 - kWeldShardBits)]++] = static_cast<uint32_t>(c);
+        }
+    }
+
+    /** Map each corner of one shard to the first corner with the same key (open addressing, linear probing). */
+    void dedupShard(const Corners& view, size_t begin, size_t end, uint32_t* representative) const {
+        if (begin == end) {
+            return;
+        }
+        const int bits = std::max(4, static_cast<int>(std::bit_width(2 * (end - begin) - 1)));
+        const size_t mask = (size_t{1} << bits) - 1;
+        std::vector<uint32_t> table(mask + 1, kEmptySlot);
+        for (size_t i = begin; i < end; ++i) {
+            const uint32_t corner = order_[i];
+            const uint32_t hash = hashes_[corner];
+            const CornerKey key = view.key(corner);
+            size_t slot = static_cast<size_t>((uint64_t{hash} * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+            for (;;) {
+                const uint32_t other = table[slot];
+                if (other == kEmptySlot) {
+                    table[slot] = corner;
+                    representative[corner] = corner;
+                    break;
+                }
+                if (hashes_[other] == hash && view.key(other) == key) {
+                    representative[corner] = other;
+                    break;
+                }
+                slot = (slot + 1) & mask;
+            }
+        }
+    }
+
+    void emitUnweldedTask(size_t task, Mesh& mesh) {
+        const auto [begin, end] = cornerRange(task);
+        const Corners view(source_, normals_);
+        for (size_t c = begin; c < end; ++c) {
+            writeVertex(view.key(c), mesh.vertices[c]);
+            bounds_[task].add(mesh.vertices[c].position);
+            mesh.indices[c] = static_cast<uint32_t>(c);
+        }
+    }
+
+    const TriangleSource& source_;
+    const StlLoaderOptions& options_;
+    const vne::io::LoadMonitor& monitor_;
+    size_t tasks_;
+    std::vector<PointBounds> bounds_;
+    std::vector<float> normals_;          //!< Effective facet normal per triangle.
+    std::vector<uint32_t> hashes_;        //!< Key hash per corner (weld only).
+    std::vector<uint32_t> shard_counts_;  //!< Per task and shard: corner count, then write offset.
+    std::vector<uint32_t> order_;         //!< Corners grouped by shard, ascending within a shard.
+};
+
+/** True for a binary STL: the triangle count matches the size, or the file has no "solid" and is long enough. */
+bool isBinaryStl(const uint8_t* data, size_t size, uint32_t& triangles) {
+    if (size < kBinaryPrefixBytes) {
+        return false;
+    }
+    uint8_t count_bytes[sizeof(uint32_t)];
+    std::memcpy(count_bytes, data + kBinaryHeaderBytes, sizeof(count_bytes));
+    triangles = static_cast<uint32_t>(count_bytes[0]) | (static_cast<uint32_t>(count_bytes[1]) << 8)
+                | (static_cast<uint32_t>(count_bytes[2]) << 16) | (static_cast<uint32_t>(count_bytes[3]) << 24);
+    const uint64_t expected = kBinaryPrefixBytes + uint64_t{triangles} * kBinaryTriangleBytes;
+    if (expected == size) {
+        return true;
+    }
+    AsciiReader reader(reinterpret_cast<const char*>(data), reinterpret_cast<const char*>(data) + size);
+    return !reader.expect("solid") && expected < size;
+}
+
+vne::io::Status decodeStl(const uint8_t* data,
+                          size_t size,
+                          const std::string& uri,
+                          const StlLoaderOptions& options,
+                          const vne::io::LoadMonitor& monitor,
+                          Mesh& mesh) {
+    using vne::io::ErrorCode;
+    TriangleSource source;
+    std::vector<float> ascii_records;
+    uint32_t binary_triangles = 0;
+    if (isBinaryStl(data, size, binary_triangles)) {
+        source = {data + kBinaryPrefixBytes, kBinaryTriangleBytes, binary_triangles, true};
+    } else if (AsciiReader(reinterpret_cast<const char*>(data), reinterpret_cast<const char*>(data) + size)
+                   .expect("solid")) {
+        vne::io::Status status = parseAscii(data, size, uri, monitor, ascii_records);
+        if (!status) {
+            return status;
+        }
+        source = {reinterpret_cast<const uint8_t*>(ascii_records.data()),
+                  kTriangleFloats * sizeof(float),
+                  ascii_records.size() / kTriangleFloats,
+                  false};
+    } else if (size >= kBinaryPrefixBytes) {
+        return stlError(ErrorCode::eDataTruncated, "Binary STL is shorter than its triangle count", uri);
+    } else {
+        return stlError(ErrorCode::eParseError, "Not an STL file", uri);
+    }
+    if (source.count == 0) {
+        return stlError(ErrorCode::eParseError, "STL file has no triangles", uri);
+    }
+    if (source.count > std::numeric_limits<uint32_t>::max() / 3) {
+        return stlError(ErrorCode::eUnsupportedFeature, "STL file has too many triangles for 32-bit indices", uri);
+    }
+
+    mesh.vertices.clear();
+    mesh.indices.clear();
+    StlBuilder builder(source, options, monitor);
+    if (!builder.build(mesh)) {
+        return stlError(ErrorCode::eCancelled, "STL load cancelled", uri);
+    }
+    mesh.name = uri;
+    mesh.parts = {Submesh{0, static_cast<uint32_t>(mesh.indices.size()), 0}};
+    mesh.materials = {Material{"DefaultMaterial",
+                               "",
+                               {kDefaultMaterialGray, kDefaultMaterialGray, kDefaultMaterialGray, 1.0f}}};
+    mesh.has_normals = true;
+    mesh.has_tangent = false;
+    mesh.has_uv0 = false;
+    builder.bounds().storeXyz(mesh.aabb_min, mesh.aabb_max);
+    (void)monitor.update("decode", kProgressPhases, kProgressPhases);
+    return vne::io::Status::okStatus();
+}
+
+}  // namespace
+
+vne::io::LoadResult<Mesh> StlLoader::loadMesh(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("StlLoader::loadMesh");
+    vne::io::LoadResult<Mesh> result{Mesh(vne::io::assetMemoryResource(request))};
+    const vne::io::LoadMonitor monitor(request);
+    MeshSource source;
+    result.status = source.open(request, monitor);
+    if (result.status) {
+        result.status = decodeStl(source.data(), source.size(), request.uri, options_, monitor, result.value);
+    }
+    if (!result.status) {
+        result.value = Mesh{};
+    }
+    return result;
+}
+
+bool StlLoader::loadFile(const std::string& path, Mesh& out_mesh) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = path;
+    vne::io::LoadResult<Mesh> result = loadMesh(request);
+    if (!result.ok()) {
+        last_error_ = result.status.message;
+        return false;
+    }
+    out_mesh = std::move(result.value);
+    last_error_.clear();
+    return true;
+}
+
+bool StlLoader::isExtensionSupported(const std::string& path) const {
+    return vne::io::fileExtension(path) == "stl";
+}
+
+const std::vector<std::string>& StlLoader::supportedExtensions() const {
+    return kStlExtensions;
+}
+
+std::string StlLoader::optionsKey() const {
+    return options_.weld_vertices ? "stl1|weld" : "stl1|noweld";
+}
+
+}  // namespace mesh
+}  // namespace vne
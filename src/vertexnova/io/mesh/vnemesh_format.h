@@ -0,0 +1,107 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+// On-disk layout of .vnemesh files, shared by exportVneMesh() and VneMeshLoader; not installed.
+
+#include "vertexnova/io/mesh/mesh.h"
+#include "vertexnova/io/mesh/vnemesh_loader.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace vne {
+namespace mesh {
+namespace vnemesh {
+
+constexpr std::array<char, 8> kMagic = {'V', 'N', 'E', 'M', 'E', 'S', 'H', '\0'};
+constexpr uint32_t kByteOrderMark = 0x01020304u;  //!< Reads back differently on a host of the other byte order.
+constexpr uint64_t kSectionAlignment = 64;
+
+constexpr uint32_t kHasNormals = 1u << 0;
+constexpr uint32_t kHasTangent = 1u << 1;
+constexpr uint32_t kHasUv0 = 1u << 2;
+
+/** Vertex attribute of a stream; the values match VertexAttributes' member order. */
+enum class Semantic : uint32_t { ePosition, eNormal, eTangent, eBitangent, eTexcoord0, eBarycentric, kCount };
+
+/** float32 components of each semantic. */
+constexpr uint32_t kSemanticComponents[] = {3, 3, 3, 3, 2, 3};
+
+/** Offset of each semantic inside VertexAttributes. */
+constexpr uint32_t kSemanticOffsets[] = {offsetof(VertexAttributes, position),
+                                         offsetof(VertexAttributes, normal),
+                                         offsetof(VertexAttributes, tangent),
+                                         offsetof(VertexAttributes, bitangent),
+                                         offsetof(VertexAttributes, texcoord0),
+                                         offsetof(VertexAttributes, barycentric)};
+
+struct Section {
+    uint64_t offset = 0;  //!< From the start of the file; a multiple of kSectionAlignment.
+    uint64_t size = 0;    //!< In bytes.
+};
+
+/** One vertex attribute: float32 components of element i at offset + i * stride. */
+struct Stream {
+    uint32_t semantic = 0;
+    uint32_t components = 0;
+    uint32_t stride = 0;
+    uint32_t reserved = 0;
+    uint64_t offset = 0;  //!< Of element 0, from the start of the file (inside the vertices section).
+};
+
+/** File header at offset 0. */
+struct Header {
+    std::array<char, 8> magic = kMagic;
+    uint32_t version = kVneMeshVersion;
+    uint32_t byte_order = kByteOrderMark;
+    uint32_t header_size = 0;  //!< sizeof(Header) of the writing version.
+    uint32_t flags = 0;        //!< kHas* bits.
+    uint64_t file_size = 0;
+    uint64_t vertex_count = 0;
+    uint64_t index_count = 0;
+    uint32_t index_size = 4;  //!< Bytes per index: 2 or 4.
+    uint32_t stream_count = 0;
+    uint32_t submesh_count = 0;
+    uint32_t material_count = 0;
+    uint32_t name_size = 0;  //!< Length of the mesh name at the start of the strings section.
+    uint32_t reserved = 0;
+    float aabb_min[3] = {0, 0, 0};
+    float aabb_max[3] = {0, 0, 0};
+    Section streams;    //!< Stream records.
+    Section vertices;   //!< Vertex data the streams point into.
+    Section indices;    //!< index_count indices of index_size bytes.
+    Section submeshes;  //!< Submesh records, as in Mesh::parts.
+    Section materials;  //!< MaterialRecord entries.
+    Section strings;    //!< Mesh name, then material strings.
+};
+
+/** Material entry; string offsets are relative to the strings section. */
+struct MaterialRecord {
+    uint32_t name_offset = 0;
+    uint32_t name_size = 0;
+    uint32_t texture_offset = 0;
+    uint32_t texture_size = 0;
+    float base_color[4] = {1, 1, 1, 1};
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && std::is_trivially_copyable_v<Stream>
+              && std::is_trivially_copyable_v<MaterialRecord> && std::is_trivially_copyable_v<Submesh>);
+static_assert(sizeof(Submesh) == 3 * sizeof(uint32_t) && sizeof(VertexAttributes) == 17 * sizeof(float));
+static_assert(sizeof(Header) == 192 && sizeof(Stream) == 24 && sizeof(MaterialRecord) == 32, "No padding on disk");
+
+constexpr uint64_t alignUp(uint64_t value) {
+    return (value + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+}  // namespace vnemesh
+}  // namespace mesh
+}  // namespace vne
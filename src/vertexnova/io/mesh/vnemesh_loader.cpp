@@ -0,0 +1,428 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/mesh/vnemesh_loader.h"
+#include "vertexnova/io/common/format_detect.h"
+#include "vertexnova/io/common/load_monitor.h"
+#include "vertexnova/io/common/parallel_for.h"
+#include "vertexnova/io/common/status.h"
+#include "vertexnova/io/common/trace.h"
+#include "vertexnova/io/mesh/mesh_source.h"
+#include "vertexnova/io/mesh/vnemesh_format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace vne {
+namespace mesh {
+
+namespace {
+
+constexpr size_t kVerticesPerTask = size_t{1} << 15;
+constexpr size_t kIndicesPerTask = size_t{1} << 18;
+constexpr uint64_t kMaxVertexCount = uint64_t{1} << 32;  //!< Addressable by 32-bit indices.
+constexpr uint64_t kProgressPhases = 2;
+constexpr const char* kSubsystem = "VneMeshLoader";
+const std::vector<std::string> kVneMeshExtensions = {"vnemesh"};
+
+vne::io::Status vnemeshError(vne::io::ErrorCode code, const std::string& message, const std::string& uri) {
+    return vne::io::Status::make(code, message, uri, kSubsystem);
+}
+
+/** True if @p section lies inside the first @p file_size bytes, after the header, on a section boundary. */
+bool sectionInBounds(const vnemesh::Section& section, uint64_t file_size) {
+    return section.offset % vnemesh::kSectionAlignment == 0 && section.offset >= sizeof(vnemesh::Header)
+           && section.offset <= file_size && section.size <= file_size - section.offset;
+}
+
+bool alignedFor(const uint8_t* data, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(data) % alignment == 0;
+}
+
+/**
+ * Header and tables of a mapped .vnemesh file, validated against the file size.
+ *
+ * Every offset, size and count is checked before use; the bulk data is only read by the decoders.
+ */
+class VneMeshFile {
+   public:
+    VneMeshFile(const uint8_t* data, size_t size, const std::string& uri)
+        : data_(data)
+        , size_(size)
+        , uri_(uri) {}
+
+    [[nodiscard]] vne::io::Status parse() {
+        if (size_ < vnemesh::kMagic.size() || std::memcmp(data_, vnemesh::kMagic.data(), vnemesh::kMagic.size()) != 0) {
+            return fail(vne::io::ErrorCode::eUnsupportedFormat, "Not a .vnemesh file");
+        }
+        if (size_ < sizeof(vnemesh::Header)) {
+            return fail(vne::io::ErrorCode::eDataTruncated, "Truncated .vnemesh header");
+        }
+        std::memcpy(&header_, data_, sizeof(header_));
+        if (header_.byte_order != vnemesh::kByteOrderMark) {
+            return fail(vne::io::ErrorCode::eUnsupportedFormat, ".vnemesh file was written with another byte order");
+        }
+        if (header_.version != kVneMeshVersion) {
+            std::string message = "Unsupported .vnemesh version ";
+            message += std::to_string(header_.version);
+            return fail(vne::io::ErrorCode::eUnsupportedFormat, message);
+        }
+        if (header_.header_size != sizeof(vnemesh::Header)) {
+            return fail(vne::io::ErrorCode::eDataCorrupt, "Invalid .vnemesh header size");
+        }
+        if (header_.file_size > size_) {
+            return fail(vne::io::ErrorCode::eDataTruncated, "Truncated .vnemesh file");
+        }
+        vne::io::Status status = parseSections();
+        if (status) {
+            status = parseStreams();
+        }
+        if (status) {
+            status = parseTables();
+        }
+        return status;
+    }
+
+    [[nodiscard]] const vnemesh::Header& header() const { return header_; }
+    [[nodiscard]] const std::vector<vnemesh::Stream>& streams() const { return streams_; }
+    [[nodiscard]] const uint8_t* at(uint64_t offset) const { return data_ + offset; }
+
+    /** True if the vertices are stored as VertexAttributes and the indices as 32-bit values (the default export). */
+    [[nodiscard]] bool isDirect() const {
+        if (header_.index_size != sizeof(uint32_t)
+            || streams_.size() != static_cast<size_t>(vnemesh::Semantic::kCount)) {
+            return false;
+        }
+        // Semantics are unique (parseStreams), so six matching streams cover every member.
+        return std::all_of(streams_.begin(), streams_.end(), [this](const vnemesh::Stream& stream) {
+            return stream.stride == sizeof(VertexAttributes)
+                   && stream.offset == header_.vertices.offset + vnemesh::kSemanticOffsets[stream.semantic];
+        });
+    }
+
+    [[nodiscard]] std::string name() const {
+        return {reinterpret_cast<const char*>(at(header_.strings.offset)), header_.name_size};
+    }
+
+    [[nodiscard]] std::vector<Material> materials() const {
+        std::vector<Material> materials(header_.material_count);
+        const char* strings = reinterpret_cast<const char*>(at(header_.strings.offset));
+        for (size_t i = 0; i < materials.size(); ++i) {
+            const vnemesh::MaterialRecord record = materialRecord(i);
+            materials[i].name.assign(strings + record.name_offset, record.name_size);
+            materials[i].base_color_tex.assign(strings + record.texture_offset, record.texture_size);
+            std::copy(record.base_color, record.base_color + 4, materials[i].base_color);
+        }
+        return materials;
+    }
+
+   private:
+    vne::io::Status fail(vne::io::ErrorCode code, const std::string& message) const {
+        return vnemeshError(code, message, uri_);
+    }
+
+    [[nodiscard]] vnemesh::MaterialRecord materialRecord(size_t index) const {
+        vnemesh::MaterialRecord record;
+        std::memcpy(&record, at(header_.materials.offset + index * sizeof(record)), sizeof(record));
+        return record;
+    }
+
+    vne::io::Status parseSections() {
+        const uint64_t file_size = header_.file_size;
+        for (const vnemesh::Section* section : {&header_.streams,
+                                                &header_.vertices,
+                                                &header_.indices,
+                                                &header_.submeshes,
+                                                &header_.materials,
+                                                &header_.strings}) {
+            if (!sectionInBounds(*section, file_size)) {
+                return fail(vne::io::ErrorCode::eDataCorrupt, "Invalid .vnemesh section table");
+            }
+        }
+        // Counts are 32-bit except vertex_count and index_count, so only their products could overflow.
+        const bool sizes_match =
+            header_.streams.size == uint64_t{header_.stream_count} * sizeof(vnemesh::Stream)
+            && header_.submeshes.size == uint64_t{header_.submesh_count} * sizeof(Submesh)
+            && header_.materials.size == uint64_t{header_.material_count} * sizeof(vnemesh::MaterialRecord)
+            && (header_.index_size == 2 || header_.index_size == 4) && header_.index_count <= UINT32_MAX
+            && header_.indices.size == header_.index_count * header_.index_size
+            && header_.name_size <= header_.strings.size && header_.vertex_count <= kMaxVertexCount;
+        if (!sizes_match) {
+            return fail(vne::io::ErrorCode::eDataCorrupt, "Inconsistent .vnemesh header counts");
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    vne::io::Status parseStreams() {
+        streams_.resize(header_.stream_count);
+        if (!streams_.empty()) {
+            std::memcpy(streams_.data(), at(header_.streams.offset), header_.streams.size);
+        }
+        const uint64_t vertices_end = header_.vertices.offset + header_.vertices.size;
+        bool seen[static_cast<size_t>(vnemesh::Semantic::kCount)] = {};
+        for (const vnemesh::Stream& stream : streams_) {
+            if (stream.semantic >= static_cast<uint32_t>(vnemesh::Semantic::kCount) || seen[stream.semantic]
+                || stream.components != vnemesh::kSemanticComponents[stream.semantic]) {
+                return fail(vne::io::ErrorCode::eDataCorrupt, "Invalid .vnemesh attribute stream");
+            }
+            seen[stream.semantic] = true;
+            const uint64_t element_size = stream.components * sizeof(float);
+            // vertex_count <= 2^32 and the stride is 32-bit, so the extent cannot overflow.
+            const uint64_t extent =
+                header_.vertex_count == 0 ? 0 : (header_.vertex_count - 1) * stream.stride + element_size;
+            if (stream.stride < element_size || stream.offset < header_.vertices.offset || stream.offset > vertices_end
+                || extent > vertices_end - stream.offset) {
+                return fail(vne::io::ErrorCode::eDataCorrupt, ".vnemesh attribute stream out of bounds");
+            }
+        }
+        if (!seen[static_cast<size_t>(vnemesh::Semantic::ePosition)]) {
+            return fail(vne::io::ErrorCode::eDataCorrupt, ".vnemesh file has no position stream");
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    vne::io::Status parseTables() {
+        for (uint32_t i = 0; i < header_.submesh_count; ++i) {
+            Submesh part;
+            std::memcpy(&part, at(header_.submeshes.offset + i * sizeof(Submesh)), sizeof(part));
+            if (uint64_t{part.first_index} + part.index_count > header_.index_count
+                || part.material_index >= header_.material_count) {
+                return fail(vne::io::ErrorCode::eDataCorrupt, "Invalid .vnemesh submesh");
+            }
+        }
+        for (uint32_t i = 0; i < header_.material_count; ++i) {
+            const vnemesh::MaterialRecord record = materialRecord(i);
+            if (uint64_t{record.name_offset} + record.name_size > header_.strings.size
+                || uint64_t{record.texture_offset} + record.texture_size > header_.strings.size) {
+                return fail(vne::io::ErrorCode::eDataCorrupt, "Invalid .vnemesh material");
+            }
+        }
+        if (!indicesInRange()) {
+            return fail(vne::io::ErrorCode::eDataCorrupt, ".vnemesh index out of range");
+        }
+        return vne::io::Status::okStatus();
+    }
+
+    /** One parallel pass over the index section: every index must address a vertex. */
+    [[nodiscard]] bool indicesInRange() const {
+        const auto count = static_cast<size_t>(header_.index_count);
+        const uint8_t* src = at(header_.indices.offset);
+        const uint32_t index_size = header_.index_size;
+        std::atomic<bool> in_range{true};
+        vne::io::parallelFor((count + kIndicesPerTask - 1) / kIndicesPerTask, [&](size_t task) {
+            const size_t begin = task * kIndicesPerTask;
+            const size_t end = std::min(count, begin + kIndicesPerTask);
+            uint32_t max_index = 0;
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t index = 0;
+                if (index_size == sizeof(uint32_t)) {
+                    std::memcpy(&index, src + i * sizeof(uint32_t), sizeof(uint32_t));
+                } else {
+                    uint16_t narrow = 0;
+                    std::memcpy(&narrow, src + i * sizeof(uint16_t), sizeof(uint16_t));
+                    index = narrow;
+                }
+                max_index = std::max(max_index, index);
+            }
+            if (max_index >= header_.vertex_count) {
+                in_range.store(false, std::memory_order_relaxed);
+            }
+        });
+        return in_range.load();
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    const std::string& uri_;
+    vnemesh::Header header_;
+    std::vector<vnemesh::Stream> streams_;
+};
+
+/** Vertex with AssimpLoader's defaults for attributes a compact file leaves out. */
+VertexAttributes defaultVertex() {
+    VertexAttributes vertex{};
+    vertex.normal[1] = 1.0f;
+    vertex.tangent[0] = 1.0f;
+    vertex.bitangent[2] = 1.0f;
+    return vertex;
+}
+
+/** Gather the attribute streams of a compact file into interleaved vertices, in parallel. */
+void gatherVertices(const VneMeshFile& file, std::pmr::vector<VertexAttributes>& out) {
+    const VertexAttributes defaults = defaultVertex();
+    const size_t count = out.size();
+    const size_t tasks = (count + kVerticesPerTask - 1) / kVerticesPerTask;
+    vne::io::parallelFor(tasks, [&](size_t task) {
+        const size_t begin = task * kVerticesPerTask;
+        const size_t end = std::min(count, begin + kVerticesPerTask);
+        std::fill(out.begin() + static_cast<std::ptrdiff_t>(begin), out.begin() + static_cast<std::ptrdiff_t>(end),
+                  defaults);
+        for (const vnemesh::Stream& stream : file.streams()) {
+            const uint8_t* src = file.at(stream.offset) + begin * stream.stride;
+            const size_t offset = vnemesh::kSemanticOffsets[stream.semantic];
+            const size_t bytes = stream.components * sizeof(float);
+            for (size_t i = begin; i < end; ++i, src += stream.stride) {
+                std::memcpy(reinterpret_cast<uint8_t*>(&out[i]) + offset, src, bytes);
+            }
+        }
+    });
+}
+
+/** Copy a trivially copyable array out of the file: a single bulk copy, either way. */
+template<typename T>
+void copyArray(const uint8_t* src, size_t count, std::pmr::vector<T>& out) {
+    if (alignedFor(src, alignof(T))) {
+        const T* first = reinterpret_cast<const T*>(src);
+        out.assign(first, first + count);
+    } else {
+        out.resize(count);
+        std::memcpy(out.data(), src, count * sizeof(T));
+    }
+}
+
+vne::io::Status decodeVneMesh(const VneMeshFile& file,
+                              const std::string& uri,
+                              const vne::io::LoadMonitor& monitor,
+                              Mesh& mesh) {
+    const vnemesh::Header& header = file.header();
+    const auto vertex_count = static_cast<size_t>(header.vertex_count);
+    const auto index_count = static_cast<size_t>(header.index_count);
+    if (file.isDirect()) {
+        copyArray(file.at(header.vertices.offset), vertex_count, mesh.vertices);
+        copyArray(file.at(header.indices.offset), index_count, mesh.indices);
+    } else {
+        mesh.vertices.resize(vertex_count);
+        gatherVertices(file, mesh.vertices);
+        if (header.index_size == sizeof(uint32_t)) {
+            copyArray(file.at(header.indices.offset), index_count, mesh.indices);
+        } else {
+            mesh.indices.resize(index_count);
+            const uint8_t* src = file.at(header.indices.offset);
+            for (size_t i = 0; i < index_count; ++i) {
+                uint16_t index = 0;
+                std::memcpy(&index, src + i * sizeof(index), sizeof(index));
+                mesh.indices[i] = index;
+            }
+        }
+    }
+    if (!monitor.update("decode", 1, kProgressPhases)) {
+        return vnemeshError(vne::io::ErrorCode::eCancelled, ".vnemesh load cancelled", uri);
+    }
+
+    mesh.parts.resize(header.submesh_count);
+    if (!mesh.parts.empty()) {
+        std::memcpy(mesh.parts.data(), file.at(header.submeshes.offset), header.submeshes.size);
+    }
+    mesh.materials = file.materials();
+    mesh.name = header.name_size > 0 ? file.name() : uri;
+    mesh.has_normals = (header.flags & vnemesh::kHasNormals) != 0;
+    mesh.has_tangent = (header.flags & vnemesh::kHasTangent) != 0;
+    mesh.has_uv0 = (header.flags & vnemesh::kHasUv0) != 0;
+    std::copy(header.aabb_min, header.aabb_min + 3, mesh.aabb_min);
+    std::copy(header.aabb_max, header.aabb_max + 3, mesh.aabb_max);
+    (void)monitor.update("decode", kProgressPhases, kProgressPhases);
+    return vne::io::Status::okStatus();
+}
+
+}  // namespace
+
+vne::io::LoadResult<Mesh> VneMeshLoader::loadMesh(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("VneMeshLoader::loadMesh");
+    vne::io::LoadResult<Mesh> result{Mesh(vne::io::assetMemoryResource(request))};
+    const vne::io::LoadMonitor monitor(request);
+    MeshSource source;
+    result.status = source.open(request, monitor);
+    if (result.status) {
+        VneMeshFile file(source.data(), source.size(), request.uri);
+        result.status = file.parse();
+        if (result.status) {
+            result.status = decodeVneMesh(file, request.uri, monitor, result.value);
+        }
+    }
+    if (!result.status) {
+        result.value = Mesh{};
+    }
+    return result;
+}
+
+vne::io::Result<VneMeshView> VneMeshLoader::loadView(const vne::io::LoadRequest& request) {
+    VNEIO_TRACE_SPAN("VneMeshLoader::loadView");
+    vne::io::Result<VneMeshView> result;
+    const vne::io::LoadMonitor monitor(request);
+    auto source = std::make_shared<MeshSource>();
+    result.status = source->open(request, monitor);
+    if (!result.status) {
+        return result;
+    }
+    VneMeshFile file(source->data(), source->size(), request.uri);
+    result.status = file.parse();
+    if (!result.status) {
+        return result;
+    }
+    if (!file.isDirect()) {
+        result.status = vnemeshError(vne::io::ErrorCode::eUnsupportedFeature,
+                                     "Compact .vnemesh files cannot be viewed; use loadMesh()",
+                                     request.uri);
+        return result;
+    }
+    // Sections are 64-byte aligned in the file, so an aligned base aligns every buffer.
+    if (!alignedFor(source->data(), alignof(VertexAttributes))) {
+        result.status = vnemeshError(vne::io::ErrorCode::eUnsupportedFeature,
+                                     "Misaligned .vnemesh buffer cannot be viewed; use loadMesh()",
+                                     request.uri);
+        return result;
+    }
+
+    const vnemesh::Header& header = file.header();
+    VneMeshView& view = result.value;
+    view.name = header.name_size > 0 ? file.name() : request.uri;
+    view.vertices = {reinterpret_cast<const VertexAttributes*>(file.at(header.vertices.offset)),
+                     static_cast<size_t>(header.vertex_count)};
+    view.indices = {reinterpret_cast<const uint32_t*>(file.at(header.indices.offset)),
+                    static_cast<size_t>(header.index_count)};
+    view.parts = {reinterpret_cast<const Submesh*>(file.at(header.submeshes.offset)), header.submesh_count};
+    view.materials = file.materials();
+    view.has_normals = (header.flags & vnemesh::kHasNormals) != 0;
+    view.has_tangent = (header.flags & vnemesh::kHasTangent) != 0;
+    view.has_uv0 = (header.flags & vnemesh::kHasUv0) != 0;
+    std::copy(header.aabb_min, header.aabb_min + 3, view.aabb_min);
+    std::copy(header.aabb_max, header.aabb_max + 3, view.aabb_max);
+    view.keep = std::move(source);
+    return result;
+}
+
+bool VneMeshLoader::loadFile(const std::string& path, Mesh& out_mesh) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = path;
+    vne::io::LoadResult<Mesh> result = loadMesh(request);
+    if (!result.ok()) {
+        last_error_ = result.status.message;
+        return false;
+    }
+    out_mesh = std::move(result.value);
+    last_error_.clear();
+    return true;
+}
+
+bool VneMeshLoader::isExtensionSupported(const std::string& path) const {
+    return vne::io::fileExtension(path) == "vnemesh";
+}
+
+const std::vector<std::string>& VneMeshLoader::supportedExtensions() const {
+    return kVneMeshExtensions;
+}
+
+}  // namespace mesh
+}  // namespace vne
@@ -0,0 +1,499 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/shared_asset.h"
+#include "vertexnova/io/common/trace.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VNEIO_HAS_SHM 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vne {
+namespace io {
+
+namespace {
+
+constexpr std::array<char, 8> kSharedMagic = {'V', 'N', 'E', 'S', 'H', 'M', '\0', '\0'};
+constexpr uint32_t kReadyMarker = 0x59444552u;  //!< "REDY"; stored last so readers never see a partial copy.
+constexpr uint64_t kSectionAlignment = 64;
+constexpr size_t kMaxSections = 5;
+constexpr size_t kMaxNameLength = 255;
+constexpr const char* kSubsystem = "SharedAsset";
+
+// Mesh sections; images and volumes use a single section 0 for their pixels / voxels.
+constexpr size_t kMeshVertices = 0;
+constexpr size_t kMeshIndices = 1;
+constexpr size_t kMeshParts = 2;
+constexpr size_t kMeshMaterials = 3;
+constexpr size_t kMeshStrings = 4;  //!< Mesh name followed by material strings.
+
+constexpr uint32_t kHasNormals = 1u << 0;
+constexpr uint32_t kHasTangent = 1u << 1;
+constexpr uint32_t kHasUv0 = 1u << 2;
+
+struct SharedSection {
+    uint64_t offset = 0;  //!< From the start of the segment; a multiple of kSectionAlignment.
+    uint64_t size = 0;    //!< In bytes.
+};
+
+/** Segment header at offset 0. Scalar fields not used by an asset type stay zero. */
+struct SharedHeader {
+    std::array<char, 8> magic = kSharedMagic;
+    uint32_t ready = 0;
+    uint32_t version = kSharedAssetVersion;
+    uint32_t asset_type = 0;
+    uint32_t section_count = 0;
+    uint64_t segment_size = 0;
+    int32_t dims[3] = {0, 0, 0};  //!< Image: width, height, channels. Volume: x, y, z.
+    int32_t pixel_type = 0;       //!< Volume.
+    int32_t components = 0;       //!< Volume.
+    uint32_t flags = 0;           //!< Mesh: kHas* bits.
+    uint32_t name_size = 0;       //!< Mesh: length of the name at the start of the strings section.
+    uint32_t reserved = 0;
+    float spacing[3] = {0, 0, 0};                                      //!< Volume.
+    float origin[3] = {0, 0, 0};                                       //!< Volume.
+    float direction[vne::image::kVolumeDirectionMatrixElements] = {};  //!< Volume.
+    float aabb_min[3] = {0, 0, 0};                                     //!< Mesh.
+    float aabb_max[3] = {0, 0, 0};                                     //!< Mesh.
+    SharedSection sections[kMaxSections] = {};
+};
+static_assert(std::is_trivially_copyable_v<SharedHeader>);
+
+/** Mesh material record; string offsets are relative to the strings section. */
+struct SharedMaterial {
+    uint32_t name_offset = 0;
+    uint32_t name_size = 0;
+    uint32_t texture_offset = 0;
+    uint32_t texture_size = 0;
+    float base_color[4] = {1, 1, 1, 1};
+};
+
+struct SectionSource {
+    const void* data = nullptr;
+    size_t size = 0;
+};
+
+Status sharedError(ErrorCode code, const std::string& message, const std::string& name) {
+    return Status::make(code, message, name, kSubsystem);
+}
+
+constexpr uint64_t alignUp(uint64_t value) {
+    return (value + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+bool validName(const std::string& name) {
+    return name.size() > 1 && name.size() <= kMaxNameLength && name.front() == '/'
+           && name.find('/', 1) == std::string::npos;
+}
+
+/** A mapped, validated segment; @c base keeps the mapping alive. */
+struct OpenedSegment {
+    std::shared_ptr<const uint8_t> base;
+    SharedHeader header;
+
+    [[nodiscard]] const uint8_t* section(size_t index) const { return base.get() + header.sections[index].offset; }
+    [[nodiscard]] uint64_t sectionSize(size_t index) const { return header.sections[index].size; }
+
+    /** Aliasing pointer to a section that shares ownership of the mapping. */
+    [[nodiscard]] std::shared_ptr<const uint8_t> share(size_t index) const {
+        return std::shared_ptr<const uint8_t>(base, section(index));
+    }
+};
+
+#if defined(VNEIO_HAS_SHM)
+
+Status publish(const std::string& name, SharedHeader header, const SectionSource* sources, size_t count) {
+    if (!validName(name)) {
+        return sharedError(ErrorCode::eInvalidArgument, "Shared segment names look like \"/name\"", name);
+    }
+    header.section_count = static_cast<uint32_t>(count);
+    uint64_t end = alignUp(sizeof(SharedHeader));
+    for (size_t i = 0; i < count; ++i) {
+        header.sections[i] = {end, sources[i].size};
+        end = alignUp(end + sources[i].size);
+    }
+    header.segment_size = end;
+    header.ready = 0;
+
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        const char* reason = errno == EEXIST ? "Shared segment already exists" : "Cannot create shared segment";
+        return sharedError(ErrorCode::eFileWriteFailed, reason, name);
+    }
+    const auto size = static_cast<size_t>(end);
+    bool sized = ::ftruncate(fd, static_cast<off_t>(size)) == 0;
+#if defined(__linux__)
+    // Reserve the pages now: a full /dev/shm is an error here instead of SIGBUS during the copy.
+    sized = sized && ::posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0;
+#endif
+    void* addr = sized ? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        return sharedError(ErrorCode::eFileWriteFailed, "Cannot size shared segment", name);
+    }
+    auto* bytes = static_cast<uint8_t*>(addr);
+    std::memcpy(bytes, &header, sizeof(header));
+    for (size_t i = 0; i < count; ++i) {
+        if (sources[i].size > 0) {
+            std::memcpy(bytes + header.sections[i].offset, sources[i].data, sources[i].size);
+        }
+    }
+    std::atomic_ref<uint32_t>(reinterpret_cast<SharedHeader*>(bytes)->ready).store(kReadyMarker,
+                                                                                    std::memory_order_release);
+    ::munmap(addr, size);
+    return Status::okStatus();
+}
+
+Result<OpenedSegment> openSegment(const std::string& name) {
+    Result<OpenedSegment> result;
+    if (!validName(name)) {
+        result.status = sharedError(ErrorCode::eInvalidArgument, "Shared segment names look like \"/name\"", name);
+        return result;
+    }
+    const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        result.status = errno == ENOENT ? sharedError(ErrorCode::eFileNotFound, "No such shared segment", name)
+                                        : sharedError(ErrorCode::eFileOpenFailed, "Cannot open shared segment", name);
+        return result;
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SharedHeader))) {
+        ::close(fd);
+        result.status = sharedError(ErrorCode::eDataTruncated, "Shared segment is not ready", name);
+        return result;
+    }
+    const auto size = static_cast<size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        result.status = sharedError(ErrorCode::eFileReadFailed, "Cannot map shared segment", name);
+        return result;
+    }
+    OpenedSegment& segment = result.value;
+    segment.base = std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(addr), [size](const uint8_t* p) {
+        ::munmap(const_cast<uint8_t*>(p), size);
+    });
+    // The mapping is read-only; an atomic load does not write, it only orders the reads after it.
+    auto* header = reinterpret_cast<SharedHeader*>(addr);
+    if (std::atomic_ref<uint32_t>(header->ready).load(std::memory_order_acquire) != kReadyMarker) {
+        result.status = sharedError(ErrorCode::eDataTruncated, "Shared segment is not ready", name);
+        return result;
+    }
+    std::memcpy(&segment.header, header, sizeof(SharedHeader));
+    const SharedHeader& h = segment.header;
+    if (h.magic != kSharedMagic || h.version != kSharedAssetVersion) {
+        result.status = sharedError(ErrorCode::eUnsupportedFormat, "Not a vneio shared segment of this version", name);
+        return result;
+    }
+    bool valid = h.segment_size <= size && h.section_count <= kMaxSections;
+    for (uint32_t i = 0; valid && i < h.section_count; ++i) {
+        const SharedSection& s = h.sections[i];
+        valid = s.offset % kSectionAlignment == 0 && s.offset <= h.segment_size && s.size <= h.segment_size - s.offset;
+    }
+    if (!valid) {
+        result.status = sharedError(ErrorCode::eDataCorrupt, "Shared segment header is inconsistent", name);
+    }
+    return result;
+}
+
+#else
+
+Status publish(const std::string& name, SharedHeader, const SectionSource*, size_t) {
+    return sharedError(ErrorCode::eNotImplemented, "Shared memory is not available on this platform", name);
+}
+
+Result<OpenedSegment> openSegment(const std::string& name) {
+    Result<OpenedSegment> result;
+    result.status = sharedError(ErrorCode::eNotImplemented, "Shared memory is not available on this platform", name);
+    return result;
+}
+
+#endif
+
+/** Opens @p name and checks that it holds an asset of @p type with @p sections sections. */
+Result<OpenedSegment> openAsset(const std::string& name, AssetType type, uint32_t sections) {
+    Result<OpenedSegment> result = openSegment(name);
+    if (result.ok() && result.value.header.asset_type != static_cast<uint32_t>(type)) {
+        result.status = sharedError(ErrorCode::eUnsupportedFormat, "Shared segment holds another asset type", name);
+    } else if (result.ok() && result.value.header.section_count != sections) {
+        result.status = sharedError(ErrorCode::eDataCorrupt, "Shared segment header is inconsistent", name);
+    }
+    return result;
+}
+
+/** Typed view of a whole section; false if its size is not a multiple of sizeof(T). */
+template<typename T>
+bool typedSection(const OpenedSegment& segment, size_t index, std::span<const T>& out) {
+    const uint64_t size = segment.sectionSize(index);
+    if (size % sizeof(T) != 0) {
+        return false;
+    }
+    out = {reinterpret_cast<const T*>(segment.section(index)), static_cast<size_t>(size / sizeof(T))};
+    return true;
+}
+
+bool stringAt(std::string_view strings, uint32_t offset, uint32_t size, std::string& out) {
+    if (offset > strings.size() || size > strings.size() - offset) {
+        return false;
+    }
+    out.assign(strings.substr(offset, size));
+    return true;
+}
+
+/** True if every index addresses a vertex and every part lies inside the index buffer and material list. */
+bool meshRangesValid(const SharedMeshView& view) {
+    const bool indices_valid = std::all_of(view.indices.begin(), view.indices.end(), [&view](uint32_t index) {
+        return index < view.vertices.size();
+    });
+    return indices_valid
+           && std::all_of(view.parts.begin(), view.parts.end(), [&view](const vne::mesh::Submesh& part) {
+                  return uint64_t{part.first_index} + part.index_count <= view.indices.size()
+                         && part.material_index < view.materials.size();
+              });
+}
+
+}  // namespace
+
+vne::image::Image SharedImageView::toImage() const {
+    return vne::image::Image(pixels.data(), width, height, channels);
+}
+
+vne::mesh::Mesh SharedMeshView::toMesh() const {
+    vne::mesh::Mesh mesh;
+    mesh.name = name;
+    mesh.vertices.assign(vertices.begin(), vertices.end());
+    mesh.indices.assign(indices.begin(), indices.end());
+    mesh.parts.assign(parts.begin(), parts.end());
+    mesh.materials = materials;
+    mesh.has_normals = has_normals;
+    mesh.has_tangent = has_tangent;
+    mesh.has_uv0 = has_uv0;
+    std::memcpy(mesh.aabb_min, aabb_min, sizeof(aabb_min));
+    std::memcpy(mesh.aabb_max, aabb_max, sizeof(aabb_max));
+    return mesh;
+}
+
+bool sharedAssetsSupported() {
+#if defined(VNEIO_HAS_SHM)
+    return true;
+#else
+    return false;
+#endif
+}
+
+Status exportShared(const std::string& name, const vne::image::Image& asset) {
+    VNEIO_TRACE_SPAN("SharedAsset::exportImage");
+    if (asset.getWidth() <= 0 || asset.getHeight() <= 0 || asset.getChannels() <= 0 || !asset.getData()) {
+        return sharedError(ErrorCode::eInvalidArgument, "Image is empty", name);
+    }
+    SharedHeader header;
+    header.asset_type = static_cast<uint32_t>(AssetType::eImage);
+    header.dims[0] = asset.getWidth();
+    header.dims[1] = asset.getHeight();
+    header.dims[2] = asset.getChannels();
+    const SectionSource pixels = {asset.getData(),
+                                  static_cast<size_t>(asset.getWidth()) * static_cast<size_t>(asset.getHeight())
+                                      * static_cast<size_t>(asset.getChannels())};
+    return publish(name, header, &pixels, 1);
+}
+
+Status exportShared(const std::string& name, const vne::mesh::Mesh& asset) {
+    VNEIO_TRACE_SPAN("SharedAsset::exportMesh");
+    if (asset.isEmpty()) {
+        return sharedError(ErrorCode::eInvalidArgument, "Mesh is empty", name);
+    }
+    SharedHeader header;
+    header.asset_type = static_cast<uint32_t>(AssetType::eMesh);
+    header.flags = (asset.has_normals ? kHasNormals : 0u) | (asset.has_tangent ? kHasTangent : 0u)
+                   | (asset.has_uv0 ? kHasUv0 : 0u);
+    header.name_size = static_cast<uint32_t>(asset.name.size());
+    std::memcpy(header.aabb_min, asset.aabb_min, sizeof(header.aabb_min));
+    std::memcpy(header.aabb_max, asset.aabb_max, sizeof(header.aabb_max));
+
+    std::string strings = asset.name;
+    std::vector<SharedMaterial> materials;
+    materials.reserve(asset.materials.size());
+    for (const vne::mesh::Material& material : asset.materials) {
+        SharedMaterial& record = materials.emplace_back();
+        record.name_offset = static_cast<uint32_t>(strings.size());
+        record.name_size = static_cast<uint32_t>(material.name.size());
+        strings += material.name;
+        record.texture_offset = static_cast<uint32_t>(strings.size());
+        record.texture_size = static_cast<uint32_t>(material.base_color_tex.size());
+        strings += material.base_color_tex;
+        std::memcpy(record.base_color, material.base_color, sizeof(record.base_color));
+    }
+    if (strings.size() > UINT32_MAX) {
+        return sharedError(ErrorCode::eInvalidArgument, "Mesh strings exceed 4 GiB", name);
+    }
+    std::array<SectionSource, kMaxSections> sources = {};
+    sources[kMeshVertices] = {asset.vertices.data(), asset.vertices.size() * sizeof(vne::mesh::VertexAttributes)};
+    sources[kMeshIndices] = {asset.indices.data(), asset.indices.size() * sizeof(uint32_t)};
+    sources[kMeshParts] = {asset.parts.data(), asset.parts.size() * sizeof(vne::mesh::Submesh)};
+    sources[kMeshMaterials] = {materials.data(), materials.size() * sizeof(SharedMaterial)};
+    sources[kMeshStrings] = {strings.data(), strings.size()};
+    return publish(name, header, sources.data(), sources.size());
+}
+
+Status exportShared(const std::string& name, const vne::image::Volume& asset) {
+    VNEIO_TRACE_SPAN("SharedAsset::exportVolume");
+    if (asset.isEmpty()) {
+        return sharedError(ErrorCode::eInvalidArgument, "Volume is empty", name);
+    }
+    SharedHeader header;
+    header.asset_type = static_cast<uint32_t>(AssetType::eVolume);
+    std::memcpy(header.dims, asset.dims, sizeof(header.dims));
+    header.pixel_type = static_cast<int32_t>(asset.pixel_type);
+    header.components = asset.components;
+    std::memcpy(header.spacing, asset.spacing, sizeof(header.spacing));
+    std::memcpy(header.origin, asset.origin, sizeof(header.origin));
+    std::memcpy(header.direction, asset.direction, sizeof(header.direction));
+    const SectionSource voxels = {asset.getData(), asset.byteCount()};
+    return publish(name, header, &voxels, 1);
+}
+
+Status unlinkShared(const std::string& name) {
+#if defined(VNEIO_HAS_SHM)
+    if (!validName(name)) {
+        return sharedError(ErrorCode::eInvalidArgument, "Shared segment names look like \"/name\"", name);
+    }
+    if (::shm_unlink(name.c_str()) != 0) {
+        return errno == ENOENT ? sharedError(ErrorCode::eFileNotFound, "No such shared segment", name)
+                               : sharedError(ErrorCode::eFileWriteFailed, "Cannot unlink shared segment", name);
+    }
+    return Status::okStatus();
+#else
+    return sharedError(ErrorCode::eNotImplemented, "Shared memory is not available on this platform", name);
+#endif
+}
+
+Result<AssetType> sharedAssetType(const std::string& name) {
+    Result<AssetType> result;
+    Result<OpenedSegment> segment = openSegment(name);
+    result.status = segment.status;
+    if (segment.ok()) {
+        result.value = static_cast<AssetType>(segment.value.header.asset_type);
+    }
+    return result;
+}
+
+Result<SharedImageView> importSharedImage(const std::string& name) {
+    VNEIO_TRACE_SPAN("SharedAsset::importImage");
+    Result<SharedImageView> result;
+    Result<OpenedSegment> segment = openAsset(name, AssetType::eImage, 1);
+    if (!segment.ok()) {
+        result.status = segment.status;
+        return result;
+    }
+    const SharedHeader& h = segment.value.header;
+    const bool sized = h.dims[0] > 0 && h.dims[1] > 0 && h.dims[2] > 0
+                       && segment.value.sectionSize(0)
+                              == static_cast<uint64_t>(h.dims[0]) * static_cast<uint64_t>(h.dims[1])
+                                     * static_cast<uint64_t>(h.dims[2]);
+    if (!sized) {
+        result.status = sharedError(ErrorCode::eInvalidDimensions, "Shared image size does not match its pixels", name);
+        return result;
+    }
+    SharedImageView& view = result.value;
+    view.width = h.dims[0];
+    view.height = h.dims[1];
+    view.channels = h.dims[2];
+    view.pixels = {segment.value.section(0), static_cast<size_t>(segment.value.sectionSize(0))};
+    view.keep = std::move(segment.value.base);
+    return result;
+}
+
+Result<SharedMeshView> importSharedMesh(const std::string& name) {
+    VNEIO_TRACE_SPAN("SharedAsset::importMesh");
+    Result<SharedMeshView> result;
+    Result<OpenedSegment> segment = openAsset(name, AssetType::eMesh, static_cast<uint32_t>(kMaxSections));
+    if (!segment.ok()) {
+        result.status = segment.status;
+        return result;
+    }
+    const OpenedSegment& s = segment.value;
+    SharedMeshView& view = result.value;
+    std::span<const SharedMaterial> materials;
+    const std::string_view strings(reinterpret_cast<const char*>(s.section(kMeshStrings)),
+                                   static_cast<size_t>(s.sectionSize(kMeshStrings)));
+    bool valid = typedSection(s, kMeshVertices, view.vertices) && typedSection(s, kMeshIndices, view.indices)
+                 && typedSection(s, kMeshParts, view.parts) && typedSection(s, kMeshMaterials, materials)
+                 && stringAt(strings, 0, s.header.name_size, view.name);
+    view.materials.reserve(materials.size());
+    for (size_t i = 0; valid && i < materials.size(); ++i) {
+        vne::mesh::Material& material = view.materials.emplace_back();
+        valid = stringAt(strings, materials[i].name_offset, materials[i].name_size, material.name)
+                && stringAt(strings, materials[i].texture_offset, materials[i].texture_size, material.base_color_tex);
+        std::memcpy(material.base_color, materials[i].base_color, sizeof(material.base_color));
+    }
+    if (!valid) {
+        result = {};
+        result.status = sharedError(ErrorCode::eDataCorrupt, "Shared mesh sections are inconsistent", name);
+        return result;
+    }
+    // The segment comes from another process: a renderer must be able to trust every index and range.
+    if (!meshRangesValid(view)) {
+        result = {};
+        result.status = sharedError(ErrorCode::eDataCorrupt, "Shared mesh indices or submeshes out of range", name);
+        return result;
+    }
+    view.has_normals = (s.header.flags & kHasNormals) != 0;
+    view.has_tangent = (s.header.flags & kHasTangent) != 0;
+    view.has_uv0 = (s.header.flags & kHasUv0) != 0;
+    std::memcpy(view.aabb_min, s.header.aabb_min, sizeof(view.aabb_min));
+    std::memcpy(view.aabb_max, s.header.aabb_max, sizeof(view.aabb_max));
+    view.keep = std::move(segment.value.base);
+    return result;
+}
+
+Result<vne::image::Volume> importSharedVolume(const std::string& name) {
+    VNEIO_TRACE_SPAN("SharedAsset::importVolume");
+    Result<vne::image::Volume> result;
+    Result<OpenedSegment> segment = openAsset(name, AssetType::eVolume, 1);
+    if (!segment.ok()) {
+        result.status = segment.status;
+        return result;
+    }
+    const SharedHeader& h = segment.value.header;
+    vne::image::Volume& volume = result.value;
+    std::memcpy(volume.dims, h.dims, sizeof(volume.dims));
+    std::memcpy(volume.spacing, h.spacing, sizeof(volume.spacing));
+    std::memcpy(volume.origin, h.origin, sizeof(volume.origin));
+    std::memcpy(volume.direction, h.direction, sizeof(volume.direction));
+    volume.pixel_type = static_cast<vne::image::VolumePixelType>(h.pixel_type);
+    volume.components = h.components;
+    const bool sized = volume.dims[0] > 0 && volume.dims[1] > 0 && volume.dims[2] > 0 && volume.components > 0
+                       && vne::image::bytesPerVoxel(volume.pixel_type) > 0
+                       && segment.value.sectionSize(0) == volume.byteCount();
+    if (!sized) {
+        result = {};
+        result.status =
+            sharedError(ErrorCode::eInvalidDimensions, "Shared volume size does not match its voxels", name);
+        return result;
+    }
+    volume.setExternalData(segment.value.share(0), volume.byteCount());
+    return result;
+}
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,155 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/vfs/file_system.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+constexpr size_t kHeaderChunkBytes = 4096;
+
+bool isAbsolutePath(const std::string& path) {
+    if (!path.empty() && (path.front() == '/' || path.front() == '\\')) {
+        return true;
+    }
+    return path.size() >= 2 && path[1] == ':';  // drive letter
+}
+
+}  // namespace
+
+size_t BufferFile::read(uint64_t offset, void* dst, size_t bytes) const {
+    if (offset >= size_) {
+        return 0;
+    }
+    const size_t count = std::min(bytes, size_ - static_cast<size_t>(offset));
+    std::memcpy(dst, data_ + offset, count);
+    return count;
+}
+
+Status IFile::readRange(uint64_t offset, void* dst, size_t bytes, const binaryio::ReadOptions& options) const {
+    auto* out = static_cast<uint8_t*>(dst);
+    const size_t chunk = std::max<size_t>(options.chunk_bytes, 1);
+    for (size_t done = 0; done < bytes;) {
+        const size_t count = std::min(chunk, bytes - done);
+        const size_t got = read(offset + done, out + done, count);
+        done += got;
+        if (got != count) {
+            const bool at_end = offset + done >= size();
+            return Status::make(at_end ? ErrorCode::eDataTruncated : ErrorCode::eFileReadFailed,
+                                at_end ? "File is shorter than the requested range" : "Failed to read file",
+                                "",
+                                "FileSystem");
+        }
+        if (options.on_chunk && !options.on_chunk(done, bytes)) {
+            return Status::make(ErrorCode::eCancelled, "Read cancelled", "", "FileSystem");
+        }
+    }
+    return Status::okStatus();
+}
+
+std::string normalizeVirtualPath(std::string_view path) {
+    std::vector<std::string_view> segments;
+    size_t pos = 0;
+    std::string unified(path);
+    std::replace(unified.begin(), unified.end(), '\\', '/');
+    const std::string_view view(unified);
+    while (pos <= view.size()) {
+        size_t end = view.find('/', pos);
+        if (end == std::string_view::npos) {
+            end = view.size();
+        }
+        const std::string_view segment = view.substr(pos, end - pos);
+        if (segment == "..") {
+            if (!segments.empty()) {
+                segments.pop_back();
+            }
+        } else if (!segment.empty() && segment != ".") {
+            segments.push_back(segment);
+        }
+        pos = end + 1;
+    }
+    std::string out;
+    out.reserve(unified.size());
+    for (const std::string_view segment : segments) {
+        if (!out.empty()) {
+            out += '/';
+        }
+        out += segment;
+    }
+    return out;
+}
+
+std::string resolveSiblingPath(const std::string& base_file, const std::string& relative) {
+    if (isAbsolutePath(relative)) {
+        return relative;
+    }
+    const size_t slash = base_file.find_last_of("/\\");
+    if (slash == std::string::npos) {
+        return relative;
+    }
+    return base_file.substr(0, slash + 1) + relative;
+}
+
+Status readFile(const IFileSystem& fs, const std::string& path, std::vector<uint8_t>& out) {
+    out.clear();
+    std::unique_ptr<IFile> file;
+    Status status = fs.openFile(path, file);
+    if (!status) {
+        return status;
+    }
+    const uint64_t size = file->size();
+    if (const std::shared_ptr<const uint8_t> bytes = file->contents()) {
+        out.assign(bytes.get(), bytes.get() + size);
+        return Status::okStatus();
+    }
+    out.resize(static_cast<size_t>(size));
+    if (!out.empty() && file->read(0, out.data(), out.size()) != out.size()) {
+        out.clear();
+        return Status::make(ErrorCode::eFileReadFailed, "Failed to read file", path, "FileSystem");
+    }
+    return Status::okStatus();
+}
+
+Status readHeaderUntilBlankLine(const IFile& file, std::string& header_text, size_t& data_offset) {
+    header_text.clear();
+    data_offset = 0;
+    const uint64_t size = file.size();
+    std::array<char, kHeaderChunkBytes> chunk{};
+    uint64_t offset = 0;
+    while (offset < size) {
+        const size_t got = file.read(offset, chunk.data(), chunk.size());
+        if (got == 0) {
+            return Status::make(ErrorCode::eFileReadFailed, "Failed to read header", {}, "FileSystem");
+        }
+        // A blank line is a '\n' that starts a line, i.e. follows another '\n' or the start of the file.
+        const size_t scan_from = header_text.size();
+        header_text.append(chunk.data(), got);
+        for (size_t i = scan_from; i < header_text.size(); ++i) {
+            if (header_text[i] == '\n' && (i == 0 || header_text[i - 1] == '\n')) {
+                header_text.resize(i + 1);
+                data_offset = i + 1;
+                return Status::okStatus();
+            }
+        }
+        offset += got;
+    }
+    if (!header_text.empty() && header_text.back() != '\n') {
+        header_text += '\n';
+    }
+    return Status::make(ErrorCode::eDataTruncated, "Header not terminated with blank line", {}, "FileSystem");
+}
+
+}  // namespace io
+}  // namespace vne
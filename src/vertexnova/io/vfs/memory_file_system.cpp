@@ -0,0 +1,105 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/vfs/memory_file_system.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+class MemoryFile final : public IFile {
+   public:
+    explicit MemoryFile(std::shared_ptr<const std::vector<uint8_t>> bytes)
+        : bytes_(std::move(bytes)) {}
+
+    [[nodiscard]] uint64_t size() const override { return bytes_->size(); }
+
+    [[nodiscard]] size_t read(uint64_t offset, void* dst, size_t bytes) const override {
+        if (offset >= bytes_->size()) {
+            return 0;
+        }
+        const size_t count = std::min(bytes, bytes_->size() - static_cast<size_t>(offset));
+        std::memcpy(dst, bytes_->data() + offset, count);
+        return count;
+    }
+
+    [[nodiscard]] std::shared_ptr<const uint8_t> contents() const override {
+        return std::shared_ptr<const uint8_t>(bytes_, bytes_->data());
+    }
+
+   private:
+    std::shared_ptr<const std::vector<uint8_t>> bytes_;
+};
+
+}  // namespace
+
+void MemoryFileSystem::addFile(const std::string& path, std::vector<uint8_t> bytes) {
+    auto shared = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+    std::string key = normalizeVirtualPath(path);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    files_[std::move(key)] = Entry{std::move(shared), ++generation_};
+}
+
+void MemoryFileSystem::addFile(const std::string& path, const std::string& text) {
+    addFile(path, std::vector<uint8_t>(text.begin(), text.end()));
+}
+
+bool MemoryFileSystem::removeFile(const std::string& path) {
+    const std::string key = normalizeVirtualPath(path);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return files_.erase(key) > 0;
+}
+
+size_t MemoryFileSystem::fileCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return files_.size();
+}
+
+bool MemoryFileSystem::exists(const std::string& path) const {
+    const std::string key = normalizeVirtualPath(path);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return files_.find(key) != files_.end();
+}
+
+Status MemoryFileSystem::stat(const std::string& path, FileInfo& out) const {
+    const std::string key = normalizeVirtualPath(path);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = files_.find(key);
+    if (it == files_.end()) {
+        return Status::make(ErrorCode::eFileNotFound, "File not found", path, "MemoryFileSystem");
+    }
+    out.size = it->second.bytes->size();
+    out.modified_time = it->second.modified_time;
+    return Status::okStatus();
+}
+
+Status MemoryFileSystem::openFile(const std::string& path, std::unique_ptr<IFile>& out) const {
+    out.reset();
+    const std::string key = normalizeVirtualPath(path);
+    std::shared_ptr<const std::vector<uint8_t>> bytes;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = files_.find(key);
+        if (it == files_.end()) {
+            return Status::make(ErrorCode::eFileNotFound, "File not found", path, "MemoryFileSystem");
+        }
+        bytes = it->second.bytes;
+    }
+    out = std::make_unique<MemoryFile>(std::move(bytes));
+    return Status::okStatus();
+}
+
+}  // namespace io
+}  // namespace vne
@@ -0,0 +1,165 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/vfs/native_file_system.h"
+#include "vertexnova/io/common/range_reader.h"
+
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VNEIO_HAS_PREAD 1
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <mutex>
+#endif
+
+namespace vne {
+namespace io {
+
+namespace {
+
+#if defined(VNEIO_HAS_PREAD)
+class NativeFile final : public IFile {
+   public:
+    NativeFile(int fd, uint64_t size, std::string path)
+        : fd_(fd)
+        , size_(size)
+        , path_(std::move(path)) {}
+    ~NativeFile() override { ::close(fd_); }
+
+    NativeFile(const NativeFile&) = delete;
+    NativeFile& operator=(const NativeFile&) = delete;
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+
+    [[nodiscard]] size_t read(uint64_t offset, void* dst, size_t bytes) const override {
+        auto* out = static_cast<uint8_t*>(dst);
+        size_t done = 0;
+        while (done < bytes) {
+            const ssize_t got = ::pread(fd_, out + done, bytes - done, static_cast<off_t>(offset + done));
+            if (got <= 0) {
+                break;
+            }
+            done += static_cast<size_t>(got);
+        }
+        return done;
+    }
+
+    [[nodiscard]] Status readRange(uint64_t offset,
+                                   void* dst,
+                                   size_t bytes,
+                                   const binaryio::ReadOptions& options) const override {
+        if (options.direct) {
+            return binaryio::readFileRange(path_, offset, dst, bytes, options);  // needs its own O_DIRECT descriptor
+        }
+        return binaryio::readDescriptorRange(fd_, offset, static_cast<uint8_t*>(dst), bytes, options, path_);
+    }
+
+   private:
+    int fd_ = -1;
+    uint64_t size_ = 0;
+    std::string path_;
+};
+#else
+class NativeFile final : public IFile {
+   public:
+    NativeFile(std::ifstream stream, uint64_t size)
+        : stream_(std::move(stream))
+        , size_(size) {}
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+
+    [[nodiscard]] size_t read(uint64_t offset, void* dst, size_t bytes) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stream_.clear();
+        stream_.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+        stream_.read(static_cast<char*>(dst), static_cast<std::streamsize>(bytes));
+        return static_cast<size_t>(stream_.gcount());
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    mutable std::ifstream stream_;
+    uint64_t size_ = 0;
+};
+#endif
+
+}  // namespace
+
+NativeFileSystem::NativeFileSystem(std::string root)
+    : root_(std::move(root)) {}
+
+std::string NativeFileSystem::resolve(const std::string& path) const {
+    if (root_.empty() || std::filesystem::path(path).is_absolute()) {
+        return path;
+    }
+    return (std::filesystem::path(root_) / path).string();
+}
+
+bool NativeFileSystem::exists(const std::string& path) const {
+    std::error_code ec;
+    return std::filesystem::is_regular_file(resolve(path), ec);
+}
+
+Status NativeFileSystem::stat(const std::string& path, FileInfo& out) const {
+    const std::string native = resolve(path);
+    std::error_code ec;
+    const uintmax_t size = std::filesystem::file_size(native, ec);
+    if (ec) {
+        return Status::make(ErrorCode::eFileNotFound, "File not found", path, "NativeFileSystem");
+    }
+    const auto mtime = std::filesystem::last_write_time(native, ec);
+    if (ec) {
+        return Status::make(ErrorCode::eFileReadFailed, "Cannot read modification time", path, "NativeFileSystem");
+    }
+    out.size = static_cast<uint64_t>(size);
+    out.modified_time = static_cast<int64_t>(mtime.time_since_epoch().count());
+    return Status::okStatus();
+}
+
+Status NativeFileSystem::openFile(const std::string& path, std::unique_ptr<IFile>& out) const {
+    out.reset();
+    const std::string native = resolve(path);
+#if defined(VNEIO_HAS_PREAD)
+    const int fd = ::open(native.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, "NativeFileSystem");
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return Status::make(ErrorCode::eFileOpenFailed, "Not a regular file", path, "NativeFileSystem");
+    }
+    out = std::make_unique<NativeFile>(fd, static_cast<uint64_t>(st.st_size), native);
+#else
+    std::ifstream stream(native, std::ios::binary | std::ios::ate);
+    if (!stream) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file", path, "NativeFileSystem");
+    }
+    const std::streamoff size = stream.tellg();
+    if (size < 0) {
+        return Status::make(ErrorCode::eFileReadFailed, "Failed to determine file size", path, "NativeFileSystem");
+    }
+    out = std::make_unique<NativeFile>(std::move(stream), static_cast<uint64_t>(size));
+#endif
+    return Status::okStatus();
+}
+
+const NativeFileSystem& nativeFileSystem() {
+    static const NativeFileSystem kNative;
+    return kNative;
+}
+
+}  // namespace io
+}  // namespace vne
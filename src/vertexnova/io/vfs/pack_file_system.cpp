@@ -0,0 +1,303 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/vfs/pack_file_system.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
+
+namespace vne {
+namespace io {
+
+namespace {
+
+constexpr std::array<char, 8> kPackMagic = {'V', 'N', 'E', 'P', 'A', 'C', 'K', '\0'};
+constexpr uint32_t kPackVersion = 2;
+constexpr size_t kPackHeaderBytes = 32;  // magic + version + entry count + toc offset + alignment + reserved
+constexpr size_t kTocRecordBytes = 32;   // path hash + offset + size + path offset + path length
+
+uint64_t pathHash(std::string_view path) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (const char c : path) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16)
+           | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint64_t readU64(const uint8_t* p) {
+    return static_cast<uint64_t>(readU32(p)) | (static_cast<uint64_t>(readU32(p + 4)) << 32);
+}
+
+void appendU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void appendU64(std::vector<uint8_t>& out, uint64_t value) {
+    appendU32(out, static_cast<uint32_t>(value));
+    appendU32(out, static_cast<uint32_t>(value >> 32));
+}
+
+class PackFile final : public IFile {
+   public:
+    PackFile(std::shared_ptr<const uint8_t> bytes, uint64_t size)
+        : bytes_(std::move(bytes))
+        , size_(size) {}
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+
+    [[nodiscard]] size_t read(uint64_t offset, void* dst, size_t bytes) const override {
+        if (offset >= size_) {
+            return 0;
+        }
+        const auto count = static_cast<size_t>(std::min<uint64_t>(bytes, size_ - offset));
+        std::memcpy(dst, bytes_.get() + offset, count);
+        return count;
+    }
+
+    [[nodiscard]] std::shared_ptr<const uint8_t> contents() const override { return bytes_; }
+
+   private:
+    std::shared_ptr<const uint8_t> bytes_;  //!< Aliases the pack mapping.
+    uint64_t size_ = 0;
+};
+
+}  // namespace
+
+Status PackFileSystem::open(const std::string& pack_path) {
+    mapping_.reset();
+    toc_ = nullptr;
+    paths_ = nullptr;
+    paths_size_ = 0;
+    entry_count_ = 0;
+    pack_path_ = pack_path;
+
+    auto mapping = std::make_shared<binaryio::MappedFile>();
+    Status status = mapping->open(pack_path, binaryio::MapAccess::eRandom);
+    if (!status) {
+        return status;
+    }
+    const uint8_t* data = mapping->data();
+    const size_t size = mapping->size();
+    auto corrupt = [&pack_path](const std::string& message) {
+        return Status::make(ErrorCode::eDataCorrupt, message, pack_path, "PackFileSystem");
+    };
+    if (size < kPackHeaderBytes || std::memcmp(data, kPackMagic.data(), kPackMagic.size()) != 0) {
+        return corrupt("Not a pack file");
+    }
+    if (readU32(data + 8) != kPackVersion) {
+        return Status::make(ErrorCode::eUnsupportedFormat, "Unsupported pack version", pack_path, "PackFileSystem");
+    }
+    const uint32_t entry_count = readU32(data + 12);
+    const uint64_t toc_offset = readU64(data + 16);
+    if (toc_offset < kPackHeaderBytes || toc_offset > size
+        || entry_count > (size - toc_offset) / kTocRecordBytes) {
+        return corrupt("Table of contents out of range");
+    }
+
+    // Validate once so lookups can trust the mapped records: payload and path bounds, and
+    // the (hash, path) order the binary search relies on.
+    const uint8_t* toc = data + toc_offset;
+    const uint8_t* paths = toc + static_cast<size_t>(entry_count) * kTocRecordBytes;
+    const size_t paths_size = size - static_cast<size_t>(paths - data);
+    std::string_view previous_path;
+    uint64_t previous_hash = 0;
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        const uint8_t* record = toc + static_cast<size_t>(i) * kTocRecordBytes;
+        const uint64_t hash = readU64(record);
+        const uint64_t offset = readU64(record + 8);
+        const uint64_t entry_size = readU64(record + 16);
+        const uint32_t path_offset = readU32(record + 24);
+        const uint32_t path_length = readU32(record + 28);
+        if (offset > toc_offset || entry_size > toc_offset - offset) {
+            return corrupt("Entry payload out of range");
+        }
+        if (path_offset > paths_size || path_length > paths_size - path_offset) {
+            return corrupt("Truncated table of contents");
+        }
+        const std::string_view path(reinterpret_cast<const char*>(paths + path_offset), path_length);
+        if (i > 0 && (hash < previous_hash || (hash == previous_hash && path <= previous_path))) {
+            return corrupt("Table of contents not sorted");
+        }
+        previous_hash = hash;
+        previous_path = path;
+    }
+
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(pack_path, ec);
+    modified_time_ = ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+    toc_ = toc;
+    paths_ = paths;
+    paths_size_ = paths_size;
+    entry_count_ = entry_count;
+    mapping_ = std::move(mapping);
+    return Status::okStatus();
+}
+
+std::optional<PackFileSystem::Entry> PackFileSystem::findEntry(const std::string& path) const {
+    if (!mapping_) {
+        return std::nullopt;
+    }
+    const std::string normalized = normalizeVirtualPath(path);
+    const uint64_t hash = pathHash(normalized);
+    // First record whose hash is not below the wanted one; equal hashes are then scanned.
+    uint32_t low = 0;
+    uint32_t high = entry_count_;
+    while (low < high) {
+        const uint32_t mid = low + (high - low) / 2;
+        if (readU64(toc_ + static_cast<size_t>(mid) * kTocRecordBytes) < hash) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    for (; low < entry_count_; ++low) {
+        const uint8_t* record = toc_ + static_cast<size_t>(low) * kTocRecordBytes;
+        if (readU64(record) != hash) {
+            break;
+        }
+        const std::string_view candidate(reinterpret_cast<const char*>(paths_ + readU32(record + 24)),
+                                         readU32(record + 28));
+        if (candidate == normalized) {
+            return Entry{readU64(record + 8), readU64(record + 16)};
+        }
+    }
+    return std::nullopt;
+}
+
+bool PackFileSystem::exists(const std::string& path) const {
+    return findEntry(path).has_value();
+}
+
+Status PackFileSystem::stat(const std::string& path, FileInfo& out) const {
+    const std::optional<Entry> entry = findEntry(path);
+    if (!entry) {
+        return Status::make(ErrorCode::eFileNotFound, "File not in pack", path, "PackFileSystem");
+    }
+    out.size = entry->size;
+    out.modified_time = modified_time_;
+    return Status::okStatus();
+}
+
+Status PackFileSystem::openFile(const std::string& path, std::unique_ptr<IFile>& out) const {
+    out.reset();
+    const std::optional<Entry> entry = findEntry(path);
+    if (!entry) {
+        return Status::make(ErrorCode::eFileNotFound, "File not in pack", path, "PackFileSystem");
+    }
+    std::shared_ptr<const uint8_t> bytes(mapping_, mapping_->data() + entry->offset);
+    out = std::make_unique<PackFile>(std::move(bytes), entry->size);
+    return Status::okStatus();
+}
+
+void PackWriter::addFile(const std::string& virtual_path, const std::string& source_path) {
+    sources_.push_back(Source{normalizeVirtualPath(virtual_path), source_path, {}});
+}
+
+void PackWriter::addBytes(const std::string& virtual_path, std::vector<uint8_t> bytes) {
+    sources_.push_back(Source{normalizeVirtualPath(virtual_path), {}, std::move(bytes)});
+}
+
+Status PackWriter::write(const std::string& pack_path) const {
+    if (alignment_ == 0 || (alignment_ & (alignment_ - 1)) != 0) {
+        return Status::make(ErrorCode::eInvalidArgument,
+                            "Pack alignment must be a power of two: " + std::to_string(alignment_),
+                            pack_path,
+                            "PackWriter");
+    }
+    std::unordered_set<std::string> seen;
+    for (const Source& source : sources_) {
+        if (!seen.insert(source.virtual_path).second) {
+            return Status::make(
+                ErrorCode::eInvalidArgument, "Duplicate pack path: " + source.virtual_path, pack_path, "PackWriter");
+        }
+    }
+
+    std::ofstream out(pack_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return Status::make(ErrorCode::eFileOpenFailed, "Cannot open file for writing", pack_path, "PackWriter");
+    }
+    // The header is rewritten once the table of contents offset is known.
+    std::vector<uint8_t> header(kPackHeaderBytes, 0);
+    out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+    struct Record {
+        uint64_t hash = 0;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        const std::string* path = nullptr;
+    };
+    std::vector<Record> records;
+    records.reserve(sources_.size());
+    uint64_t offset = kPackHeaderBytes;
+    std::vector<uint8_t> file_bytes;
+    const std::vector<uint8_t> padding(alignment_, 0);
+    for (const Source& source : sources_) {
+        const std::vector<uint8_t>* payload = &source.bytes;
+        if (!source.source_path.empty()) {
+            Status status = binaryio::readFile(source.source_path, file_bytes);
+            if (!status) {
+                return status;
+            }
+            payload = &file_bytes;
+        }
+        const uint64_t aligned = (offset + alignment_ - 1) & ~static_cast<uint64_t>(alignment_ - 1);
+        out.write(reinterpret_cast<const char*>(padding.data()), static_cast<std::streamsize>(aligned - offset));
+        out.write(reinterpret_cast<const char*>(payload->data()), static_cast<std::streamsize>(payload->size()));
+        records.push_back(Record{pathHash(source.virtual_path), aligned, payload->size(), &source.virtual_path});
+        offset = aligned + payload->size();
+    }
+
+    std::sort(records.begin(), records.end(), [](const Record& a, const Record& b) {
+        return a.hash != b.hash ? a.hash < b.hash : *a.path < *b.path;
+    });
+    std::vector<uint8_t> toc;
+    std::string paths;
+    toc.reserve(records.size() * kTocRecordBytes);
+    for (const Record& record : records) {
+        appendU64(toc, record.hash);
+        appendU64(toc, record.offset);
+        appendU64(toc, record.size);
+        appendU32(toc, static_cast<uint32_t>(paths.size()));
+        appendU32(toc, static_cast<uint32_t>(record.path->size()));
+        paths += *record.path;
+    }
+    out.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size()));
+    out.write(paths.data(), static_cast<std::streamsize>(paths.size()));
+
+    header.clear();
+    header.insert(header.end(), kPackMagic.begin(), kPackMagic.end());
+    appendU32(header, kPackVersion);
+    appendU32(header, static_cast<uint32_t>(sources_.size()));
+    appendU64(header, offset);
+    appendU32(header, alignment_);
+    appendU32(header, 0);
+    out.seekp(0, std::ios::beg);
+    out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    if (!out) {
+        return Status::make(ErrorCode::eFileWriteFailed, "Failed to write pack", pack_path, "PackWriter");
+    }
+    return Status::okStatus();
+}
+
+}  // namespace io
+}  // namespace vne
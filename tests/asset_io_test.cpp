@@ -5,13 +5,34 @@
  */
 
 #include "vertexnova/io/asset_io.h"
+#include "vertexnova/io/asset_watcher.h"
+#include "vertexnova/io/cooked_asset_loader.h"
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/trace.h"
 #include "vertexnova/io/image/nrrd_loader.h"
+#include "vertexnova/io/image/volume_loader.h"
 #include "vertexnova/io/image/mhd_loader.h"
 #include "vertexnova/io/image/stb_image_loader.h"
 #include "vertexnova/io/mesh/assimp_loader.h"
+#include "vertexnova/io/mesh/obj_loader.h"
+#include "vertexnova/io/mesh/stl_loader.h"
+#include "vertexnova/io/shared_asset.h"
 #include "vertexnova/io/utils/path_utils.h"
+#include "vertexnova/io/vfs/memory_file_system.h"
+#include "vertexnova/io/vfs/pack_file_system.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <variant>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -85,3 +106,1398 @@ TEST(AssetIOTest, NoLoaderReturnsError) {
     EXPECT_FALSE(result.ok());
     EXPECT_FALSE(result.status.message.empty());
 }
+
+TEST(AssetIOTest, LoadVolumeAsyncWithCompletion) {
+    AssetIO io(2);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+
+    int callbacks = 0;
+    LoadHandle<vne::image::Volume> handle =
+        io.loadVolumeAsync(request, [&callbacks](const LoadResult<vne::image::Volume>& result) {
+            EXPECT_TRUE(result.ok());
+            ++callbacks;
+        });
+    ASSERT_TRUE(handle.valid());
+
+    const LoadResult<vne::image::Volume>& result = handle.get();
+    ASSERT_TRUE(result.ok()) << result.status.message;
+    EXPECT_EQ(result.value.width(), 4);
+    EXPECT_TRUE(handle.isReady());
+
+    // Callbacks only run on the polling thread.
+    EXPECT_EQ(callbacks, 0);
+    io.waitIdle();
+    EXPECT_EQ(io.pollCompletions(), 1u);
+    EXPECT_EQ(callbacks, 1);
+    EXPECT_EQ(io.pollCompletions(), 0u);
+}
+
+TEST(AssetIOTest, ManyConcurrentAsyncLoads) {
+    AssetIO io(4);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+
+    std::string path = getTestdataPath("textures/sample.png");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test image not found: " << path;
+    }
+
+    LoadRequest request;
+    request.asset_type = AssetType::eImage;
+    request.uri = path;
+
+    std::vector<LoadHandle<vne::image::Image>> handles;
+    for (int i = 0; i < 16; ++i) {
+        handles.push_back(io.loadImageAsync(request));
+    }
+    for (const auto& handle : handles) {
+        ASSERT_TRUE(handle.get().ok()) << handle.get().status.message;
+        EXPECT_FALSE(handle.get().value.isEmpty());
+    }
+}
+
+TEST(AssetIOTest, AsyncFailureReportsStatus) {
+    AssetIO io(1);
+    LoadRequest request;
+    request.asset_type = AssetType::eMesh;
+    request.uri = "/nonexistent.obj";
+
+    LoadHandle<vne::mesh::Mesh> handle = io.loadMeshAsync(request);
+    EXPECT_FALSE(handle.get().ok());
+    EXPECT_EQ(handle.get().status.code, ErrorCode::eUnsupportedFormat);
+}
+
+TEST(AssetIOTest, LoadBatchHeterogeneous) {
+    AssetIO io(3);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.registerMeshLoader(std::make_unique<vne::mesh::AssimpLoader>());
+
+    const std::string image_path = getTestdataPath("textures/sample.png");
+    const std::string volume_path = getTestdataPath("volumes/small3d.nrrd");
+    const std::string mesh_path = getTestdataPath("meshes/minimal.stl");
+    if (!std::filesystem::exists(image_path) || !std::filesystem::exists(volume_path)
+        || !std::filesystem::exists(mesh_path)) {
+        GTEST_SKIP() << "Test data not found";
+    }
+
+    std::vector<LoadRequest> requests(7);
+    for (size_t i = 0; i < 2; ++i) {
+        requests[i].asset_type = AssetType::eImage;
+        requests[i].uri = image_path;
+        requests[i + 2].asset_type = AssetType::eVolume;
+        requests[i + 2].uri = volume_path;
+        requests[i + 4].asset_type = AssetType::eMesh;
+        requests[i + 4].uri = mesh_path;
+    }
+    requests[6].asset_type = AssetType::eVolume;
+    requests[6].uri = "/nonexistent.nrrd";
+
+    BatchLoadResult batch = io.loadBatch(requests);
+    ASSERT_EQ(batch.results.size(), requests.size());
+    ASSERT_EQ(batch.item_seconds.size(), requests.size());
+
+    // Results keep input order regardless of execution order.
+    for (size_t i = 0; i < 2; ++i) {
+        ASSERT_TRUE(batch.results[i].ok()) << batch.results[i].status.message;
+        EXPECT_TRUE(std::holds_alternative<vne::image::Image>(batch.results[i].value));
+        ASSERT_TRUE(batch.results[i + 2].ok()) << batch.results[i + 2].status.message;
+        EXPECT_EQ(std::get<vne::image::Volume>(batch.results[i + 2].value).width(), 4);
+        ASSERT_TRUE(batch.results[i + 4].ok()) << batch.results[i + 4].status.message;
+        EXPECT_TRUE(std::holds_alternative<vne::mesh::Mesh>(batch.results[i + 4].value));
+    }
+    EXPECT_FALSE(batch.results[6].ok());
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(batch.results[6].value));
+
+    EXPECT_EQ(batch.stats.succeeded, 6u);
+    EXPECT_EQ(batch.stats.failed, 1u);
+    EXPECT_GT(batch.stats.wall_seconds, 0.0);
+    EXPECT_GE(batch.stats.parallelism(), 0.0);
+}
+
+TEST(AssetIOTest, LoadBatchEmpty) {
+    AssetIO io(1);
+    BatchLoadResult batch = io.loadBatch({});
+    EXPECT_TRUE(batch.results.empty());
+    EXPECT_EQ(batch.stats.succeeded + batch.stats.failed, 0u);
+}
+
+TEST(AssetIOTest, SharedLoadHitsCache) {
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.setCacheBudget(1u << 20);
+
+    std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+
+    auto first = io.loadVolumeShared(request);
+    ASSERT_TRUE(first.ok()) << first.status.message;
+    auto second = io.loadVolumeShared(request);
+    ASSERT_TRUE(second.ok()) << second.status.message;
+    EXPECT_EQ(first.value.get(), second.value.get());
+
+    // Different load flags are a different cache entry.
+    request.prefer_16bit = true;
+    auto third = io.loadVolumeShared(request);
+    ASSERT_TRUE(third.ok());
+    EXPECT_NE(first.value.get(), third.value.get());
+
+    AssetCacheStats stats = io.cacheStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.entry_count, 2u);
+    EXPECT_EQ(stats.bytes_in_use, first.value->byteCount() + third.value->byteCount());
+}
+
+#if defined(VNEIO_WITH_TRACING) && VNEIO_WITH_TRACING
+TEST(AssetIOTest, LoadRecordsTraceSpans) {
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+
+    trace::clear();
+    ASSERT_TRUE(io.loadVolume(request).ok());
+    const std::string json = trace::toChromeTraceJson();
+    EXPECT_NE(json.find("\"name\":\"AssetIO::load\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"NrrdLoader::loadVolume\""), std::string::npos);
+    trace::clear();
+}
+#endif
+
+TEST(AssetIOTest, SharedLoadWithoutCacheBudget) {
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+
+    auto first = io.loadVolumeShared(request);
+    auto second = io.loadVolumeShared(request);
+    ASSERT_TRUE(first.ok() && second.ok());
+    EXPECT_NE(first.value.get(), second.value.get());
+    EXPECT_EQ(io.cacheStats().entry_count, 0u);
+    EXPECT_EQ(io.cacheStats().misses, 0u);
+}
+
+TEST(AssetCacheTest, EvictsLeastRecentlyUsed) {
+    auto makeVolume = [](int depth) {
+        auto volume = std::make_shared<vne::image::Volume>();
+        volume->dims[0] = 10;
+        volume->dims[1] = 10;
+        volume->dims[2] = depth;
+        volume->data.resize(volume->byteCount());
+        return std::shared_ptr<const vne::image::Volume>(std::move(volume));
+    };
+
+    AssetCache cache(250);
+    cache.insert<vne::image::Volume>("a", makeVolume(1));
+    cache.insert<vne::image::Volume>("b", makeVolume(1));
+    EXPECT_NE(cache.find<vne::image::Volume>("a"), nullptr);  // "b" is now least recently used
+
+    cache.insert<vne::image::Volume>("c", makeVolume(1));
+    EXPECT_EQ(cache.find<vne::image::Volume>("b"), nullptr);
+    EXPECT_NE(cache.find<vne::image::Volume>("a"), nullptr);
+    EXPECT_NE(cache.find<vne::image::Volume>("c"), nullptr);
+    EXPECT_EQ(cache.find<vne::mesh::Mesh>("c"), nullptr);
+
+    // Larger than the whole budget: returned but not cached.
+    auto big = cache.insert<vne::image::Volume>("big", makeVolume(3));
+    ASSERT_NE(big, nullptr);
+    EXPECT_EQ(cache.find<vne::image::Volume>("big"), nullptr);
+
+    AssetCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entry_count, 2u);
+    EXPECT_EQ(stats.bytes_in_use, 200u);
+
+    cache.setByteBudget(100);
+    EXPECT_EQ(cache.stats().entry_count, 1u);
+    EXPECT_EQ(cache.stats().evictions, 2u);
+}
+
+TEST(AssetCacheTest, KeySeparatesReadPaths) {
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(request.uri)) {
+        GTEST_SKIP() << "Test data not found";
+    }
+    // Buffered, mapped and direct-I/O loads must not be cached or coalesced into one another.
+    const std::optional<std::string> buffered = AssetCache::makeKey(request);
+    request.memory_map = true;
+    const std::optional<std::string> mapped = AssetCache::makeKey(request);
+    request.memory_map = false;
+    request.direct_io = true;
+    const std::optional<std::string> direct = AssetCache::makeKey(request);
+    ASSERT_TRUE(buffered && mapped && direct);
+    EXPECT_NE(*buffered, *mapped);
+    EXPECT_NE(*buffered, *direct);
+    EXPECT_NE(*mapped, *direct);
+}
+
+TEST(AssetIOTest, HintFormatOverridesExtension) {
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::MhdLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    std::string source = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(source)) {
+        GTEST_SKIP() << "Test volume not found: " << source;
+    }
+    const std::string path = "asset_io_hint_volume.dat";
+    std::filesystem::copy_file(source, path, std::filesystem::copy_options::overwrite_existing);
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+    request.hint_format = "nrrd";
+
+    LoadResult<vne::image::Volume> result = io.loadVolume(request);
+    ASSERT_TRUE(result.ok()) << result.status.message;
+    EXPECT_EQ(result.value.width(), 4);
+
+    // A wrong hint is trusted: no sniffing fallback.
+    request.hint_format = "mhd";
+    EXPECT_FALSE(io.loadVolume(request).ok());
+
+    std::filesystem::remove(path);
+}
+
+TEST(AssetIOTest, SniffsMissingOrWrongExtension) {
+    AssetIO io(1);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::MhdLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    std::string volume_source = getTestdataPath("volumes/small3d.nrrd");
+    std::string image_source = getTestdataPath("textures/sample.png");
+    if (!std::filesystem::exists(volume_source) || !std::filesystem::exists(image_source)) {
+        GTEST_SKIP() << "Test data not found";
+    }
+    const std::string no_extension = "asset_io_sniff_volume";
+    const std::string wrong_extension = "asset_io_sniff_volume.mhd";
+    const std::string image_no_extension = "asset_io_sniff_image";
+    std::filesystem::copy_file(volume_source, no_extension, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::copy_file(volume_source, wrong_extension, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::copy_file(image_source, image_no_extension, std::filesystem::copy_options::overwrite_existing);
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = no_extension;
+    LoadResult<vne::image::Volume> volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_EQ(volume.value.width(), 4);
+
+    request.uri = wrong_extension;
+    volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_EQ(volume.value.depth(), 4);
+
+    request.asset_type = AssetType::eImage;
+    request.uri = image_no_extension;
+    LoadResult<vne::image::Image> image = io.loadImage(request);
+    ASSERT_TRUE(image.ok()) << image.status.message;
+    EXPECT_FALSE(image.value.isEmpty());
+
+    std::filesystem::remove(no_extension);
+    std::filesystem::remove(wrong_extension);
+    std::filesystem::remove(image_no_extension);
+}
+
+TEST(AssetIOTest, LoadsThroughPackFileSystem) {
+    const std::string image_source = getTestdataPath("textures/sample.png");
+    const std::string mesh_source = getTestdataPath("meshes/minimal.stl");
+    const std::string volume_source = getTestdataPath("volumes/small3d.nrrd");
+    const std::string ascii_source = getTestdataPath("volumes/an-hist.nrrd");
+    for (const std::string& source : {image_source, mesh_source, volume_source, ascii_source}) {
+        if (!std::filesystem::exists(source)) {
+            GTEST_SKIP() << "Test data not found: " << source;
+        }
+    }
+
+    // Detached big-endian MHD: header and data resolved next to each other inside the pack.
+    const std::string mhd_header =
+        "ObjectType = Image\nNDims = 3\nDimSize = 2 1 1\nElementType = MET_USHORT\n"
+        "ElementByteOrderMSB = True\nElementDataFile = ct.raw\n\n";
+    const std::string pack_path = "asset_io_test.pack";
+    PackWriter writer;
+    writer.addFile("textures/sample.png", image_source);
+    writer.addFile("textures/sniffed", image_source);
+    writer.addFile("meshes/minimal.stl", mesh_source);
+    writer.addFile("volumes/small3d.nrrd", volume_source);
+    writer.addFile("volumes/an-hist.nrrd", ascii_source);
+    writer.addBytes("volumes/ct.mhd", std::vector<uint8_t>(mhd_header.begin(), mhd_header.end()));
+    writer.addBytes("volumes/ct.raw", {0x01, 0x02, 0x00, 0x07});
+    ASSERT_TRUE(writer.write(pack_path).ok());
+
+    auto pack = std::make_shared<PackFileSystem>();
+    ASSERT_TRUE(pack->open(pack_path).ok());
+
+    AssetIO io(2);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    io.registerMeshLoader(std::make_unique<vne::mesh::AssimpLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::MhdLoader>());
+    io.setFileSystem(pack);
+
+    LoadRequest request;
+    request.asset_type = AssetType::eImage;
+    request.uri = "textures/sample.png";
+    LoadResult<vne::image::Image> image = io.loadImage(request);
+    ASSERT_TRUE(image.ok()) << image.status.message;
+    vne::image::Image native(image_source);
+    ASSERT_EQ(image.value.getWidth(), native.getWidth());
+    EXPECT_EQ(std::memcmp(image.value.getData(), native.getData(), assetByteSize(native)), 0);
+
+    request.uri = "textures/sniffed";
+    EXPECT_TRUE(io.loadImage(request).ok());
+
+    request.uri = image_source;  // OS paths are not visible through the pack
+    EXPECT_FALSE(io.loadImage(request).ok());
+
+    request.asset_type = AssetType::eMesh;
+    request.uri = "meshes/minimal.stl";
+    LoadResult<vne::mesh::Mesh> mesh = io.loadMesh(request);
+    ASSERT_TRUE(mesh.ok()) << mesh.status.message;
+    EXPECT_FALSE(mesh.value.vertices.empty());
+
+    request.asset_type = AssetType::eVolume;
+    request.uri = "volumes/small3d.nrrd";
+    request.memory_map = true;
+    LoadResult<vne::image::Volume> volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_TRUE(volume.value.hasExternalData());  // references the pack mapping
+    EXPECT_EQ(volume.value.getData()[5], 5);
+    request.memory_map = false;
+
+    request.uri = "volumes/an-hist.nrrd";
+    volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_EQ(volume.value.width(), 256);
+
+    request.uri = "volumes/ct.mhd";
+    volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    const auto* voxels = reinterpret_cast<const uint16_t*>(volume.value.getData());
+    EXPECT_EQ(voxels[0], 0x0102);
+    EXPECT_EQ(voxels[1], 0x0007);
+
+    std::vector<LoadRequest> batch(2);
+    batch[0].asset_type = AssetType::eImage;
+    batch[0].uri = "textures/sample.png";
+    batch[1].asset_type = AssetType::eVolume;
+    batch[1].uri = "volumes/small3d.nrrd";
+    BatchLoadResult loaded = io.loadBatch(batch);
+    EXPECT_EQ(loaded.stats.succeeded, 2u);
+
+    io.setFileSystem(nullptr);
+    pack.reset();
+    std::filesystem::remove(pack_path);
+}
+
+TEST(AssetIOTest, MemoryFileSystemCacheTracksReplacement) {
+    const std::string volume_source = getTestdataPath("volumes/small3d.nrrd");
+    std::vector<uint8_t> bytes;
+    if (!binaryio::readFile(volume_source, bytes).ok()) {
+        GTEST_SKIP() << "Test volume not found: " << volume_source;
+    }
+    auto fs = std::make_shared<MemoryFileSystem>();
+    fs->addFile("small3d.nrrd", bytes);
+
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.setFileSystem(fs);
+    io.setCacheBudget(1 << 20);
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = "small3d.nrrd";
+    auto first = io.loadVolumeShared(request);
+    auto second = io.loadVolumeShared(request);
+    ASSERT_TRUE(first.ok()) << first.status.message;
+    ASSERT_TRUE(second.ok());
+    EXPECT_EQ(first.value, second.value);
+
+    // Same size and path, new contents: the modification stamp changes the cache key.
+    bytes.back() ^= 0xFF;
+    fs->addFile("small3d.nrrd", bytes);
+    auto third = io.loadVolumeShared(request);
+    ASSERT_TRUE(third.ok());
+    EXPECT_NE(third.value, first.value);
+    EXPECT_EQ(io.cacheStats().hits, 1u);
+    EXPECT_EQ(io.cacheStats().misses, 2u);
+}
+
+TEST(AssetIOTest, LoadsFromMemoryBuffers) {
+    const std::string image_source = getTestdataPath("textures/sample.png");
+    const std::string mesh_source = getTestdataPath("meshes/minimal.stl");
+    const std::string volume_source = getTestdataPath("volumes/small3d.nrrd");
+    std::vector<uint8_t> image_bytes;
+    std::vector<uint8_t> mesh_bytes;
+    std::vector<uint8_t> volume_bytes;
+    if (!binaryio::readFile(image_source, image_bytes).ok() || !binaryio::readFile(mesh_source, mesh_bytes).ok()
+        || !binaryio::readFile(volume_source, volume_bytes).ok()) {
+        GTEST_SKIP() << "Test data not found";
+    }
+
+    AssetIO io(1);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    io.registerMeshLoader(std::make_unique<vne::mesh::AssimpLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::MhdLoader>());
+    io.setCacheBudget(1 << 20);
+
+    // No uri at all: the format is sniffed from the buffer.
+    LoadRequest request;
+    request.asset_type = AssetType::eImage;
+    request.buffer = std::as_bytes(std::span(image_bytes));
+    LoadResult<vne::image::Image> image = io.loadImage(request);
+    ASSERT_TRUE(image.ok()) << image.status.message;
+    vne::image::Image native(image_source);
+    ASSERT_EQ(image.value.getWidth(), native.getWidth());
+    EXPECT_EQ(std::memcmp(image.value.getData(), native.getData(), assetByteSize(native)), 0);
+
+    request.asset_type = AssetType::eMesh;
+    request.hint_format = "stl";
+    request.buffer = std::as_bytes(std::span(mesh_bytes));
+    LoadResult<vne::mesh::Mesh> mesh = io.loadMesh(request);
+    ASSERT_TRUE(mesh.ok()) << mesh.status.message;
+    EXPECT_FALSE(mesh.value.vertices.empty());
+    request.hint_format.clear();
+
+    request.asset_type = AssetType::eVolume;
+    request.uri = "in-memory.nrrd";
+    request.buffer = std::as_bytes(std::span(volume_bytes));
+    request.memory_map = true;  // ignored: buffer loads always copy
+    LoadResult<vne::image::Volume> volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_FALSE(volume.value.hasExternalData());
+    EXPECT_EQ(volume.value.getData()[5], 5);
+    request.memory_map = false;
+
+    // Buffer loads bypass the cache.
+    EXPECT_TRUE(io.loadVolumeShared(request).ok());
+    EXPECT_TRUE(io.loadVolumeShared(request).ok());
+    EXPECT_EQ(io.cacheStats().hits, 0u);
+
+    // MHD with local data, and with detached data resolved next to the uri.
+    const std::string local_mhd =
+        "ObjectType = Image\nNDims = 3\nDimSize = 2 1 1\nElementType = MET_UCHAR\nElementDataFile = LOCAL\n\n";
+    std::vector<uint8_t> local_bytes(local_mhd.begin(), local_mhd.end());
+    local_bytes.push_back(3);
+    local_bytes.push_back(4);
+    request.uri = "local.mhd";
+    request.buffer = std::as_bytes(std::span(local_bytes));
+    volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_EQ(volume.value.getData()[1], 4);
+
+    const std::string detached_mhd =
+        "ObjectType = Image\nNDims = 3\nDimSize = 2 1 1\nElementType = MET_UCHAR\nElementDataFile = ct.raw\n\n";
+    auto fs = std::make_shared<MemoryFileSystem>();
+    fs->addFile("volumes/ct.raw", std::vector<uint8_t>{8, 9});
+    io.setFileSystem(fs);
+    request.uri = "volumes/ct.mhd";  // names the header only; it is never opened
+    request.buffer = std::as_bytes(std::span(detached_mhd));
+    volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_EQ(volume.value.getData()[0], 8);
+    io.setFileSystem(nullptr);
+}
+
+TEST(AssetIOTest, AsyncLoadsRunByPriority) {
+    const std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    // The first load blocks the single worker inside its progress callback until released.
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    std::promise<void> started;
+    std::once_flag started_once;
+    LoadRequest blocker;
+    blocker.asset_type = AssetType::eVolume;
+    blocker.uri = path;
+    blocker.on_progress = [&](const LoadProgress&) {
+        std::call_once(started_once, [&started] { started.set_value(); });
+        gate.wait();
+    };
+    LoadHandle<vne::image::Volume> first = io.loadVolumeAsync(blocker);
+    started.get_future().wait();
+
+    std::vector<std::string> order;
+    auto track = [&order](const char* name) {
+        return [&order, name](const LoadResult<vne::image::Volume>& result) {
+            EXPECT_TRUE(result.ok()) << result.status.message;
+            order.emplace_back(name);
+        };
+    };
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+    request.priority = LoadPriority::eBackground;
+    LoadHandle<vne::image::Volume> prefetch = io.loadVolumeAsync(request, track("prefetch"));
+    LoadHandle<vne::image::Volume> bumped = io.loadVolumeAsync(request, track("bumped"));
+    request.priority = LoadPriority::eNormal;
+    io.loadVolumeAsync(request, track("normal"));
+    request.priority = LoadPriority::eHigh;
+    io.loadVolumeAsync(request, track("high"));
+    EXPECT_TRUE(io.setLoadPriority(bumped, LoadPriority::eUrgent));
+    EXPECT_FALSE(io.setLoadPriority(first, LoadPriority::eUrgent));  // already running
+
+    release.set_value();
+    io.waitIdle();
+    io.pollCompletions();
+    EXPECT_EQ(order, (std::vector<std::string>{"bumped", "high", "normal", "prefetch"}));
+    EXPECT_TRUE(first.get().ok());
+    EXPECT_FALSE(io.setLoadPriority(prefetch, LoadPriority::eUrgent));  // finished
+}
+
+TEST(AssetIOTest, CancelsAndReportsProgress) {
+    const std::string volume_path = getTestdataPath("volumes/small3d.nrrd");
+    const std::string mesh_path = getTestdataPath("meshes/minimal.stl");
+    if (!std::filesystem::exists(volume_path) || !std::filesystem::exists(mesh_path)) {
+        GTEST_SKIP() << "Test data not found";
+    }
+    AssetIO io(1);
+    io.registerMeshLoader(std::make_unique<vne::mesh::AssimpLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::MhdLoader>());
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = volume_path;
+    std::vector<std::string> stages;
+    uint64_t last_completed = 0;
+    uint64_t last_total = 0;
+    request.on_progress = [&](const LoadProgress& progress) {
+        stages.emplace_back(progress.stage);
+        last_completed = progress.completed;
+        last_total = progress.total;
+    };
+    LoadResult<vne::image::Volume> volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    ASSERT_FALSE(stages.empty());
+    EXPECT_EQ(stages.front(), "read");
+    EXPECT_EQ(last_completed, last_total);
+    EXPECT_EQ(last_total, volume.value.byteCount());
+
+    // Cancelled from inside the read loop: the load stops with eCancelled and no other loader is tried.
+    request.cancel_token = CancellationToken::make();
+    request.on_progress = [&request](const LoadProgress&) { request.cancel_token.cancel(); };
+    volume = io.loadVolume(request);
+    EXPECT_EQ(volume.status.code, ErrorCode::eCancelled);
+    EXPECT_TRUE(volume.value.data.empty());
+
+    // Big-endian detached MHD: cancelled during the byte-swap pass.
+    const std::string mhd_path = "asset_io_cancel.mhd";
+    const std::string raw_path = "asset_io_cancel.raw";
+    const std::string header =
+        "ObjectType = Image\nNDims = 3\nDimSize = 2 1 1\nElementType = MET_USHORT\n"
+        "ElementByteOrderMSB = True\nElementDataFile = asset_io_cancel.raw\n\n";
+    const uint8_t voxels[4] = {0x01, 0x02, 0x00, 0x07};
+    ASSERT_TRUE(binaryio::writeFile(mhd_path, header.data(), header.size()).ok());
+    ASSERT_TRUE(binaryio::writeFile(raw_path, voxels, sizeof(voxels)).ok());
+    request.uri = mhd_path;
+    request.cancel_token = CancellationToken::make();
+    request.on_progress = [&request](const LoadProgress& progress) {
+        if (progress.stage == "swap") {
+            request.cancel_token.cancel();
+        }
+    };
+    EXPECT_EQ(io.loadVolume(request).status.code, ErrorCode::eCancelled);
+
+    // Already cancelled: async loads fail without touching the file.
+    request.on_progress = nullptr;
+    LoadHandle<vne::image::Volume> handle = io.loadVolumeAsync(request);
+    EXPECT_EQ(handle.get().status.code, ErrorCode::eCancelled);
+
+    request.asset_type = AssetType::eMesh;
+    request.uri = mesh_path;
+    request.cancel_token = CancellationToken::make();
+    stages.clear();
+    request.on_progress = [&](const LoadProgress& progress) { stages.emplace_back(progress.stage); };
+    LoadResult<vne::mesh::Mesh> mesh = io.loadMesh(request);
+    ASSERT_TRUE(mesh.ok()) << mesh.status.message;
+    EXPECT_EQ(stages.back(), "convert");
+    request.cancel_token.cancel();
+    EXPECT_EQ(io.loadMesh(request).status.code, ErrorCode::eCancelled);
+
+    std::filesystem::remove(mhd_path);
+    std::filesystem::remove(raw_path);
+}
+
+namespace {
+
+/** Counts bytes handed out, forwarding to the default resource. */
+class CountingResource final : public std::pmr::memory_resource {
+   public:
+    std::atomic<size_t> allocated{0};
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocated += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+}  // namespace
+
+TEST(AssetIOTest, AllocatesFromRequestMemoryResource) {
+    const std::string image_path = getTestdataPath("textures/sample.png");
+    const std::string mesh_path = getTestdataPath("meshes/minimal.stl");
+    const std::string volume_path = getTestdataPath("volumes/small3d.nrrd");
+    for (const std::string& path : {image_path, mesh_path, volume_path}) {
+        if (!std::filesystem::exists(path)) {
+            GTEST_SKIP() << "Test data not found: " << path;
+        }
+    }
+    AssetIO io(2);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    io.registerMeshLoader(std::make_unique<vne::mesh::AssimpLoader>());
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+
+    CountingResource resource;
+    LoadRequest request;
+    request.memory_resource = &resource;
+    request.asset_type = AssetType::eVolume;
+    request.uri = volume_path;
+    LoadResult<vne::image::Volume> volume = io.loadVolume(request);
+    ASSERT_TRUE(volume.ok()) << volume.status.message;
+    EXPECT_EQ(volume.value.data.get_allocator().resource(), &resource);
+    EXPECT_GE(resource.allocated.load(), volume.value.byteCount());
+
+    request.asset_type = AssetType::eMesh;
+    request.uri = mesh_path;
+    LoadHandle<vne::mesh::Mesh> mesh = io.loadMeshAsync(request);  // survives the hop to the caller
+    ASSERT_TRUE(mesh.get().ok()) << mesh.get().status.message;
+    EXPECT_EQ(mesh.get().value.vertices.get_allocator().resource(), &resource);
+    EXPECT_EQ(mesh.get().value.indices.get_allocator().resource(), &resource);
+
+    request.asset_type = AssetType::eImage;
+    request.uri = image_path;
+    const size_t before = resource.allocated.load();
+    LoadResult<vne::image::Image> image = io.loadImage(request);
+    ASSERT_TRUE(image.ok()) << image.status.message;
+    EXPECT_EQ(image.value.getMemoryResource(), &resource);
+    EXPECT_GT(resource.allocated.load(), before);
+
+    // Copies fall back to the default resource.
+    const vne::image::Volume copy = volume.value;
+    EXPECT_EQ(copy.data.get_allocator().resource(), std::pmr::get_default_resource());
+}
+
+TEST(AssetIOTest, SharedLoadsFromAnArenaAreNotCached) {
+    const std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+    AssetIO io(1);
+    io.registerVolumeLoader(std::make_unique<vne::image::NrrdLoader>());
+    io.setCacheBudget(size_t{64} << 20);
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+    std::vector<uint8_t> voxels;
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        request.memory_resource = &arena;
+        LoadResult<std::shared_ptr<const vne::image::Volume>> framed = io.loadVolumeShared(request);
+        ASSERT_TRUE(framed.ok()) << framed.status.message;
+        EXPECT_EQ(framed.value->data.get_allocator().resource(), &arena);
+        voxels.assign(framed.value->data.begin(), framed.value->data.end());
+    }
+    EXPECT_EQ(io.cacheStats().entry_count, 0u);
+
+    // The arena is gone: a later shared load decodes again into storage of its own.
+    request.memory_resource = nullptr;
+    LoadResult<std::shared_ptr<const vne::image::Volume>> shared = io.loadVolumeShared(request);
+    ASSERT_TRUE(shared.ok()) << shared.status.message;
+    EXPECT_EQ(shared.value->data.get_allocator().resource(), std::pmr::get_default_resource());
+    EXPECT_TRUE(std::equal(voxels.begin(), voxels.end(), shared.value->data.begin(), shared.value->data.end()));
+    EXPECT_EQ(io.cacheStats().hits, 0u);
+    EXPECT_EQ(io.cacheStats().entry_count, 1u);
+}
+
+namespace {
+
+/** NrrdLoader that counts loads and holds each one until released. */
+class GatedVolumeLoader final : public vne::image::IVolumeLoader {
+   public:
+    explicit GatedVolumeLoader(std::shared_future<void> gate)
+        : gate_(std::move(gate)) {}
+
+    [[nodiscard]] bool canLoad(const LoadRequest& request) const override { return inner_.canLoad(request); }
+    [[nodiscard]] const std::vector<std::string>& supportedExtensions() const override {
+        return inner_.supportedExtensions();
+    }
+    [[nodiscard]] LoadResult<vne::image::Volume> loadVolume(const LoadRequest& request) override {
+        loads_->fetch_add(1);
+        gate_.wait();
+        return inner_.loadVolume(request);
+    }
+
+    [[nodiscard]] std::shared_ptr<std::atomic<int>> loads() const { return loads_; }
+
+   private:
+    vne::image::NrrdLoader inner_;
+    std::shared_future<void> gate_;
+    std::shared_ptr<std::atomic<int>> loads_ = std::make_shared<std::atomic<int>>(0);
+};
+
+}  // namespace
+
+TEST(AssetIOTest, CoalescesConcurrentIdenticalLoads) {
+    const std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path;
+    }
+    std::promise<void> release;
+    auto loader = std::make_unique<GatedVolumeLoader>(release.get_future().share());
+    const std::shared_ptr<std::atomic<int>> loads = loader->loads();
+    AssetIO io(4);
+    io.registerVolumeLoader(std::move(loader));
+
+    LoadRequest request;
+    request.asset_type = AssetType::eVolume;
+    request.uri = path;
+    std::vector<LoadHandle<vne::image::Volume>> handles;
+    for (int i = 0; i < 4; ++i) {
+        handles.push_back(io.loadVolumeAsync(request));
+    }
+    std::vector<std::future<LoadResult<std::shared_ptr<const vne::image::Volume>>>> shared;
+    for (int i = 0; i < 2; ++i) {
+        shared.push_back(std::async(std::launch::async, [&io, &request] { return io.loadVolumeShared(request); }));
+    }
+    // 4 value loads collapse into one; the 2 shared loads into another.
+    while (io.coalescingStats().coalesced < 4) {
+        std::this_thread::yield();
+    }
+    release.set_value();
+    for (auto& handle : handles) {
+        const LoadResult<vne::image::Volume>& result = handle.get();
+        ASSERT_TRUE(result.ok()) << result.status.message;
+        EXPECT_EQ(result.value.byteCount(), handles.front().get().value.byteCount());
+    }
+    auto first = shared[0].get();
+    auto second = shared[1].get();
+    ASSERT_TRUE(first.ok() && second.ok());
+    EXPECT_EQ(first.value, second.value);  // one instance
+    EXPECT_EQ(loads->load(), 2);
+    EXPECT_EQ(io.coalescingStats().executed, 2u);
+
+    // Requests that carry a cancel token load on their own.
+    request.cancel_token = CancellationToken::make();
+    EXPECT_TRUE(io.loadVolume(request).ok());
+    EXPECT_EQ(loads->load(), 3);
+    EXPECT_EQ(io.coalescingStats().coalesced, 4u);
+}
+
+TEST(CookCacheTest, RoundTripsMeshAndVolume) {
+    const std::string directory = "test_cook_cache_roundtrip";
+    std::filesystem::remove_all(directory);
+    CookCache cook(directory);
+
+    vne::mesh::Mesh mesh;
+    mesh.name = "tri";
+    mesh.has_normals = true;
+    mesh.vertices.resize(3);
+    for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+        mesh.vertices[i].position[0] = static_cast<float>(i);
+    }
+    mesh.indices = {0, 1, 2};
+    mesh.parts.push_back({0, 3, 0});
+    mesh.materials.push_back({"red", "red.png", {1.0f, 0.0f, 0.0f, 1.0f}});
+    mesh.aabb_max[0] = 2.0f;
+    ASSERT_TRUE(cook.store("mesh-key", mesh).ok());
+
+    std::pmr::monotonic_buffer_resource arena;
+    vne::mesh::Mesh restored(&arena);
+    ASSERT_TRUE(cook.load("mesh-key", restored));
+    EXPECT_EQ(restored.vertices.get_allocator().resource(), &arena);
+    EXPECT_EQ(restored.name, "tri");
+    EXPECT_TRUE(restored.has_normals);
+    ASSERT_EQ(restored.vertices.size(), 3u);
+    EXPECT_EQ(restored.vertices[2].position[0], 2.0f);
+    EXPECT_EQ(restored.indices.size(), 3u);
+    ASSERT_EQ(restored.parts.size(), 1u);
+    EXPECT_EQ(restored.parts[0].index_count, 3u);
+    ASSERT_EQ(restored.materials.size(), 1u);
+    EXPECT_EQ(restored.materials[0].base_color_tex, "red.png");
+    EXPECT_EQ(restored.aabb_max[0], 2.0f);
+
+    // Blobs with indices or submeshes out of range (e.g. a hand-made pack entry) are rejected untouched.
+    const std::vector<uint8_t> valid_blob = CookCache::encode(mesh);
+    vne::mesh::Mesh decoded;
+    EXPECT_TRUE(CookCache::decode(valid_blob.data(), valid_blob.size(), decoded));
+    for (int corruption = 0; corruption < 3; ++corruption) {
+        vne::mesh::Mesh bad = mesh;
+        if (corruption == 0) {
+            bad.indices[2] = 3;
+        } else if (corruption == 1) {
+            bad.parts[0].index_count = 4;
+        } else {
+            bad.parts[0].material_index = 1;
+        }
+        const std::vector<uint8_t> blob = CookCache::encode(bad);
+        vne::mesh::Mesh untouched_mesh;
+        EXPECT_FALSE(CookCache::decode(blob.data(), blob.size(), untouched_mesh)) << corruption;
+        EXPECT_TRUE(untouched_mesh.vertices.empty());
+    }
+
+    vne::image::Volume volume;
+    volume.dims[0] = 4;
+    volume.dims[1] = 3;
+    volume.dims[2] = 2;
+    volume.pixel_type = vne::image::VolumePixelType::eInt16;
+    volume.spacing[2] = 2.5f;
+    volume.data.resize(volume.byteCount());
+    for (size_t i = 0; i < volume.data.size(); ++i) {
+        volume.data[i] = static_cast<uint8_t>(i);
+    }
+    ASSERT_TRUE(cook.store("volume-key", volume).ok());
+    vne::image::Volume restored_volume;
+    ASSERT_TRUE(cook.load("volume-key", restored_volume));
+    EXPECT_EQ(restored_volume.pixel_type, vne::image::VolumePixelType::eInt16);
+    EXPECT_EQ(restored_volume.spacing[2], 2.5f);
+    EXPECT_EQ(restored_volume.data, volume.data);
+
+    // Unknown keys, the wrong asset kind and truncated blobs are misses that leave the output alone.
+    vne::image::Volume untouched;
+    EXPECT_FALSE(cook.load("other-key", untouched));
+    EXPECT_FALSE(cook.load("mesh-key", untouched));
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        std::filesystem::resize_file(entry.path(), std::filesystem::file_size(entry.path()) - 1);
+    }
+    EXPECT_FALSE(cook.load("volume-key", untouched));
+    EXPECT_TRUE(untouched.isEmpty());
+
+    CookCacheStats stats = cook.stats();
+    EXPECT_EQ(stats.stores, 2u);
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 3u);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(CookCacheTest, ChecksRecordedDependencies) {
+    const std::string root = "test_cook_cache_dependencies";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root + "/a");
+    std::filesystem::create_directories(root + "/b");
+    auto write = [](const std::string& path, const std::string& text) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << text;
+    };
+    write(root + "/a/mesh.src", "source");
+    write(root + "/a/side.txt", "one");
+
+    CookCache cook(root + "/cooked");
+    vne::mesh::Mesh mesh;
+    mesh.vertices.resize(1);
+    std::vector<std::string> recorded = {root + "/a/side.txt", root + "/a/absent.txt", root + "/a/mesh.src"};
+    LoadRequest request;
+    request.uri = root + "/a/mesh.src";
+    request.dependencies = &recorded;
+    ASSERT_TRUE(cook.store("key", mesh, &request).ok());
+
+    std::vector<std::string> dependencies;
+    request.dependencies = &dependencies;
+    auto hit = [&cook, &request, &dependencies](const std::string& uri) {
+        vne::mesh::Mesh restored;
+        dependencies.clear();
+        request.uri = uri;
+        return cook.load("key", restored, &request);
+    };
+    EXPECT_TRUE(hit(root + "/a/mesh.src"));
+    EXPECT_EQ(dependencies, (std::vector<std::string>{root + "/a/absent.txt", root + "/a/side.txt"}));
+    vne::mesh::Mesh restored;
+    EXPECT_FALSE(cook.load("key", restored));  // dependencies cannot be checked without the request
+
+    // Editing, creating or deleting a dependency misses until it matches the recorded state again.
+    write(root + "/a/side.txt", "two");
+    EXPECT_FALSE(hit(root + "/a/mesh.src"));
+    write(root + "/a/side.txt", "one");
+    EXPECT_TRUE(hit(root + "/a/mesh.src"));
+    write(root + "/a/absent.txt", "");
+    EXPECT_FALSE(hit(root + "/a/mesh.src"));
+    std::filesystem::remove(root + "/a/absent.txt");
+    std::filesystem::remove(root + "/a/side.txt");
+    EXPECT_FALSE(hit(root + "/a/mesh.src"));
+
+    // Dependencies resolve next to the source being served.
+    write(root + "/b/side.txt", "one");
+    EXPECT_TRUE(hit(root + "/b/mesh.src"));
+    EXPECT_EQ(dependencies.back(), root + "/b/side.txt");
+    write(root + "/b/side.txt", "three");
+    EXPECT_FALSE(hit(root + "/b/mesh.src"));
+
+    std::filesystem::remove_all(root);
+}
+
+TEST(AssetIOTest, CookCacheRestoresAcrossInstances) {
+    std::string source = getTestdataPath("textures/sample.png");
+    if (!std::filesystem::exists(source)) {
+        GTEST_SKIP() << "Test image not found: " << source;
+    }
+    const std::string directory = "test_cook_cache_assetio";
+    const std::string path = "test_cook_cache_sample.png";
+    std::filesystem::remove_all(directory);
+    std::filesystem::copy_file(source, path, std::filesystem::copy_options::overwrite_existing);
+
+    LoadRequest request;
+    request.asset_type = AssetType::eImage;
+    request.uri = path;
+    auto loadWithNewInstance = [&request, &directory](CookCacheStats& stats) {
+        AssetIO io(1);
+        io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+        io.setCookCacheDirectory(directory);
+        LoadResult<vne::image::Image> result = io.loadImage(request);
+        stats = io.cookCacheStats();
+        return result;
+    };
+
+    CookCacheStats stats;
+    LoadResult<vne::image::Image> cold = loadWithNewInstance(stats);
+    ASSERT_TRUE(cold.ok()) << cold.status.message;
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.stores, 1u);
+
+    LoadResult<vne::image::Image> warm = loadWithNewInstance(stats);
+    ASSERT_TRUE(warm.ok()) << warm.status.message;
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.stores, 0u);
+    ASSERT_EQ(warm.value.getWidth(), cold.value.getWidth());
+    ASSERT_EQ(warm.value.getChannels(), cold.value.getChannels());
+    const size_t bytes = static_cast<size_t>(cold.value.getWidth()) * static_cast<size_t>(cold.value.getHeight())
+                         * static_cast<size_t>(cold.value.getChannels());
+    EXPECT_EQ(std::memcmp(warm.value.getData(), cold.value.getData(), bytes), 0);
+
+    // Editing the source (trailing bytes are ignored by the decoder) changes the content hash.
+    {
+        std::ofstream append(path, std::ios::binary | std::ios::app);
+        append << "edit";
+    }
+    LoadResult<vne::image::Image> edited = loadWithNewInstance(stats);
+    ASSERT_TRUE(edited.ok()) << edited.status.message;
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.stores, 1u);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(AssetIOTest, CookCacheChecksFilesTheImportReads) {
+    const std::string root = "test_cook_cache_deps";
+    const std::string directory = root + "/cooked";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root + "/a");
+    std::filesystem::create_directories(root + "/b");
+    auto write = [](const std::string& path, const std::string& text) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << text;
+    };
+    const std::string obj = "mtllib tri.mtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl paint\nf 1 2 3\n";
+    write(root + "/a/tri.obj", obj);
+    write(root + "/a/tri.mtl", "newmtl paint\nKd 1 0 0\n");
+    vne::mesh::Mesh probe;
+    if (!vne::mesh::AssimpLoader().loadFile(root + "/a/tri.obj", probe)) {
+        std::filesystem::remove_all(root);
+        GTEST_SKIP() << "Assimp built without the OBJ importer";
+    }
+
+    // Red channel of the "paint" material of a fresh AssetIO's load (-1 if the load or material is missing).
+    CookCacheStats stats;
+    std::vector<std::string> dependencies;
+    auto loadPaint = [&directory, &stats, &dependencies](const std::string& path) {
+        AssetIO io(1);
+        io.registerMeshLoader(std::make_unique<vne::mesh::AssimpLoader>());
+        io.setCookCacheDirectory(directory);
+        LoadRequest request;
+        request.asset_type = AssetType::eMesh;
+        request.uri = path;
+        dependencies.clear();
+        request.dependencies = &dependencies;
+        LoadResult<vne::mesh::Mesh> result = io.loadMesh(request);
+        stats = io.cookCacheStats();
+        EXPECT_TRUE(result.ok()) << result.status.message;
+        for (const vne::mesh::Material& material : result.value.materials) {
+            if (material.name == "paint") {
+                return material.base_color[0];
+            }
+        }
+        return -1.0f;
+    };
+    auto listed = [&dependencies](const std::string& path) {
+        return std::find(dependencies.begin(), dependencies.end(), path) != dependencies.end();
+    };
+
+    EXPECT_EQ(loadPaint(root + "/a/tri.obj"), 1.0f);
+    EXPECT_EQ(stats.stores, 1u);
+    EXPECT_TRUE(listed(root + "/a/tri.mtl"));
+    EXPECT_EQ(loadPaint(root + "/a/tri.obj"), 1.0f);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_TRUE(listed(root + "/a/tri.mtl"));
+
+    // Editing only the material library re-imports.
+    write(root + "/a/tri.mtl", "newmtl paint\nKd 0.5 0 0\n");
+    EXPECT_EQ(loadPaint(root + "/a/tri.obj"), 0.5f);
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.stores, 1u);
+
+    // An identical .obj elsewhere is checked against its own library, and a deleted library misses too.
+    write(root + "/b/tri.obj", obj);
+    write(root + "/b/tri.mtl", "newmtl paint\nKd 0.25 0 0\n");
+    EXPECT_EQ(loadPaint(root + "/b/tri.obj"), 0.25f);
+    EXPECT_EQ(stats.hits, 0u);
+    std::filesystem::remove(root + "/b/tri.mtl");
+    EXPECT_NE(loadPaint(root + "/b/tri.obj"), 0.25f);
+    EXPECT_EQ(stats.hits, 0u);
+
+    std::filesystem::remove_all(root);
+}
+
+TEST(AssetIOTest, CookCacheChecksObjMaterialLibraries) {
+    const std::string directory = "test_cook_cache_obj";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string obj_path = directory + "/tri.obj";
+    const std::string mtl_path = directory + "/tri.mtl";
+    std::ofstream(obj_path) << "mtllib tri.mtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl paint\nf 1 2 3\n";
+
+    AssetIO io(1);
+    io.registerMeshLoader(std::make_unique<vne::mesh::ObjLoader>());
+    io.setCookCacheDirectory(directory + "/cooked");
+    LoadRequest request;
+    request.asset_type = AssetType::eMesh;
+    request.uri = obj_path;
+    auto paintRed = [&io, &request]() {
+        LoadResult<vne::mesh::Mesh> result = io.loadMesh(request);
+        EXPECT_TRUE(result.ok()) << result.status.message;
+        return result.ok() && !result.value.materials.empty() ? result.value.materials.back().base_color[0] : -1.0f;
+    };
+
+    const float missing_library = paintRed();  // default material until the library exists
+    std::ofstream(mtl_path) << "newmtl paint\nKd 0.5 0 0\n";
+    EXPECT_EQ(paintRed(), 0.5f);
+    EXPECT_EQ(paintRed(), 0.5f);
+    EXPECT_EQ(io.cookCacheStats().hits, 1u);
+    std::ofstream(mtl_path) << "newmtl paint\nKd 0.25 0 0\n";
+    EXPECT_EQ(paintRed(), 0.25f);
+    EXPECT_NE(missing_library, 0.25f);
+    EXPECT_EQ(io.cookCacheStats().hits, 1u);
+    EXPECT_EQ(io.cookCacheStats().stores, 3u);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(AssetIOTest, CookCacheHitNamesMeshAfterRequest) {
+    const std::string directory = "test_cook_cache_names";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string stl =
+        "solid tri\nfacet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex 1 0 0\nvertex 0 1 0\n"
+        "endloop\nendfacet\nendsolid tri\n";
+    for (const std::string& path : {directory + "/first.stl", directory + "/second.stl"}) {
+        std::ofstream(path, std::ios::binary) << stl;
+    }
+
+    AssetIO io(1);
+    io.registerMeshLoader(std::make_unique<vne::mesh::StlLoader>());
+    io.setCookCacheDirectory(directory + "/cooked");
+    LoadRequest request;
+    request.asset_type = AssetType::eMesh;
+    for (const std::string& path : {directory + "/first.stl", directory + "/second.stl"}) {
+        request.uri = path;
+        LoadResult<vne::mesh::Mesh> result = io.loadMesh(request);
+        ASSERT_TRUE(result.ok()) << result.status.message;
+        EXPECT_EQ(result.value.name, path);
+    }
+    EXPECT_EQ(io.cookCacheStats().hits, 1u);  // identical bytes share one blob
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(AssetIOTest, WatcherReloadsOnlyChangedFiles) {
+    std::string source = getTestdataPath("textures/sample.png");
+    if (!AssetWatcher::supported() || !std::filesystem::exists(source)) {
+        GTEST_SKIP() << "Change notifications or test image unavailable";
+    }
+    const std::string directory = "test_asset_watcher";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string edited = directory + "/edited.png";
+    const std::string untouched = directory + "/untouched.png";
+    std::filesystem::copy_file(source, edited);
+    std::filesystem::copy_file(source, untouched);
+
+    AssetIO io(1);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    AssetWatcher watcher(io, std::chrono::milliseconds(20));
+
+    LoadRequest request;
+    request.asset_type = AssetType::eImage;
+    std::vector<uint64_t> generations;
+    request.uri = edited;
+    auto edited_id =
+        watcher.watchImage(request, [&generations](uint64_t generation, const LoadResult<vne::image::Image>& result) {
+            EXPECT_TRUE(result.ok()) << result.status.message;
+            generations.push_back(generation);
+        });
+    ASSERT_TRUE(edited_id.ok()) << edited_id.status.message;
+    request.uri = untouched;
+    bool untouched_reloaded = false;
+    auto untouched_id = watcher.watchImage(
+        request, [&untouched_reloaded](uint64_t, const LoadResult<vne::image::Image>&) { untouched_reloaded = true; });
+    ASSERT_TRUE(untouched_id.ok()) << untouched_id.status.message;
+
+    auto waitForGeneration = [&](uint64_t generation) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while ((generations.empty() || generations.back() < generation)
+               && std::chrono::steady_clock::now() < deadline) {
+            io.pollCompletions();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return !generations.empty() && generations.back() == generation;
+    };
+
+    // A burst of writes is debounced into a single reload.
+    for (int i = 0; i < 3; ++i) {
+        std::ofstream append(edited, std::ios::binary | std::ios::app);
+        append << "edit";
+    }
+    ASSERT_TRUE(waitForGeneration(1));
+
+    // Saving through a temporary file renamed over the original is seen as well.
+    std::filesystem::copy_file(source, directory + "/edited.tmp");
+    std::filesystem::rename(directory + "/edited.tmp", edited);
+    ASSERT_TRUE(waitForGeneration(2));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    io.waitIdle();
+    io.pollCompletions();
+    EXPECT_EQ(generations, (std::vector<uint64_t>{1, 2}));
+    EXPECT_FALSE(untouched_reloaded);
+    EXPECT_EQ(watcher.stats().reloads, 2u);
+
+    EXPECT_TRUE(watcher.unwatch(edited_id.value));
+    EXPECT_FALSE(watcher.unwatch(edited_id.value));
+
+    LoadRequest from_memory;
+    from_memory.uri = edited;
+    const std::byte byte{};
+    from_memory.buffer = std::span<const std::byte>(&byte, 1);
+    EXPECT_EQ(watcher.watchImage(from_memory, {}).status.code, ErrorCode::eInvalidArgument);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(AssetIOTest, ResolvesPackUrisAndCookedEntries) {
+    const std::string image_source = getTestdataPath("textures/sample.png");
+    if (!std::filesystem::exists(image_source)) {
+        GTEST_SKIP() << "Test image not found: " << image_source;
+    }
+    vne::mesh::Mesh mesh;
+    mesh.vertices.resize(3);
+    mesh.vertices[1].position[1] = 1.0f;
+    mesh.indices = {0, 1, 2};
+    vne::image::Volume volume;
+    volume.dims[0] = 2;
+    volume.dims[1] = 2;
+    volume.dims[2] = 1;
+    volume.data = {1, 2, 3, 4};
+
+    const std::string pack_path = "asset_io_cooked.pack";
+    PackWriter writer;
+    writer.addFile("textures/sample.png", image_source);
+    writer.addBytes("meshes/tri.vnecook", CookCache::encode(mesh));
+    writer.addBytes("volumes/cooked", CookCache::encode(volume));  // no extension: sniffed
+    ASSERT_TRUE(writer.write(pack_path).ok());
+    auto pack = std::make_shared<PackFileSystem>();
+    ASSERT_TRUE(pack->open(pack_path).ok());
+
+    AssetIO io(1);
+    io.registerImageLoader(std::make_unique<vne::image::StbImageLoader>());
+    io.registerMeshLoader(std::make_unique<CookedMeshLoader>());
+    io.registerVolumeLoader(std::make_unique<CookedVolumeLoader>());
+
+    LoadRequest request;
+    request.asset_type = AssetType::eImage;
+    request.uri = "pack://textures/sample.png";
+    EXPECT_EQ(io.loadImage(request).status.code, ErrorCode::eFileNotFound);  // nothing mounted
+
+    io.mountPack(pack);
+    LoadResult<vne::image::Image> image = io.loadImage(request);
+    ASSERT_TRUE(image.ok()) << image.status.message;
+    request.uri = image_source;  // OS paths keep working next to pack:// uris
+    EXPECT_TRUE(io.loadImage(request).ok());
+
+    request.asset_type = AssetType::eMesh;
+    request.uri = "pack://meshes/tri.vnecook";
+    LoadResult<vne::mesh::Mesh> restored = io.loadMesh(request);
+    ASSERT_TRUE(restored.ok()) << restored.status.message;
+    ASSERT_EQ(restored.value.vertices.size(), 3u);
+    EXPECT_EQ(restored.value.vertices[1].position[1], 1.0f);
+    EXPECT_EQ(restored.value.indices.size(), 3u);
+
+    request.asset_type = AssetType::eVolume;
+    request.uri = "pack://volumes/cooked";
+    LoadResult<vne::image::Volume> restored_volume = io.loadVolume(request);
+    ASSERT_TRUE(restored_volume.ok()) << restored_volume.status.message;
+    EXPECT_EQ(restored_volume.value.data, volume.data);
+
+    request.uri = "pack://meshes/tri.vnecook";  // a mesh blob is not a volume
+    EXPECT_FALSE(io.loadVolume(request).ok());
+
+    io.mountPack(nullptr);
+    pack.reset();
+    std::filesystem::remove(pack_path);
+}
+
+TEST(SharedAssetTest, ExportsAndMapsReadOnlyViews) {
+    if (!sharedAssetsSupported()) {
+        GTEST_SKIP() << "Shared memory is not available on this platform";
+    }
+    const std::string prefix = "/vneio-test-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed());
+    const std::string volume_name = prefix + "-volume";
+    const std::string mesh_name = prefix + "-mesh";
+    const std::string image_name = prefix + "-image";
+    for (const std::string& name : {volume_name, mesh_name, image_name}) {
+        (void)unlinkShared(name);
+    }
+
+    vne::image::Volume volume;
+    volume.dims[0] = 4;
+    volume.dims[1] = 3;
+    volume.dims[2] = 2;
+    volume.pixel_type = vne::image::VolumePixelType::eUint16;
+    volume.spacing[1] = 0.5f;
+    volume.direction[0] = -1.0f;
+    volume.data.resize(volume.byteCount());
+    for (size_t i = 0; i < volume.data.size(); ++i) {
+        volume.data[i] = static_cast<uint8_t>(i * 7);
+    }
+    ASSERT_TRUE(exportShared(volume_name, volume).ok());
+    EXPECT_EQ(exportShared(volume_name, volume).code, ErrorCode::eFileWriteFailed);  // names are exclusive
+
+    vne::mesh::Mesh mesh;
+    mesh.name = "tri";
+    mesh.has_uv0 = true;
+    mesh.vertices.resize(3);
+    mesh.vertices[2].texcoord0[1] = 1.0f;
+    mesh.indices = {0, 1, 2};
+    mesh.parts.push_back({0, 3, 1});
+    mesh.materials.push_back({"default", "", {1.0f, 1.0f, 1.0f, 1.0f}});
+    mesh.materials.push_back({"red", "red.png", {1.0f, 0.0f, 0.0f, 1.0f}});
+    mesh.aabb_min[2] = -1.0f;
+    ASSERT_TRUE(exportShared(mesh_name, mesh).ok());
+
+    const uint8_t pixels[] = {10, 20, 30, 40, 50, 60};
+    ASSERT_TRUE(exportShared(image_name, vne::image::Image(pixels, 2, 1, 3)).ok());
+
+    Result<AssetType> type = sharedAssetType(mesh_name);
+    ASSERT_TRUE(type.ok()) << type.status.message;
+    EXPECT_EQ(type.value, AssetType::eMesh);
+
+    // Volumes come back as external storage that points into the mapping.
+    Result<vne::image::Volume> shared_volume = importSharedVolume(volume_name);
+    ASSERT_TRUE(shared_volume.ok()) << shared_volume.status.message;
+    const vne::image::Volume& mapped = shared_volume.value;
+    EXPECT_TRUE(mapped.hasExternalData());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.getData()) % 64, 0u);
+    EXPECT_EQ(mapped.pixel_type, vne::image::VolumePixelType::eUint16);
+    EXPECT_EQ(mapped.spacing[1], 0.5f);
+    EXPECT_EQ(mapped.direction[0], -1.0f);
+    ASSERT_EQ(mapped.dataSize(), volume.data.size());
+    EXPECT_EQ(std::memcmp(mapped.getData(), volume.data.data(), volume.data.size()), 0);
+
+    Result<SharedMeshView> shared_mesh = importSharedMesh(mesh_name);
+    ASSERT_TRUE(shared_mesh.ok()) << shared_mesh.status.message;
+    const SharedMeshView& view = shared_mesh.value;
+    EXPECT_EQ(view.name, "tri");
+    EXPECT_TRUE(view.has_uv0);
+    EXPECT_FALSE(view.has_normals);
+    ASSERT_EQ(view.vertices.size(), 3u);
+    EXPECT_EQ(view.vertices[2].texcoord0[1], 1.0f);
+    ASSERT_EQ(view.indices.size(), 3u);
+    EXPECT_EQ(view.indices[2], 2u);
+    ASSERT_EQ(view.parts.size(), 1u);
+    EXPECT_EQ(view.parts[0].material_index, 1u);
+    ASSERT_EQ(view.materials.size(), 2u);
+    EXPECT_EQ(view.materials[1].name, "red");
+    EXPECT_EQ(view.materials[1].base_color_tex, "red.png");
+    EXPECT_EQ(view.materials[1].base_color[1], 0.0f);
+    EXPECT_EQ(view.aabb_min[2], -1.0f);
+    vne::mesh::Mesh copy = view.toMesh();
+    EXPECT_EQ(copy.indices, mesh.indices);
+    EXPECT_EQ(copy.materials[0].name, "default");
+
+    Result<SharedImageView> shared_image = importSharedImage(image_name);
+    ASSERT_TRUE(shared_image.ok()) << shared_image.status.message;
+    EXPECT_EQ(shared_image.value.width, 2);
+    EXPECT_EQ(shared_image.value.channels, 3);
+    ASSERT_EQ(shared_image.value.pixels.size(), sizeof(pixels));
+    EXPECT_EQ(shared_image.value.pixels[5], 60);
+    EXPECT_EQ(shared_image.value.toImage().getData()[4], 50);
+
+    // The segment's header names its asset type; other importers refuse it.
+    EXPECT_EQ(importSharedVolume(mesh_name).status.code, ErrorCode::eUnsupportedFormat);
+    EXPECT_EQ(importSharedImage("no-leading-slash").status.code, ErrorCode::eInvalidArgument);
+    EXPECT_EQ(exportShared(prefix + "-empty", vne::image::Volume()).code, ErrorCode::eInvalidArgument);
+
+    // Segments come from other processes: out-of-range indices or submeshes are not handed out.
+    const std::string bad_name = prefix + "-bad-mesh";
+    (void)unlinkShared(bad_name);
+    vne::mesh::Mesh bad_mesh = mesh;
+    bad_mesh.indices[1] = 3;
+    ASSERT_TRUE(exportShared(bad_name, bad_mesh).ok());
+    EXPECT_EQ(importSharedMesh(bad_name).status.code, ErrorCode::eDataCorrupt);
+    EXPECT_TRUE(unlinkShared(bad_name).ok());
+    bad_mesh = mesh;
+    bad_mesh.parts[0].material_index = 2;
+    ASSERT_TRUE(exportShared(bad_name, bad_mesh).ok());
+    EXPECT_EQ(importSharedMesh(bad_name).status.code, ErrorCode::eDataCorrupt);
+    EXPECT_TRUE(unlinkShared(bad_name).ok());
+
+    // Unlinking removes the name; views already mapped stay readable.
+    for (const std::string& name : {volume_name, mesh_name, image_name}) {
+        EXPECT_TRUE(unlinkShared(name).ok());
+    }
+    EXPECT_EQ(importSharedMesh(mesh_name).status.code, ErrorCode::eFileNotFound);
+    EXPECT_EQ(unlinkShared(mesh_name).code, ErrorCode::eFileNotFound);
+    EXPECT_EQ(view.vertices[2].texcoord0[1], 1.0f);
+    EXPECT_EQ(mapped.getData()[1], volume.data[1]);
+}
@@ -0,0 +1,245 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/common/codec.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vne::io;
+using namespace vne::io::binaryio;
+
+TEST(MappedFileTest, MapsFileContents) {
+    const std::string path = "test_mapped_file.bin";
+    const uint8_t bytes[6] = {1, 2, 3, 4, 5, 6};
+    ASSERT_TRUE(writeFile(path, bytes, sizeof(bytes)).ok());
+
+    MappedFile file;
+    ASSERT_TRUE(file.open(path, MapAccess::eRandom).ok());
+    EXPECT_TRUE(file.isOpen());
+    ASSERT_EQ(file.size(), 6u);
+    EXPECT_EQ(file.data()[0], 1);
+    EXPECT_EQ(file.data()[5], 6);
+    file.advise(MapAccess::eWillNeed, 2, 2);
+
+    MappedFile moved(std::move(file));
+    EXPECT_FALSE(file.isOpen());
+    ASSERT_TRUE(moved.isOpen());
+    EXPECT_EQ(moved.data()[3], 4);
+    moved.close();
+    EXPECT_FALSE(moved.isOpen());
+
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, EmptyAndMissingFiles) {
+    const std::string path = "test_mapped_empty.bin";
+    ASSERT_TRUE(writeFile(path, nullptr, 0).ok());
+    MappedFile file;
+    ASSERT_TRUE(file.open(path).ok());
+    EXPECT_EQ(file.size(), 0u);
+    EXPECT_EQ(file.data(), nullptr);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(file.open("/nonexistent/file.bin").code, ErrorCode::eFileOpenFailed);
+    EXPECT_FALSE(file.isOpen());
+}
+
+TEST(MappedFileTest, SharedRangeOutlivesCaller) {
+    const std::string path = "test_mapped_range.bin";
+    const uint8_t bytes[8] = {10, 11, 12, 13, 14, 15, 16, 17};
+    ASSERT_TRUE(writeFile(path, bytes, sizeof(bytes)).ok());
+
+    std::shared_ptr<const uint8_t> range;
+    ASSERT_TRUE(mapFileRange(path, 4, 4, range).ok());
+    ASSERT_NE(range, nullptr);
+    EXPECT_EQ(range.get()[0], 14);
+    EXPECT_EQ(range.get()[3], 17);
+
+    std::shared_ptr<const uint8_t> too_long;
+    EXPECT_EQ(mapFileRange(path, 4, 5, too_long).code, ErrorCode::eDataTruncated);
+    EXPECT_EQ(too_long, nullptr);
+
+    std::filesystem::remove(path);
+    // The mapping stays readable after the file is unlinked.
+    EXPECT_EQ(range.get()[1], 15);
+}
+
+TEST(ReadFileRangeTest, EveryBackendReadsTheSameBytes) {
+    const std::string path = "test_read_range.bin";
+    std::vector<uint8_t> bytes((size_t{5} << 20) + 123);
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 31u + (i >> 11));
+    }
+    ASSERT_TRUE(writeFile(path, bytes.data(), bytes.size()).ok());
+
+    const size_t offset = 4099;  // unaligned, as after a text header
+    const size_t count = bytes.size() - offset;
+    for (ReadBackend backend : {ReadBackend::eStream, ReadBackend::ePread, ReadBackend::eIoUring, ReadBackend::eAuto}) {
+        ReadOptions options;
+        options.backend = backend;
+        options.chunk_bytes = 64 << 10;
+        options.queue_depth = 8;
+        uint64_t last_done = 0;
+        options.on_chunk = [&](uint64_t done, uint64_t total) {
+            EXPECT_GT(done, last_done);
+            EXPECT_EQ(total, count);
+            last_done = done;
+            return true;
+        };
+        std::vector<uint8_t> out(count);
+        ASSERT_TRUE(readFileRange(path, offset, out.data(), out.size(), options).ok())
+            << static_cast<int>(backend);
+        EXPECT_EQ(last_done, count);
+        EXPECT_TRUE(std::equal(out.begin(), out.end(), bytes.begin() + offset)) << static_cast<int>(backend);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(ReadFileRangeTest, ReportsTruncationAndCancellation) {
+    const std::string path = "test_read_range_short.bin";
+    std::vector<uint8_t> bytes(size_t{1} << 20, 7);
+    ASSERT_TRUE(writeFile(path, bytes.data(), bytes.size()).ok());
+
+    for (ReadBackend backend : {ReadBackend::eStream, ReadBackend::ePread, ReadBackend::eIoUring}) {
+        ReadOptions options;
+        options.backend = backend;
+        options.chunk_bytes = 64 << 10;
+        std::vector<uint8_t> out(bytes.size() + 1);
+        EXPECT_EQ(readFileRange(path, 0, out.data(), out.size(), options).code, ErrorCode::eDataTruncated)
+            << static_cast<int>(backend);
+
+        int chunks = 0;
+        options.on_chunk = [&](uint64_t, uint64_t) { return ++chunks < 3; };
+        EXPECT_EQ(readFileRange(path, 0, out.data(), bytes.size(), options).code, ErrorCode::eCancelled)
+            << static_cast<int>(backend);
+    }
+    std::vector<uint8_t> out(1);
+    EXPECT_EQ(readFileRange("/nonexistent/file.bin", 0, out.data(), 1).code, ErrorCode::eFileOpenFailed);
+    std::filesystem::remove(path);
+}
+
+TEST(ReadFileRangeTest, DirectReadsAlignedAndUnalignedRanges) {
+    const std::string path = "test_read_direct.bin";
+    std::vector<uint8_t> bytes((size_t{9} << 20) + 777);
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 13u + (i >> 12));
+    }
+    ASSERT_TRUE(writeFile(path, bytes.data(), bytes.size()).ok());
+
+    std::pmr::memory_resource* aligned = directIoMemoryResource();
+    for (ReadBackend backend : {ReadBackend::ePread, ReadBackend::eIoUring}) {
+        // Aligned offset into aligned memory (read in place, partial tail block) and an
+        // unaligned header offset (bounce buffer).
+        for (const size_t offset : {size_t{0}, kDirectIoAlignment * 3, size_t{4099}}) {
+            const size_t count = bytes.size() - offset;
+            std::pmr::vector<uint8_t> out(count, aligned);
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(out.data()) % kDirectIoAlignment, 0u);
+            ReadOptions options;
+            options.backend = backend;
+            options.direct = true;
+            uint64_t last_done = 0;
+            options.on_chunk = [&](uint64_t done, uint64_t total) {
+                EXPECT_GT(done, last_done);
+                EXPECT_EQ(total, count);
+                last_done = done;
+                return true;
+            };
+            ASSERT_TRUE(readFileRange(path, offset, out.data(), count, options).ok()) << offset;
+            EXPECT_EQ(last_done, count);
+            EXPECT_TRUE(std::equal(out.begin(), out.end(), bytes.begin() + offset)) << offset;
+        }
+    }
+
+    ReadOptions options;
+    options.direct = true;
+    std::vector<uint8_t> out(bytes.size());
+    EXPECT_EQ(readFileRange(path, 1, out.data(), out.size(), options).code, ErrorCode::eDataTruncated);
+    std::filesystem::remove(path);
+}
+
+TEST(CodecTest, EveryCodecRoundTripsSparseAndRandomData) {
+    // Mostly air with a few structured slabs, as in a CT volume, plus incompressible noise.
+    std::vector<uint8_t> sparse((size_t{3} << 20) + 777, 0);
+    for (size_t i = size_t{1} << 20; i < (size_t{1} << 20) + 200000; ++i) {
+        sparse[i] = static_cast<uint8_t>((i * 7u) ^ (i >> 5));
+    }
+    std::vector<uint8_t> noise((size_t{1} << 20) + 5);
+    std::mt19937 rng(42);
+    for (uint8_t& b : noise) {
+        b = static_cast<uint8_t>(rng());
+    }
+
+    ASSERT_NE(findCodec(CodecId::eLz), nullptr);
+    EXPECT_EQ(findCodec("lz"), findCodec(CodecId::eLz));
+    EXPECT_EQ(findCodec(CodecId::eNone), nullptr);
+    for (const CodecId id : {CodecId::eLz, CodecId::eZlib, CodecId::eGzip, CodecId::eZstd}) {
+        const std::shared_ptr<const ICodec> codec = findCodec(id);
+        if (!codec) {
+            continue;  // optional codec not built
+        }
+        for (const std::vector<uint8_t>* input : {&sparse, &noise}) {
+            for (const size_t size : {size_t{0}, size_t{1}, size_t{3}, size_t{17}, input->size()}) {
+                std::vector<uint8_t> packed;
+                ASSERT_TRUE(compressBuffer(id, input->data(), size, packed).ok()) << codec->name() << " " << size;
+                EXPECT_LE(packed.size(), codec->maxCompressedSize(size)) << codec->name();
+                std::vector<uint8_t> out(size);
+                ASSERT_TRUE(decompressBuffer(id, packed.data(), packed.size(), out.data(), out.size()).ok())
+                    << codec->name() << " " << size;
+                EXPECT_TRUE(std::equal(out.begin(), out.end(), input->begin())) << codec->name() << " " << size;
+            }
+        }
+        std::vector<uint8_t> packed;
+        ASSERT_TRUE(compressBuffer(id, sparse.data(), sparse.size(), packed).ok());
+        EXPECT_LT(packed.size(), sparse.size() / 4) << codec->name();
+
+        // Truncated streams and a wrong decoded size are rejected, never overrun.
+        std::vector<uint8_t> out(sparse.size() + 1);
+        EXPECT_EQ(decompressBuffer(id, packed.data(), packed.size() / 2, out.data(), sparse.size()).code,
+                  ErrorCode::eDataCorrupt)
+            << codec->name();
+        EXPECT_EQ(decompressBuffer(id, packed.data(), packed.size(), out.data(), sparse.size() + 1).code,
+                  ErrorCode::eDataCorrupt)
+            << codec->name();
+        EXPECT_EQ(decompressBuffer(id, packed.data(), packed.size(), out.data(), sparse.size() - 1).code,
+                  ErrorCode::eDataCorrupt)
+            << codec->name();
+    }
+}
+
+TEST(CodecTest, LzStoresIncompressibleBlocksAndRejectsBadOffsets) {
+    std::vector<uint8_t> noise(size_t{2} << 20);
+    std::mt19937 rng(7);
+    for (uint8_t& b : noise) {
+        b = static_cast<uint8_t>(rng());
+    }
+    const std::shared_ptr<const ICodec> lz = findCodec(CodecId::eLz);
+    ASSERT_NE(lz, nullptr);
+    std::vector<uint8_t> packed;
+    ASSERT_TRUE(compressBuffer(CodecId::eLz, noise.data(), noise.size(), packed).ok());
+    EXPECT_EQ(packed.size(), lz->maxCompressedSize(noise.size()));
+
+    // One compressed block whose only match points before the start of the output.
+    const std::vector<uint8_t> bad = {4, 0, 0, 0, 0x10, 'a', 5, 0};
+    std::vector<uint8_t> out(5);
+    EXPECT_EQ(decompressBuffer(CodecId::eLz, bad.data(), bad.size(), out.data(), out.size()).code,
+              ErrorCode::eDataCorrupt);
+
+    std::vector<uint8_t> small(16);
+    size_t packed_size = 0;
+    EXPECT_EQ(lz->compress(noise.data(), noise.size(), small.data(), small.size(), packed_size, 0).code,
+              ErrorCode::eInvalidArgument);
+}
@@ -0,0 +1,182 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/completion_queue.h"
+#include "vertexnova/io/common/scratch_arena.h"
+#include "vertexnova/io/common/single_flight.h"
+#include "vertexnova/io/common/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vne::io;
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(3);
+        EXPECT_EQ(pool.threadCount(), 3u);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&counter] { counter.fetch_add(1); });
+        }
+        pool.waitIdle();
+        EXPECT_EQ(counter.load(), 100);
+    }
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPoolTest, DestructorDrainsQueue) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(1);
+        for (int i = 0; i < 10; ++i) {
+            pool.submit([&counter] { counter.fetch_add(1); });
+        }
+    }
+    EXPECT_EQ(counter.load(), 10);
+}
+
+TEST(ThreadPoolTest, RunsByPriorityThenDeadline) {
+    ThreadPool pool(1);
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    std::promise<void> started;
+    pool.submit([&started, gate] {
+        started.set_value();
+        gate.wait();
+    });
+    started.get_future().wait();  // the single worker is now busy; everything below queues
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&mutex, &order](int tag) {
+        return [&mutex, &order, tag] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(tag);
+        };
+    };
+    const auto now = ThreadPool::Clock::now();
+    pool.submit(record(1), -1);                                    // background
+    const ThreadPool::TaskId bumped = pool.submit(record(2), -1);  // background, bumped below
+    pool.submit(record(3));                                        // normal, no deadline
+    pool.submit(record(4), 0, now + std::chrono::seconds(2));     // normal, later deadline
+    pool.submit(record(5), 0, now + std::chrono::seconds(1));     // normal, earlier deadline
+    pool.submit(record(6), 2);                                     // urgent
+    EXPECT_EQ(pool.pendingCount(), 6u);
+    EXPECT_TRUE(pool.reprioritize(bumped, 1));
+    EXPECT_FALSE(pool.reprioritize(ThreadPool::kInvalidTaskId, 1));
+
+    release.set_value();
+    pool.waitIdle();
+    EXPECT_EQ(order, (std::vector<int>{6, 2, 5, 4, 3, 1}));
+    EXPECT_FALSE(pool.reprioritize(bumped, 2));  // already ran
+}
+
+TEST(CompletionQueueTest, DrainRunsInPushOrder) {
+    CompletionQueue queue;
+    EXPECT_TRUE(queue.empty());
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i) {
+        queue.push([&order, i] { order.push_back(i); });
+    }
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ(queue.drain(2), 2u);
+    EXPECT_EQ(queue.drain(), 3u);
+    EXPECT_TRUE(queue.empty());
+    ASSERT_EQ(order.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(order[static_cast<size_t>(i)], i);
+    }
+}
+
+TEST(CompletionQueueTest, MultipleProducers) {
+    CompletionQueue queue;
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 1000;
+    int executed = 0;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, &executed] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                queue.push([&executed] { ++executed; });
+            }
+        });
+    }
+    size_t drained = 0;
+    while (drained < static_cast<size_t>(kProducers * kPerProducer)) {
+        drained += queue.drain();
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    EXPECT_EQ(executed, kProducers * kPerProducer);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ScratchArenaTest, ReusesThreadBlockAndNests) {
+    const void* first = nullptr;
+    {
+        ScratchArena arena;
+        std::pmr::vector<uint8_t> bytes(64, arena.resource());
+        first = bytes.data();
+        {
+            // A nested arena cannot share the thread block; it still allocates.
+            ScratchArena nested;
+            std::pmr::vector<uint8_t> other(64, nested.resource());
+            EXPECT_NE(static_cast<const void*>(other.data()), first);
+        }
+        std::pmr::vector<uint8_t> large(kScratchBlockBytes * 2, arena.resource());  // spills past the block
+        EXPECT_EQ(large.size(), kScratchBlockBytes * 2);
+    }
+    ScratchArena again;
+    std::pmr::vector<uint8_t> bytes(64, again.resource());
+    EXPECT_EQ(static_cast<const void*>(bytes.data()), first);
+}
+
+TEST(SingleFlightTest, ConcurrentCallersShareOneExecution) {
+    SingleFlight flight;
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    std::atomic<int> runs{0};
+    auto slow = [&]() {
+        runs.fetch_add(1);
+        gate.wait();
+        return std::string("decoded");
+    };
+
+    constexpr int kCallers = 6;
+    std::vector<std::future<std::string>> results;
+    for (int i = 0; i < kCallers; ++i) {
+        results.push_back(std::async(std::launch::async, [&] { return flight.run<std::string>("a", slow); }));
+    }
+    // Everyone but the running caller must have joined before the result is released.
+    while (flight.stats().coalesced < kCallers - 1) {
+        std::this_thread::yield();
+    }
+    release.set_value();
+    for (auto& result : results) {
+        EXPECT_EQ(result.get(), "decoded");
+    }
+    EXPECT_EQ(runs.load(), 1);
+    EXPECT_EQ(flight.stats().executed, 1u);
+
+    // Finished keys run again; other keys and result types never share.
+    EXPECT_EQ(flight.run<std::string>("a", [] { return std::string("again"); }), "again");
+    EXPECT_EQ(flight.run<int>("a", [] { return 7; }), 7);
+    EXPECT_EQ(flight.stats().executed, 3u);
+    EXPECT_THROW(flight.run<int>("b", []() -> int { throw std::runtime_error("failed"); }), std::runtime_error);
+}
@@ -0,0 +1,77 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/format_detect.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vne::io;
+
+namespace {
+
+std::vector<uint8_t> bytesOf(const std::string& text) {
+    return std::vector<uint8_t>(text.begin(), text.end());
+}
+
+}  // namespace
+
+TEST(FormatDetectTest, NormalizesExtensionsAndHints) {
+    EXPECT_EQ(normalizeFormat(".PNG"), "png");
+    EXPECT_EQ(normalizeFormat("*.Nrrd"), "nrrd");
+    EXPECT_EQ(fileExtension("/data/scan.MHA"), "mha");
+    EXPECT_EQ(fileExtension("/data.v2/scan"), "");
+    EXPECT_EQ(fileExtension("noext"), "");
+
+    LoadRequest request;
+    request.uri = "/data/volume.bin";
+    EXPECT_EQ(requestFormat(request), "bin");
+    request.hint_format = ".NRRD";
+    EXPECT_EQ(requestFormat(request), "nrrd");
+}
+
+TEST(FormatDetectTest, SniffsSignatures) {
+    const std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0};
+    EXPECT_EQ(sniffFormat(png, png.size()), "png");
+    const std::vector<uint8_t> jpeg = {0xFF, 0xD8, 0xFF, 0xE0};
+    EXPECT_EQ(sniffFormat(jpeg, jpeg.size()), "jpg");
+
+    const auto nrrd = bytesOf("NRRD0004\ntype: uchar\n");
+    EXPECT_EQ(sniffFormat(nrrd, nrrd.size()), "nrrd");
+    const auto mhd = bytesOf("ObjectType = Image\nNDims = 3\n");
+    EXPECT_EQ(sniffFormat(mhd, mhd.size()), "mhd");
+    const auto ascii_stl = bytesOf("solid cube\n facet normal 0 0 1\n");
+    EXPECT_EQ(sniffFormat(ascii_stl, ascii_stl.size()), "stl");
+    const auto ply = bytesOf("ply\r\nformat binary_little_endian 1.0\r\n");
+    EXPECT_EQ(sniffFormat(ply, ply.size()), "ply");
+    const auto glb = bytesOf(std::string("glTF\x02\0\0\0", 8));
+    EXPECT_EQ(sniffFormat(glb, glb.size()), "glb");
+    const auto vnemesh = bytesOf(std::string("VNEMESH\0\x01\0\0\0", 12));
+    EXPECT_EQ(sniffFormat(vnemesh, vnemesh.size()), "vnemesh");
+
+    std::vector<uint8_t> dicom(kSniffHeaderBytes, 0);
+    std::memcpy(dicom.data() + 128, "DICM", 4);
+    EXPECT_EQ(sniffFormat(dicom, 4096), "dcm");
+
+    const auto unknown = bytesOf("hello world");
+    EXPECT_EQ(sniffFormat(unknown, unknown.size()), "");
+}
+
+TEST(FormatDetectTest, SniffsBinaryStlBySize) {
+    // 80-byte header (may itself start with "solid") + triangle count 2 + 2 * 50 bytes.
+    std::vector<uint8_t> header(84, 0);
+    std::memcpy(header.data(), "solid exported by a CAD tool", 28);
+    header[80] = 2;
+    EXPECT_EQ(sniffFormat(header, 84 + 2 * 50), "stl");
+
+    std::memcpy(header.data(), "binary", 6);
+    EXPECT_EQ(sniffFormat(header, 84 + 2 * 50), "stl");
+    EXPECT_EQ(sniffFormat(header, 84 + 3 * 50), "");
+}
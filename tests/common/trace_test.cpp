@@ -0,0 +1,86 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vne::io;
+
+namespace {
+
+std::vector<trace::TraceEvent> eventsNamed(const char* name) {
+    std::vector<trace::TraceEvent> events = trace::snapshot();
+    events.erase(std::remove_if(events.begin(),
+                                events.end(),
+                                [name](const trace::TraceEvent& e) { return std::strcmp(e.name, name) != 0; }),
+                 events.end());
+    return events;
+}
+
+}  // namespace
+
+TEST(TraceTest, RecordsSpansAsChromeJson) {
+    trace::clear();
+    {
+        const trace::ScopedSpan span("TraceTest::outer", "test");
+        trace::record("TraceTest::inner \"quoted\"", "test", 1000, 3500);
+    }
+    const auto outer = eventsNamed("TraceTest::outer");
+    ASSERT_EQ(outer.size(), 1u);
+    EXPECT_STREQ(outer[0].category, "test");
+    EXPECT_GT(outer[0].thread_id, 0u);
+
+    const auto inner = eventsNamed("TraceTest::inner \"quoted\"");
+    ASSERT_EQ(inner.size(), 1u);
+    EXPECT_EQ(inner[0].duration_ns, 2500u);
+
+    const std::string json = trace::toChromeTraceJson();
+    EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"TraceTest::outer\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"TraceTest::inner \\\"quoted\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"dur\":2.500"), std::string::npos);
+
+    trace::clear();
+    EXPECT_TRUE(trace::snapshot().empty());
+}
+
+TEST(TraceTest, PausedRecorderSkipsSpans) {
+    trace::clear();
+    trace::setEnabled(false);
+    {
+        const trace::ScopedSpan span("TraceTest::paused", "test");
+    }
+    trace::setEnabled(true);
+    EXPECT_TRUE(eventsNamed("TraceTest::paused").empty());
+}
+
+TEST(TraceTest, RingKeepsNewestEventsPerThread) {
+    trace::clear();
+    std::thread writer([] {
+        for (uint64_t i = 0; i < trace::kTraceEventsPerThread + 10; ++i) {
+            trace::record("TraceTest::ring", "test", i + 1, i + 2);
+        }
+    });
+    writer.join();
+    trace::record("TraceTest::ring", "test", 1, 2);
+
+    const auto events = eventsNamed("TraceTest::ring");
+    ASSERT_EQ(events.size(), trace::kTraceEventsPerThread + 1);
+    const uint32_t main_id = events.front().thread_id;  // start 1 sorts first
+    EXPECT_NE(events.back().thread_id, main_id);
+    EXPECT_EQ(events.back().start_ns, trace::kTraceEventsPerThread + 10);
+    // The writer's ten oldest events were overwritten.
+    EXPECT_EQ(events[1].start_ns, 11u);
+    trace::clear();
+}
@@ -5,13 +5,20 @@
  */
 
 #include "vertexnova/io/image/volume.h"
+#include "vertexnova/io/common/binary_io.h"
 #include "vertexnova/io/image/nrrd_loader.h"
 #include "vertexnova/io/image/mhd_loader.h"
+#include "vertexnova/io/image/volume_exporter.h"
 #include "vertexnova/io/utils/path_utils.h"
 
 #include <filesystem>
 #include <fstream>
 #include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -151,3 +158,251 @@ TEST(VolumeTest, NrrdLoaderLoadSmall3dNrrd) {
     EXPECT_EQ(vol.getData()[0], 0);
     EXPECT_EQ(vol.getData()[63], 63);
 }
+
+TEST(VolumeTest, NrrdLoaderMemoryMapMatchesCopy) {
+    std::string path = getTestdataPath("volumes/small3d.nrrd");
+    if (!std::filesystem::exists(path)) {
+        GTEST_SKIP() << "Test volume not found: " << path << " (run from project root with testdata/volumes present)";
+    }
+    NrrdLoader loader;
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eVolume;
+    request.uri = path;
+    auto copied = loader.loadVolume(request);
+    request.memory_map = true;
+    auto mapped = loader.loadVolume(request);
+    ASSERT_TRUE(copied.ok()) << copied.status.message;
+    ASSERT_TRUE(mapped.ok()) << mapped.status.message;
+
+    EXPECT_FALSE(copied.value.hasExternalData());
+    EXPECT_TRUE(mapped.value.hasExternalData());
+    EXPECT_TRUE(mapped.value.data.empty());
+    EXPECT_FALSE(mapped.value.isEmpty());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(mapped.value.dims[i], copied.value.dims[i]);
+        EXPECT_FLOAT_EQ(mapped.value.spacing[i], copied.value.spacing[i]);
+    }
+    EXPECT_EQ(mapped.value.pixel_type, copied.value.pixel_type);
+    ASSERT_EQ(mapped.value.dataSize(), copied.value.dataSize());
+    EXPECT_EQ(std::memcmp(mapped.value.getData(), copied.value.getData(), copied.value.dataSize()), 0);
+}
+
+TEST(VolumeTest, NrrdLoaderMemoryMapDetachedHeader) {
+    const std::string header_path = "test_mapped.nhdr";
+    const std::string raw_path = "test_mapped.raw";
+    {
+        std::ofstream h(header_path);
+        ASSERT_TRUE(h);
+        h << "NRRD0004\n";
+        h << "# detached 16-bit volume\n";
+        h << "type: ushort\n";
+        h << "dimension: 3\n";
+        h << "sizes: 3 2 2\n";
+        h << "spacings: 0.5 0.5 2\n";
+        h << "endian: little\n";
+        h << "encoding: raw\n";
+        h << "data file: " << raw_path << "\n";
+    }
+    {
+        std::ofstream r(raw_path, std::ios::binary);
+        for (uint16_t v = 0; v < 12; ++v) {
+            const uint8_t bytes[2] = {static_cast<uint8_t>(v * 300 & 0xFF), static_cast<uint8_t>(v * 300 >> 8)};
+            r.write(reinterpret_cast<const char*>(bytes), 2);
+        }
+    }
+
+    NrrdLoader loader;
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eVolume;
+    request.uri = header_path;
+    request.memory_map = true;
+    auto result = loader.loadVolume(request);
+    ASSERT_TRUE(result.ok()) << result.status.message;
+    const Volume& vol = result.value;
+    EXPECT_TRUE(vol.hasExternalData());
+    EXPECT_EQ(vol.width(), 3);
+    EXPECT_EQ(vol.height(), 2);
+    EXPECT_EQ(vol.depth(), 2);
+    EXPECT_EQ(vol.pixel_type, VolumePixelType::eUint16);
+    EXPECT_FLOAT_EQ(vol.spacing[2], 2.0f);
+    const auto* voxels = reinterpret_cast<const uint16_t*>(vol.getData());
+    EXPECT_EQ(voxels[0], 0);
+    EXPECT_EQ(voxels[11], 3300);
+
+    std::filesystem::remove(header_path);
+    std::filesystem::remove(raw_path);
+}
+
+TEST(VolumeTest, MhdLoaderMemoryMapAndDetach) {
+    const std::string header_path = "test_mapped.mhd";
+    const std::string raw_path = "test_mapped_mhd.raw";
+    {
+        std::ofstream h(header_path);
+        ASSERT_TRUE(h);
+        h << "ObjectType = Image\n";
+        h << "NDims = 3\n";
+        h << "DimSize = 2 2 2\n";
+        h << "ElementType = MET_FLOAT\n";
+        h << "ElementSpacing = 1 1 1\n";
+        h << "ElementDataFile = " << raw_path << "\n\n";
+    }
+    {
+        std::ofstream r(raw_path, std::ios::binary);
+        for (int i = 0; i < 8; ++i) {
+            const float v = static_cast<float>(i) * 0.25f;
+            r.write(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+    }
+
+    MhdLoader loader;
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eVolume;
+    request.uri = header_path;
+    request.memory_map = true;
+    auto result = loader.loadVolume(request);
+    ASSERT_TRUE(result.ok()) << result.status.message;
+    Volume vol = result.value;
+    EXPECT_TRUE(vol.hasExternalData());
+    EXPECT_FLOAT_EQ(reinterpret_cast<const float*>(std::as_const(vol).getData())[7], 1.75f);
+
+    // Writable access copies the mapping into owned storage.
+    reinterpret_cast<float*>(vol.getData())[0] = 42.0f;
+    EXPECT_FALSE(vol.hasExternalData());
+    EXPECT_EQ(vol.data.size(), 8 * sizeof(float));
+    EXPECT_FLOAT_EQ(reinterpret_cast<const float*>(std::as_const(result.value).getData())[0], 0.0f);
+
+    std::filesystem::remove(header_path);
+    std::filesystem::remove(raw_path);
+}
+
+TEST(VolumeTest, MhdLoaderDirectIoMatchesBufferedRead) {
+    Volume source;
+    source.dims[0] = 97;  // odd payload size: the last partial block goes through the bounce buffer
+    source.dims[1] = 96;
+    source.dims[2] = 95;
+    source.pixel_type = VolumePixelType::eUint16;
+    source.data.resize(source.byteCount());
+    for (size_t i = 0; i < source.data.size(); ++i) {
+        source.data[i] = static_cast<uint8_t>(i * 31u + (i >> 9));
+    }
+    // .mha: voxels follow the text header at an unaligned offset; .mhd: detached raw file at offset 0.
+    for (const bool inline_data : {true, false}) {
+        const std::string path = inline_data ? "test_direct.mha" : "test_direct.mhd";
+        MhdExportOptions opts;
+        opts.inline_data = inline_data;
+        std::string error;
+        ASSERT_TRUE(exportMhd(path, source, opts, &error)) << error;
+
+        MhdLoader loader;
+        vne::io::LoadRequest request;
+        request.asset_type = vne::io::AssetType::eVolume;
+        request.uri = path;
+        request.direct_io = true;
+        auto result = loader.loadVolume(request);
+        ASSERT_TRUE(result.ok()) << result.status.message;
+        const Volume& vol = result.value;
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(vol.data.data()) % vne::io::binaryio::kDirectIoAlignment, 0u);
+        ASSERT_EQ(vol.dataSize(), source.byteCount());
+        EXPECT_EQ(std::memcmp(vol.getData(), source.data.data(), source.byteCount()), 0) << path;
+
+        std::filesystem::remove(path);
+        std::filesystem::remove("test_direct.raw");
+    }
+}
+
+TEST(VolumeTest, CompressedExportsRoundTrip) {
+    using vne::io::binaryio::CodecId;
+    Volume source;
+    source.dims[0] = 64;
+    source.dims[1] = 48;
+    source.dims[2] = 40;
+    source.pixel_type = VolumePixelType::eInt16;
+    source.data.assign(source.byteCount(), 0);  // mostly air
+    auto* voxels = reinterpret_cast<int16_t*>(source.data.data());
+    for (size_t i = 20000; i < 40000; ++i) {
+        voxels[i] = static_cast<int16_t>(i % 1000 - 500);
+    }
+    {
+        // A malformed CompressedDataSize is reported as a load error, never thrown.
+        const std::string header =
+            "ObjectType = Image\nNDims = 3\nDimSize = 2 2 2\nElementType = MET_UCHAR\n"
+            "CompressedData = True\nCompressedDataSize = 99999999999999999999999\nElementDataFile = LOCAL\n\n";
+        vne::io::LoadRequest bad_request;
+        bad_request.asset_type = vne::io::AssetType::eVolume;
+        bad_request.uri = "test_bad_size.mha";
+        bad_request.buffer = std::as_bytes(std::span(header));
+        MhdLoader loader;
+        vne::io::LoadResult<Volume> result;
+        EXPECT_NO_THROW(result = loader.loadVolume(bad_request));
+        EXPECT_FALSE(result.ok());
+        EXPECT_NE(result.status.message.find("CompressedDataSize"), std::string::npos) << result.status.message;
+    }
+    if (!vne::io::binaryio::findCodec(CodecId::eGzip)) {
+        std::string error;
+        NrrdExportOptions opts;
+        opts.codec = CodecId::eGzip;
+        EXPECT_FALSE(exportNrrd("test_gzip.nrrd", source, opts, &error));
+        EXPECT_FALSE(std::filesystem::exists("test_gzip.nrrd"));
+        GTEST_SKIP() << "built without VNEIO_WITH_ZLIB";
+    }
+
+    auto expectSame = [&source](const vne::io::LoadResult<Volume>& result, const std::string& path) {
+        ASSERT_TRUE(result.ok()) << path << ": " << result.status.message;
+        ASSERT_EQ(result.value.dataSize(), source.byteCount()) << path;
+        EXPECT_EQ(std::memcmp(result.value.getData(), source.data.data(), source.byteCount()), 0) << path;
+    };
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eVolume;
+
+    for (const std::string path : {"test_gzip.nrrd", "test_gzip.nhdr"}) {
+        NrrdExportOptions opts;
+        opts.codec = CodecId::eGzip;
+        std::string error;
+        ASSERT_TRUE(exportNrrd(path, source, opts, &error)) << error;
+        EXPECT_LT(std::filesystem::file_size(path.ends_with(".nhdr") ? "test_gzip.raw.gz" : path),
+                  source.byteCount() / 4);
+        NrrdLoader loader;
+        request.uri = path;
+        request.memory_map = path.ends_with(".nhdr");  // compressed data cannot be mapped; read instead
+        expectSame(loader.loadVolume(request), path);
+        std::filesystem::remove(path);
+    }
+    std::filesystem::remove("test_gzip.raw.gz");
+
+    for (const std::string path : {"test_zlib.mha", "test_zlib.mhd"}) {
+        MhdExportOptions opts;
+        opts.codec = CodecId::eZlib;
+        std::string error;
+        ASSERT_TRUE(exportMhd(path, source, opts, &error)) << error;
+        MhdLoader loader;
+        request.uri = path;
+        request.memory_map = false;
+        expectSame(loader.loadVolume(request), path);
+
+        // Same file through a virtual file system (resident contents are inflated in place).
+        std::vector<uint8_t> header_bytes;
+        ASSERT_TRUE(vne::io::binaryio::readFile(path, header_bytes).ok());
+        request.buffer = std::as_bytes(std::span(header_bytes));
+        expectSame(loader.loadVolume(request), path + " (buffer)");
+        request.buffer = {};
+
+        // Cancelling at the final decode report still fails the load with a message.
+        vne::io::LoadRequest cancelled = request;
+        cancelled.cancel_token = vne::io::CancellationToken::make();
+        cancelled.on_progress = [&cancelled](const vne::io::LoadProgress& progress) {
+            if (progress.stage == "decode" && progress.completed == progress.total) {
+                cancelled.cancel_token.cancel();
+            }
+        };
+        const auto cancelled_result = loader.loadVolume(cancelled);
+        EXPECT_EQ(cancelled_result.status.code, vne::io::ErrorCode::eCancelled) << path;
+        EXPECT_FALSE(cancelled_result.status.message.empty()) << path;
+        std::filesystem::remove(path);
+    }
+    std::filesystem::remove("test_zlib.zraw");
+
+    NrrdExportOptions bad;
+    bad.codec = CodecId::eZstd;
+    EXPECT_FALSE(exportNrrd("test_bad_codec.nrrd", source, bad));
+    EXPECT_FALSE(std::filesystem::exists("test_bad_codec.nrrd"));
+}
@@ -9,13 +9,25 @@
  * ----------------------------------------------------------------------
  */
 
+#include "vertexnova/io/asset_io.h"
 #include "vertexnova/io/mesh/mesh.h"
 #include "vertexnova/io/mesh/mesh_loader.h"
 #include "vertexnova/io/mesh/assimp_loader.h"
+#include "vertexnova/io/mesh/gltf_loader.h"
+#include "vertexnova/io/mesh/mesh_exporter.h"
 #include "vertexnova/io/mesh/mesh_loader_registry.h"
+#include "vertexnova/io/mesh/obj_loader.h"
+#include "vertexnova/io/mesh/ply_loader.h"
+#include "vertexnova/io/mesh/stl_loader.h"
+#include "vertexnova/io/mesh/vnemesh_loader.h"
 #include "vertexnova/io/utils/path_utils.h"
 
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -253,3 +265,968 @@ TEST_F(MeshLoaderTest, RegistryReturnsNullForUnsupportedPath) {
     auto loader = MeshLoaderRegistry::getLoaderFor("file.xyz");
     EXPECT_EQ(loader, nullptr);
 }
+
+namespace {
+
+/** Binary STL of a flat grid (two triangles per cell, +Z facet normals) plus one triangle with a zero normal. */
+std::vector<uint8_t> makeBinaryStl(int cells, const char* header = "vneio grid") {
+    std::vector<float> records;
+    auto add = [&records](const float (&n)[3], const float (&a)[3], const float (&b)[3], const float (&c)[3]) {
+        for (const float* v : {n, a, b, c}) {
+            records.insert(records.end(), v, v + 3);
+        }
+    };
+    for (int y = 0; y < cells; ++y) {
+        for (int x = 0; x < cells; ++x) {
+            const auto fx = static_cast<float>(x);
+            const auto fy = static_cast<float>(y);
+            add({0, 0, 1}, {fx, fy, 0}, {fx + 1, fy, 0}, {fx + 1, fy + 1, 0});
+            add({0, 0, 1}, {fx, fy, 0}, {fx + 1, fy + 1, 0}, {fx, fy + 1, 0});
+        }
+    }
+    add({0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 2});  // normal left to the loader: +X
+    const uint32_t triangles = static_cast<uint32_t>(records.size() / 12);
+    std::vector<uint8_t> bytes(84 + size_t{50} * triangles, 0);
+    std::memcpy(bytes.data(), header, std::strlen(header));
+    std::memcpy(bytes.data() + 80, &triangles, sizeof(triangles));
+    for (uint32_t t = 0; t < triangles; ++t) {
+        std::memcpy(bytes.data() + 84 + size_t{50} * t, records.data() + size_t{12} * t, 12 * sizeof(float));
+    }
+    return bytes;
+}
+
+vne::io::LoadResult<Mesh> loadStlBuffer(const std::vector<uint8_t>& bytes, const StlLoaderOptions& options = {}) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = "grid.stl";
+    request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(bytes.data()), bytes.size());
+    StlLoader loader(options);
+    return loader.loadMesh(request);
+}
+
+}  // namespace
+
+TEST_F(MeshLoaderTest, StlLoaderMatchesAssimpOnAsciiStl) {
+    // Assimp's tangent pass leaves these UV-less corners unjoinable, so compare with welding off.
+    StlLoaderOptions options;
+    options.weld_vertices = false;
+    StlLoader native(options);
+    Mesh mesh;
+    ASSERT_TRUE(native.loadFile(kMeshPath, mesh)) << native.getLastError();
+    AssimpLoader assimp;
+    Mesh reference;
+    ASSERT_TRUE(assimp.loadFile(kMeshPath, reference));
+
+    EXPECT_EQ(mesh.name, kMeshPath);
+    EXPECT_EQ(mesh.getVertexCount(), reference.getVertexCount());
+    EXPECT_EQ(mesh.getIndexCount(), reference.getIndexCount());
+    EXPECT_EQ(mesh.getSubmeshCount(), reference.getSubmeshCount());
+    EXPECT_EQ(mesh.getMaterialCount(), reference.getMaterialCount());
+    EXPECT_EQ(mesh.has_normals, reference.has_normals);
+    EXPECT_EQ(mesh.has_uv0, reference.has_uv0);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(mesh.aabb_min[i], reference.aabb_min[i]);
+        EXPECT_EQ(mesh.aabb_max[i], reference.aabb_max[i]);
+    }
+    EXPECT_EQ(MeshLoaderRegistry::getLoaderFor("scan.STL")->supportedExtensions(), native.supportedExtensions());
+
+    // The two facets share an edge and a normal, so welding keeps four vertices.
+    Mesh welded;
+    ASSERT_TRUE(StlLoader().loadFile(kMeshPath, welded));
+    EXPECT_EQ(welded.getVertexCount(), 4u);
+}
+
+TEST_F(MeshLoaderTest, StlLoaderWeldsBinaryStlInParallel) {
+    constexpr int kCells = 130;  // 33801 triangles: more than one parse task
+    const std::vector<uint8_t> bytes = makeBinaryStl(kCells, "solid but binary");
+
+    StlLoaderOptions options;
+    options.max_threads = 4;
+    vne::io::LoadResult<Mesh> welded = loadStlBuffer(bytes, options);
+    ASSERT_TRUE(welded.ok()) << welded.status.message;
+    const Mesh& mesh = welded.value;
+    const size_t grid_vertices = static_cast<size_t>(kCells + 1) * (kCells + 1);
+    EXPECT_EQ(mesh.getVertexCount(), grid_vertices + 3);
+    ASSERT_EQ(mesh.getIndexCount(), static_cast<size_t>(2 * kCells * kCells + 1) * 3);
+    ASSERT_EQ(mesh.parts.size(), 1u);
+    EXPECT_EQ(mesh.parts[0].index_count, mesh.getIndexCount());
+    EXPECT_EQ(mesh.aabb_max[0], static_cast<float>(kCells));
+    EXPECT_EQ(mesh.aabb_max[2], 2.0f);
+    EXPECT_EQ(mesh.aabb_min[1], 0.0f);
+
+    // Vertices keep first-occurrence order, so the first triangle is (0, 1, 2) and the next reuses 0 and 2.
+    EXPECT_EQ(mesh.indices[0], 0u);
+    EXPECT_EQ(mesh.indices[3], 0u);
+    EXPECT_EQ(mesh.indices[4], 2u);
+    const VertexAttributes& last = mesh.vertices[mesh.indices.back()];
+    EXPECT_EQ(last.position[2], 2.0f);
+    EXPECT_EQ(last.normal[0], 1.0f);
+    EXPECT_EQ(mesh.vertices[0].normal[2], 1.0f);
+    EXPECT_EQ(mesh.vertices[0].tangent[0], 1.0f);
+
+    options.max_threads = 1;
+    vne::io::LoadResult<Mesh> serial = loadStlBuffer(bytes, options);
+    ASSERT_TRUE(serial.ok());
+    EXPECT_EQ(serial.value.indices, mesh.indices);
+
+    options.weld_vertices = false;
+    vne::io::LoadResult<Mesh> unwelded = loadStlBuffer(bytes, options);
+    ASSERT_TRUE(unwelded.ok());
+    EXPECT_EQ(unwelded.value.getVertexCount(), mesh.getIndexCount());
+    EXPECT_EQ(unwelded.value.vertices[4].position[0], 1.0f);
+
+    std::vector<uint8_t> truncated(bytes.begin(), bytes.end() - 10);
+    truncated[0] = 'x';  // no "solid": a short binary file
+    EXPECT_EQ(loadStlBuffer(truncated).status.code, vne::io::ErrorCode::eDataTruncated);
+    const std::string garbage = "solid x\nfacet normal 0 0 1\nouter loop\nvertex 0 0\n";
+    EXPECT_EQ(loadStlBuffer(std::vector<uint8_t>(garbage.begin(), garbage.end())).status.code,
+              vne::io::ErrorCode::eParseError);
+}
+
+namespace {
+
+vne::io::LoadResult<Mesh> loadObjBuffer(const std::string& text, const ObjLoaderOptions& options = {}) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = "buffer.obj";
+    request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(text.data()), text.size());
+    ObjLoader loader(options);
+    return loader.loadMesh(request);
+}
+
+}  // namespace
+
+TEST_F(MeshLoaderTest, ObjLoaderGroupsMaterialsAndResolvesIndices) {
+    const std::string obj_path = "test_native_obj.obj";
+    {
+        std::ofstream obj(obj_path);
+        ASSERT_TRUE(obj);
+        obj << "# quad with two materials\n";
+        obj << "mtllib test_native_obj.mtl\n";
+        obj << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n";
+        obj << "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n";
+        obj << "vn 0 0 1\n";
+        obj << "f 1/1/1 2/2/1 3/3/1\n";        // before any usemtl: default material
+        obj << "usemtl red\n";
+        obj << "f -4/-4/-1 -2/-2/-1 -1/-1/-1\n";  // relative indices: 1, 3, 4
+        obj << "usemtl missing\n";
+        obj << "f 1 2 \\\n  4 # continued\n";   // unknown material: default
+        obj << "usemtl red\n";
+        obj << "f 1/1/1 2/2/1 3/3/1 4/4/1\n";  // quad: two triangles
+        obj << "l 1 2\n";
+    }
+    {
+        std::ofstream mtl("test_native_obj.mtl");
+        ASSERT_TRUE(mtl);
+        mtl << "newmtl unused\nKd 0 0 1\n\nnewmtl red\nKd 1 0 0\nmap_Kd -s 1 1 1 red.png\n";
+    }
+
+    ObjLoader loader;
+    Mesh mesh;
+    const bool loaded = loader.loadFile(obj_path, mesh);
+    std::filesystem::remove(obj_path);
+    std::filesystem::remove("test_native_obj.mtl");
+    ASSERT_TRUE(loaded) << loader.getLastError();
+
+    // Unused materials are dropped; each used one gets a submesh with its own vertices.
+    ASSERT_EQ(mesh.getMaterialCount(), 2u);
+    EXPECT_EQ(mesh.materials[0].name, "DefaultMaterial");
+    EXPECT_FLOAT_EQ(mesh.materials[0].base_color[0], 0.6f);
+    EXPECT_EQ(mesh.materials[1].name, "red");
+    EXPECT_EQ(mesh.materials[1].base_color_tex, "red.png");
+    EXPECT_EQ(mesh.materials[1].base_color[0], 1.0f);
+    EXPECT_EQ(mesh.materials[1].base_color[2], 0.0f);
+    ASSERT_EQ(mesh.getSubmeshCount(), 2u);
+    EXPECT_EQ(mesh.parts[0].first_index, 0u);
+    EXPECT_EQ(mesh.parts[0].index_count, 6u);
+    EXPECT_EQ(mesh.parts[1].first_index, 6u);
+    EXPECT_EQ(mesh.parts[1].index_count, 9u);
+    EXPECT_EQ(mesh.parts[1].material_index, 1u);
+    EXPECT_EQ(mesh.getVertexCount(), 10u);
+    const std::vector<uint32_t> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 6, 9, 7, 6, 7, 8};
+    EXPECT_EQ(std::vector<uint32_t>(mesh.indices.begin(), mesh.indices.end()), expected);
+
+    EXPECT_TRUE(mesh.has_uv0);
+    EXPECT_TRUE(mesh.has_normals);
+    EXPECT_TRUE(mesh.has_tangent);
+    EXPECT_EQ(mesh.vertices[0].texcoord0[1], 1.0f);  // flipped V
+    EXPECT_EQ(mesh.vertices[3].normal[1], 1.0f);     // no vn: AssimpLoader's default
+    EXPECT_EQ(mesh.vertices[3].tangent[0], 1.0f);
+    const VertexAttributes& red = mesh.vertices[6];
+    EXPECT_EQ(red.normal[2], 1.0f);
+    EXPECT_NEAR(red.tangent[0], 1.0f, 1e-6f);
+    EXPECT_NEAR(red.bitangent[1], 1.0f, 1e-6f);
+    EXPECT_EQ(mesh.aabb_max[1], 1.0f);
+    EXPECT_EQ(mesh.aabb_min[2], 0.0f);
+    EXPECT_EQ(MeshLoaderRegistry::getLoaderFor("scan.OBJ")->supportedExtensions(), loader.supportedExtensions());
+
+    EXPECT_EQ(loadObjBuffer("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n").status.code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(loadObjBuffer("v 0 x 0\nf 1 1 1\n").status.code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(loadObjBuffer("v 0 0 0\nl 1 1\n").status.code, vne::io::ErrorCode::eParseError);
+}
+
+TEST_F(MeshLoaderTest, ObjLoaderParsesChunksInParallel) {
+    constexpr int kCells = 400;  // several MiB: more than one line-aligned chunk
+    std::string text;
+    for (int y = 0; y <= kCells; ++y) {
+        for (int x = 0; x <= kCells; ++x) {
+            text += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\n";
+        }
+    }
+    for (int y = 0; y < kCells; ++y) {
+        for (int x = 0; x < kCells; ++x) {
+            const int a = y * (kCells + 1) + x + 1;
+            const int d = a + kCells + 1;
+            text += "f " + std::to_string(a) + " " + std::to_string(a + 1) + " " + std::to_string(d + 1) + " "
+                    + std::to_string(d) + "\n";
+        }
+    }
+
+    ObjLoaderOptions options;
+    options.max_threads = 4;
+    vne::io::LoadResult<Mesh> parallel = loadObjBuffer(text, options);
+    ASSERT_TRUE(parallel.ok()) << parallel.status.message;
+    const Mesh& mesh = parallel.value;
+    EXPECT_EQ(mesh.getVertexCount(), static_cast<size_t>(kCells + 1) * (kCells + 1));
+    ASSERT_EQ(mesh.getIndexCount(), static_cast<size_t>(kCells) * kCells * 6);
+    ASSERT_EQ(mesh.getSubmeshCount(), 1u);
+    EXPECT_EQ(mesh.materials[0].name, "DefaultMaterial");
+    EXPECT_FALSE(mesh.has_uv0);
+    EXPECT_FALSE(mesh.has_normals);
+    EXPECT_FALSE(mesh.has_tangent);
+    EXPECT_EQ(mesh.aabb_max[0], static_cast<float>(kCells));
+    EXPECT_EQ(mesh.aabb_max[1], static_cast<float>(kCells));
+
+    // First-occurrence order: the first quad is vertices 0..3, fanned into (0, 1, 2) and (0, 2, 3).
+    const std::vector<uint32_t> first_quad = {0, 1, 2, 0, 2, 3};
+    EXPECT_EQ(std::vector<uint32_t>(mesh.indices.begin(), mesh.indices.begin() + 6), first_quad);
+    EXPECT_EQ(mesh.vertices[2].position[0], 1.0f);
+    EXPECT_EQ(mesh.vertices[2].position[1], 1.0f);
+    EXPECT_EQ(mesh.vertices.back().position[1], static_cast<float>(kCells));
+
+    options.max_threads = 1;
+    vne::io::LoadResult<Mesh> serial = loadObjBuffer(text, options);
+    ASSERT_TRUE(serial.ok());
+    EXPECT_EQ(serial.value.indices, mesh.indices);
+}
+
+namespace {
+
+vne::io::LoadResult<Mesh> loadPlyBuffer(const std::string& bytes, const PlyLoaderOptions& options = {}) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = "buffer.ply";
+    request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(bytes.data()), bytes.size());
+    PlyLoader loader(options);
+    return loader.loadMesh(request);
+}
+
+/** Append @p value in little-endian (or big-endian) byte order. */
+template<typename T>
+void appendPly(std::string& out, T value, bool big_endian = false) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (big_endian) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    out.append(bytes, sizeof(T));
+}
+
+/** Quad and triangle with normals, UVs, colors, confidence and an extra element, in @p format. */
+std::string makeScanPly(const std::string& format) {
+    const bool ascii = format == "ascii";
+    const bool big_endian = format == "binary_big_endian";
+    std::string ply = "ply\nformat " + format + " 1.0\ncomment scanner output\n";
+    ply += "element vertex 5\nproperty float x\nproperty float y\nproperty float z\n";
+    ply += "property float nx\nproperty float ny\nproperty float nz\nproperty float s\nproperty float t\n";
+    ply += "property uchar red\nproperty uchar green\nproperty uchar blue\nproperty float confidence\n";
+    ply += "element edge 1\nproperty int vertex1\nproperty int vertex2\n";
+    ply += "element face 2\nproperty list uchar int vertex_indices\nend_header\n";
+    const float positions[5][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {2, 0, -1}};
+    for (int v = 0; v < 5; ++v) {
+        const float attributes[] = {positions[v][0], positions[v][1], positions[v][2], 0, 0, 1, 0.25f, 0.75f};
+        for (const float value : attributes) {
+            if (ascii) {
+                ply += std::to_string(value) + " ";
+            } else {
+                appendPly(ply, value, big_endian);
+            }
+        }
+        if (ascii) {
+            ply += "255 128 0 0.5\n";
+        } else {
+            ply += "\xff\x80";
+            ply += '\0';
+            appendPly(ply, 0.5f, big_endian);
+        }
+    }
+    const std::vector<std::vector<int32_t>> records = {{0, 1}, {4, 0, 1, 2, 3}, {3, 1, 4, 2}};
+    for (const std::vector<int32_t>& record : records) {
+        for (size_t i = 0; i < record.size(); ++i) {
+            if (ascii) {
+                ply += std::to_string(record[i]) + (i + 1 < record.size() ? " " : "\n");
+            } else if (i == 0 && record.size() != 2) {
+                ply += static_cast<char>(record[i]);  // uchar list count
+            } else {
+                appendPly(ply, record[i], big_endian);
+            }
+        }
+    }
+    return ply;
+}
+
+}  // namespace
+
+TEST_F(MeshLoaderTest, PlyLoaderDecodesLayoutsAndSkipsUnusedProperties) {
+    vne::io::LoadResult<Mesh> binary = loadPlyBuffer(makeScanPly("binary_little_endian"));
+    ASSERT_TRUE(binary.ok()) << binary.status.message;
+    const Mesh& mesh = binary.value;
+    ASSERT_EQ(mesh.getVertexCount(), 5u);
+    const std::vector<uint32_t> expected = {0, 1, 2, 0, 2, 3, 1, 4, 2};  // quad fanned, then the triangle
+    EXPECT_EQ(std::vector<uint32_t>(mesh.indices.begin(), mesh.indices.end()), expected);
+    ASSERT_EQ(mesh.getSubmeshCount(), 1u);
+    EXPECT_EQ(mesh.parts[0].index_count, 9u);
+    ASSERT_EQ(mesh.getMaterialCount(), 1u);
+    EXPECT_EQ(mesh.materials[0].name, "DefaultMaterial");
+    EXPECT_TRUE(mesh.has_normals);
+    EXPECT_TRUE(mesh.has_uv0);
+    EXPECT_FALSE(mesh.has_tangent);
+    EXPECT_EQ(mesh.vertices[4].position[0], 2.0f);
+    EXPECT_EQ(mesh.vertices[4].normal[2], 1.0f);
+    EXPECT_EQ(mesh.vertices[4].texcoord0[0], 0.25f);
+    EXPECT_EQ(mesh.vertices[4].texcoord0[1], 0.25f);  // flipped V
+    EXPECT_EQ(mesh.vertices[4].tangent[0], 1.0f);
+    EXPECT_EQ(mesh.aabb_min[2], -1.0f);
+    EXPECT_EQ(mesh.aabb_max[0], 2.0f);
+
+    // The same scan in the other encodings decodes to the same mesh.
+    for (const char* format : {"binary_big_endian", "ascii"}) {
+        vne::io::LoadResult<Mesh> other = loadPlyBuffer(makeScanPly(format));
+        ASSERT_TRUE(other.ok()) << format << ": " << other.status.message;
+        EXPECT_EQ(other.value.indices, mesh.indices) << format;
+        for (size_t v = 0; v < mesh.getVertexCount(); ++v) {
+            EXPECT_EQ(std::memcmp(&other.value.vertices[v], &mesh.vertices[v], sizeof(VertexAttributes)), 0)
+                << format << " vertex " << v;
+        }
+    }
+
+    PlyLoaderOptions positions_only;
+    positions_only.positions_only = true;
+    vne::io::LoadResult<Mesh> positions = loadPlyBuffer(makeScanPly("binary_little_endian"), positions_only);
+    ASSERT_TRUE(positions.ok());
+    EXPECT_FALSE(positions.value.has_normals);
+    EXPECT_FALSE(positions.value.has_uv0);
+    EXPECT_EQ(positions.value.vertices[4].position[2], -1.0f);
+    EXPECT_EQ(positions.value.vertices[4].normal[1], 1.0f);  // default normal
+    EXPECT_EQ(positions.value.indices, mesh.indices);
+
+    PlyLoader loader;
+    EXPECT_EQ(MeshLoaderRegistry::getLoaderFor("scan.PLY")->supportedExtensions(), loader.supportedExtensions());
+    EXPECT_NE(loader.optionsKey(), PlyLoader(positions_only).optionsKey());
+
+    const std::string scan = makeScanPly("binary_little_endian");
+    EXPECT_EQ(loadPlyBuffer(scan.substr(0, scan.size() - 3)).status.code, vne::io::ErrorCode::eDataTruncated);
+    std::string bad_index = scan;
+    bad_index[bad_index.size() - 4] = 9;  // last triangle corner: vertex 9 of 5
+    EXPECT_EQ(loadPlyBuffer(bad_index).status.code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(loadPlyBuffer("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nend_header\n0\n").status.code,
+              vne::io::ErrorCode::eParseError);  // no y/z
+    EXPECT_EQ(loadPlyBuffer("ply\nformat ascii 1.0\nelement vertex 1\n").status.code, vne::io::ErrorCode::eParseError);
+}
+
+TEST_F(MeshLoaderTest, PlyLoaderDecodesLargeBlocksInParallel) {
+    constexpr uint32_t kCells = 300;  // more vertices and triangles than one parallel task holds
+    constexpr uint32_t kSide = kCells + 1;
+    std::string vertices;
+    for (uint32_t y = 0; y < kSide; ++y) {
+        for (uint32_t x = 0; x < kSide; ++x) {
+            appendPly(vertices, static_cast<float>(x));
+            appendPly(vertices, static_cast<float>(y));
+            appendPly(vertices, 0.0f);
+            vertices += "\x10\x20\x30";  // colors: skipped, but the fast copy keeps the stride
+        }
+    }
+    const std::string vertex_header = "element vertex " + std::to_string(kSide * kSide)
+                                      + "\nproperty float x\nproperty float y\nproperty float z\n"
+                                        "property uchar red\nproperty uchar green\nproperty uchar blue\n";
+    std::string mesh_ply = "ply\nformat binary_little_endian 1.0\n" + vertex_header;
+    mesh_ply += "element face " + std::to_string(2 * kCells * kCells) + "\nproperty list uchar uint vertex_indices\n";
+    mesh_ply += "end_header\n" + vertices;
+    for (uint32_t y = 0; y < kCells; ++y) {
+        for (uint32_t x = 0; x < kCells; ++x) {
+            const uint32_t a = y * kSide + x;
+            const uint32_t triangles[2][3] = {{a, a + 1, a + kSide + 1}, {a, a + kSide + 1, a + kSide}};
+            for (const auto& triangle : triangles) {
+                mesh_ply += '\3';
+                for (const uint32_t index : triangle) {
+                    appendPly(mesh_ply, index);
+                }
+            }
+        }
+    }
+
+    PlyLoaderOptions options;
+    options.max_threads = 4;
+    vne::io::LoadResult<Mesh> parallel = loadPlyBuffer(mesh_ply, options);
+    ASSERT_TRUE(parallel.ok()) << parallel.status.message;
+    EXPECT_EQ(parallel.value.getVertexCount(), static_cast<size_t>(kSide) * kSide);
+    ASSERT_EQ(parallel.value.getIndexCount(), static_cast<size_t>(kCells) * kCells * 6);
+    const std::vector<uint32_t> first_cell = {0, 1, kSide + 1, 0, kSide + 1, kSide};
+    EXPECT_EQ(std::vector<uint32_t>(parallel.value.indices.begin(), parallel.value.indices.begin() + 6), first_cell);
+    EXPECT_EQ(parallel.value.vertices.back().position[0], static_cast<float>(kCells));
+    EXPECT_EQ(parallel.value.aabb_max[1], static_cast<float>(kCells));
+    EXPECT_FALSE(parallel.value.has_normals);
+
+    options.max_threads = 1;
+    vne::io::LoadResult<Mesh> serial = loadPlyBuffer(mesh_ply, options);
+    ASSERT_TRUE(serial.ok());
+    EXPECT_EQ(serial.value.indices, parallel.value.indices);
+    EXPECT_EQ(serial.value.vertices.back().position[1], static_cast<float>(kCells));
+
+    // Without faces the file is a point cloud: vertices only.
+    options.max_threads = 4;
+    vne::io::LoadResult<Mesh> cloud =
+        loadPlyBuffer("ply\nformat binary_little_endian 1.0\n" + vertex_header + "end_header\n" + vertices, options);
+    ASSERT_TRUE(cloud.ok()) << cloud.status.message;
+    EXPECT_TRUE(cloud.value.isEmpty());
+    EXPECT_EQ(cloud.value.getVertexCount(), static_cast<size_t>(kSide) * kSide);
+    EXPECT_EQ(cloud.value.getSubmeshCount(), 0u);
+    EXPECT_EQ(cloud.value.vertices[kSide + 2].position[0], 2.0f);
+    EXPECT_EQ(cloud.value.vertices[kSide + 2].position[1], 1.0f);
+    EXPECT_EQ(cloud.value.aabb_min[0], 0.0f);
+}
+
+namespace {
+
+/** GLB container around @p json and @p bin, with both chunks padded to 4 bytes. */
+std::string makeGlb(std::string json, std::string bin) {
+    json.resize((json.size() + 3) / 4 * 4, ' ');
+    bin.resize((bin.size() + 3) / 4 * 4, '\0');
+    std::string glb = "glTF";
+    appendPly(glb, uint32_t{2});
+    appendPly(glb, static_cast<uint32_t>(12 + 8 + json.size() + (bin.empty() ? 0 : 8 + bin.size())));
+    appendPly(glb, static_cast<uint32_t>(json.size()));
+    glb += "JSON" + json;
+    if (!bin.empty()) {
+        appendPly(glb, static_cast<uint32_t>(bin.size()));
+        glb += std::string("BIN\0", 4) + bin;
+    }
+    return glb;
+}
+
+std::string base64(const std::string& bytes) {
+    static constexpr char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+        uint32_t bits = static_cast<uint8_t>(bytes[i]) << 16;
+        bits |= i + 1 < bytes.size() ? static_cast<uint8_t>(bytes[i + 1]) << 8 : 0;
+        bits |= i + 2 < bytes.size() ? static_cast<uint8_t>(bytes[i + 2]) : 0;
+        const size_t emitted = std::min<size_t>(bytes.size() - i, 3) + 1;  // 2 to 4 characters, then padding
+        for (size_t k = 0; k < 4; ++k) {
+            out += k < emitted ? kAlphabet[(bits >> (18 - 6 * k)) & 63] : '=';
+        }
+    }
+    return out;
+}
+
+vne::io::LoadResult<Mesh> loadGltfBuffer(const std::string& bytes,
+                                         const GltfLoaderOptions& options = {},
+                                         const std::string& uri = "buffer.glb") {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = uri;
+    request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(bytes.data()), bytes.size());
+    GltfLoader loader(options);
+    return loader.loadMesh(request);
+}
+
+/** Quad (uint16 indices, normals, UVs, material 0) and triangle (uint32 indices) sharing four positions. */
+std::string quadGltfBin() {
+    std::string bin;
+    for (const float value : {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 0.f,   // positions
+                              0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f,   // normals
+                              0.f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 1.f}) {                    // UVs
+        appendPly(bin, value);
+    }
+    for (const uint16_t index : {0, 1, 2, 0, 2, 3}) {
+        appendPly(bin, index);
+    }
+    for (const uint32_t index : {0u, 1u, 2u}) {
+        appendPly(bin, index);
+    }
+    return bin;  // 152 bytes
+}
+
+std::string quadGltfJson(const std::string& buffer_uri, const std::string& extra = "") {
+    std::string json = R"({"asset":{"version":"2.0"},)" + extra;
+    json += R"("buffers":[{"byteLength":152)" + (buffer_uri.empty() ? "" : R"(,"uri":")" + buffer_uri + "\"") + "}],";
+    json += R"("bufferViews":[{"buffer":0,"byteLength":48},{"buffer":0,"byteOffset":48,"byteLength":48},
+        {"buffer":0,"byteOffset":96,"byteLength":32},{"buffer":0,"byteOffset":128,"byteLength":12},
+        {"buffer":0,"byteOffset":140,"byteLength":12}],
+      "accessors":[{"bufferView":0,"componentType":5126,"count":4,"type":"VEC3"},
+        {"bufferView":1,"componentType":5126,"count":4,"type":"VEC3"},
+        {"bufferView":2,"componentType":5126,"count":4,"type":"VEC2"},
+        {"bufferView":3,"componentType":5123,"count":6,"type":"SCALAR"},
+        {"bufferView":4,"componentType":5125,"count":3,"type":"SCALAR"}],
+      "meshes":[{"primitives":[{"attributes":{"POSITION":0,"NORMAL":1,"TEXCOORD_0":2},"indices":3,"material":0},
+        {"attributes":{"POSITION":0},"indices":4},{"attributes":{"POSITION":0},"mode":1}]}],
+      "materials":[{"name":"red","pbrMetallicRoughness":{"baseColorFactor":[1,0,0,1],"baseColorTexture":{"index":0}}}],
+      "textures":[{"source":0}],"images":[{"uri":"red%20tex.png"}],
+      "nodes":[{"mesh":0,"translation":[10,0,0],"children":[1]},{"mesh":0,"scale":[-1,1,1]}],
+      "scene":0,"scenes":[{"nodes":[0]}]})";
+    return json;
+}
+
+}  // namespace
+
+TEST_F(MeshLoaderTest, GltfLoaderConvertsPrimitivesAndAppliesNodeTransforms) {
+    const std::string glb = makeGlb(quadGltfJson(""), quadGltfBin());
+    vne::io::LoadResult<Mesh> result = loadGltfBuffer(glb);
+    ASSERT_TRUE(result.ok()) << result.status.message;
+    const Mesh& mesh = result.value;
+
+    // Two node instances of two triangle primitives (the line primitive is skipped).
+    ASSERT_EQ(mesh.getSubmeshCount(), 4u);
+    EXPECT_EQ(mesh.getVertexCount(), 16u);
+    const std::vector<uint32_t> expected = {0, 1, 2, 0, 2, 3, 4, 5, 6,
+                                            8, 10, 9, 8, 11, 10, 12, 14, 13};  // mirrored instance: winding flipped
+    EXPECT_EQ(std::vector<uint32_t>(mesh.indices.begin(), mesh.indices.end()), expected);
+    EXPECT_EQ(mesh.parts[1].first_index, 6u);
+    EXPECT_EQ(mesh.parts[1].index_count, 3u);
+    EXPECT_EQ(mesh.parts[0].material_index, 0u);
+    EXPECT_EQ(mesh.parts[1].material_index, 1u);
+    ASSERT_EQ(mesh.getMaterialCount(), 2u);
+    EXPECT_EQ(mesh.materials[0].name, "red");
+    EXPECT_EQ(mesh.materials[0].base_color[1], 0.0f);
+    EXPECT_EQ(mesh.materials[0].base_color_tex, "red tex.png");
+    EXPECT_EQ(mesh.materials[1].name, "DefaultMaterial");
+
+    EXPECT_EQ(mesh.vertices[1].position[0], 11.0f);  // translated
+    EXPECT_EQ(mesh.vertices[9].position[0], 9.0f);   // translated and mirrored
+    EXPECT_EQ(mesh.vertices[9].normal[2], 1.0f);
+    EXPECT_EQ(mesh.vertices[4].normal[1], 1.0f);  // no NORMAL: AssimpLoader's default
+    EXPECT_EQ(mesh.vertices[2].texcoord0[1], 1.0f);  // glTF UVs already have a top-left origin
+    EXPECT_TRUE(mesh.has_normals);
+    EXPECT_TRUE(mesh.has_uv0);
+    EXPECT_FALSE(mesh.has_tangent);
+    EXPECT_EQ(mesh.aabb_min[0], 9.0f);
+    EXPECT_EQ(mesh.aabb_max[0], 11.0f);
+    EXPECT_EQ(mesh.aabb_max[1], 1.0f);
+
+    GltfLoaderOptions raw;
+    raw.pre_transform_vertices = false;
+    raw.flip_uvs = false;
+    vne::io::LoadResult<Mesh> untransformed = loadGltfBuffer(glb, raw);
+    ASSERT_TRUE(untransformed.ok());
+    EXPECT_EQ(untransformed.value.getSubmeshCount(), 2u);
+    EXPECT_EQ(untransformed.value.vertices[1].position[0], 1.0f);
+    EXPECT_EQ(untransformed.value.vertices[2].texcoord0[1], 0.0f);
+    EXPECT_NE(GltfLoader(raw).optionsKey(), GltfLoader().optionsKey());
+
+    // Views alias the GLB's BIN chunk: no copy, no conversion.
+    vne::io::LoadRequest request;
+    request.uri = "buffer.glb";
+    request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(glb.data()), glb.size());
+    GltfLoader loader;
+    vne::io::Result<GltfView> view = loader.loadView(request);
+    ASSERT_TRUE(view.ok()) << view.status.message;
+    ASSERT_EQ(view.value.primitives.size(), 2u);
+    const GltfPrimitiveView& quad = view.value.primitives[0];
+    const auto* bin = reinterpret_cast<const std::byte*>(glb.data()) + glb.size() - 152;
+    EXPECT_EQ(quad.positions.data, bin);
+    EXPECT_EQ(quad.positions.count, 4u);
+    EXPECT_EQ(quad.positions.stride, 12u);
+    EXPECT_EQ(quad.normals.data, bin + 48);
+    EXPECT_EQ(quad.indices.component_type, GltfComponentType::eUint16);
+    const std::span<const uint16_t> quad_indices = quad.indices.tight<uint16_t>();
+    ASSERT_EQ(quad_indices.size(), 6u);
+    EXPECT_EQ(quad_indices[5], 3u);
+    EXPECT_TRUE(quad.indices.tight<uint32_t>().empty());
+    EXPECT_EQ(view.value.primitives[1].indices.tight<uint32_t>().size(), 3u);
+    EXPECT_TRUE(view.value.primitives[1].normals.empty());
+    EXPECT_EQ(view.value.primitives[1].material_index, 1u);
+    EXPECT_EQ(view.value.materials.size(), 2u);
+    EXPECT_NE(view.value.keep, nullptr);
+
+    EXPECT_EQ(MeshLoaderRegistry::getLoaderFor("scene.GLB")->supportedExtensions(), loader.supportedExtensions());
+    EXPECT_EQ(loadGltfBuffer(glb.substr(0, glb.size() - 8)).status.code, vne::io::ErrorCode::eDataTruncated);
+    const std::string draco = makeGlb(quadGltfJson("", R"("extensionsRequired":["KHR_draco_mesh_compression"],)"),
+                                      quadGltfBin());
+    EXPECT_EQ(loadGltfBuffer(draco).status.code, vne::io::ErrorCode::eUnsupportedFeature);
+    std::string bad_index = quadGltfBin();
+    bad_index[140] = 7;  // first uint32 index: vertex 7 of 4
+    EXPECT_EQ(loadGltfBuffer(makeGlb(quadGltfJson(""), bad_index)).status.code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(loadGltfBuffer(R"({"asset":{"version":"1.0"}})", {}, "old.gltf").status.code,
+              vne::io::ErrorCode::eUnsupportedFormat);
+}
+
+TEST_F(MeshLoaderTest, GltfLoaderRejectsMalformedAccessorsAndNodeGraphs) {
+    GltfLoader loader;
+    const auto view = [&loader](const std::string& json) {
+        vne::io::LoadRequest request;
+        request.asset_type = vne::io::AssetType::eMesh;
+        request.uri = "malformed.gltf";
+        request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(json.data()), json.size());
+        return loader.loadView(request).status;
+    };
+    // A count whose (count - 1) * stride wraps around 2^64 must not pass the bufferView bounds check.
+    const auto strided = [](const std::string& count, const std::string& stride) {
+        return R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":4096,)"
+               R"("uri":"data:application/octet-stream;base64,)"
+               + base64(std::string(4096, '\0')) + R"("}],"bufferViews":[{"buffer":0,"byteLength":4096,"byteStride":)"
+               + stride + R"(}],"accessors":[{"bufferView":0,"componentType":5126,"count":)" + count
+               + R"(,"type":"VEC3"}],"meshes":[{"primitives":[{"attributes":{"POSITION":0}}]}]})";
+    };
+    EXPECT_TRUE(view(strided("256", "16")).ok());
+    EXPECT_EQ(view(strided("1152921504606847232", "16")).code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(loadGltfBuffer(strided("1152921504606847232", "16"), {}, "malformed.gltf").status.code,
+              vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(view(strided("257", "16")).code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(view(strided("4", "14")).code, vne::io::ErrorCode::eParseError);   // not a multiple of 4
+    EXPECT_EQ(view(strided("4", "256")).code, vne::io::ErrorCode::eParseError);  // above 252
+
+    // Nodes have one parent: shared children and cycles are rejected instead of walked repeatedly.
+    const std::string quad = quadGltfJson("");
+    const std::string scene_graph = R"("nodes":[{"mesh":0,"translation":[10,0,0],"children":[1]},)"
+                                    R"({"mesh":0,"scale":[-1,1,1]}],
+      "scene":0,"scenes":[{"nodes":[0]}])";
+    ASSERT_NE(quad.find(scene_graph), std::string::npos);
+    const auto withNodes = [&](const std::string& nodes, const std::string& roots) {
+        std::string json = quad;
+        json.replace(json.find(scene_graph), scene_graph.size(),
+                     R"("nodes":[)" + nodes + R"(],"scene":0,"scenes":[{"nodes":[)" + roots + "]}]");
+        return makeGlb(json, quadGltfBin());
+    };
+    const std::string shared = withNodes(R"({"children":[2]},{"children":[2]},{"mesh":0})", "0,1");
+    EXPECT_EQ(loadGltfBuffer(shared).status.code, vne::io::ErrorCode::eParseError);
+    EXPECT_EQ(loadGltfBuffer(withNodes(R"({"children":[1]},{"children":[0],"mesh":0})", "0")).status.code,
+              vne::io::ErrorCode::eParseError);
+    std::string doubling;  // node i lists node i + 1 twice: 2^60 paths if walked naively
+    for (int i = 0; i < 60; ++i) {
+        doubling += R"({"children":[)" + std::to_string(i + 1) + "," + std::to_string(i + 1) + "]},";
+    }
+    EXPECT_EQ(loadGltfBuffer(withNodes(doubling + R"({"mesh":0})", "0")).status.code, vne::io::ErrorCode::eParseError);
+
+    // A long valid chain is walked without recursion.
+    constexpr int kChain = 100000;
+    std::string chain;
+    for (int i = 0; i + 1 < kChain; ++i) {
+        chain += R"({"children":[)" + std::to_string(i + 1) + "]},";
+    }
+    vne::io::LoadResult<Mesh> deep = loadGltfBuffer(withNodes(chain + R"({"mesh":0})", "0"));
+    ASSERT_TRUE(deep.ok()) << deep.status.message;
+    EXPECT_EQ(deep.value.getSubmeshCount(), 2u);
+}
+
+TEST_F(MeshLoaderTest, GltfLoaderCookCacheNoticesEditedBuffers) {
+    const std::string directory = "test_gltf_cook";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory + "/quad.gltf") << quadGltfJson("quad.bin");
+    std::string bin = quadGltfBin();
+    std::ofstream(directory + "/quad.bin", std::ios::binary) << bin;
+
+    vne::io::AssetIO io(1);
+    io.registerMeshLoader(std::make_unique<GltfLoader>());
+    io.setCookCacheDirectory(directory + "/cooked");
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = directory + "/quad.gltf";
+    auto secondX = [&io, &request]() {
+        vne::io::LoadResult<Mesh> result = io.loadMesh(request);
+        EXPECT_TRUE(result.ok()) << result.status.message;
+        return result.ok() ? result.value.vertices[1].position[0] : 0.0f;
+    };
+    const float cold = secondX();
+    EXPECT_EQ(secondX(), cold);
+    EXPECT_EQ(io.cookCacheStats().hits, 1u);
+
+    // Move vertex 1 in the .bin only; the .gltf is unchanged.
+    const float moved = 2.0f;
+    std::memcpy(bin.data() + 3 * sizeof(float), &moved, sizeof(moved));
+    std::ofstream(directory + "/quad.bin", std::ios::binary | std::ios::trunc) << bin;
+    EXPECT_EQ(secondX(), cold + 1.0f);
+    EXPECT_EQ(io.cookCacheStats().hits, 1u);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(MeshLoaderTest, GltfLoaderResolvesBuffersAndConvertsInParallel) {
+    // External .bin, data: URI and GLB BIN chunk all decode to the same mesh.
+    const std::string bin = quadGltfBin();
+    const std::string gltf_path = "test_native_gltf.gltf";
+    {
+        std::ofstream gltf(gltf_path);
+        std::ofstream buffer("test native gltf.bin", std::ios::binary);
+        ASSERT_TRUE(gltf && buffer);
+        gltf << quadGltfJson("test%20native%20gltf.bin");
+        buffer << bin;
+    }
+    GltfLoader loader;
+    Mesh external;
+    const bool loaded = loader.loadFile(gltf_path, external);
+    std::filesystem::remove(gltf_path);
+    std::filesystem::remove("test native gltf.bin");
+    ASSERT_TRUE(loaded) << loader.getLastError();
+    vne::io::LoadResult<Mesh> embedded =
+        loadGltfBuffer(quadGltfJson("data:application/octet-stream;base64," + base64(bin)), {}, "embedded.gltf");
+    ASSERT_TRUE(embedded.ok()) << embedded.status.message;
+    vne::io::LoadResult<Mesh> glb = loadGltfBuffer(makeGlb(quadGltfJson(""), bin));
+    ASSERT_TRUE(glb.ok());
+    EXPECT_EQ(external.indices, glb.value.indices);
+    EXPECT_EQ(embedded.value.indices, glb.value.indices);
+    ASSERT_EQ(external.getVertexCount(), glb.value.getVertexCount());
+    for (size_t v = 0; v < external.getVertexCount(); ++v) {
+        EXPECT_EQ(std::memcmp(&external.vertices[v], &glb.value.vertices[v], sizeof(VertexAttributes)), 0);
+        EXPECT_EQ(std::memcmp(&embedded.value.vertices[v], &glb.value.vertices[v], sizeof(VertexAttributes)), 0);
+    }
+
+    // A grid large enough for several vertex and index tasks, with interleaved position/UV.
+    constexpr uint32_t kCells = 300;
+    constexpr uint32_t kSide = kCells + 1;
+    std::string grid;
+    for (uint32_t y = 0; y < kSide; ++y) {
+        for (uint32_t x = 0; x < kSide; ++x) {
+            for (const float value : {static_cast<float>(x), static_cast<float>(y), 0.0f, x / 300.0f, y / 300.0f}) {
+                appendPly(grid, value);
+            }
+        }
+    }
+    const size_t vertex_bytes = grid.size();
+    for (uint32_t y = 0; y < kCells; ++y) {
+        for (uint32_t x = 0; x < kCells; ++x) {
+            const uint32_t a = y * kSide + x;
+            for (const uint32_t index : {a, a + 1, a + kSide + 1, a, a + kSide + 1, a + kSide}) {
+                appendPly(grid, index);
+            }
+        }
+    }
+    const std::string grid_json =
+        R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":)" + std::to_string(grid.size())
+        + R"(}],"bufferViews":[{"buffer":0,"byteLength":)" + std::to_string(vertex_bytes)
+        + R"(,"byteStride":20},{"buffer":0,"byteOffset":)" + std::to_string(vertex_bytes) + R"(,"byteLength":)"
+        + std::to_string(grid.size() - vertex_bytes) + R"(}],"accessors":[
+          {"bufferView":0,"componentType":5126,"count":)" + std::to_string(kSide * kSide) + R"(,"type":"VEC3"},
+          {"bufferView":0,"byteOffset":12,"componentType":5126,"count":)" + std::to_string(kSide * kSide)
+        + R"(,"type":"VEC2"},{"bufferView":1,"componentType":5125,"count":)" + std::to_string(kCells * kCells * 6)
+        + R"(,"type":"SCALAR"}],"meshes":[{"primitives":[{"attributes":{"POSITION":0,"TEXCOORD_0":1},"indices":2}]}]})";
+    const std::string grid_glb = makeGlb(grid_json, grid);
+    GltfLoaderOptions options;
+    options.max_threads = 4;
+    vne::io::LoadResult<Mesh> parallel = loadGltfBuffer(grid_glb, options);
+    ASSERT_TRUE(parallel.ok()) << parallel.status.message;
+    EXPECT_EQ(parallel.value.getVertexCount(), static_cast<size_t>(kSide) * kSide);
+    EXPECT_EQ(parallel.value.getIndexCount(), static_cast<size_t>(kCells) * kCells * 6);
+    EXPECT_EQ(parallel.value.vertices.back().texcoord0[0], 1.0f);
+    EXPECT_EQ(parallel.value.aabb_max[1], static_cast<float>(kCells));
+    options.max_threads = 1;
+    vne::io::LoadResult<Mesh> serial = loadGltfBuffer(grid_glb, options);
+    ASSERT_TRUE(serial.ok());
+    EXPECT_EQ(serial.value.indices, parallel.value.indices);
+    EXPECT_EQ(std::memcmp(serial.value.vertices.data(), parallel.value.vertices.data(),
+                          serial.value.vertices.size() * sizeof(VertexAttributes)),
+              0);
+}
+
+// ---- .vnemesh ----
+
+namespace {
+
+/** Grid mesh with normals and UVs (tangents at AssimpLoader's defaults), split into two submeshes. */
+Mesh makeGridMesh(uint32_t cells) {
+    const uint32_t side = cells + 1;
+    Mesh mesh;
+    mesh.name = "grid";
+    for (uint32_t y = 0; y < side; ++y) {
+        for (uint32_t x = 0; x < side; ++x) {
+            VertexAttributes vertex{};
+            vertex.position[0] = static_cast<float>(x);
+            vertex.position[1] = static_cast<float>(y);
+            vertex.normal[2] = 1.0f;
+            vertex.tangent[0] = 1.0f;
+            vertex.bitangent[2] = 1.0f;
+            vertex.texcoord0[0] = static_cast<float>(x) / static_cast<float>(cells);
+            vertex.texcoord0[1] = static_cast<float>(y) / static_cast<float>(cells);
+            mesh.vertices.push_back(vertex);
+        }
+    }
+    for (uint32_t y = 0; y < cells; ++y) {
+        for (uint32_t x = 0; x < cells; ++x) {
+            const uint32_t a = y * side + x;
+            for (const uint32_t index : {a, a + 1, a + side + 1, a, a + side + 1, a + side}) {
+                mesh.indices.push_back(index);
+            }
+        }
+    }
+    const auto half = static_cast<uint32_t>(mesh.indices.size() / 6 * 3);
+    mesh.parts = {{0, half, 0}, {half, static_cast<uint32_t>(mesh.indices.size()) - half, 1}};
+    mesh.materials = {{"floor", "", {0.5f, 0.5f, 0.5f, 1.0f}}, {"tiles", "textures/tiles.png", {1, 1, 1, 1}}};
+    mesh.has_normals = true;
+    mesh.has_uv0 = true;
+    mesh.aabb_max[0] = mesh.aabb_max[1] = static_cast<float>(cells);
+    return mesh;
+}
+
+void expectSameMesh(const Mesh& actual, const Mesh& expected) {
+    EXPECT_EQ(actual.name, expected.name);
+    ASSERT_EQ(actual.getVertexCount(), expected.getVertexCount());
+    EXPECT_EQ(std::memcmp(actual.vertices.data(), expected.vertices.data(),
+                          expected.vertices.size() * sizeof(VertexAttributes)),
+              0);
+    EXPECT_EQ(actual.indices, expected.indices);
+    ASSERT_EQ(actual.getSubmeshCount(), expected.getSubmeshCount());
+    for (size_t i = 0; i < expected.parts.size(); ++i) {
+        EXPECT_EQ(actual.parts[i].first_index, expected.parts[i].first_index);
+        EXPECT_EQ(actual.parts[i].index_count, expected.parts[i].index_count);
+        EXPECT_EQ(actual.parts[i].material_index, expected.parts[i].material_index);
+    }
+    ASSERT_EQ(actual.getMaterialCount(), expected.getMaterialCount());
+    for (size_t i = 0; i < expected.materials.size(); ++i) {
+        EXPECT_EQ(actual.materials[i].name, expected.materials[i].name);
+        EXPECT_EQ(actual.materials[i].base_color_tex, expected.materials[i].base_color_tex);
+        EXPECT_EQ(actual.materials[i].base_color[0], expected.materials[i].base_color[0]);
+    }
+    EXPECT_EQ(actual.has_normals, expected.has_normals);
+    EXPECT_EQ(actual.has_tangent, expected.has_tangent);
+    EXPECT_EQ(actual.has_uv0, expected.has_uv0);
+    EXPECT_EQ(actual.aabb_max[1], expected.aabb_max[1]);
+}
+
+vne::io::LoadRequest vneMeshBufferRequest(const char* data, size_t size) {
+    vne::io::LoadRequest request;
+    request.asset_type = vne::io::AssetType::eMesh;
+    request.uri = "buffer.vnemesh";
+    request.buffer = std::span<const std::byte>(reinterpret_cast<const std::byte*>(data), size);
+    return request;
+}
+
+std::string readBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+}  // namespace
+
+TEST_F(MeshLoaderTest, VneMeshLoaderRoundTripsInterleavedAndCompactLayouts) {
+    // Enough vertices for several gather tasks; 16-bit indices still fit in the compact file.
+    const Mesh mesh = makeGridMesh(200);
+    const std::string path = "test_vnemesh_roundtrip.vnemesh";
+    std::string error;
+    ASSERT_TRUE(exportVneMesh(path, mesh, {}, &error)) << error;
+    const size_t interleaved_size = std::filesystem::file_size(path);
+
+    auto loader = MeshLoaderRegistry::getLoaderFor(path);
+    ASSERT_NE(loader, nullptr);
+    Mesh interleaved;
+    ASSERT_TRUE(loader->loadFile(path, interleaved)) << loader->getLastError();
+    expectSameMesh(interleaved, mesh);
+
+    VneMeshExportOptions compact_options;
+    compact_options.compact = true;
+    ASSERT_TRUE(exportVneMesh(path, mesh, compact_options, &error)) << error;
+    EXPECT_LT(std::filesystem::file_size(path), interleaved_size / 2);
+    Mesh compact;
+    const bool loaded = loader->loadFile(path, compact);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(loaded) << loader->getLastError();
+    expectSameMesh(compact, mesh);
+
+    // Point clouds (no indices) export too; meshes without vertices do not.
+    Mesh points = makeGridMesh(1);
+    points.indices.clear();
+    points.parts.clear();
+    ASSERT_TRUE(exportVneMesh(path, points, {}, &error)) << error;
+    Mesh points_loaded;
+    EXPECT_TRUE(loader->loadFile(path, points_loaded));
+    std::filesystem::remove(path);
+    EXPECT_EQ(points_loaded.getVertexCount(), 4u);
+    EXPECT_EQ(points_loaded.getIndexCount(), 0u);
+    EXPECT_FALSE(exportVneMesh(path, Mesh{}, {}, &error));
+
+    // The exporter refuses what the loader would reject.
+    Mesh bad = makeGridMesh(1);
+    bad.materials.clear();
+    EXPECT_FALSE(exportVneMesh(path, bad, {}, &error));
+    bad = makeGridMesh(1);
+    bad.parts[1].index_count += 1;
+    EXPECT_FALSE(exportVneMesh(path, bad, {}, &error));
+    bad = makeGridMesh(1);
+    bad.indices[0] = 4;
+    EXPECT_FALSE(exportVneMesh(path, bad, {}, &error));
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(MeshLoaderTest, VneMeshLoaderMapsViewsAndRejectsBadFiles) {
+    const Mesh mesh = makeGridMesh(4);
+    const std::string path = "test_vnemesh_view.vnemesh";
+    ASSERT_TRUE(exportVneMesh(path, mesh));
+    const std::string bytes = readBytes(path);
+    VneMeshLoader loader;
+
+    // Mapped file: the views point into the mapping kept alive by keep.
+    vne::io::LoadRequest file_request;
+    file_request.asset_type = vne::io::AssetType::eMesh;
+    file_request.uri = path;
+    vne::io::Result<VneMeshView> mapped = loader.loadView(file_request);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(mapped.ok()) << mapped.status.message;
+    EXPECT_NE(mapped.value.keep, nullptr);
+    ASSERT_EQ(mapped.value.vertices.size(), mesh.vertices.size());
+    EXPECT_EQ(std::memcmp(mapped.value.vertices.data(), mesh.vertices.data(),
+                          mesh.vertices.size() * sizeof(VertexAttributes)),
+              0);
+    EXPECT_TRUE(std::equal(mapped.value.indices.begin(), mapped.value.indices.end(), mesh.indices.begin(),
+                           mesh.indices.end()));
+    ASSERT_EQ(mapped.value.parts.size(), 2u);
+    EXPECT_EQ(mapped.value.parts[1].material_index, 1u);
+    ASSERT_EQ(mapped.value.materials.size(), 2u);
+    EXPECT_EQ(mapped.value.materials[1].base_color_tex, "textures/tiles.png");
+    EXPECT_TRUE(mapped.value.has_uv0);
+
+    // Buffer: no copy, the views point into the caller's bytes.
+    vne::io::Result<VneMeshView> view = loader.loadView(vneMeshBufferRequest(bytes.data(), bytes.size()));
+    ASSERT_TRUE(view.ok()) << view.status.message;
+    const auto* first = reinterpret_cast<const char*>(view.value.vertices.data());
+    EXPECT_GE(first, bytes.data());
+    EXPECT_LT(first, bytes.data() + bytes.size());
+    const auto* indices = reinterpret_cast<const char*>(view.value.indices.data());
+    EXPECT_GE(indices, bytes.data());
+    EXPECT_LT(indices, bytes.data() + bytes.size());
+
+    // A misaligned buffer cannot be viewed but still loads (copied).
+    std::string shifted = " " + bytes;
+    vne::io::LoadRequest shifted_request = vneMeshBufferRequest(shifted.data() + 1, bytes.size());
+    EXPECT_EQ(loader.loadView(shifted_request).status.code, vne::io::ErrorCode::eUnsupportedFeature);
+    vne::io::LoadResult<Mesh> copied = loader.loadMesh(shifted_request);
+    ASSERT_TRUE(copied.ok()) << copied.status.message;
+    expectSameMesh(copied.value, mesh);
+
+    const auto expectError = [&](std::string damaged, vne::io::ErrorCode code) {
+        vne::io::LoadResult<Mesh> result = loader.loadMesh(vneMeshBufferRequest(damaged.data(), damaged.size()));
+        EXPECT_EQ(result.status.code, code) << result.status.message;
+        EXPECT_TRUE(result.value.isEmpty());
+    };
+    expectError(bytes.substr(0, bytes.size() - 1), vne::io::ErrorCode::eDataTruncated);
+    expectError(bytes.substr(0, 100), vne::io::ErrorCode::eDataTruncated);
+    std::string bad = bytes;
+    bad[0] = 'X';
+    expectError(bad, vne::io::ErrorCode::eUnsupportedFormat);
+    bad = bytes;
+    bad[8] = 2;  // version
+    expectError(bad, vne::io::ErrorCode::eUnsupportedFormat);
+    bad = bytes;
+    std::swap(bad[12], bad[15]);  // byte-order mark
+    std::swap(bad[13], bad[14]);
+    expectError(bad, vne::io::ErrorCode::eUnsupportedFormat);
+    bad = bytes;
+    bad[32] += 1;  // vertex_count: the streams no longer fit the vertex section
+    expectError(bad, vne::io::ErrorCode::eDataCorrupt);
+    uint64_t indices_offset = 0;
+    std::memcpy(&indices_offset, bytes.data() + 128, sizeof(indices_offset));  // Header::indices.offset
+    bad = bytes;
+    const uint32_t past_end = static_cast<uint32_t>(mesh.vertices.size());
+    std::memcpy(bad.data() + indices_offset, &past_end, sizeof(past_end));
+    expectError(bad, vne::io::ErrorCode::eDataCorrupt);
+    EXPECT_EQ(loader.loadView(vneMeshBufferRequest(bad.data(), bad.size())).status.code,
+              vne::io::ErrorCode::eDataCorrupt);
+}
@@ -0,0 +1,139 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2025 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/io/common/binary_io.h"
+#include "vertexnova/io/vfs/file_system.h"
+#include "vertexnova/io/vfs/memory_file_system.h"
+#include "vertexnova/io/vfs/native_file_system.h"
+#include "vertexnova/io/vfs/pack_file_system.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vne::io;
+
+TEST(FileSystemTest, NormalizesAndResolvesVirtualPaths) {
+    EXPECT_EQ(normalizeVirtualPath("./textures//a.png"), "textures/a.png");
+    EXPECT_EQ(normalizeVirtualPath("/textures\\sub/../a.png"), "textures/a.png");
+    EXPECT_EQ(normalizeVirtualPath("../a.png"), "a.png");
+    EXPECT_EQ(resolveSiblingPath("volumes/ct.mhd", "ct.raw"), "volumes/ct.raw");
+    EXPECT_EQ(resolveSiblingPath("ct.mhd", "ct.raw"), "ct.raw");
+    EXPECT_EQ(resolveSiblingPath("volumes/ct.mhd", "/data/ct.raw"), "/data/ct.raw");
+}
+
+TEST(FileSystemTest, MemoryFileSystemReadsAndReplaces) {
+    MemoryFileSystem fs;
+    fs.addFile("dir/a.txt", std::string("hello\n\nbody"));
+    EXPECT_TRUE(fs.exists("./dir//a.txt"));
+    EXPECT_FALSE(fs.exists("dir/b.txt"));
+
+    FileInfo before;
+    ASSERT_TRUE(fs.stat("dir/a.txt", before).ok());
+    EXPECT_EQ(before.size, 11u);
+
+    std::unique_ptr<IFile> file;
+    ASSERT_TRUE(fs.openFile("dir/a.txt", file).ok());
+    ASSERT_NE(file->contents(), nullptr);
+    std::string header;
+    size_t data_offset = 0;
+    ASSERT_TRUE(readHeaderUntilBlankLine(*file, header, data_offset).ok());
+    EXPECT_EQ(header, "hello\n\n");
+    EXPECT_EQ(data_offset, 7u);
+    char tail[8] = {};
+    EXPECT_EQ(file->read(data_offset, tail, sizeof(tail)), 4u);
+    EXPECT_EQ(std::string(tail, 4), "body");
+
+    // Replacing a file bumps its stamp; the open handle keeps the old bytes.
+    fs.addFile("dir/a.txt", std::string("x"));
+    FileInfo after;
+    ASSERT_TRUE(fs.stat("dir/a.txt", after).ok());
+    EXPECT_EQ(after.size, 1u);
+    EXPECT_NE(after.modified_time, before.modified_time);
+    EXPECT_EQ(file->size(), 11u);
+
+    EXPECT_TRUE(fs.removeFile("dir/a.txt"));
+    EXPECT_EQ(fs.openFile("dir/a.txt", file).code, ErrorCode::eFileNotFound);
+    EXPECT_EQ(file, nullptr);
+}
+
+TEST(FileSystemTest, PackRoundTripAndNativeBackend) {
+    const std::string source_path = "test_vfs_source.bin";
+    const std::string pack_path = "test_vfs.pack";
+    const uint8_t source_bytes[5] = {9, 8, 7, 6, 5};
+    ASSERT_TRUE(binaryio::writeFile(source_path, source_bytes, sizeof(source_bytes)).ok());
+
+    NativeFileSystem native(std::filesystem::current_path().string());
+    EXPECT_TRUE(native.exists(source_path));
+    std::vector<uint8_t> read_back;
+    ASSERT_TRUE(readFile(native, source_path, read_back).ok());
+    EXPECT_EQ(read_back, std::vector<uint8_t>(source_bytes, source_bytes + 5));
+
+    PackWriter writer;
+    writer.addFile("bin/source.bin", source_path);
+    writer.addBytes("text/empty.txt", {});
+    writer.addBytes("text/hello.txt", {'h', 'i'});
+    ASSERT_TRUE(writer.write(pack_path).ok());
+
+    auto pack = std::make_shared<PackFileSystem>();
+    ASSERT_TRUE(pack->open(pack_path).ok());
+    EXPECT_EQ(pack->fileCount(), 3u);
+    EXPECT_TRUE(pack->exists("./bin/source.bin"));
+    EXPECT_FALSE(pack->exists("source.bin"));
+
+    std::unique_ptr<IFile> file;
+    ASSERT_TRUE(pack->openFile("bin/source.bin", file).ok());
+    ASSERT_EQ(file->size(), 5u);
+    std::shared_ptr<const uint8_t> contents = file->contents();
+    ASSERT_NE(contents, nullptr);
+    file.reset();
+    pack.reset();
+    EXPECT_EQ(contents.get()[4], 5);  // the mapping outlives the file system
+
+    // Many entries: every lookup is a binary search over the hash-sorted table in the mapping,
+    // and payloads honour the requested alignment.
+    PackWriter many;
+    many.setAlignment(256);
+    for (int i = 0; i < 1000; ++i) {
+        many.addBytes("many/" + std::to_string(i) + ".bin", {static_cast<uint8_t>(i), 1, 2});
+    }
+    ASSERT_TRUE(many.write(pack_path).ok());
+    PackFileSystem many_pack;
+    ASSERT_TRUE(many_pack.open(pack_path).ok());
+    EXPECT_EQ(many_pack.fileCount(), 1000u);
+    for (int i = 0; i < 1000; i += 37) {
+        ASSERT_TRUE(many_pack.openFile("many/" + std::to_string(i) + ".bin", file).ok()) << i;
+        EXPECT_EQ(file->contents().get()[0], static_cast<uint8_t>(i));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(file->contents().get()) % 256, 0u);
+    }
+    EXPECT_FALSE(many_pack.exists("many/1000.bin"));
+    many.setAlignment(3);
+    EXPECT_EQ(many.write(pack_path).code, ErrorCode::eInvalidArgument);
+
+    ASSERT_TRUE(writer.write(pack_path).ok());
+    PackFileSystem reopened;
+    ASSERT_TRUE(reopened.open(pack_path).ok());
+    ASSERT_TRUE(readFile(reopened, "text/hello.txt", read_back).ok());
+    EXPECT_EQ(read_back, (std::vector<uint8_t>{'h', 'i'}));
+    ASSERT_TRUE(readFile(reopened, "text/empty.txt", read_back).ok());
+    EXPECT_TRUE(read_back.empty());
+
+    PackWriter duplicate;
+    duplicate.addBytes("a", {1});
+    duplicate.addBytes("./a", {2});
+    EXPECT_EQ(duplicate.write(pack_path).code, ErrorCode::eInvalidArgument);
+
+    PackFileSystem not_a_pack;
+    EXPECT_EQ(not_a_pack.open(source_path).code, ErrorCode::eDataCorrupt);
+    EXPECT_FALSE(not_a_pack.isOpen());
+
+    std::filesystem::remove(source_path);
+    std::filesystem::remove(pack_path);
+}